@@ -6,6 +6,7 @@
 #define OLED_MENU_CONFIG_H_
 // include your translations here
 #include "OLEDMenuTranslations.h"
+#include "OLEDMenuRle.h"
 #define OLED_MENU_WIDTH 128
 #define OLED_MENU_HEIGHT 64
 #define OLED_MENU_MAX_SUBITEMS_NUM 16 // should be less than 256
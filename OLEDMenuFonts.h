@@ -1,7 +1,7 @@
 #ifndef OLED_MENU_FONTS_H_
 #define OLED_MENU_FONTS_H_
+// generated by generate_translations.py from fonts.h, only the glyphs the menu uses
 // Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
 const uint8_t DejaVu_Sans_Mono_12[] PROGMEM = {
     0x07, // Width: 7
     0x0F, // Height: 15
@@ -235,99 +235,99 @@ const uint8_t DejaVu_Sans_Mono_12[] PROGMEM = {
     0x0A, 0xE1, 0x0B, 0x07, // 255:2785
 
     // Font Data:
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0D,                                     // 33
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38,                               // 34
-    0x00, 0x02, 0x40, 0x0E, 0xE0, 0x03, 0x50, 0x0A, 0xC0, 0x07, 0x70, 0x02, 0x40,       // 35
-    0x00, 0x00, 0xE0, 0x04, 0x90, 0x08, 0xF8, 0x3F, 0x10, 0x09, 0x20, 0x07,             // 36
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0D, // 33
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, // 34
+    0x00, 0x02, 0x40, 0x0E, 0xE0, 0x03, 0x50, 0x0A, 0xC0, 0x07, 0x70, 0x02, 0x40, // 35
+    0x00, 0x00, 0xE0, 0x04, 0x90, 0x08, 0xF8, 0x3F, 0x10, 0x09, 0x20, 0x07, // 36
     0x30, 0x00, 0x48, 0x01, 0x48, 0x01, 0xB0, 0x06, 0x80, 0x09, 0x40, 0x09, 0x00, 0x06, // 37
     0x00, 0x00, 0x00, 0x07, 0xF0, 0x0C, 0xC8, 0x08, 0x08, 0x0B, 0x08, 0x06, 0x00, 0x0B, // 38
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,                                           // 39
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x1C, 0x1C, 0x04, 0x10,             // 40
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x1C, 0x1C, 0xE0, 0x03,                         // 41
-    0x00, 0x00, 0x90, 0x00, 0x60, 0x00, 0xF8, 0x01, 0x60, 0x00, 0x90,                   // 42
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, // 39
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x1C, 0x1C, 0x04, 0x10, // 40
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x1C, 0x1C, 0xE0, 0x03, // 41
+    0x00, 0x00, 0x90, 0x00, 0x60, 0x00, 0xF8, 0x01, 0x60, 0x00, 0x90, // 42
     0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xE0, 0x0F, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, // 43
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0C,                                     // 44
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,                         // 45
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,                                     // 46
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x08,       // 47
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0C, // 44
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, // 45
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, // 46
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x08, // 47
     0x00, 0x00, 0xE0, 0x03, 0x18, 0x0C, 0x08, 0x08, 0x88, 0x08, 0x18, 0x0C, 0xE0, 0x03, // 48
-    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x00, 0x08, 0x00, 0x08,             // 49
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x00, 0x08, 0x00, 0x08, // 49
     0x00, 0x00, 0x10, 0x08, 0x08, 0x0C, 0x08, 0x0A, 0x08, 0x09, 0x88, 0x08, 0x70, 0x08, // 50
     0x00, 0x00, 0x10, 0x04, 0x08, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x70, 0x07, // 51
     0x00, 0x00, 0x00, 0x03, 0xC0, 0x02, 0x60, 0x02, 0x18, 0x02, 0xF8, 0x0F, 0x00, 0x02, // 52
     0x00, 0x00, 0x78, 0x04, 0x48, 0x08, 0x48, 0x08, 0x48, 0x08, 0xC8, 0x0C, 0x80, 0x07, // 53
     0x00, 0x00, 0xE0, 0x03, 0x90, 0x0C, 0x48, 0x08, 0x48, 0x08, 0xC8, 0x0C, 0x90, 0x07, // 54
-    0x00, 0x00, 0x08, 0x00, 0x08, 0x08, 0x08, 0x06, 0x88, 0x01, 0x78, 0x00, 0x18,       // 55
+    0x00, 0x00, 0x08, 0x00, 0x08, 0x08, 0x08, 0x06, 0x88, 0x01, 0x78, 0x00, 0x18, // 55
     0x00, 0x00, 0x70, 0x07, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x70, 0x07, // 56
     0x00, 0x00, 0xF0, 0x04, 0x18, 0x09, 0x08, 0x09, 0x08, 0x09, 0x98, 0x04, 0xE0, 0x03, // 57
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C,                                     // 58
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x0C,                                     // 59
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, // 58
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x0C, // 59
     0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x20, 0x04, // 60
     0x00, 0x00, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, // 61
     0x00, 0x00, 0x20, 0x04, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x80, 0x01, 0x80, 0x01, // 62
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x88, 0x0D, 0xC8, 0x00, 0x48, 0x00, 0x30,       // 63
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x88, 0x0D, 0xC8, 0x00, 0x48, 0x00, 0x30, // 63
     0x00, 0x00, 0xC0, 0x0F, 0x20, 0x18, 0x10, 0x23, 0x90, 0x24, 0xB0, 0x24, 0xE0, 0x07, // 64
     0x00, 0x00, 0x00, 0x0C, 0xC0, 0x03, 0x38, 0x02, 0x38, 0x02, 0xC0, 0x03, 0x00, 0x0C, // 65
     0x00, 0x00, 0xF8, 0x0F, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x70, 0x07, // 66
     0x00, 0x00, 0xE0, 0x03, 0x10, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x04, // 67
     0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x04, 0xE0, 0x03, // 68
     0x00, 0x00, 0xF8, 0x0F, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, // 69
-    0x00, 0x00, 0xF8, 0x0F, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88,       // 70
+    0x00, 0x00, 0xF8, 0x0F, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, // 70
     0x00, 0x00, 0xE0, 0x03, 0x10, 0x04, 0x08, 0x08, 0x08, 0x08, 0x88, 0x08, 0x90, 0x07, // 71
     0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xF8, 0x0F, // 72
-    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08,             // 73
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x07,             // 74
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, // 73
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x07, // 74
     0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0xC0, 0x00, 0x20, 0x03, 0x10, 0x06, 0x08, 0x08, // 75
     0x00, 0x00, 0xF8, 0x0F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, // 76
     0x00, 0x00, 0xF8, 0x0F, 0x30, 0x00, 0xC0, 0x01, 0xC0, 0x01, 0x30, 0x00, 0xF8, 0x0F, // 77
     0x00, 0x00, 0xF8, 0x0F, 0x18, 0x00, 0xE0, 0x00, 0x80, 0x03, 0x00, 0x0C, 0xF8, 0x0F, // 78
     0x00, 0x00, 0xE0, 0x03, 0x18, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x18, 0x0C, 0xE0, 0x03, // 79
-    0x00, 0x00, 0xF8, 0x0F, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x70,       // 80
+    0x00, 0x00, 0xF8, 0x0F, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x70, // 80
     0x00, 0x00, 0xE0, 0x03, 0x18, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x18, 0x3C, 0xE0, 0x07, // 81
     0x00, 0x00, 0xF8, 0x0F, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x01, 0x70, 0x06, // 82
     0x00, 0x00, 0x70, 0x04, 0xC8, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x10, 0x07, // 83
-    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x0F, 0x08, 0x00, 0x08, 0x00, 0x08,       // 84
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x0F, 0x08, 0x00, 0x08, 0x00, 0x08, // 84
     0x00, 0x00, 0xF8, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0xF8, 0x07, // 85
-    0x00, 0x00, 0x18, 0x00, 0xE0, 0x01, 0x00, 0x0E, 0x00, 0x0E, 0xE0, 0x01, 0x18,       // 86
+    0x00, 0x00, 0x18, 0x00, 0xE0, 0x01, 0x00, 0x0E, 0x00, 0x0E, 0xE0, 0x01, 0x18, // 86
     0xF8, 0x01, 0x00, 0x0E, 0xC0, 0x03, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0E, 0xF8, 0x01, // 87
     0x00, 0x00, 0x08, 0x08, 0x30, 0x06, 0xC0, 0x01, 0xC0, 0x01, 0x30, 0x06, 0x08, 0x08, // 88
-    0x08, 0x00, 0x10, 0x00, 0x60, 0x00, 0x80, 0x0F, 0x60, 0x00, 0x10, 0x00, 0x08,       // 89
+    0x08, 0x00, 0x10, 0x00, 0x60, 0x00, 0x80, 0x0F, 0x60, 0x00, 0x10, 0x00, 0x08, // 89
     0x00, 0x00, 0x08, 0x0C, 0x08, 0x0E, 0x88, 0x09, 0xC8, 0x08, 0x38, 0x08, 0x18, 0x08, // 90
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x04, 0x10,                         // 91
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x04, 0x10, // 91
     0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x10, // 92
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0xFC, 0x1F,                                     // 93
-    0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20,                   // 94
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0xFC, 0x1F, // 93
+    0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, // 94
     0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, // 95
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08,                               // 96
-    0x00, 0x00, 0x40, 0x06, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0xC0, 0x0F,             // 97
-    0x00, 0x00, 0xFC, 0x0F, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07,             // 98
-    0x00, 0x00, 0xC0, 0x07, 0x60, 0x0C, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08,             // 99
-    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xFC, 0x0F,             // 100
-    0x00, 0x00, 0xC0, 0x07, 0x60, 0x09, 0x20, 0x09, 0x20, 0x09, 0xC0, 0x05,             // 101
-    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0xF8, 0x0F, 0x24, 0x00, 0x24,                   // 102
-    0x00, 0x00, 0xC0, 0x07, 0x20, 0x28, 0x20, 0x48, 0x20, 0x48, 0xE0, 0x3F,             // 103
-    0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0xC0, 0x0F,             // 104
-    0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xE4, 0x0F, 0x00, 0x08, 0x00, 0x08,             // 105
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x20, 0x40, 0xE4, 0x3F,                         // 106
-    0x00, 0x00, 0xFC, 0x0F, 0x00, 0x01, 0x80, 0x02, 0x40, 0x04, 0x20, 0x08,             // 107
-    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0xFC, 0x07, 0x00, 0x08, 0x00, 0x08,             // 108
-    0x00, 0x00, 0xE0, 0x0F, 0x20, 0x00, 0xE0, 0x0F, 0x20, 0x00, 0xE0, 0x0F,             // 109
-    0x00, 0x00, 0xE0, 0x0F, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0xC0, 0x0F,             // 110
-    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07,             // 111
-    0x00, 0x00, 0xE0, 0x7F, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07,             // 112
-    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xE0, 0x7F,             // 113
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40,       // 114
-    0x00, 0x00, 0xC0, 0x04, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0x40, 0x06,             // 115
-    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0xF8, 0x0F, 0x20, 0x08, 0x20, 0x08,             // 116
-    0x00, 0x00, 0xE0, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0xE0, 0x0F,             // 117
-    0x00, 0x00, 0x60, 0x00, 0x80, 0x03, 0x00, 0x0C, 0x80, 0x03, 0x60,                   // 118
-    0x60, 0x00, 0x80, 0x03, 0x00, 0x0E, 0x80, 0x01, 0x00, 0x0E, 0x80, 0x03, 0x60,       // 119
-    0x00, 0x00, 0x20, 0x08, 0xC0, 0x06, 0x00, 0x01, 0xC0, 0x06, 0x20, 0x08,             // 120
-    0x00, 0x00, 0x60, 0x40, 0x80, 0x67, 0x00, 0x1C, 0x80, 0x03, 0x60,                   // 121
-    0x00, 0x00, 0x20, 0x0C, 0x20, 0x0A, 0x20, 0x09, 0xA0, 0x08, 0x60, 0x08,             // 122
-    0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x7C, 0x1F, 0x04, 0x10, 0x04, 0x10,             // 123
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F,                                     // 124
-    0x00, 0x00, 0x04, 0x10, 0x04, 0x10, 0x7C, 0x1F, 0x80, 0x00, 0x80,                   // 125
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, // 96
+    0x00, 0x00, 0x40, 0x06, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0xC0, 0x0F, // 97
+    0x00, 0x00, 0xFC, 0x0F, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07, // 98
+    0x00, 0x00, 0xC0, 0x07, 0x60, 0x0C, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, // 99
+    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xFC, 0x0F, // 100
+    0x00, 0x00, 0xC0, 0x07, 0x60, 0x09, 0x20, 0x09, 0x20, 0x09, 0xC0, 0x05, // 101
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0xF8, 0x0F, 0x24, 0x00, 0x24, // 102
+    0x00, 0x00, 0xC0, 0x07, 0x20, 0x28, 0x20, 0x48, 0x20, 0x48, 0xE0, 0x3F, // 103
+    0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0xC0, 0x0F, // 104
+    0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xE4, 0x0F, 0x00, 0x08, 0x00, 0x08, // 105
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x20, 0x40, 0xE4, 0x3F, // 106
+    0x00, 0x00, 0xFC, 0x0F, 0x00, 0x01, 0x80, 0x02, 0x40, 0x04, 0x20, 0x08, // 107
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0xFC, 0x07, 0x00, 0x08, 0x00, 0x08, // 108
+    0x00, 0x00, 0xE0, 0x0F, 0x20, 0x00, 0xE0, 0x0F, 0x20, 0x00, 0xE0, 0x0F, // 109
+    0x00, 0x00, 0xE0, 0x0F, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0xC0, 0x0F, // 110
+    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07, // 111
+    0x00, 0x00, 0xE0, 0x7F, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07, // 112
+    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xE0, 0x7F, // 113
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, // 114
+    0x00, 0x00, 0xC0, 0x04, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0x40, 0x06, // 115
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0xF8, 0x0F, 0x20, 0x08, 0x20, 0x08, // 116
+    0x00, 0x00, 0xE0, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0xE0, 0x0F, // 117
+    0x00, 0x00, 0x60, 0x00, 0x80, 0x03, 0x00, 0x0C, 0x80, 0x03, 0x60, // 118
+    0x60, 0x00, 0x80, 0x03, 0x00, 0x0E, 0x80, 0x01, 0x00, 0x0E, 0x80, 0x03, 0x60, // 119
+    0x00, 0x00, 0x20, 0x08, 0xC0, 0x06, 0x00, 0x01, 0xC0, 0x06, 0x20, 0x08, // 120
+    0x00, 0x00, 0x60, 0x40, 0x80, 0x67, 0x00, 0x1C, 0x80, 0x03, 0x60, // 121
+    0x00, 0x00, 0x20, 0x0C, 0x20, 0x0A, 0x20, 0x09, 0xA0, 0x08, 0x60, 0x08, // 122
+    0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x7C, 0x1F, 0x04, 0x10, 0x04, 0x10, // 123
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, // 124
+    0x00, 0x00, 0x04, 0x10, 0x04, 0x10, 0x7C, 0x1F, 0x80, 0x00, 0x80, // 125
     0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, // 126
     0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 127
     0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 128
@@ -362,37 +362,37 @@ const uint8_t DejaVu_Sans_Mono_12[] PROGMEM = {
     0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 157
     0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 158
     0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 159
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x3F,                                     // 161
-    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0xF8, 0x3F, 0x20, 0x08, 0x40, 0x04,             // 162
-    0x00, 0x00, 0x80, 0x08, 0xF0, 0x0F, 0x88, 0x08, 0x88, 0x08, 0x08, 0x08,             // 163
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x3F, // 161
+    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0xF8, 0x3F, 0x20, 0x08, 0x40, 0x04, // 162
+    0x00, 0x00, 0x80, 0x08, 0xF0, 0x0F, 0x88, 0x08, 0x88, 0x08, 0x08, 0x08, // 163
     0x00, 0x00, 0x20, 0x04, 0xC0, 0x03, 0x40, 0x02, 0x40, 0x02, 0xC0, 0x03, 0x20, 0x04, // 164
-    0x08, 0x00, 0x50, 0x01, 0x60, 0x01, 0x80, 0x0F, 0x60, 0x01, 0x50, 0x01, 0x08,       // 165
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C,                                     // 166
-    0x00, 0x00, 0xF0, 0x11, 0x28, 0x13, 0x48, 0x12, 0xC8, 0x14, 0x88, 0x0F,             // 167
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,                               // 168
+    0x08, 0x00, 0x50, 0x01, 0x60, 0x01, 0x80, 0x0F, 0x60, 0x01, 0x50, 0x01, 0x08, // 165
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, // 166
+    0x00, 0x00, 0xF0, 0x11, 0x28, 0x13, 0x48, 0x12, 0xC8, 0x14, 0x88, 0x0F, // 167
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, // 168
     0xC0, 0x01, 0x20, 0x02, 0xD0, 0x05, 0x50, 0x05, 0x50, 0x05, 0x20, 0x02, 0xC0, 0x01, // 169
-    0x00, 0x00, 0xE8, 0x02, 0xA8, 0x02, 0xA8, 0x02, 0xF0, 0x02,                         // 170
+    0x00, 0x00, 0xE8, 0x02, 0xA8, 0x02, 0xA8, 0x02, 0xF0, 0x02, // 170
     0x00, 0x00, 0x00, 0x01, 0x80, 0x02, 0x40, 0x04, 0x00, 0x01, 0x80, 0x02, 0x40, 0x04, // 171
     0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x03, // 172
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,                         // 173
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, // 173
     0xC0, 0x01, 0x20, 0x02, 0xD0, 0x05, 0xD0, 0x05, 0xD0, 0x05, 0x20, 0x02, 0xC0, 0x01, // 174
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,                   // 175
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x48, 0x00, 0x48, 0x00, 0x30,                   // 176
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, // 175
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x48, 0x00, 0x48, 0x00, 0x30, // 176
     0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0xE0, 0x0B, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, // 177
-    0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0xE8, 0x00, 0xB8,                               // 178
-    0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0xD8,                   // 179
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04,                               // 180
+    0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0xE8, 0x00, 0xB8, // 178
+    0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0xD8, // 179
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, // 180
     0x00, 0x00, 0xE0, 0x7F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0xE0, 0x0F, 0x00, 0x08, // 181
     0x00, 0x00, 0x70, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x1F, 0x08, 0x00, 0xF8, 0x1F, // 182
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,                                     // 183
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30,                         // 184
-    0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0xF8, 0x00, 0x80,                               // 185
-    0x00, 0x00, 0x70, 0x02, 0x88, 0x02, 0x88, 0x02, 0x70, 0x02,                         // 186
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, // 183
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30, // 184
+    0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0xF8, 0x00, 0x80, // 185
+    0x00, 0x00, 0x70, 0x02, 0x88, 0x02, 0x88, 0x02, 0x70, 0x02, // 186
     0x00, 0x00, 0x40, 0x04, 0x80, 0x02, 0x00, 0x01, 0x40, 0x04, 0x80, 0x02, 0x00, 0x01, // 187
     0x44, 0x02, 0x7C, 0x03, 0x40, 0x01, 0x00, 0x0D, 0x80, 0x0B, 0x80, 0x1F, 0x00, 0x08, // 188
-    0x44, 0x02, 0x7C, 0x03, 0x40, 0x01, 0x00, 0x11, 0x80, 0x1D, 0x80, 0x17,             // 189
+    0x44, 0x02, 0x7C, 0x03, 0x40, 0x01, 0x00, 0x11, 0x80, 0x1D, 0x80, 0x17, // 189
     0x00, 0x02, 0x44, 0x03, 0x54, 0x01, 0x54, 0x0D, 0xEC, 0x0B, 0x80, 0x1F, 0x00, 0x08, // 190
-    0x00, 0x38, 0x00, 0x4C, 0x00, 0x44, 0x60, 0x43, 0x00, 0x20,                         // 191
+    0x00, 0x38, 0x00, 0x4C, 0x00, 0x44, 0x60, 0x43, 0x00, 0x20, // 191
     0x00, 0x00, 0x00, 0x0C, 0xC1, 0x03, 0x3A, 0x02, 0x38, 0x02, 0xC0, 0x03, 0x00, 0x0C, // 192
     0x00, 0x00, 0x00, 0x0C, 0xC0, 0x03, 0x3A, 0x02, 0x39, 0x02, 0xC0, 0x03, 0x00, 0x0C, // 193
     0x00, 0x00, 0x00, 0x0C, 0xC2, 0x03, 0x39, 0x02, 0x39, 0x02, 0xC2, 0x03, 0x00, 0x0C, // 194
@@ -405,10 +405,10 @@ const uint8_t DejaVu_Sans_Mono_12[] PROGMEM = {
     0x00, 0x00, 0xF8, 0x0F, 0x88, 0x08, 0x8A, 0x08, 0x89, 0x08, 0x88, 0x08, 0x88, 0x08, // 201
     0x00, 0x00, 0xF8, 0x0F, 0x8A, 0x08, 0x89, 0x08, 0x89, 0x08, 0x8A, 0x08, 0x88, 0x08, // 202
     0x00, 0x00, 0xF8, 0x0F, 0x8A, 0x08, 0x88, 0x08, 0x8A, 0x08, 0x88, 0x08, 0x88, 0x08, // 203
-    0x00, 0x00, 0x08, 0x08, 0x09, 0x08, 0xFA, 0x0F, 0x08, 0x08, 0x08, 0x08,             // 204
-    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0xFA, 0x0F, 0x09, 0x08, 0x08, 0x08,             // 205
-    0x00, 0x00, 0x08, 0x08, 0x0A, 0x08, 0xF9, 0x0F, 0x0A, 0x08, 0x08, 0x08,             // 206
-    0x00, 0x00, 0x08, 0x08, 0x0A, 0x08, 0xF8, 0x0F, 0x0A, 0x08, 0x08, 0x08,             // 207
+    0x00, 0x00, 0x08, 0x08, 0x09, 0x08, 0xFA, 0x0F, 0x08, 0x08, 0x08, 0x08, // 204
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0xFA, 0x0F, 0x09, 0x08, 0x08, 0x08, // 205
+    0x00, 0x00, 0x08, 0x08, 0x0A, 0x08, 0xF9, 0x0F, 0x0A, 0x08, 0x08, 0x08, // 206
+    0x00, 0x00, 0x08, 0x08, 0x0A, 0x08, 0xF8, 0x0F, 0x0A, 0x08, 0x08, 0x08, // 207
     0x80, 0x00, 0xF8, 0x0F, 0x88, 0x08, 0x88, 0x08, 0x08, 0x08, 0x10, 0x04, 0xE0, 0x03, // 208
     0x00, 0x00, 0xF8, 0x0F, 0x1B, 0x00, 0xE1, 0x00, 0x82, 0x03, 0x03, 0x0C, 0xF8, 0x0F, // 209
     0x00, 0x00, 0xE0, 0x03, 0x19, 0x0C, 0x0A, 0x08, 0x08, 0x08, 0x18, 0x0C, 0xE0, 0x03, // 210
@@ -416,506 +416,229 @@ const uint8_t DejaVu_Sans_Mono_12[] PROGMEM = {
     0x00, 0x00, 0xE0, 0x03, 0x1A, 0x0C, 0x09, 0x08, 0x09, 0x08, 0x1A, 0x0C, 0xE0, 0x03, // 212
     0x00, 0x00, 0xE0, 0x03, 0x1B, 0x0C, 0x09, 0x08, 0x0A, 0x08, 0x1B, 0x0C, 0xE0, 0x03, // 213
     0x00, 0x00, 0xE0, 0x03, 0x1A, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x1A, 0x0C, 0xE0, 0x03, // 214
-    0x00, 0x00, 0x20, 0x02, 0x40, 0x01, 0x80, 0x00, 0x40, 0x01, 0x20, 0x02,             // 215
+    0x00, 0x00, 0x20, 0x02, 0x40, 0x01, 0x80, 0x00, 0x40, 0x01, 0x20, 0x02, // 215
     0x00, 0x08, 0xE0, 0x07, 0x18, 0x0E, 0x88, 0x09, 0x48, 0x08, 0x38, 0x0C, 0xF8, 0x03, // 216
     0x00, 0x00, 0xF8, 0x07, 0x01, 0x08, 0x02, 0x08, 0x00, 0x08, 0x00, 0x08, 0xF8, 0x07, // 217
     0x00, 0x00, 0xF8, 0x07, 0x00, 0x08, 0x02, 0x08, 0x01, 0x08, 0x00, 0x08, 0xF8, 0x07, // 218
     0x00, 0x00, 0xF8, 0x07, 0x02, 0x08, 0x01, 0x08, 0x01, 0x08, 0x02, 0x08, 0xF8, 0x07, // 219
     0x00, 0x00, 0xF8, 0x07, 0x02, 0x08, 0x00, 0x08, 0x00, 0x08, 0x02, 0x08, 0xF8, 0x07, // 220
-    0x08, 0x00, 0x10, 0x00, 0x60, 0x00, 0x82, 0x0F, 0x61, 0x00, 0x10, 0x00, 0x08,       // 221
-    0x00, 0x00, 0xF8, 0x0F, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0xE0,       // 222
-    0x00, 0x00, 0xF8, 0x0F, 0xE4, 0x00, 0xA4, 0x09, 0x18, 0x09, 0x00, 0x06,             // 223
-    0x00, 0x00, 0x40, 0x06, 0x20, 0x09, 0x24, 0x09, 0x28, 0x09, 0xC0, 0x0F,             // 224
-    0x00, 0x00, 0x40, 0x06, 0x20, 0x09, 0x28, 0x09, 0x24, 0x09, 0xC0, 0x0F,             // 225
-    0x00, 0x00, 0x40, 0x06, 0x28, 0x09, 0x24, 0x09, 0x24, 0x09, 0xC8, 0x0F,             // 226
-    0x00, 0x00, 0x40, 0x06, 0x2C, 0x09, 0x24, 0x09, 0x28, 0x09, 0xCC, 0x0F,             // 227
-    0x00, 0x00, 0x40, 0x06, 0x28, 0x09, 0x20, 0x09, 0x28, 0x09, 0xC0, 0x0F,             // 228
-    0x00, 0x00, 0x40, 0x06, 0x26, 0x09, 0x29, 0x09, 0x29, 0x09, 0xC6, 0x0F,             // 229
-    0x00, 0x00, 0x40, 0x0F, 0x20, 0x09, 0xC0, 0x07, 0x20, 0x09, 0xE0, 0x09,             // 230
-    0x00, 0x00, 0xC0, 0x07, 0x60, 0x0C, 0x20, 0x28, 0x20, 0x28, 0x40, 0x38,             // 231
-    0x00, 0x00, 0xC0, 0x07, 0x60, 0x09, 0x24, 0x09, 0x28, 0x09, 0xC0, 0x05,             // 232
-    0x00, 0x00, 0xC0, 0x07, 0x60, 0x09, 0x28, 0x09, 0x24, 0x09, 0xC0, 0x05,             // 233
-    0x00, 0x00, 0xC0, 0x07, 0x68, 0x09, 0x24, 0x09, 0x24, 0x09, 0xC8, 0x05,             // 234
-    0x00, 0x00, 0xC0, 0x07, 0x68, 0x09, 0x20, 0x09, 0x28, 0x09, 0xC0, 0x05,             // 235
-    0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xE4, 0x0F, 0x08, 0x08, 0x00, 0x08,             // 236
-    0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xE8, 0x0F, 0x04, 0x08, 0x00, 0x08,             // 237
-    0x00, 0x00, 0x28, 0x08, 0x24, 0x08, 0xE4, 0x0F, 0x08, 0x08, 0x00, 0x08,             // 238
-    0x00, 0x00, 0x20, 0x08, 0x28, 0x08, 0xE0, 0x0F, 0x08, 0x08, 0x00, 0x08,             // 239
-    0x00, 0x00, 0x80, 0x07, 0x54, 0x08, 0x58, 0x08, 0x68, 0x08, 0xC0, 0x07,             // 240
-    0x00, 0x00, 0xE0, 0x0F, 0x4C, 0x00, 0x24, 0x00, 0x28, 0x00, 0xCC, 0x0F,             // 241
-    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x24, 0x08, 0x28, 0x08, 0xC0, 0x07,             // 242
-    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x28, 0x08, 0x24, 0x08, 0xC0, 0x07,             // 243
-    0x00, 0x00, 0xC0, 0x07, 0x28, 0x08, 0x24, 0x08, 0x28, 0x08, 0xC0, 0x07,             // 244
-    0x00, 0x00, 0xCC, 0x07, 0x24, 0x08, 0x2C, 0x08, 0x28, 0x08, 0xCC, 0x07,             // 245
-    0x00, 0x00, 0xC0, 0x07, 0x28, 0x08, 0x20, 0x08, 0x28, 0x08, 0xC0, 0x07,             // 246
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x40, 0x05, 0x00, 0x01, 0x00, 0x01,             // 247
-    0x00, 0x00, 0xC0, 0x0F, 0x20, 0x0A, 0x20, 0x09, 0xA0, 0x08, 0xE0, 0x07,             // 248
-    0x00, 0x00, 0xE0, 0x07, 0x00, 0x08, 0x04, 0x08, 0x08, 0x08, 0xE0, 0x0F,             // 249
-    0x00, 0x00, 0xE0, 0x07, 0x00, 0x08, 0x08, 0x08, 0x04, 0x08, 0xE0, 0x0F,             // 250
-    0x00, 0x00, 0xE0, 0x07, 0x08, 0x08, 0x04, 0x08, 0x08, 0x08, 0xE0, 0x0F,             // 251
-    0x00, 0x00, 0xE0, 0x07, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0xE0, 0x0F,             // 252
-    0x00, 0x00, 0x60, 0x40, 0x80, 0x67, 0x08, 0x1C, 0x84, 0x03, 0x60,                   // 253
-    0x00, 0x00, 0xFC, 0x7F, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07,             // 254
-    0x00, 0x00, 0x60, 0x40, 0x88, 0x67, 0x00, 0x1C, 0x88, 0x03, 0x60                    // 255
+    0x08, 0x00, 0x10, 0x00, 0x60, 0x00, 0x82, 0x0F, 0x61, 0x00, 0x10, 0x00, 0x08, // 221
+    0x00, 0x00, 0xF8, 0x0F, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0xE0, // 222
+    0x00, 0x00, 0xF8, 0x0F, 0xE4, 0x00, 0xA4, 0x09, 0x18, 0x09, 0x00, 0x06, // 223
+    0x00, 0x00, 0x40, 0x06, 0x20, 0x09, 0x24, 0x09, 0x28, 0x09, 0xC0, 0x0F, // 224
+    0x00, 0x00, 0x40, 0x06, 0x20, 0x09, 0x28, 0x09, 0x24, 0x09, 0xC0, 0x0F, // 225
+    0x00, 0x00, 0x40, 0x06, 0x28, 0x09, 0x24, 0x09, 0x24, 0x09, 0xC8, 0x0F, // 226
+    0x00, 0x00, 0x40, 0x06, 0x2C, 0x09, 0x24, 0x09, 0x28, 0x09, 0xCC, 0x0F, // 227
+    0x00, 0x00, 0x40, 0x06, 0x28, 0x09, 0x20, 0x09, 0x28, 0x09, 0xC0, 0x0F, // 228
+    0x00, 0x00, 0x40, 0x06, 0x26, 0x09, 0x29, 0x09, 0x29, 0x09, 0xC6, 0x0F, // 229
+    0x00, 0x00, 0x40, 0x0F, 0x20, 0x09, 0xC0, 0x07, 0x20, 0x09, 0xE0, 0x09, // 230
+    0x00, 0x00, 0xC0, 0x07, 0x60, 0x0C, 0x20, 0x28, 0x20, 0x28, 0x40, 0x38, // 231
+    0x00, 0x00, 0xC0, 0x07, 0x60, 0x09, 0x24, 0x09, 0x28, 0x09, 0xC0, 0x05, // 232
+    0x00, 0x00, 0xC0, 0x07, 0x60, 0x09, 0x28, 0x09, 0x24, 0x09, 0xC0, 0x05, // 233
+    0x00, 0x00, 0xC0, 0x07, 0x68, 0x09, 0x24, 0x09, 0x24, 0x09, 0xC8, 0x05, // 234
+    0x00, 0x00, 0xC0, 0x07, 0x68, 0x09, 0x20, 0x09, 0x28, 0x09, 0xC0, 0x05, // 235
+    0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xE4, 0x0F, 0x08, 0x08, 0x00, 0x08, // 236
+    0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xE8, 0x0F, 0x04, 0x08, 0x00, 0x08, // 237
+    0x00, 0x00, 0x28, 0x08, 0x24, 0x08, 0xE4, 0x0F, 0x08, 0x08, 0x00, 0x08, // 238
+    0x00, 0x00, 0x20, 0x08, 0x28, 0x08, 0xE0, 0x0F, 0x08, 0x08, 0x00, 0x08, // 239
+    0x00, 0x00, 0x80, 0x07, 0x54, 0x08, 0x58, 0x08, 0x68, 0x08, 0xC0, 0x07, // 240
+    0x00, 0x00, 0xE0, 0x0F, 0x4C, 0x00, 0x24, 0x00, 0x28, 0x00, 0xCC, 0x0F, // 241
+    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x24, 0x08, 0x28, 0x08, 0xC0, 0x07, // 242
+    0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x28, 0x08, 0x24, 0x08, 0xC0, 0x07, // 243
+    0x00, 0x00, 0xC0, 0x07, 0x28, 0x08, 0x24, 0x08, 0x28, 0x08, 0xC0, 0x07, // 244
+    0x00, 0x00, 0xCC, 0x07, 0x24, 0x08, 0x2C, 0x08, 0x28, 0x08, 0xCC, 0x07, // 245
+    0x00, 0x00, 0xC0, 0x07, 0x28, 0x08, 0x20, 0x08, 0x28, 0x08, 0xC0, 0x07, // 246
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x40, 0x05, 0x00, 0x01, 0x00, 0x01, // 247
+    0x00, 0x00, 0xC0, 0x0F, 0x20, 0x0A, 0x20, 0x09, 0xA0, 0x08, 0xE0, 0x07, // 248
+    0x00, 0x00, 0xE0, 0x07, 0x00, 0x08, 0x04, 0x08, 0x08, 0x08, 0xE0, 0x0F, // 249
+    0x00, 0x00, 0xE0, 0x07, 0x00, 0x08, 0x08, 0x08, 0x04, 0x08, 0xE0, 0x0F, // 250
+    0x00, 0x00, 0xE0, 0x07, 0x08, 0x08, 0x04, 0x08, 0x08, 0x08, 0xE0, 0x0F, // 251
+    0x00, 0x00, 0xE0, 0x07, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0xE0, 0x0F, // 252
+    0x00, 0x00, 0x60, 0x40, 0x80, 0x67, 0x08, 0x1C, 0x84, 0x03, 0x60, // 253
+    0x00, 0x00, 0xFC, 0x7F, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07, // 254
+    0x00, 0x00, 0x60, 0x40, 0x88, 0x67, 0x00, 0x1C, 0x88, 0x03, 0x60 // 255
 };
 
-// Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
 const uint8_t DejaVu_Sans_Mono_10[] PROGMEM = {
     0x06, // Width: 6
     0x0D, // Height: 13
     0x20, // First Char: 32
-    0xE0, // Numbers of Chars: 224
+    0x1A, // Numbers of Chars: 26
 
     // Jump Table:
     0xFF, 0xFF, 0x00, 0x06, // 32:65535
-    0x00, 0x00, 0x08, 0x06, // 33:0
-    0x00, 0x08, 0x09, 0x06, // 34:8
-    0x00, 0x11, 0x0B, 0x06, // 35:17
-    0x00, 0x1C, 0x0C, 0x06, // 36:28
-    0x00, 0x28, 0x0C, 0x06, // 37:40
-    0x00, 0x34, 0x0C, 0x06, // 38:52
-    0x00, 0x40, 0x07, 0x06, // 39:64
-    0x00, 0x47, 0x08, 0x06, // 40:71
-    0x00, 0x4F, 0x08, 0x06, // 41:79
-    0x00, 0x57, 0x0B, 0x06, // 42:87
-    0x00, 0x62, 0x0B, 0x06, // 43:98
-    0x00, 0x6D, 0x06, 0x06, // 44:109
-    0x00, 0x73, 0x09, 0x06, // 45:115
-    0x00, 0x7C, 0x06, 0x06, // 46:124
-    0x00, 0x82, 0x0B, 0x06, // 47:130
-    0x00, 0x8D, 0x0C, 0x06, // 48:141
-    0x00, 0x99, 0x0C, 0x06, // 49:153
-    0x00, 0xA5, 0x0C, 0x06, // 50:165
-    0x00, 0xB1, 0x0C, 0x06, // 51:177
-    0x00, 0xBD, 0x0B, 0x06, // 52:189
-    0x00, 0xC8, 0x0C, 0x06, // 53:200
-    0x00, 0xD4, 0x0C, 0x06, // 54:212
-    0x00, 0xE0, 0x0B, 0x06, // 55:224
-    0x00, 0xEB, 0x0C, 0x06, // 56:235
-    0x00, 0xF7, 0x0C, 0x06, // 57:247
-    0x01, 0x03, 0x06, 0x06, // 58:259
-    0x01, 0x09, 0x06, 0x06, // 59:265
-    0x01, 0x0F, 0x0C, 0x06, // 60:271
-    0x01, 0x1B, 0x09, 0x06, // 61:283
-    0x01, 0x24, 0x0B, 0x06, // 62:292
-    0x01, 0x2F, 0x09, 0x06, // 63:303
-    0x01, 0x38, 0x0C, 0x06, // 64:312
-    0x01, 0x44, 0x0C, 0x06, // 65:324
-    0x01, 0x50, 0x0C, 0x06, // 66:336
-    0x01, 0x5C, 0x0C, 0x06, // 67:348
-    0x01, 0x68, 0x0C, 0x06, // 68:360
-    0x01, 0x74, 0x0C, 0x06, // 69:372
-    0x01, 0x80, 0x0B, 0x06, // 70:384
-    0x01, 0x8B, 0x0C, 0x06, // 71:395
-    0x01, 0x97, 0x0C, 0x06, // 72:407
-    0x01, 0xA3, 0x0C, 0x06, // 73:419
-    0x01, 0xAF, 0x0A, 0x06, // 74:431
-    0x01, 0xB9, 0x0C, 0x06, // 75:441
-    0x01, 0xC5, 0x0C, 0x06, // 76:453
-    0x01, 0xD1, 0x0C, 0x06, // 77:465
-    0x01, 0xDD, 0x0C, 0x06, // 78:477
-    0x01, 0xE9, 0x0C, 0x06, // 79:489
-    0x01, 0xF5, 0x0B, 0x06, // 80:501
-    0x02, 0x00, 0x0C, 0x06, // 81:512
-    0x02, 0x0C, 0x0C, 0x06, // 82:524
-    0x02, 0x18, 0x0C, 0x06, // 83:536
-    0x02, 0x24, 0x0B, 0x06, // 84:548
-    0x02, 0x2F, 0x0C, 0x06, // 85:559
-    0x02, 0x3B, 0x0B, 0x06, // 86:571
-    0x02, 0x46, 0x0B, 0x06, // 87:582
-    0x02, 0x51, 0x0C, 0x06, // 88:593
-    0x02, 0x5D, 0x0B, 0x06, // 89:605
-    0x02, 0x68, 0x0C, 0x06, // 90:616
-    0x02, 0x74, 0x08, 0x06, // 91:628
-    0x02, 0x7C, 0x0C, 0x06, // 92:636
-    0x02, 0x88, 0x08, 0x06, // 93:648
-    0x02, 0x90, 0x09, 0x06, // 94:656
-    0x02, 0x99, 0x0C, 0x06, // 95:665
-    0x02, 0xA5, 0x05, 0x06, // 96:677
-    0x02, 0xAA, 0x0C, 0x06, // 97:682
-    0x02, 0xB6, 0x0C, 0x06, // 98:694
-    0x02, 0xC2, 0x0A, 0x06, // 99:706
-    0x02, 0xCC, 0x0C, 0x06, // 100:716
-    0x02, 0xD8, 0x0C, 0x06, // 101:728
-    0x02, 0xE4, 0x09, 0x06, // 102:740
-    0x02, 0xED, 0x0C, 0x06, // 103:749
-    0x02, 0xF9, 0x0C, 0x06, // 104:761
-    0x03, 0x05, 0x0C, 0x06, // 105:773
-    0x03, 0x11, 0x08, 0x06, // 106:785
-    0x03, 0x19, 0x0C, 0x06, // 107:793
-    0x03, 0x25, 0x0A, 0x06, // 108:805
-    0x03, 0x2F, 0x0C, 0x06, // 109:815
-    0x03, 0x3B, 0x0C, 0x06, // 110:827
-    0x03, 0x47, 0x0C, 0x06, // 111:839
-    0x03, 0x53, 0x0C, 0x06, // 112:851
-    0x03, 0x5F, 0x0C, 0x06, // 113:863
-    0x03, 0x6B, 0x0B, 0x06, // 114:875
-    0x03, 0x76, 0x0C, 0x06, // 115:886
-    0x03, 0x82, 0x0A, 0x06, // 116:898
-    0x03, 0x8C, 0x0C, 0x06, // 117:908
-    0x03, 0x98, 0x0B, 0x06, // 118:920
-    0x03, 0xA3, 0x0B, 0x06, // 119:931
-    0x03, 0xAE, 0x0C, 0x06, // 120:942
-    0x03, 0xBA, 0x0B, 0x06, // 121:954
-    0x03, 0xC5, 0x0C, 0x06, // 122:965
-    0x03, 0xD1, 0x0A, 0x06, // 123:977
-    0x03, 0xDB, 0x08, 0x06, // 124:987
-    0x03, 0xE3, 0x0B, 0x06, // 125:995
-    0x03, 0xEE, 0x0B, 0x06, // 126:1006
-    0x03, 0xF9, 0x0C, 0x06, // 127:1017
-    0x04, 0x05, 0x0C, 0x06, // 128:1029
-    0x04, 0x11, 0x0C, 0x06, // 129:1041
-    0x04, 0x1D, 0x0C, 0x06, // 130:1053
-    0x04, 0x29, 0x0C, 0x06, // 131:1065
-    0x04, 0x35, 0x0C, 0x06, // 132:1077
-    0x04, 0x41, 0x0C, 0x06, // 133:1089
-    0x04, 0x4D, 0x0C, 0x06, // 134:1101
-    0x04, 0x59, 0x0C, 0x06, // 135:1113
-    0x04, 0x65, 0x0C, 0x06, // 136:1125
-    0x04, 0x71, 0x0C, 0x06, // 137:1137
-    0x04, 0x7D, 0x0C, 0x06, // 138:1149
-    0x04, 0x89, 0x0C, 0x06, // 139:1161
-    0x04, 0x95, 0x0C, 0x06, // 140:1173
-    0x04, 0xA1, 0x0C, 0x06, // 141:1185
-    0x04, 0xAD, 0x0C, 0x06, // 142:1197
-    0x04, 0xB9, 0x0C, 0x06, // 143:1209
-    0x04, 0xC5, 0x0C, 0x06, // 144:1221
-    0x04, 0xD1, 0x0C, 0x06, // 145:1233
-    0x04, 0xDD, 0x0C, 0x06, // 146:1245
-    0x04, 0xE9, 0x0C, 0x06, // 147:1257
-    0x04, 0xF5, 0x0C, 0x06, // 148:1269
-    0x05, 0x01, 0x0C, 0x06, // 149:1281
-    0x05, 0x0D, 0x0C, 0x06, // 150:1293
-    0x05, 0x19, 0x0C, 0x06, // 151:1305
-    0x05, 0x25, 0x0C, 0x06, // 152:1317
-    0x05, 0x31, 0x0C, 0x06, // 153:1329
-    0x05, 0x3D, 0x0C, 0x06, // 154:1341
-    0x05, 0x49, 0x0C, 0x06, // 155:1353
-    0x05, 0x55, 0x0C, 0x06, // 156:1365
-    0x05, 0x61, 0x0C, 0x06, // 157:1377
-    0x05, 0x6D, 0x0C, 0x06, // 158:1389
-    0x05, 0x79, 0x0C, 0x06, // 159:1401
-    0xFF, 0xFF, 0x00, 0x06, // 160:65535
-    0x05, 0x85, 0x08, 0x06, // 161:1413
-    0x05, 0x8D, 0x0A, 0x06, // 162:1421
-    0x05, 0x97, 0x0C, 0x06, // 163:1431
-    0x05, 0xA3, 0x0C, 0x06, // 164:1443
-    0x05, 0xAF, 0x0B, 0x06, // 165:1455
-    0x05, 0xBA, 0x08, 0x06, // 166:1466
-    0x05, 0xC2, 0x0A, 0x06, // 167:1474
-    0x05, 0xCC, 0x09, 0x06, // 168:1484
-    0x05, 0xD5, 0x0B, 0x06, // 169:1493
-    0x05, 0xE0, 0x0A, 0x06, // 170:1504
-    0x05, 0xEA, 0x0A, 0x06, // 171:1514
-    0x05, 0xF4, 0x0B, 0x06, // 172:1524
-    0x05, 0xFF, 0x09, 0x06, // 173:1535
-    0x06, 0x08, 0x0B, 0x06, // 174:1544
-    0x06, 0x13, 0x09, 0x06, // 175:1555
-    0x06, 0x1C, 0x07, 0x06, // 176:1564
-    0x06, 0x23, 0x0C, 0x06, // 177:1571
-    0x06, 0x2F, 0x09, 0x06, // 178:1583
-    0x06, 0x38, 0x09, 0x06, // 179:1592
-    0x06, 0x41, 0x07, 0x06, // 180:1601
-    0x06, 0x48, 0x0C, 0x06, // 181:1608
-    0x06, 0x54, 0x0C, 0x06, // 182:1620
-    0x06, 0x60, 0x05, 0x06, // 183:1632
-    0x06, 0x65, 0x08, 0x06, // 184:1637
-    0x06, 0x6D, 0x09, 0x06, // 185:1645
-    0x06, 0x76, 0x0A, 0x06, // 186:1654
-    0x06, 0x80, 0x09, 0x06, // 187:1664
-    0x06, 0x89, 0x0C, 0x06, // 188:1673
-    0x06, 0x95, 0x0C, 0x06, // 189:1685
-    0x06, 0xA1, 0x0C, 0x06, // 190:1697
-    0x06, 0xAD, 0x0A, 0x06, // 191:1709
-    0x06, 0xB7, 0x0C, 0x06, // 192:1719
-    0x06, 0xC3, 0x0C, 0x06, // 193:1731
-    0x06, 0xCF, 0x0C, 0x06, // 194:1743
-    0x06, 0xDB, 0x0C, 0x06, // 195:1755
-    0x06, 0xE7, 0x0C, 0x06, // 196:1767
-    0x06, 0xF3, 0x0C, 0x06, // 197:1779
-    0x06, 0xFF, 0x0C, 0x06, // 198:1791
-    0x07, 0x0B, 0x0C, 0x06, // 199:1803
-    0x07, 0x17, 0x0C, 0x06, // 200:1815
-    0x07, 0x23, 0x0C, 0x06, // 201:1827
-    0x07, 0x2F, 0x0C, 0x06, // 202:1839
-    0x07, 0x3B, 0x0C, 0x06, // 203:1851
-    0x07, 0x47, 0x0C, 0x06, // 204:1863
-    0x07, 0x53, 0x0C, 0x06, // 205:1875
-    0x07, 0x5F, 0x0C, 0x06, // 206:1887
-    0x07, 0x6B, 0x0C, 0x06, // 207:1899
-    0x07, 0x77, 0x0C, 0x06, // 208:1911
-    0x07, 0x83, 0x0C, 0x06, // 209:1923
-    0x07, 0x8F, 0x0C, 0x06, // 210:1935
-    0x07, 0x9B, 0x0C, 0x06, // 211:1947
-    0x07, 0xA7, 0x0C, 0x06, // 212:1959
-    0x07, 0xB3, 0x0C, 0x06, // 213:1971
-    0x07, 0xBF, 0x0C, 0x06, // 214:1983
-    0x07, 0xCB, 0x0C, 0x06, // 215:1995
-    0x07, 0xD7, 0x0C, 0x06, // 216:2007
-    0x07, 0xE3, 0x0C, 0x06, // 217:2019
-    0x07, 0xEF, 0x0C, 0x06, // 218:2031
-    0x07, 0xFB, 0x0C, 0x06, // 219:2043
-    0x08, 0x07, 0x0C, 0x06, // 220:2055
-    0x08, 0x13, 0x0B, 0x06, // 221:2067
-    0x08, 0x1E, 0x0B, 0x06, // 222:2078
-    0x08, 0x29, 0x0C, 0x06, // 223:2089
-    0x08, 0x35, 0x0C, 0x06, // 224:2101
-    0x08, 0x41, 0x0C, 0x06, // 225:2113
-    0x08, 0x4D, 0x0C, 0x06, // 226:2125
-    0x08, 0x59, 0x0C, 0x06, // 227:2137
-    0x08, 0x65, 0x0C, 0x06, // 228:2149
-    0x08, 0x71, 0x0C, 0x06, // 229:2161
-    0x08, 0x7D, 0x0C, 0x06, // 230:2173
-    0x08, 0x89, 0x0A, 0x06, // 231:2185
-    0x08, 0x93, 0x0C, 0x06, // 232:2195
-    0x08, 0x9F, 0x0C, 0x06, // 233:2207
-    0x08, 0xAB, 0x0C, 0x06, // 234:2219
-    0x08, 0xB7, 0x0C, 0x06, // 235:2231
-    0x08, 0xC3, 0x0C, 0x06, // 236:2243
-    0x08, 0xCF, 0x0C, 0x06, // 237:2255
-    0x08, 0xDB, 0x0C, 0x06, // 238:2267
-    0x08, 0xE7, 0x0C, 0x06, // 239:2279
-    0x08, 0xF3, 0x0C, 0x06, // 240:2291
-    0x08, 0xFF, 0x0C, 0x06, // 241:2303
-    0x09, 0x0B, 0x0C, 0x06, // 242:2315
-    0x09, 0x17, 0x0C, 0x06, // 243:2327
-    0x09, 0x23, 0x0C, 0x06, // 244:2339
-    0x09, 0x2F, 0x0C, 0x06, // 245:2351
-    0x09, 0x3B, 0x0C, 0x06, // 246:2363
-    0x09, 0x47, 0x09, 0x06, // 247:2375
-    0x09, 0x50, 0x0C, 0x06, // 248:2384
-    0x09, 0x5C, 0x0C, 0x06, // 249:2396
-    0x09, 0x68, 0x0C, 0x06, // 250:2408
-    0x09, 0x74, 0x0C, 0x06, // 251:2420
-    0x09, 0x80, 0x0C, 0x06, // 252:2432
-    0x09, 0x8C, 0x0B, 0x06, // 253:2444
-    0x09, 0x97, 0x0C, 0x06, // 254:2455
-    0x09, 0xA3, 0x0B, 0x06, // 255:2467
+    0xFF, 0xFF, 0x00, 0x06, // 33:65535
+    0xFF, 0xFF, 0x00, 0x06, // 34:65535
+    0xFF, 0xFF, 0x00, 0x06, // 35:65535
+    0xFF, 0xFF, 0x00, 0x06, // 36:65535
+    0xFF, 0xFF, 0x00, 0x06, // 37:65535
+    0xFF, 0xFF, 0x00, 0x06, // 38:65535
+    0xFF, 0xFF, 0x00, 0x06, // 39:65535
+    0xFF, 0xFF, 0x00, 0x06, // 40:65535
+    0xFF, 0xFF, 0x00, 0x06, // 41:65535
+    0xFF, 0xFF, 0x00, 0x06, // 42:65535
+    0xFF, 0xFF, 0x00, 0x06, // 43:65535
+    0xFF, 0xFF, 0x00, 0x06, // 44:65535
+    0xFF, 0xFF, 0x00, 0x06, // 45:65535
+    0xFF, 0xFF, 0x00, 0x06, // 46:65535
+    0x00, 0x00, 0x0B, 0x06, // 47:0
+    0x00, 0x0B, 0x0C, 0x06, // 48:11
+    0x00, 0x17, 0x0C, 0x06, // 49:23
+    0x00, 0x23, 0x0C, 0x06, // 50:35
+    0x00, 0x2F, 0x0C, 0x06, // 51:47
+    0x00, 0x3B, 0x0B, 0x06, // 52:59
+    0x00, 0x46, 0x0C, 0x06, // 53:70
+    0x00, 0x52, 0x0C, 0x06, // 54:82
+    0x00, 0x5E, 0x0B, 0x06, // 55:94
+    0x00, 0x69, 0x0C, 0x06, // 56:105
+    0x00, 0x75, 0x0C, 0x06, // 57:117
 
     // Font Data:
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02,                         // 33
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38,                   // 34
-    0x80, 0x00, 0xE0, 0x03, 0xB8, 0x00, 0xE0, 0x03, 0xB8, 0x00, 0x20,       // 35
-    0x00, 0x00, 0x60, 0x02, 0x50, 0x02, 0xF8, 0x07, 0x90, 0x02, 0x90, 0x01, // 36
-    0x38, 0x00, 0xA8, 0x00, 0x78, 0x00, 0xC0, 0x03, 0xA0, 0x02, 0x80, 0x03, // 37
-    0x00, 0x00, 0xC0, 0x01, 0x38, 0x02, 0x68, 0x02, 0x88, 0x01, 0xC0, 0x02, // 38
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,                               // 39
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x04, 0x04,                         // 40
-    0x00, 0x00, 0x00, 0x00, 0x0C, 0x06, 0xF0, 0x01,                         // 41
-    0x00, 0x00, 0x48, 0x00, 0x30, 0x00, 0x78, 0x00, 0x30, 0x00, 0x48,       // 42
-    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0xF0, 0x01, 0x40, 0x00, 0x40,       // 43
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,                                     // 44
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,                   // 45
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02,                                     // 46
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x08,       // 47
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x08, // 47
     0x00, 0x00, 0xF0, 0x01, 0x08, 0x02, 0x48, 0x02, 0x08, 0x02, 0xF0, 0x01, // 48
     0x00, 0x00, 0x08, 0x02, 0x08, 0x02, 0xF8, 0x03, 0x00, 0x02, 0x00, 0x02, // 49
     0x00, 0x00, 0x10, 0x02, 0x08, 0x03, 0x88, 0x02, 0xC8, 0x02, 0x70, 0x02, // 50
     0x00, 0x00, 0x10, 0x01, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0xB0, 0x01, // 51
-    0x00, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x90, 0x00, 0xF8, 0x03, 0x80,       // 52
+    0x00, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x90, 0x00, 0xF8, 0x03, 0x80, // 52
     0x00, 0x00, 0x38, 0x02, 0x28, 0x02, 0x28, 0x02, 0x28, 0x02, 0xC0, 0x01, // 53
     0x00, 0x00, 0xF0, 0x01, 0x58, 0x02, 0x48, 0x02, 0x48, 0x02, 0x88, 0x01, // 54
-    0x00, 0x00, 0x08, 0x00, 0x08, 0x02, 0x88, 0x01, 0x78, 0x00, 0x18,       // 55
+    0x00, 0x00, 0x08, 0x00, 0x08, 0x02, 0x88, 0x01, 0x78, 0x00, 0x18, // 55
     0x00, 0x00, 0xB0, 0x01, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0xB0, 0x01, // 56
-    0x00, 0x00, 0x30, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x03, 0xF0, 0x01, // 57
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x02,                                     // 58
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x0E,                                     // 59
-    0x00, 0x00, 0x40, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x10, 0x01, // 60
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,                   // 61
-    0x00, 0x00, 0x10, 0x01, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x40,       // 62
-    0x00, 0x00, 0x08, 0x00, 0xC8, 0x02, 0x28, 0x00, 0x18,                   // 63
-    0x00, 0x00, 0xE0, 0x03, 0x18, 0x04, 0xE8, 0x0B, 0x28, 0x0A, 0xF0, 0x03, // 64
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x98, 0x00, 0xE0, 0x00, 0x00, 0x03, // 65
-    0x00, 0x00, 0xF8, 0x03, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0xB0, 0x01, // 66
-    0x00, 0x00, 0xF0, 0x01, 0x18, 0x03, 0x08, 0x02, 0x08, 0x02, 0x18, 0x03, // 67
-    0x00, 0x00, 0xF8, 0x03, 0x08, 0x02, 0x08, 0x02, 0x18, 0x03, 0xF0, 0x01, // 68
-    0x00, 0x00, 0xF8, 0x03, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, // 69
-    0x00, 0x00, 0xF8, 0x03, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48,       // 70
-    0x00, 0x00, 0xF0, 0x01, 0x18, 0x03, 0x08, 0x02, 0x48, 0x02, 0xD0, 0x03, // 71
-    0x00, 0x00, 0xF8, 0x03, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0xF8, 0x03, // 72
-    0x00, 0x00, 0x08, 0x02, 0x08, 0x02, 0xF8, 0x03, 0x08, 0x02, 0x08, 0x02, // 73
-    0x00, 0x00, 0x00, 0x01, 0x08, 0x02, 0x08, 0x02, 0xF8, 0x01,             // 74
-    0x00, 0x00, 0xF8, 0x03, 0x40, 0x00, 0xA0, 0x00, 0x10, 0x01, 0x08, 0x02, // 75
-    0x00, 0x00, 0xF8, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, // 76
-    0x00, 0x00, 0xF8, 0x03, 0x30, 0x00, 0x40, 0x00, 0x30, 0x00, 0xF8, 0x03, // 77
-    0x00, 0x00, 0xF8, 0x03, 0x30, 0x00, 0x40, 0x00, 0x80, 0x01, 0xF8, 0x03, // 78
-    0x00, 0x00, 0xF0, 0x01, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0xF0, 0x01, // 79
-    0x00, 0x00, 0xF8, 0x03, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x30,       // 80
-    0x00, 0x00, 0xF0, 0x01, 0x08, 0x02, 0x08, 0x02, 0x08, 0x06, 0xF0, 0x05, // 81
-    0x00, 0x00, 0xF8, 0x03, 0x48, 0x00, 0x48, 0x00, 0xC8, 0x00, 0xB0, 0x01, // 82
-    0x00, 0x00, 0x30, 0x01, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x90, 0x01, // 83
-    0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x03, 0x08, 0x00, 0x08,       // 84
-    0x00, 0x00, 0xF8, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0xF8, 0x01, // 85
-    0x00, 0x00, 0x18, 0x00, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x18,       // 86
-    0x38, 0x00, 0xC0, 0x03, 0x70, 0x00, 0x70, 0x00, 0xC0, 0x03, 0x38,       // 87
-    0x00, 0x00, 0x08, 0x02, 0xB0, 0x01, 0x40, 0x00, 0xB0, 0x01, 0x08, 0x02, // 88
-    0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x30, 0x00, 0x08,       // 89
-    0x00, 0x00, 0x08, 0x02, 0x88, 0x03, 0x48, 0x02, 0x38, 0x02, 0x08, 0x02, // 90
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x04, 0x04,                         // 91
-    0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x04, // 92
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0xFC, 0x07,                         // 93
-    0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20,                   // 94
-    0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, // 95
-    0x00, 0x00, 0x04, 0x00, 0x08,                                           // 96
-    0x00, 0x00, 0x20, 0x03, 0xA0, 0x02, 0xA0, 0x02, 0xA0, 0x02, 0xC0, 0x03, // 97
-    0x00, 0x00, 0xFC, 0x03, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0xC0, 0x01, // 98
-    0x00, 0x00, 0xC0, 0x01, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02,             // 99
-    0x00, 0x00, 0xC0, 0x01, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0xFC, 0x03, // 100
-    0x00, 0x00, 0xC0, 0x01, 0xA0, 0x02, 0xA0, 0x02, 0xA0, 0x02, 0xC0, 0x02, // 101
-    0x00, 0x00, 0x20, 0x00, 0xF8, 0x03, 0x24, 0x00, 0x24,                   // 102
-    0x00, 0x00, 0xC0, 0x01, 0x20, 0x0A, 0x20, 0x0A, 0x20, 0x0A, 0xE0, 0x07, // 103
-    0x00, 0x00, 0xFC, 0x03, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0xC0, 0x03, // 104
-    0x00, 0x00, 0x00, 0x02, 0x20, 0x02, 0xE4, 0x03, 0x00, 0x02, 0x00, 0x02, // 105
-    0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xE4, 0x07,                         // 106
-    0x00, 0x00, 0xFC, 0x03, 0x80, 0x00, 0xC0, 0x00, 0x20, 0x01, 0x00, 0x02, // 107
-    0x04, 0x00, 0x04, 0x00, 0xFC, 0x01, 0x00, 0x02, 0x00, 0x02,             // 108
-    0x00, 0x00, 0xE0, 0x03, 0x20, 0x00, 0xE0, 0x03, 0x20, 0x00, 0xE0, 0x03, // 109
-    0x00, 0x00, 0xE0, 0x03, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0xC0, 0x03, // 110
-    0x00, 0x00, 0xC0, 0x01, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0xC0, 0x01, // 111
-    0x00, 0x00, 0xE0, 0x0F, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0xC0, 0x01, // 112
-    0x00, 0x00, 0xC0, 0x01, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0xE0, 0x0F, // 113
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x20, 0x00, 0x20, 0x00, 0x60,       // 114
-    0x00, 0x00, 0x40, 0x02, 0xA0, 0x02, 0xA0, 0x02, 0xA0, 0x02, 0xA0, 0x01, // 115
-    0x00, 0x00, 0x20, 0x00, 0xF8, 0x03, 0x20, 0x02, 0x20, 0x02,             // 116
-    0x00, 0x00, 0xE0, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0xE0, 0x03, // 117
-    0x00, 0x00, 0x20, 0x00, 0xC0, 0x01, 0x00, 0x02, 0xC0, 0x01, 0x20,       // 118
-    0x00, 0x00, 0x60, 0x00, 0x80, 0x03, 0x40, 0x00, 0x80, 0x03, 0x60,       // 119
-    0x00, 0x00, 0x20, 0x02, 0x60, 0x03, 0x80, 0x00, 0x60, 0x03, 0x20, 0x02, // 120
-    0x00, 0x00, 0x20, 0x08, 0xC0, 0x08, 0x00, 0x07, 0xC0, 0x00, 0x20,       // 121
-    0x00, 0x00, 0x20, 0x02, 0x20, 0x03, 0xA0, 0x02, 0x60, 0x02, 0x20, 0x02, // 122
-    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0xBC, 0x07, 0x04, 0x04,             // 123
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,                         // 124
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0xBC, 0x07, 0x40, 0x00, 0x40,       // 125
-    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x80, 0x00, 0x80,       // 126
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 127
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 128
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 129
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 130
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 131
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 132
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 133
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 134
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 135
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 136
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 137
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 138
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 139
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 140
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 141
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 142
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 143
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 144
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 145
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 146
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 147
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 148
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 149
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 150
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 151
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 152
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 153
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 154
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 155
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 156
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 157
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 158
-    0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, // 159
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0F,                         // 161
-    0x00, 0x00, 0xC0, 0x01, 0x20, 0x02, 0xF0, 0x0F, 0x20, 0x02,             // 162
-    0x00, 0x00, 0x40, 0x02, 0xF0, 0x03, 0x48, 0x02, 0x48, 0x02, 0x08, 0x02, // 163
-    0x00, 0x00, 0x10, 0x01, 0xE0, 0x00, 0xA0, 0x00, 0xE0, 0x00, 0x10, 0x01, // 164
-    0x00, 0x00, 0xA8, 0x00, 0xB0, 0x00, 0xC0, 0x03, 0xB0, 0x00, 0xA8,       // 165
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0F,                         // 166
-    0x00, 0x00, 0xD8, 0x04, 0xA8, 0x04, 0x68, 0x05, 0xC8, 0x06,             // 167
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,                   // 168
-    0xE0, 0x00, 0x18, 0x03, 0x68, 0x02, 0x98, 0x02, 0x98, 0x03, 0xE0,       // 169
-    0x00, 0x00, 0x78, 0x01, 0x58, 0x01, 0x58, 0x01, 0x78, 0x01,             // 170
-    0x00, 0x00, 0xC0, 0x00, 0x20, 0x01, 0xC0, 0x00, 0x20, 0x01,             // 171
-    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0xC0,       // 172
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,                   // 173
-    0xE0, 0x00, 0x18, 0x03, 0xF8, 0x02, 0x78, 0x02, 0xB8, 0x03, 0xE0,       // 174
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,                   // 175
-    0x00, 0x00, 0x38, 0x00, 0x28, 0x00, 0x38,                               // 176
-    0x00, 0x00, 0x40, 0x02, 0x40, 0x02, 0xF0, 0x03, 0x40, 0x02, 0x40, 0x02, // 177
-    0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x68, 0x00, 0x58,                   // 178
-    0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x58, 0x00, 0x68,                   // 179
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04,                               // 180
-    0x00, 0x00, 0xE0, 0x0F, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0xE0, 0x03, // 181
-    0x00, 0x00, 0x30, 0x00, 0x78, 0x00, 0xF8, 0x07, 0x08, 0x00, 0xF8, 0x07, // 182
-    0x00, 0x00, 0x00, 0x00, 0xC0,                                           // 183
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0C,                         // 184
-    0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x78, 0x00, 0x40,                   // 185
-    0x00, 0x00, 0x30, 0x01, 0x48, 0x01, 0x48, 0x01, 0x30, 0x01,             // 186
-    0x00, 0x00, 0x20, 0x01, 0xC0, 0x00, 0x20, 0x01, 0xC0,                   // 187
-    0x80, 0x00, 0xA4, 0x00, 0xFC, 0x06, 0x60, 0x06, 0x40, 0x0F, 0x00, 0x04, // 188
-    0x80, 0x00, 0xA4, 0x00, 0xFC, 0x00, 0x60, 0x09, 0x40, 0x0D, 0x00, 0x0B, // 189
-    0x80, 0x00, 0xA4, 0x00, 0xEC, 0x06, 0x74, 0x06, 0x40, 0x0F, 0x00, 0x04, // 190
-    0x00, 0x00, 0x00, 0x0C, 0x00, 0x0A, 0xA0, 0x09, 0x00, 0x08,             // 191
-    0x00, 0x00, 0x00, 0x03, 0xE1, 0x00, 0x9A, 0x00, 0xE0, 0x00, 0x00, 0x03, // 192
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x9A, 0x00, 0xE1, 0x00, 0x00, 0x03, // 193
-    0x00, 0x00, 0x00, 0x03, 0xE2, 0x00, 0x99, 0x00, 0xE2, 0x00, 0x00, 0x03, // 194
-    0x00, 0x00, 0x00, 0x03, 0xE3, 0x00, 0x9A, 0x00, 0xE1, 0x00, 0x00, 0x03, // 195
-    0x00, 0x00, 0x00, 0x03, 0xE2, 0x00, 0x98, 0x00, 0xE2, 0x00, 0x00, 0x03, // 196
-    0x00, 0x00, 0x00, 0x03, 0xE6, 0x00, 0x9A, 0x00, 0xE6, 0x00, 0x00, 0x03, // 197
-    0x00, 0x03, 0xE0, 0x00, 0x98, 0x00, 0xF8, 0x03, 0x48, 0x02, 0x48, 0x02, // 198
-    0x00, 0x00, 0xF0, 0x01, 0x18, 0x0B, 0x08, 0x0E, 0x08, 0x02, 0x18, 0x03, // 199
-    0x00, 0x00, 0xF8, 0x03, 0x49, 0x02, 0x4A, 0x02, 0x48, 0x02, 0x48, 0x02, // 200
-    0x00, 0x00, 0xF8, 0x03, 0x48, 0x02, 0x4A, 0x02, 0x49, 0x02, 0x48, 0x02, // 201
-    0x00, 0x00, 0xF8, 0x03, 0x4A, 0x02, 0x49, 0x02, 0x4A, 0x02, 0x48, 0x02, // 202
-    0x00, 0x00, 0xF8, 0x03, 0x4A, 0x02, 0x48, 0x02, 0x4A, 0x02, 0x48, 0x02, // 203
-    0x00, 0x00, 0x08, 0x02, 0x09, 0x02, 0xFA, 0x03, 0x08, 0x02, 0x08, 0x02, // 204
-    0x00, 0x00, 0x08, 0x02, 0x08, 0x02, 0xFA, 0x03, 0x09, 0x02, 0x08, 0x02, // 205
-    0x00, 0x00, 0x08, 0x02, 0x0A, 0x02, 0xF9, 0x03, 0x0A, 0x02, 0x08, 0x02, // 206
-    0x00, 0x00, 0x08, 0x02, 0x0A, 0x02, 0xF8, 0x03, 0x0A, 0x02, 0x08, 0x02, // 207
-    0x40, 0x00, 0xF8, 0x03, 0x48, 0x02, 0x08, 0x02, 0x18, 0x03, 0xF0, 0x01, // 208
-    0x00, 0x00, 0xF8, 0x03, 0x33, 0x00, 0x42, 0x00, 0x81, 0x01, 0xF8, 0x03, // 209
-    0x00, 0x00, 0xF0, 0x01, 0x09, 0x02, 0x0A, 0x02, 0x08, 0x02, 0xF0, 0x01, // 210
-    0x00, 0x00, 0xF0, 0x01, 0x08, 0x02, 0x0A, 0x02, 0x09, 0x02, 0xF0, 0x01, // 211
-    0x00, 0x00, 0xF0, 0x01, 0x0A, 0x02, 0x09, 0x02, 0x0A, 0x02, 0xF0, 0x01, // 212
-    0x00, 0x00, 0xF0, 0x01, 0x0B, 0x02, 0x0A, 0x02, 0x09, 0x02, 0xF0, 0x01, // 213
-    0x00, 0x00, 0xF0, 0x01, 0x0A, 0x02, 0x08, 0x02, 0x0A, 0x02, 0xF0, 0x01, // 214
-    0x00, 0x00, 0x20, 0x02, 0x40, 0x01, 0x80, 0x00, 0x40, 0x01, 0x20, 0x02, // 215
-    0x00, 0x02, 0xF0, 0x01, 0x88, 0x02, 0x48, 0x02, 0x28, 0x02, 0xF8, 0x01, // 216
-    0x00, 0x00, 0xF8, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x02, 0xF8, 0x01, // 217
-    0x00, 0x00, 0xF8, 0x01, 0x00, 0x02, 0x02, 0x02, 0x01, 0x02, 0xF8, 0x01, // 218
-    0x00, 0x00, 0xF8, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0xF8, 0x01, // 219
-    0x00, 0x00, 0xF8, 0x01, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0xF8, 0x01, // 220
-    0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0xC2, 0x03, 0x31, 0x00, 0x08,       // 221
-    0x00, 0x00, 0xF8, 0x03, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x60,       // 222
-    0x00, 0x00, 0xF8, 0x03, 0x04, 0x00, 0x74, 0x02, 0x98, 0x02, 0x80, 0x03, // 223
-    0x00, 0x00, 0x24, 0x03, 0xA8, 0x02, 0xA0, 0x02, 0xA0, 0x02, 0xC0, 0x03, // 224
-    0x00, 0x00, 0x20, 0x03, 0xA8, 0x02, 0xA4, 0x02, 0xA0, 0x02, 0xC0, 0x03, // 225
-    0x00, 0x00, 0x28, 0x03, 0xA4, 0x02, 0xA8, 0x02, 0xA0, 0x02, 0xC0, 0x03, // 226
-    0x00, 0x00, 0x28, 0x03, 0xA4, 0x02, 0xA8, 0x02, 0xA4, 0x02, 0xC0, 0x03, // 227
-    0x00, 0x00, 0x20, 0x03, 0xA4, 0x02, 0xA0, 0x02, 0xA4, 0x02, 0xC0, 0x03, // 228
-    0x00, 0x00, 0x20, 0x03, 0xAE, 0x02, 0xAA, 0x02, 0xAE, 0x02, 0xC0, 0x03, // 229
-    0x00, 0x00, 0xA0, 0x03, 0xA0, 0x02, 0xC0, 0x01, 0xA0, 0x02, 0xE0, 0x02, // 230
-    0x00, 0x00, 0xC0, 0x01, 0x20, 0x02, 0x20, 0x0A, 0x20, 0x0E,             // 231
-    0x00, 0x00, 0xC4, 0x01, 0xA8, 0x02, 0xA0, 0x02, 0xA0, 0x02, 0xC0, 0x02, // 232
-    0x00, 0x00, 0xC0, 0x01, 0xA8, 0x02, 0xA4, 0x02, 0xA0, 0x02, 0xC0, 0x02, // 233
-    0x00, 0x00, 0xC8, 0x01, 0xA4, 0x02, 0xA8, 0x02, 0xA0, 0x02, 0xC0, 0x02, // 234
-    0x00, 0x00, 0xC0, 0x01, 0xA4, 0x02, 0xA0, 0x02, 0xA4, 0x02, 0xC0, 0x02, // 235
-    0x00, 0x00, 0x04, 0x02, 0x28, 0x02, 0xE0, 0x03, 0x00, 0x02, 0x00, 0x02, // 236
-    0x00, 0x00, 0x00, 0x02, 0x28, 0x02, 0xE4, 0x03, 0x00, 0x02, 0x00, 0x02, // 237
-    0x00, 0x00, 0x08, 0x02, 0x24, 0x02, 0xE8, 0x03, 0x00, 0x02, 0x00, 0x02, // 238
-    0x00, 0x00, 0x00, 0x02, 0x24, 0x02, 0xE0, 0x03, 0x04, 0x02, 0x00, 0x02, // 239
-    0x00, 0x00, 0xC0, 0x01, 0x2C, 0x02, 0x28, 0x02, 0x38, 0x02, 0xE0, 0x01, // 240
-    0x00, 0x00, 0xE8, 0x03, 0x44, 0x00, 0x28, 0x00, 0x24, 0x00, 0xC0, 0x03, // 241
-    0x00, 0x00, 0xC4, 0x01, 0x28, 0x02, 0x20, 0x02, 0x20, 0x02, 0xC0, 0x01, // 242
-    0x00, 0x00, 0xC0, 0x01, 0x28, 0x02, 0x24, 0x02, 0x20, 0x02, 0xC0, 0x01, // 243
-    0x00, 0x00, 0xC0, 0x01, 0x28, 0x02, 0x24, 0x02, 0x28, 0x02, 0xC0, 0x01, // 244
-    0x00, 0x00, 0xC8, 0x01, 0x24, 0x02, 0x2C, 0x02, 0x28, 0x02, 0xC4, 0x01, // 245
-    0x00, 0x00, 0xC0, 0x01, 0x24, 0x02, 0x20, 0x02, 0x24, 0x02, 0xC0, 0x01, // 246
-    0x40, 0x00, 0x40, 0x00, 0x50, 0x01, 0x40, 0x00, 0x40,                   // 247
-    0x00, 0x00, 0xC0, 0x03, 0x20, 0x03, 0xA0, 0x02, 0x60, 0x02, 0xE0, 0x01, // 248
-    0x00, 0x00, 0xE4, 0x01, 0x08, 0x02, 0x00, 0x02, 0x00, 0x02, 0xE0, 0x03, // 249
-    0x00, 0x00, 0xE0, 0x01, 0x08, 0x02, 0x04, 0x02, 0x00, 0x02, 0xE0, 0x03, // 250
-    0x00, 0x00, 0xE0, 0x01, 0x08, 0x02, 0x04, 0x02, 0x08, 0x02, 0xE0, 0x03, // 251
-    0x00, 0x00, 0xE0, 0x01, 0x04, 0x02, 0x00, 0x02, 0x04, 0x02, 0xE0, 0x03, // 252
-    0x00, 0x00, 0x20, 0x08, 0xC8, 0x08, 0x04, 0x07, 0xC0, 0x00, 0x20,       // 253
-    0x00, 0x00, 0xFC, 0x0F, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0xC0, 0x01, // 254
-    0x00, 0x00, 0x20, 0x08, 0xC4, 0x08, 0x00, 0x07, 0xC4, 0x00, 0x20        // 255
+    0x00, 0x00, 0x30, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x03, 0xF0, 0x01 // 57
+};
+
+const uint8_t URW_Gothic_L_Book_20[] PROGMEM = {
+    0x17, // Width: 23
+    0x19, // Height: 25
+    0x20, // First Char: 32
+    0x5B, // Numbers of Chars: 91
+
+    // Jump Table:
+    0xFF, 0xFF, 0x00, 0x06, // 32:65535
+    0xFF, 0xFF, 0x00, 0x06, // 33:65535
+    0xFF, 0xFF, 0x00, 0x06, // 34:65535
+    0xFF, 0xFF, 0x00, 0x0B, // 35:65535
+    0xFF, 0xFF, 0x00, 0x0B, // 36:65535
+    0xFF, 0xFF, 0x00, 0x10, // 37:65535
+    0xFF, 0xFF, 0x00, 0x0F, // 38:65535
+    0xFF, 0xFF, 0x00, 0x04, // 39:65535
+    0xFF, 0xFF, 0x00, 0x07, // 40:65535
+    0xFF, 0xFF, 0x00, 0x07, // 41:65535
+    0xFF, 0xFF, 0x00, 0x09, // 42:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 43:65535
+    0xFF, 0xFF, 0x00, 0x06, // 44:65535
+    0x00, 0x00, 0x16, 0x07, // 45:0
+    0x00, 0x16, 0x0B, 0x06, // 46:22
+    0xFF, 0xFF, 0x00, 0x09, // 47:65535
+    0x00, 0x21, 0x27, 0x0B, // 48:33
+    0x00, 0x48, 0x1B, 0x0B, // 49:72
+    0x00, 0x63, 0x27, 0x0B, // 50:99
+    0x00, 0x8A, 0x27, 0x0B, // 51:138
+    0x00, 0xB1, 0x27, 0x0B, // 52:177
+    0x00, 0xD8, 0x27, 0x0B, // 53:216
+    0x00, 0xFF, 0x27, 0x0B, // 54:255
+    0x01, 0x26, 0x25, 0x0B, // 55:294
+    0x01, 0x4B, 0x27, 0x0B, // 56:331
+    0x01, 0x72, 0x26, 0x0B, // 57:370
+    0xFF, 0xFF, 0x00, 0x06, // 58:65535
+    0xFF, 0xFF, 0x00, 0x06, // 59:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 60:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 61:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 62:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 63:65535
+    0xFF, 0xFF, 0x00, 0x11, // 64:65535
+    0xFF, 0xFF, 0x00, 0x0F, // 65:65535
+    0x01, 0x98, 0x27, 0x0B, // 66:408
+    0xFF, 0xFF, 0x00, 0x10, // 67:65535
+    0x01, 0xBF, 0x36, 0x0F, // 68:447
+    0xFF, 0xFF, 0x00, 0x0B, // 69:65535
+    0xFF, 0xFF, 0x00, 0x0A, // 70:65535
+    0x01, 0xF5, 0x3E, 0x11, // 71:501
+    0x02, 0x33, 0x2F, 0x0E, // 72:563
+    0xFF, 0xFF, 0x00, 0x05, // 73:65535
+    0xFF, 0xFF, 0x00, 0x0A, // 74:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 75:65535
+    0xFF, 0xFF, 0x00, 0x09, // 76:65535
+    0xFF, 0xFF, 0x00, 0x12, // 77:65535
+    0xFF, 0xFF, 0x00, 0x0F, // 78:65535
+    0xFF, 0xFF, 0x00, 0x11, // 79:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 80:65535
+    0xFF, 0xFF, 0x00, 0x11, // 81:65535
+    0x02, 0x62, 0x2B, 0x0C, // 82:610
+    0xFF, 0xFF, 0x00, 0x0A, // 83:65535
+    0xFF, 0xFF, 0x00, 0x09, // 84:65535
+    0xFF, 0xFF, 0x00, 0x0D, // 85:65535
+    0x02, 0x8D, 0x35, 0x0E, // 86:653
+    0xFF, 0xFF, 0x00, 0x13, // 87:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 88:65535
+    0x02, 0xC2, 0x29, 0x0C, // 89:706
+    0xFF, 0xFF, 0x00, 0x0A, // 90:65535
+    0xFF, 0xFF, 0x00, 0x07, // 91:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 92:65535
+    0xFF, 0xFF, 0x00, 0x07, // 93:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 94:65535
+    0xFF, 0xFF, 0x00, 0x0A, // 95:65535
+    0xFF, 0xFF, 0x00, 0x08, // 96:65535
+    0x02, 0xEB, 0x2F, 0x0E, // 97:747
+    0x03, 0x1A, 0x2F, 0x0E, // 98:794
+    0x03, 0x49, 0x2B, 0x0D, // 99:841
+    0xFF, 0xFF, 0x00, 0x0E, // 100:65535
+    0x03, 0x74, 0x2F, 0x0D, // 101:884
+    0xFF, 0xFF, 0x00, 0x06, // 102:65535
+    0xFF, 0xFF, 0x00, 0x0D, // 103:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 104:65535
+    0xFF, 0xFF, 0x00, 0x04, // 105:65535
+    0xFF, 0xFF, 0x00, 0x04, // 106:65535
+    0xFF, 0xFF, 0x00, 0x0A, // 107:65535
+    0x03, 0xA3, 0x07, 0x04, // 108:931
+    0xFF, 0xFF, 0x00, 0x13, // 109:65535
+    0x03, 0xAA, 0x2B, 0x0C, // 110:938
+    0x03, 0xD5, 0x2F, 0x0D, // 111:981
+    0x04, 0x04, 0x2F, 0x0E, // 112:1028
+    0xFF, 0xFF, 0x00, 0x0E, // 113:65535
+    0xFF, 0xFF, 0x00, 0x06, // 114:65535
+    0x04, 0x33, 0x1B, 0x08, // 115:1075
+    0xFF, 0xFF, 0x00, 0x07, // 116:65535
+    0xFF, 0xFF, 0x00, 0x0C, // 117:65535
+    0xFF, 0xFF, 0x00, 0x0B, // 118:65535
+    0x04, 0x4E, 0x3E, 0x11, // 119:1102
+    0x04, 0x8C, 0x23, 0x0A, // 120:1164
+    0x04, 0xAF, 0x26, 0x0B, // 121:1199
+    0x04, 0xD5, 0x1F, 0x09, // 122:1237
+
+    // Font Data:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, // 45
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, // 46
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0xC0, 0x00, 0x06, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x20, 0x00, 0x08, 0x00, 0x20, 0x00, 0x08, 0x00, 0x20, 0x00, 0x08, 0x00, 0x60, 0x00, 0x0C, 0x00, 0xC0, 0x00, 0x06, 0x00, 0x80, 0xFF, 0x03, // 48
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, // 49
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0xC0, 0x03, 0x0E, 0x00, 0x60, 0x00, 0x0B, 0x00, 0x20, 0x80, 0x09, 0x00, 0x20, 0xC0, 0x08, 0x00, 0x20, 0x60, 0x08, 0x00, 0x20, 0x30, 0x08, 0x00, 0x40, 0x18, 0x08, 0x00, 0x80, 0x0F, 0x08, // 50
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x80, 0x81, 0x07, 0x00, 0xC0, 0x01, 0x0C, 0x00, 0x20, 0x00, 0x08, 0x00, 0x20, 0x08, 0x08, 0x00, 0x20, 0x18, 0x08, 0x00, 0x40, 0x1C, 0x08, 0x00, 0x80, 0x37, 0x04, 0x00, 0x00, 0xE0, 0x03, // 51
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x0C, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0xE0, 0x00, 0x01, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x01, // 52
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0xE0, 0x1F, 0x06, 0x00, 0xE0, 0x0C, 0x0C, 0x00, 0x20, 0x04, 0x08, 0x00, 0x20, 0x04, 0x08, 0x00, 0x20, 0x04, 0x08, 0x00, 0x20, 0x08, 0x04, 0x00, 0x20, 0x18, 0x06, 0x00, 0x00, 0xE0, 0x01, // 53
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x0E, 0x04, 0x00, 0x80, 0x07, 0x08, 0x00, 0xC0, 0x04, 0x08, 0x00, 0x60, 0x04, 0x08, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0xE0, 0x01, // 54
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x20, 0x00, 0x0E, 0x00, 0x20, 0x80, 0x03, 0x00, 0x20, 0xF0, 0x00, 0x00, 0x20, 0x3C, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x60, // 55
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x80, 0x37, 0x06, 0x00, 0x40, 0x1C, 0x0C, 0x00, 0x20, 0x08, 0x08, 0x00, 0x20, 0x08, 0x08, 0x00, 0x20, 0x08, 0x08, 0x00, 0x40, 0x1C, 0x0C, 0x00, 0x80, 0x37, 0x06, 0x00, 0x00, 0xE0, 0x03, // 56
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x20, 0x40, 0x0C, 0x00, 0x20, 0x40, 0x06, 0x00, 0x20, 0xC0, 0x03, 0x00, 0x40, 0xE0, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x1F, // 57
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x20, 0x10, 0x08, 0x00, 0x20, 0x10, 0x08, 0x00, 0x20, 0x10, 0x08, 0x00, 0x20, 0x10, 0x08, 0x00, 0x40, 0x18, 0x08, 0x00, 0x80, 0x2F, 0x04, 0x00, 0x00, 0xC0, 0x03, // 66
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x20, 0x00, 0x08, 0x00, 0x20, 0x00, 0x08, 0x00, 0x20, 0x00, 0x08, 0x00, 0x20, 0x00, 0x08, 0x00, 0x20, 0x00, 0x08, 0x00, 0x20, 0x00, 0x08, 0x00, 0x40, 0x00, 0x04, 0x00, 0x40, 0x00, 0x04, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x7C, // 68
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x80, 0x00, 0x02, 0x00, 0x40, 0x00, 0x04, 0x00, 0x40, 0x00, 0x04, 0x00, 0x20, 0x20, 0x08, 0x00, 0x20, 0x20, 0x08, 0x00, 0x20, 0x20, 0x08, 0x00, 0x20, 0x20, 0x08, 0x00, 0x20, 0x20, 0x08, 0x00, 0x60, 0x20, 0x0C, 0x00, 0x40, 0x20, 0x06, 0x00, 0x80, 0x21, 0x03, 0x00, 0x00, 0xE1, 0x01, 0x00, 0x00, 0xE0, // 71
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xE0, 0xFF, 0x0F, // 72
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x20, 0xE0, 0x00, 0x00, 0x20, 0xA0, 0x01, 0x00, 0x60, 0x30, 0x07, 0x00, 0xC0, 0x10, 0x0C, 0x00, 0x80, 0x0F, 0x08, // 82
+    0x20, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x20, // 86
+    0x20, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x20, // 89
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x00, 0xFE, 0x0F, // 97
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0xF0, 0x01, // 98
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x0C, 0x06, // 99
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x46, 0x0C, 0x00, 0x00, 0x42, 0x08, 0x00, 0x00, 0x42, 0x08, 0x00, 0x00, 0x42, 0x08, 0x00, 0x00, 0x46, 0x08, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00, 0x70, 0x01, // 101
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, // 108
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xF8, 0x0F, // 110
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0xF0, 0x01, // 111
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0xF0, 0x01, // 112
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x06, 0x00, 0x00, 0x26, 0x0C, 0x00, 0x00, 0x62, 0x08, 0x00, 0x00, 0x42, 0x08, 0x00, 0x00, 0xC2, 0x0C, 0x00, 0x00, 0x8C, 0x07, // 115
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0E, // 119
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x02, 0x08, // 120
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0xC1, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x06, // 121
+    0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x0E, 0x00, 0x00, 0x02, 0x0B, 0x00, 0x00, 0xC2, 0x09, 0x00, 0x00, 0x62, 0x08, 0x00, 0x00, 0x3A, 0x08, 0x00, 0x00, 0x0E, 0x08, 0x00, 0x00, 0x06, 0x08 // 122
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -7,7 +7,7 @@
 #include "slot.h"
 #include "src/WebSockets.h"
 #include "src/WebSocketsServer.h"
-#include "fonts.h"
+#include "OLEDMenuFonts.h"
 #include "OSDManager.h"
 
 typedef TV5725<GBS_ADDR> GBS;
@@ -44,7 +44,7 @@ bool resolutionMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OLEDMen
     display->setFont(ArialMT_Plain_16);
     display->setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT::TEXT_ALIGN_CENTER);
     display->drawString(OLED_MENU_WIDTH / 2, 16, item->str);
-    display->drawXbm((OLED_MENU_WIDTH - TEXT_LOADED_WIDTH) / 2, OLED_MENU_HEIGHT / 2, IMAGE_ITEM(TEXT_LOADED));
+    drawRleXbm(display, (OLED_MENU_WIDTH - TEXT_LOADED_WIDTH) / 2, OLED_MENU_HEIGHT / 2, IMAGE_ITEM(TEXT_LOADED));
     display->display();
     uint8_t videoMode = getVideoMode();
     PresetPreference preset = PresetPreference::Output1080P;
@@ -116,7 +116,7 @@ bool presetSelectionMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OL
     display->setFont(ArialMT_Plain_16);
     display->setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT::TEXT_ALIGN_CENTER);
     display->drawString(OLED_MENU_WIDTH / 2, 16, item->str);
-    display->drawXbm((OLED_MENU_WIDTH - TEXT_LOADED_WIDTH) / 2, OLED_MENU_HEIGHT / 2, IMAGE_ITEM(TEXT_LOADED));
+    drawRleXbm(display, (OLED_MENU_WIDTH - TEXT_LOADED_WIDTH) / 2, OLED_MENU_HEIGHT / 2, IMAGE_ITEM(TEXT_LOADED));
     display->display();
     uopt->presetSlot = 'A' + item->tag; // ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~()!*:,
     uopt->presetPreference = PresetPreference::OutputCustomized;
@@ -183,13 +183,13 @@ bool resetMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OLEDMenuNav,
     display->setColor(OLEDDISPLAY_COLOR::WHITE);
     switch (item->tag) {
         case MT_RESET_GBS:
-            display->drawXbm(CENTER_IMAGE(TEXT_RESETTING_GBS));
+            drawRleXbm(display, CENTER_IMAGE(TEXT_RESETTING_GBS));
             break;
         case MT_RESTORE_FACTORY:
-            display->drawXbm(CENTER_IMAGE(TEXT_RESTORING));
+            drawRleXbm(display, CENTER_IMAGE(TEXT_RESTORING));
             break;
         case MT_RESET_WIFI:
-            display->drawXbm(CENTER_IMAGE(TEXT_RESETTING_WIFI));
+            drawRleXbm(display, CENTER_IMAGE(TEXT_RESETTING_WIFI));
             break;
     }
     display->display();
@@ -234,7 +234,7 @@ bool currentSettingHandler(OLEDMenuManager *manager, OLEDMenuItem *, OLEDMenuNav
             return false;
         }
         display.setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT::TEXT_ALIGN_CENTER);
-        display.drawXbm(CENTER_IMAGE(TEXT_NO_INPUT));
+        drawRleXbm(&display, CENTER_IMAGE(TEXT_NO_INPUT));
     } else {
         // TODO translations
         boolean vsyncActive = 0;
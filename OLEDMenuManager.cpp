@@ -5,6 +5,14 @@
 #include "OLEDMenuManager.h"
 #include "OLEDMenuFonts.h"
 
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+// display() only sends the bounding box of the pixels changed since the last call,
+// so pushing each redrawn region on its own keeps e.g. the status bar and a
+// scrolling item from merging into one big box
+#define OLED_MENU_PUSH_PER_REGION 1
+#else
+#define OLED_MENU_PUSH_PER_REGION 0 // every display() sends the whole framebuffer
+#endif
 
 OLEDMenuManager::OLEDMenuManager(SSD1306Wire *display)
     : display(display)
@@ -149,18 +157,45 @@ void OLEDMenuManager::drawOneItem(OLEDMenuItem *item, uint16_t yOffset, bool neg
             this->display->drawString(wrappingOffset, yOffset, item->str);
         }
     } else {
-        this->display->drawXbm(curScrollOffset, yOffset, item->imageWidth, item->imageHeight, item->xbmImage);
+        drawRleXbm(this->display, curScrollOffset, yOffset, item->imageWidth, item->imageHeight, item->xbmImage);
         if (wrappingOffset < OLED_MENU_WIDTH) {
-            this->display->drawXbm(wrappingOffset, yOffset, item->imageWidth, item->imageHeight, item->xbmImage);
+            drawRleXbm(this->display, wrappingOffset, yOffset, item->imageWidth, item->imageHeight, item->xbmImage);
         }
     }
 }
+// Redraws only what changed since the last call: the status bar and the rows whose
+// selection changed when the cursor moves, scrolling rows on every refresh, and
+// nothing at all (no I2C traffic) when the menu is idle. Everything else (another
+// menu, another page, screen saver, item handlers) gets a full redraw.
 void OLEDMenuManager::drawSubItems(OLEDMenuItem *parent)
 {
-    display->clear();
-    drawStatusBar(itemUnderCursor == nullptr);
-    uint16_t yOffset = OLED_MENU_STATUS_BAR_HEIGHT;
     uint8_t targetPage = itemUnderCursor == nullptr ? 0 : itemUnderCursor->pageInParent;
+    bool full = fullRedraw || parent != drawnParent || targetPage != drawnPage;
+    bool cursorMoved = itemUnderCursor != drawnCursorItem;
+    bool pending = false;
+    auto regionDone = [this, full, &pending]() {
+        if (!full && OLED_MENU_PUSH_PER_REGION) {
+            display->display();
+        } else {
+            pending = true;
+        }
+    };
+    auto clearRegion = [this, full](int16_t y, int16_t height) {
+        if (!full) {
+            display->setColor(OLEDDISPLAY_COLOR::BLACK);
+            display->fillRect(0, y, OLED_MENU_WIDTH, height);
+        }
+    };
+
+    if (full) {
+        display->clear();
+    }
+    if (full || cursorMoved) {
+        clearRegion(0, OLED_MENU_STATUS_BAR_HEIGHT);
+        drawStatusBar(itemUnderCursor == nullptr);
+        regionDone();
+    }
+    uint16_t yOffset = OLED_MENU_STATUS_BAR_HEIGHT;
     for (int i = 0; i < parent->numSubItem; ++i) {
         OLEDMenuItem *subItem = parent->subItems[i];
 #if OLED_MENU_OVER_DRAW
@@ -169,7 +204,12 @@ void OLEDMenuManager::drawSubItems(OLEDMenuItem *parent)
         if (subItem->pageInParent == targetPage) {
 #endif
             bool negative = subItem == itemUnderCursor;
-            drawOneItem(subItem, yOffset, negative);
+            bool scrolls = subItem->imageWidth > OLED_MENU_WIDTH && (negative || subItem->alwaysScrolls);
+            if (full || scrolls || negative != (subItem == drawnCursorItem)) {
+                clearRegion(yOffset, subItem->imageHeight);
+                drawOneItem(subItem, yOffset, negative);
+                regionDone();
+            }
             yOffset += subItem->imageHeight;
             if (itemUnderCursor == parent->subItems[i]) {
                 cursor = i;
@@ -180,7 +220,13 @@ void OLEDMenuManager::drawSubItems(OLEDMenuItem *parent)
             }
         }
     }
-    display->display();
+    if (pending) {
+        display->display();
+    }
+    fullRedraw = false;
+    drawnParent = parent;
+    drawnPage = targetPage;
+    drawnCursorItem = itemUnderCursor;
 }
 
 void OLEDMenuManager::goBack(bool preserveCursor)
@@ -270,6 +316,7 @@ void OLEDMenuManager::resetScroll()
 void OLEDMenuManager::enterItem(OLEDMenuItem *item, OLEDMenuNav btn, bool isFirstTime)
 {
     bool willEnter = true;
+    fullRedraw = true; // handlers may draw or change the sub items
     if (this->state == OLEDMenuState::IDLE) {
         pushItem(item);
         this->state = OLEDMenuState::ITEM_HANDLING;
@@ -313,10 +360,10 @@ void OLEDMenuManager::drawStatusBar(bool negative)
     }
     if (peakItem() != rootItem) {
         // not on main menu, draw back button
-        this->display->drawXbm(0, 0, IMAGE_ITEM(OM_STATUS_BAR_BACK));
+        drawRleXbm(this->display, 0, 0, IMAGE_ITEM(OM_STATUS_BAR_BACK));
     } else {
         // main menu, draw some custom info
-        this->display->drawXbm(0, 0, IMAGE_ITEM(OM_STATUS_CUSTOM));
+        drawRleXbm(this->display, 0, 0, IMAGE_ITEM(OM_STATUS_CUSTOM));
     }
     static uint8_t totalItems = 0;
     uint8_t curIndex = 1;
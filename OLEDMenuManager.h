@@ -43,6 +43,11 @@ private:
     const uint8_t *font;
     char statusBarBuffer[16];
     bool disabled;
+    // what drawSubItems() pushed last, to redraw only the regions that changed
+    bool fullRedraw = true;
+    OLEDMenuItem *drawnParent = nullptr;
+    OLEDMenuItem *drawnCursorItem = nullptr;
+    uint8_t drawnPage = 0;
     friend void setup();
 
     void resetScroll();
@@ -91,8 +96,9 @@ private:
         display->setColor(OLEDDISPLAY_COLOR::WHITE);
         constexpr int16_t max_x = OLED_MENU_WIDTH - OM_SCREEN_SAVER_WIDTH;
         constexpr int16_t max_y = OLED_MENU_HEIGHT - OM_SCREEN_SAVER_HEIGHT;
-        display->drawXbm(rand() % max_x, rand() % max_y, IMAGE_ITEM(OM_SCREEN_SAVER));
+        drawRleXbm(display, rand() % max_x, rand() % max_y, IMAGE_ITEM(OM_SCREEN_SAVER));
         display->display();
+        fullRedraw = true;
     }
 
 public:
@@ -126,6 +132,7 @@ public:
         if (state == OLEDMenuState::FREEZING)
         {
             state = OLEDMenuState::ITEM_HANDLING;
+            fullRedraw = true; // the handler owned the screen
             delay(OLED_MENU_REFRESH_INTERVAL_IN_MS); // avoid retriggering current button
         }
     }
@@ -141,6 +148,12 @@ public:
     void enable()
     {
         this->disabled = false;
+        this->fullRedraw = true;
+    }
+    // call after drawing on the display outside of item handlers
+    void invalidate()
+    {
+        this->fullRedraw = true;
     }
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef OLED_MENU_RLE_H_
+#define OLED_MENU_RLE_H_
+#include "SSD1306Wire.h"
+
+// Draws a zero run length encoded XBM image (OLEDMenuTranslations.h, written by
+// generate_translations.py): 0x00, n stands for n zero bytes, any other byte is
+// one XBM byte. Same result as drawXbm() on the decoded image, in the current
+// color, but the data is decoded while drawing and empty runs are skipped whole,
+// so there is no buffer and less work than for the raw image.
+inline void drawRleXbm(OLEDDisplay *display, int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *rle)
+{
+    const uint16_t rowBytes = (width + 7) / 8;
+    const uint16_t total = rowBytes * height;
+    uint16_t index = 0; // in the decoded image
+    while (index < total) {
+        uint8_t data = pgm_read_byte(rle++);
+        if (data == 0) {
+            index += pgm_read_byte(rle++);
+            continue;
+        }
+        int16_t y = yMove + index / rowBytes;
+        int16_t x = (index % rowBytes) * 8;
+        for (; data && x < width; x++, data >>= 1) {
+            if (data & 0x01) {
+                display->setPixel(xMove + x, y);
+            }
+        }
+        index++;
+    }
+}
+#endif
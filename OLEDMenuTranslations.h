@@ -1,134 +1,116 @@
 #ifndef OLED_MENU_TRANSLATIONS_H_
 #define OLED_MENU_TRANSLATIONS_H_
+// generated by generate_translations.py, zero run length encoded, draw with drawRleXbm()
+#define OLED_MENU_TRANSLATIONS_RLE
 
 #define OM_STATUS_CUSTOM_WIDTH 59
 #define OM_STATUS_CUSTOM_HEIGHT 13
-const unsigned char OM_STATUS_CUSTOM [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x86,0x1,0x4,0xc0,0x30,0x0,0x0,0x0,0x86,0x1,0x0,0xc0,0x30,0x0,0x0,0x0,
-0x86,0x71,0xf4,0xc0,0x30,0x8e,0x47,0x4,0x4a,0xc9,0x94,0x41,0x29,0x99,0x4c,0x4,
-0x4a,0x81,0x14,0x41,0x29,0x91,0x48,0x4,0x4a,0xf1,0x14,0x41,0xa9,0x9f,0x48,0x4,
-0x32,0x89,0x14,0x41,0x26,0x81,0x48,0x4,0x32,0xcd,0x14,0x41,0x26,0x91,0x48,0x6,
-0x32,0xb9,0x14,0x41,0x26,0x8e,0x88,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char OM_STATUS_CUSTOM [] PROGMEM = { // 104 bytes raw
+0x0,0x10,0x86,0x1,0x4,0xc0,0x30,0x0,0x3,0x86,0x1,0x0,0x1,0xc0,0x30,0x0,
+0x3,0x86,0x71,0xf4,0xc0,0x30,0x8e,0x47,0x4,0x4a,0xc9,0x94,0x41,0x29,0x99,0x4c,
+0x4,0x4a,0x81,0x14,0x41,0x29,0x91,0x48,0x4,0x4a,0xf1,0x14,0x41,0xa9,0x9f,0x48,
+0x4,0x32,0x89,0x14,0x41,0x26,0x81,0x48,0x4,0x32,0xcd,0x14,0x41,0x26,0x91,0x48,
+0x6,0x32,0xb9,0x14,0x41,0x26,0x8e,0x88,0x5,0x0,0x10,
 
 };
 
 #define OM_STATUS_BAR_BACK_WIDTH 39
 #define OM_STATUS_BAR_BACK_HEIGHT 13
-const unsigned char OM_STATUS_BAR_BACK [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x3,0x0,0x4,0x0,
-0x20,0x6,0x0,0x4,0x0,0x20,0xc4,0xe1,0x24,0x0,0x20,0x22,0x93,0x15,0x4,0xe0,
-0x7,0x12,0x1c,0x6,0x20,0xc4,0x1b,0x1c,0x6,0x20,0x24,0x12,0x14,0x4,0x20,0x34,
-0x13,0x25,0x0,0xe0,0xe3,0xe2,0x64,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,
+const unsigned char OM_STATUS_BAR_BACK [] PROGMEM = { // 65 bytes raw
+0x0,0xb,0xe0,0x3,0x0,0x1,0x4,0x0,0x1,0x20,0x6,0x0,0x1,0x4,0x0,0x1,
+0x20,0xc4,0xe1,0x24,0x0,0x1,0x20,0x22,0x93,0x15,0x4,0xe0,0x7,0x12,0x1c,0x6,
+0x20,0xc4,0x1b,0x1c,0x6,0x20,0x24,0x12,0x14,0x4,0x20,0x34,0x13,0x25,0x0,0x1,
+0xe0,0xe3,0xe2,0x64,0x0,0xa,
 
 };
 
 #define OM_SCREEN_SAVER_WIDTH 78
 #define OM_SCREEN_SAVER_HEIGHT 15
-const unsigned char OM_SCREEN_SAVER [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0x30,0x0,0x0,0x84,0x0,0x0,0x42,0x0,
-0x0,0x0,0x30,0x0,0x0,0x44,0x0,0x0,0x42,0xce,0x71,0x1c,0x38,0x3c,0x21,0x24,
-0x38,0x21,0x42,0x22,0x93,0x24,0x48,0x64,0x12,0x34,0x64,0x12,0x3e,0x22,0x12,0x4,
-0x48,0x44,0x12,0x3c,0x44,0x12,0x2,0xf2,0xe3,0x38,0xfc,0x44,0x12,0x2c,0x7e,0x12,
-0x2,0x22,0x80,0x20,0x84,0x44,0xc,0x44,0x4,0xc,0x2,0x22,0x92,0x24,0x84,0x44,
-0xc,0xc4,0x44,0xc,0x2,0xc2,0xf1,0x3c,0x2,0x45,0xc,0x84,0x39,0xc,0x0,0x0,
-0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,
-0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char OM_SCREEN_SAVER [] PROGMEM = { // 150 bytes raw
+0x0,0x14,0x3e,0x0,0x3,0x30,0x0,0x2,0x84,0x0,0x2,0x42,0x0,0x3,0x30,0x0,
+0x2,0x44,0x0,0x2,0x42,0xce,0x71,0x1c,0x38,0x3c,0x21,0x24,0x38,0x21,0x42,0x22,
+0x93,0x24,0x48,0x64,0x12,0x34,0x64,0x12,0x3e,0x22,0x12,0x4,0x48,0x44,0x12,0x3c,
+0x44,0x12,0x2,0xf2,0xe3,0x38,0xfc,0x44,0x12,0x2c,0x7e,0x12,0x2,0x22,0x80,0x20,
+0x84,0x44,0xc,0x44,0x4,0xc,0x2,0x22,0x92,0x24,0x84,0x44,0xc,0xc4,0x44,0xc,
+0x2,0xc2,0xf1,0x3c,0x2,0x45,0xc,0x84,0x39,0xc,0x0,0x6,0x4,0x0,0x2,0x4,
+0x0,0x6,0x6,0x0,0x2,0x6,0x0,0x14,
 
 };
 
 #define OM_RESOLUTION_WIDTH 63
 #define OM_RESOLUTION_HEIGHT 13
-const unsigned char OM_RESOLUTION [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x7e,0x0,0x0,0x20,0x40,0x4,0x0,0x0,0xc2,0x0,0x0,0x20,0x40,0x0,0x0,0x0,
-0x82,0x38,0x87,0x23,0xf1,0xe4,0x78,0x1c,0xc2,0x64,0x49,0x26,0x51,0x94,0xc9,0x24,
-0x7e,0x44,0x41,0x24,0x51,0x14,0x89,0x4,0x22,0x7e,0x6e,0x24,0x51,0x1c,0x89,0x38,
-0x42,0x4,0x48,0x24,0x51,0x14,0x89,0x20,0xc2,0x44,0x49,0x26,0x59,0x94,0x89,0x24,
-0x82,0x38,0x8f,0x23,0xd6,0xe4,0x88,0x3c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char OM_RESOLUTION [] PROGMEM = { // 104 bytes raw
+0x0,0x10,0x7e,0x0,0x2,0x20,0x40,0x4,0x0,0x2,0xc2,0x0,0x2,0x20,0x40,0x0,
+0x3,0x82,0x38,0x87,0x23,0xf1,0xe4,0x78,0x1c,0xc2,0x64,0x49,0x26,0x51,0x94,0xc9,
+0x24,0x7e,0x44,0x41,0x24,0x51,0x14,0x89,0x4,0x22,0x7e,0x6e,0x24,0x51,0x1c,0x89,
+0x38,0x42,0x4,0x48,0x24,0x51,0x14,0x89,0x20,0xc2,0x44,0x49,0x26,0x59,0x94,0x89,
+0x24,0x82,0x38,0x8f,0x23,0xd6,0xe4,0x88,0x3c,0x0,0x10,
 
 };
 
 #define OM_PASSTHROUGH_WIDTH 67
 #define OM_PASSTHROUGH_HEIGHT 15
-const unsigned char OM_PASSTHROUGH [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x3e,0x0,0x0,0x90,0x0,0x0,0x0,0x40,0x0,0x42,0x0,0x0,0x90,0x0,
-0x0,0x0,0x40,0x0,0x42,0x1c,0xc7,0xb9,0xc7,0x39,0x11,0xcb,0x3,0x42,0x32,0x49,
+const unsigned char OM_PASSTHROUGH [] PROGMEM = { // 135 bytes raw
+0x0,0x12,0x3e,0x0,0x2,0x90,0x0,0x3,0x40,0x0,0x1,0x42,0x0,0x2,0x90,0x0,
+0x3,0x40,0x0,0x1,0x42,0x1c,0xc7,0xb9,0xc7,0x39,0x11,0xcb,0x3,0x42,0x32,0x49,
 0x92,0x4c,0x64,0x91,0x4c,0x6,0x3e,0x20,0x41,0x90,0x48,0x44,0x91,0x48,0x4,0x2,
 0x3c,0x8e,0x93,0x48,0x46,0x51,0x48,0x4,0x2,0x22,0x8,0x92,0x48,0x44,0x91,0x48,
 0x4,0x2,0x33,0x49,0x92,0x48,0x64,0x99,0x4c,0x4,0x2,0x2e,0xcf,0xb3,0x48,0x38,
-0x16,0x4f,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x80,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x16,0x4f,0x4,0x0,0x7,0xc,0x0,0x7,0x80,0x7,0x0,0x13,
 
 };
 
 #define OM_DOWNSCALE_WIDTH 65
 #define OM_DOWNSCALE_HEIGHT 13
-const unsigned char OM_DOWNSCALE [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x3e,0x0,0x0,0x0,0xe0,0x1,0x0,0x1,0x0,0x42,0x0,0x0,0x0,0x10,
-0x3,0x0,0x1,0x0,0xc2,0xb8,0x48,0x1e,0x10,0xe2,0x38,0x71,0x0,0x82,0xe4,0x4c,
-0x32,0x30,0x90,0x65,0xc9,0x0,0x82,0x44,0x4d,0x22,0xc0,0x11,0x40,0x89,0x0,0x82,
-0x46,0x55,0xa2,0x7,0x1a,0x78,0xfd,0x0,0xc2,0x44,0x35,0x22,0x10,0x12,0x44,0x9,
-0x0,0x42,0x64,0x32,0x22,0x10,0x12,0x67,0x89,0x0,0x3e,0x38,0x32,0x22,0xe0,0xe1,
-0x5c,0x71,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,
+const unsigned char OM_DOWNSCALE [] PROGMEM = { // 117 bytes raw
+0x0,0x12,0x3e,0x0,0x3,0xe0,0x1,0x0,0x1,0x1,0x0,0x1,0x42,0x0,0x3,0x10,
+0x3,0x0,0x1,0x1,0x0,0x1,0xc2,0xb8,0x48,0x1e,0x10,0xe2,0x38,0x71,0x0,0x1,
+0x82,0xe4,0x4c,0x32,0x30,0x90,0x65,0xc9,0x0,0x1,0x82,0x44,0x4d,0x22,0xc0,0x11,
+0x40,0x89,0x0,0x1,0x82,0x46,0x55,0xa2,0x7,0x1a,0x78,0xfd,0x0,0x1,0xc2,0x44,
+0x35,0x22,0x10,0x12,0x44,0x9,0x0,0x1,0x42,0x64,0x32,0x22,0x10,0x12,0x67,0x89,
+0x0,0x1,0x3e,0x38,0x32,0x22,0xe0,0xe1,0x5c,0x71,0x0,0x13,
 
 };
 
 #define OM_PRESET_WIDTH 41
 #define OM_PRESET_HEIGHT 13
-const unsigned char OM_PRESET [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,
-0x1,0x0,0x42,0x0,0x0,0x0,0x1,0x0,0x42,0xce,0x71,0xb8,0x73,0x0,0x42,0x22,
-0x93,0x64,0x91,0x0,0x3e,0x22,0x12,0x44,0x11,0x0,0x2,0xf2,0xe3,0x7e,0xe1,0x0,
-0x2,0x22,0x80,0x4,0x81,0x0,0x2,0x22,0x92,0x44,0x91,0x0,0x2,0xc2,0xf1,0x38,
-0xf3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char OM_PRESET [] PROGMEM = { // 78 bytes raw
+0x0,0xc,0x3e,0x0,0x3,0x1,0x0,0x1,0x42,0x0,0x3,0x1,0x0,0x1,0x42,0xce,
+0x71,0xb8,0x73,0x0,0x1,0x42,0x22,0x93,0x64,0x91,0x0,0x1,0x3e,0x22,0x12,0x44,
+0x11,0x0,0x1,0x2,0xf2,0xe3,0x7e,0xe1,0x0,0x1,0x2,0x22,0x80,0x4,0x81,0x0,
+0x1,0x2,0x22,0x92,0x44,0x91,0x0,0x1,0x2,0xc2,0xf1,0x38,0xf3,0x0,0xd,
 
 };
 
 #define OM_RESET_RESTORE_WIDTH 77
 #define OM_RESET_RESTORE_HEIGHT 13
-const unsigned char OM_RESET_RESTORE [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x7e,0x0,0x0,0x20,0xf2,0x3,0x0,0x2,0x0,0x0,0xc2,0x0,
-0x0,0x20,0x12,0x6,0x0,0x2,0x0,0x0,0x82,0x38,0x87,0x73,0x12,0xe4,0x38,0xe7,
+const unsigned char OM_RESET_RESTORE [] PROGMEM = { // 130 bytes raw
+0x0,0x14,0x7e,0x0,0x2,0x20,0xf2,0x3,0x0,0x1,0x2,0x0,0x2,0xc2,0x0,0x2,
+0x20,0x12,0x6,0x0,0x1,0x2,0x0,0x2,0x82,0x38,0x87,0x73,0x12,0xe4,0x38,0xe7,
 0x38,0x7,0xc2,0x64,0x49,0x26,0x10,0x96,0x49,0x92,0x89,0xc,0x7e,0x44,0x41,0x24,
 0xf1,0x13,0x9,0x12,0x89,0x8,0x22,0x7e,0xee,0x27,0x11,0xf9,0x71,0x1a,0xc9,0xf,
-0x42,0x4,0x48,0x20,0x11,0x12,0x40,0x12,0x89,0x0,0xc2,0x44,0x49,0xa4,0x10,0x16,
-0x49,0x92,0x89,0x8,0x82,0x38,0x8f,0xe3,0x10,0xe4,0x78,0xe6,0x8,0x7,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,
+0x42,0x4,0x48,0x20,0x11,0x12,0x40,0x12,0x89,0x0,0x1,0xc2,0x44,0x49,0xa4,0x10,
+0x16,0x49,0x92,0x89,0x8,0x82,0x38,0x8f,0xe3,0x10,0xe4,0x78,0xe6,0x8,0x7,0x0,
+0x14,
 
 };
 
 #define OM_RESET_GBS_WIDTH 60
 #define OM_RESET_GBS_HEIGHT 13
-const unsigned char OM_RESET_GBS [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x7e,0x0,0x0,0x20,0xc0,0xe3,0xc3,0x3,0xc2,0x0,0x0,0x20,0x20,0x24,0x26,0x6,
-0x82,0x38,0x87,0x73,0x10,0x20,0x24,0x4,0xc2,0x64,0x49,0x26,0x10,0x20,0x62,0x0,
-0x7e,0x44,0x41,0x24,0x10,0xef,0x87,0x3,0x22,0x7e,0xee,0x27,0x10,0x2c,0x4,0x4,
-0x42,0x4,0x48,0x20,0x10,0x2c,0x24,0x4,0xc2,0x44,0x49,0x24,0x20,0x24,0x24,0x4,
-0x82,0x38,0x8f,0x63,0xc0,0xe3,0xc3,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char OM_RESET_GBS [] PROGMEM = { // 104 bytes raw
+0x0,0x10,0x7e,0x0,0x2,0x20,0xc0,0xe3,0xc3,0x3,0xc2,0x0,0x2,0x20,0x20,0x24,
+0x26,0x6,0x82,0x38,0x87,0x73,0x10,0x20,0x24,0x4,0xc2,0x64,0x49,0x26,0x10,0x20,
+0x62,0x0,0x1,0x7e,0x44,0x41,0x24,0x10,0xef,0x87,0x3,0x22,0x7e,0xee,0x27,0x10,
+0x2c,0x4,0x4,0x42,0x4,0x48,0x20,0x10,0x2c,0x24,0x4,0xc2,0x44,0x49,0x24,0x20,
+0x24,0x24,0x4,0x82,0x38,0x8f,0x63,0xc0,0xe3,0xc3,0x3,0x0,0x10,
 
 };
 
 #define OM_RESET_WIFI_WIDTH 126
 #define OM_RESET_WIFI_HEIGHT 13
-const unsigned char OM_RESET_WIFI [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x38,0x4,0x0,0x0,0x61,0x94,0x5f,0xc0,0x1,0x0,0x0,0x0,0x40,0x2,0x0,0x0,
-0xc4,0x4,0x0,0x0,0x62,0x84,0x0,0x20,0x6,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+const unsigned char OM_RESET_WIFI [] PROGMEM = { // 208 bytes raw
+0x0,0x20,0x38,0x4,0x0,0x2,0x61,0x94,0x5f,0xc0,0x1,0x0,0x3,0x40,0x2,0x0,
+0x2,0xc4,0x4,0x0,0x2,0x62,0x84,0x0,0x1,0x20,0x6,0x0,0x3,0x40,0x0,0x3,
 0x82,0xe4,0x70,0x1c,0x52,0x96,0x40,0x10,0xc4,0xf1,0x3c,0x1c,0xee,0xe2,0x3c,0xe,
 0x2,0x94,0xc9,0x4,0x52,0x92,0x40,0x10,0x20,0x93,0x65,0x32,0x59,0x92,0x65,0x12,
 0x2,0x14,0x81,0x4,0xd2,0x92,0x4f,0x10,0x20,0x12,0x45,0x22,0x41,0x12,0x45,0x2,
@@ -136,459 +118,301 @@ const unsigned char OM_RESET_WIFI [] PROGMEM = {
 0x82,0x14,0x88,0x4,0x8c,0x91,0x40,0x10,0x24,0x12,0x45,0x2,0x41,0x12,0x45,0x10,
 0xc6,0x14,0xcd,0x4,0x8c,0x91,0x40,0x30,0x26,0x13,0x45,0x22,0x51,0x92,0x45,0x12,
 0x38,0xe4,0xb8,0x4,0xc,0x91,0x40,0xc0,0xc1,0x11,0x45,0x1c,0xce,0xe2,0x44,0x1e,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x20,
 
 };
 
 #define OM_RESTORE_FACTORY_WIDTH 85
 #define OM_RESTORE_FACTORY_HEIGHT 15
-const unsigned char OM_RESTORE_FACTORY [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x7e,0x0,0x40,0x0,0x0,0xc0,0xf,0x0,0x4,0x0,
-0x0,0xc2,0x0,0x40,0x0,0x0,0x40,0x0,0x0,0x4,0x0,0x0,0x82,0x38,0xe7,0x38,
-0xe7,0x40,0x80,0xe3,0x8e,0xf3,0x10,0xc2,0x64,0x49,0x64,0x91,0x41,0x40,0x96,0x45,
-0x16,0x9,0x7e,0x44,0x41,0x44,0x11,0xc1,0x7,0x14,0x44,0x14,0x9,0x22,0x7e,0x4e,
-0x46,0xf9,0x41,0x80,0x1f,0x64,0x14,0x9,0x42,0x4,0x48,0x44,0x11,0x40,0x40,0x14,
-0x44,0x14,0x6,0xc2,0x44,0x49,0x64,0x11,0x41,0x60,0x16,0x45,0x16,0x6,0x82,0x38,
-0xcf,0x38,0xe1,0x40,0xc0,0xe5,0x8c,0x13,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,
+const unsigned char OM_RESTORE_FACTORY [] PROGMEM = { // 165 bytes raw
+0x0,0x16,0x7e,0x0,0x1,0x40,0x0,0x2,0xc0,0xf,0x0,0x1,0x4,0x0,0x2,0xc2,
+0x0,0x1,0x40,0x0,0x2,0x40,0x0,0x2,0x4,0x0,0x2,0x82,0x38,0xe7,0x38,0xe7,
+0x40,0x80,0xe3,0x8e,0xf3,0x10,0xc2,0x64,0x49,0x64,0x91,0x41,0x40,0x96,0x45,0x16,
+0x9,0x7e,0x44,0x41,0x44,0x11,0xc1,0x7,0x14,0x44,0x14,0x9,0x22,0x7e,0x4e,0x46,
+0xf9,0x41,0x80,0x1f,0x64,0x14,0x9,0x42,0x4,0x48,0x44,0x11,0x40,0x40,0x14,0x44,
+0x14,0x6,0xc2,0x44,0x49,0x64,0x11,0x41,0x60,0x16,0x45,0x16,0x6,0x82,0x38,0xcf,
+0x38,0xe1,0x40,0xc0,0xe5,0x8c,0x13,0x6,0x0,0xa,0x2,0x0,0xa,0x3,0x0,0x16,
 
 };
 
 #define OM_CURRENT_WIDTH 80
 #define OM_CURRENT_HEIGHT 15
-const unsigned char OM_CURRENT [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x40,0xc0,0x3,0x10,0x0,0x20,0xc4,0x0,
-0x0,0x0,0x40,0x20,0x6,0x10,0x0,0x20,0x82,0x44,0x77,0x8e,0xe7,0x10,0x44,0x3c,
-0x4f,0x74,0x2,0x44,0x11,0x99,0x4c,0x10,0x48,0x14,0x59,0x24,0x2,0x44,0x11,0x91,
-0x48,0x10,0x48,0x14,0x51,0x24,0x2,0x44,0x91,0x9f,0x48,0x10,0x4c,0x14,0x51,0x24,
-0x82,0x44,0x11,0x81,0x48,0x10,0x44,0x14,0x51,0x24,0xc6,0x64,0x11,0x91,0x48,0x20,
-0x46,0x16,0x59,0x26,0x38,0x58,0x11,0x8e,0xc8,0xc0,0x83,0x35,0x8f,0x65,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char OM_CURRENT [] PROGMEM = { // 150 bytes raw
+0x0,0x14,0x38,0x0,0x3,0x40,0xc0,0x3,0x10,0x0,0x1,0x20,0xc4,0x0,0x3,0x40,
+0x20,0x6,0x10,0x0,0x1,0x20,0x82,0x44,0x77,0x8e,0xe7,0x10,0x44,0x3c,0x4f,0x74,
+0x2,0x44,0x11,0x99,0x4c,0x10,0x48,0x14,0x59,0x24,0x2,0x44,0x11,0x91,0x48,0x10,
+0x48,0x14,0x51,0x24,0x2,0x44,0x91,0x9f,0x48,0x10,0x4c,0x14,0x51,0x24,0x82,0x44,
+0x11,0x81,0x48,0x10,0x44,0x14,0x51,0x24,0xc6,0x64,0x11,0x91,0x48,0x20,0x46,0x16,
+0x59,0x26,0x38,0x58,0x11,0x8e,0xc8,0xc0,0x83,0x35,0x8f,0x65,0x0,0x8,0x1,0x0,
+0x9,0x1,0x0,0x15,
 
 };
 
 #define OM_WIFI_WIDTH 48
 #define OM_WIFI_HEIGHT 13
-const unsigned char OM_WIFI [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x61,0x94,0x5f,0x10,
-0xc0,0x1,0x62,0x84,0x0,0x10,0x40,0x0,0x52,0x96,0x40,0x10,0xef,0x38,0x52,0x92,
-0x40,0x10,0x59,0x64,0xd2,0x92,0x4f,0x10,0x51,0x44,0x94,0x92,0x40,0x10,0x51,0x46,
-0x8c,0x91,0x40,0x10,0x51,0x44,0x8c,0x91,0x40,0x10,0x51,0x64,0xc,0x91,0x40,0x10,
-0x51,0x38,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char OM_WIFI [] PROGMEM = { // 78 bytes raw
+0x0,0xc,0x61,0x94,0x5f,0x10,0xc0,0x1,0x62,0x84,0x0,0x1,0x10,0x40,0x0,0x1,
+0x52,0x96,0x40,0x10,0xef,0x38,0x52,0x92,0x40,0x10,0x59,0x64,0xd2,0x92,0x4f,0x10,
+0x51,0x44,0x94,0x92,0x40,0x10,0x51,0x46,0x8c,0x91,0x40,0x10,0x51,0x44,0x8c,0x91,
+0x40,0x10,0x51,0x64,0xc,0x91,0x40,0x10,0x51,0x38,0x0,0xc,
 
 };
 
 #define TEXT_NO_PRESETS_WIDTH 288
 #define TEXT_NO_PRESETS_HEIGHT 13
-const unsigned char TEXT_NO_PRESETS [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x82,0x0,0xf0,0x1,0x0,0x0,0x8,0x0,
-0xf8,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x24,0x0,0x20,0x8c,0x80,0x0,0x82,0x4,
-0x2,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x3c,0x0,0x4,0x86,0x0,0x10,0x2,
-0x0,0x0,0x8,0x0,0x8,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x24,0x0,0x40,0x8c,
-0x80,0x0,0x82,0x4,0x2,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x4,0x0,0x4,
-0x8a,0x38,0x10,0x72,0xce,0xe1,0xdc,0x1,0x8,0x89,0xe3,0x38,0x1c,0x88,0x1c,0xe,
-0xee,0xe1,0x40,0xca,0x9c,0x7,0x82,0x4,0xe7,0x80,0x73,0xe,0x77,0x1c,0x70,0x1e,
-0xe,0x2e,0x77,0xe,0x8a,0x64,0x10,0x12,0x59,0x92,0x49,0x2,0x8,0x49,0x96,0x49,
-0x32,0x88,0x24,0x19,0x24,0x93,0x41,0x4a,0xb2,0xc,0x82,0x4,0x92,0x41,0x16,0x99,
-0x2c,0x32,0xc8,0x32,0x19,0x24,0x91,0x4,0x92,0x44,0xf0,0x11,0x51,0x10,0x49,0x0,
-0xf8,0x48,0x4,0x9,0x22,0x88,0x4,0x11,0x24,0x12,0x41,0x5a,0xa2,0x8,0x82,0x4,
-0x12,0x41,0x10,0x11,0x28,0x22,0x88,0x22,0x11,0x24,0x11,0x4,0x92,0x46,0x10,0x90,
-0x9f,0xfb,0x89,0x3,0x8,0xe8,0xe7,0x71,0x3f,0x88,0xb8,0x1f,0x24,0xfa,0x81,0x52,
-0xbf,0x8,0x82,0x4,0x1a,0x61,0x90,0x1f,0x2f,0x3f,0x8c,0xa2,0x1f,0x24,0xe1,0x4,
-0xa2,0x44,0x10,0x10,0x1,0x12,0x8,0x2,0x8,0x48,0x10,0x41,0x2,0x88,0x20,0x1,
-0x24,0x12,0x80,0x31,0x82,0x8,0xc2,0x4,0x12,0x41,0x10,0x81,0x28,0x2,0x88,0x22,
-0x1,0x24,0x81,0x4,0xc2,0x64,0x10,0x10,0x51,0x12,0x49,0x2,0x8,0x48,0x9c,0x49,
-0x22,0xc8,0x24,0x11,0x24,0x12,0x81,0x31,0xa2,0xc,0x46,0x4,0x92,0x41,0x14,0xd1,
-0x2c,0x22,0xc8,0x22,0x11,0x24,0x91,0x4,0xc2,0x38,0x10,0x10,0xce,0xe3,0xd8,0x13,
-0x8,0x88,0x73,0x79,0x1c,0xb0,0x3c,0xe,0x2c,0xe2,0x80,0x21,0x9c,0x7,0x3c,0x4,
-0xe6,0x80,0x13,0x8e,0x6b,0x1c,0x70,0x22,0xe,0x24,0xf1,0x2c,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,
+const unsigned char TEXT_NO_PRESETS [] PROGMEM = { // 468 bytes raw
+0x0,0x48,0x82,0x0,0x1,0xf0,0x1,0x0,0x2,0x8,0x0,0x1,0xf8,0x8,0x0,0x6,
+0x24,0x0,0x1,0x20,0x8c,0x80,0x0,0x1,0x82,0x4,0x2,0x0,0x3,0x20,0x0,0x4,
+0x3c,0x0,0x1,0x4,0x86,0x0,0x1,0x10,0x2,0x0,0x2,0x8,0x0,0x1,0x8,0x9,
+0x0,0x6,0x24,0x0,0x1,0x40,0x8c,0x80,0x0,0x1,0x82,0x4,0x2,0x0,0x3,0x20,
+0x0,0x4,0x4,0x0,0x1,0x4,0x8a,0x38,0x10,0x72,0xce,0xe1,0xdc,0x1,0x8,0x89,
+0xe3,0x38,0x1c,0x88,0x1c,0xe,0xee,0xe1,0x40,0xca,0x9c,0x7,0x82,0x4,0xe7,0x80,
+0x73,0xe,0x77,0x1c,0x70,0x1e,0xe,0x2e,0x77,0xe,0x8a,0x64,0x10,0x12,0x59,0x92,
+0x49,0x2,0x8,0x49,0x96,0x49,0x32,0x88,0x24,0x19,0x24,0x93,0x41,0x4a,0xb2,0xc,
+0x82,0x4,0x92,0x41,0x16,0x99,0x2c,0x32,0xc8,0x32,0x19,0x24,0x91,0x4,0x92,0x44,
+0xf0,0x11,0x51,0x10,0x49,0x0,0x1,0xf8,0x48,0x4,0x9,0x22,0x88,0x4,0x11,0x24,
+0x12,0x41,0x5a,0xa2,0x8,0x82,0x4,0x12,0x41,0x10,0x11,0x28,0x22,0x88,0x22,0x11,
+0x24,0x11,0x4,0x92,0x46,0x10,0x90,0x9f,0xfb,0x89,0x3,0x8,0xe8,0xe7,0x71,0x3f,
+0x88,0xb8,0x1f,0x24,0xfa,0x81,0x52,0xbf,0x8,0x82,0x4,0x1a,0x61,0x90,0x1f,0x2f,
+0x3f,0x8c,0xa2,0x1f,0x24,0xe1,0x4,0xa2,0x44,0x10,0x10,0x1,0x12,0x8,0x2,0x8,
+0x48,0x10,0x41,0x2,0x88,0x20,0x1,0x24,0x12,0x80,0x31,0x82,0x8,0xc2,0x4,0x12,
+0x41,0x10,0x81,0x28,0x2,0x88,0x22,0x1,0x24,0x81,0x4,0xc2,0x64,0x10,0x10,0x51,
+0x12,0x49,0x2,0x8,0x48,0x9c,0x49,0x22,0xc8,0x24,0x11,0x24,0x12,0x81,0x31,0xa2,
+0xc,0x46,0x4,0x92,0x41,0x14,0xd1,0x2c,0x22,0xc8,0x22,0x11,0x24,0x91,0x4,0xc2,
+0x38,0x10,0x10,0xce,0xe3,0xd8,0x13,0x8,0x88,0x73,0x79,0x1c,0xb0,0x3c,0xe,0x2c,
+0xe2,0x80,0x21,0x9c,0x7,0x3c,0x4,0xe6,0x80,0x13,0x8e,0x6b,0x1c,0x70,0x22,0xe,
+0x24,0xf1,0x2c,0x0,0x48,
 
 };
 
 #define TEXT_TOO_MANY_PRESETS_WIDTH 230
 #define TEXT_TOO_MANY_PRESETS_HEIGHT 15
-const unsigned char TEXT_TOO_MANY_PRESETS [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3e,0x2,0x0,0x0,0x0,0x0,
-0x0,0x80,0x30,0x2,0x2,0x41,0x82,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x42,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x31,
-0x2,0x2,0x41,0x82,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x4,0x0,0x42,0xe2,0x38,0xe,0x7,0x22,0x87,0x3,0x29,0x73,0x1e,0x41,
-0xc2,0x71,0xc0,0x71,0x1c,0xc7,0x71,0xe0,0x1d,0xc7,0x39,0xf0,0x38,0xe7,0x70,0xee,
-0x0,0x42,0x92,0x65,0x92,0xc,0x22,0x49,0x6,0x29,0xc9,0x32,0x41,0x82,0xc8,0x20,
-0xcb,0xb2,0x4c,0x92,0x20,0x93,0x4c,0x64,0x90,0x89,0x2c,0xc9,0x24,0x1,0x3e,0x12,
-0x41,0x82,0x8,0x22,0x41,0x4,0x69,0x89,0x22,0x41,0x82,0x88,0x0,0xa,0x82,0x48,
-0x10,0x20,0x93,0x48,0x44,0x10,0x89,0x28,0x88,0x24,0x0,0x2,0xfa,0x79,0xdc,0xf,
-0x22,0xee,0x7,0x4a,0xfd,0x22,0x41,0x82,0x8c,0xc0,0xf,0xc3,0x8f,0xe3,0x20,0xd3,
-0x48,0x7e,0x10,0xc9,0xcf,0xfd,0xc4,0x1,0x2,0x12,0x44,0x90,0x0,0x22,0x48,0x0,
-0xc6,0x8,0x22,0x61,0x82,0x88,0x20,0xa,0x82,0x0,0x82,0x20,0x93,0x48,0x4,0x10,
-0x89,0x0,0x9,0x4,0x1,0x2,0x12,0x67,0x92,0x8,0x32,0x49,0x4,0xc6,0x88,0x32,
-0x23,0x82,0xc8,0x30,0x8b,0xa2,0x48,0x92,0x20,0x93,0x4c,0x44,0x90,0x89,0x28,0x89,
-0x24,0x1,0x2,0xe2,0x5c,0x1e,0x7,0x2c,0x8f,0x3,0x86,0x70,0x1e,0x1e,0x82,0x71,
-0xe0,0x72,0x1c,0xc7,0xf3,0x20,0x13,0x47,0x38,0xf0,0x8,0xe7,0x71,0xec,0x9,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,
+const unsigned char TEXT_TOO_MANY_PRESETS [] PROGMEM = { // 435 bytes raw
+0x0,0x3a,0x3e,0x2,0x0,0x5,0x80,0x30,0x2,0x2,0x41,0x82,0x0,0xe,0x4,0x0,
+0x1,0x42,0x2,0x0,0x6,0x31,0x2,0x2,0x41,0x82,0x0,0xe,0x4,0x0,0x1,0x42,
+0xe2,0x38,0xe,0x7,0x22,0x87,0x3,0x29,0x73,0x1e,0x41,0xc2,0x71,0xc0,0x71,0x1c,
+0xc7,0x71,0xe0,0x1d,0xc7,0x39,0xf0,0x38,0xe7,0x70,0xee,0x0,0x1,0x42,0x92,0x65,
+0x92,0xc,0x22,0x49,0x6,0x29,0xc9,0x32,0x41,0x82,0xc8,0x20,0xcb,0xb2,0x4c,0x92,
+0x20,0x93,0x4c,0x64,0x90,0x89,0x2c,0xc9,0x24,0x1,0x3e,0x12,0x41,0x82,0x8,0x22,
+0x41,0x4,0x69,0x89,0x22,0x41,0x82,0x88,0x0,0x1,0xa,0x82,0x48,0x10,0x20,0x93,
+0x48,0x44,0x10,0x89,0x28,0x88,0x24,0x0,0x1,0x2,0xfa,0x79,0xdc,0xf,0x22,0xee,
+0x7,0x4a,0xfd,0x22,0x41,0x82,0x8c,0xc0,0xf,0xc3,0x8f,0xe3,0x20,0xd3,0x48,0x7e,
+0x10,0xc9,0xcf,0xfd,0xc4,0x1,0x2,0x12,0x44,0x90,0x0,0x1,0x22,0x48,0x0,0x1,
+0xc6,0x8,0x22,0x61,0x82,0x88,0x20,0xa,0x82,0x0,0x1,0x82,0x20,0x93,0x48,0x4,
+0x10,0x89,0x0,0x1,0x9,0x4,0x1,0x2,0x12,0x67,0x92,0x8,0x32,0x49,0x4,0xc6,
+0x88,0x32,0x23,0x82,0xc8,0x30,0x8b,0xa2,0x48,0x92,0x20,0x93,0x4c,0x44,0x90,0x89,
+0x28,0x89,0x24,0x1,0x2,0xe2,0x5c,0x1e,0x7,0x2c,0x8f,0x3,0x86,0x70,0x1e,0x1e,
+0x82,0x71,0xe0,0x72,0x1c,0xc7,0xf3,0x20,0x13,0x47,0x38,0xf0,0x8,0xe7,0x71,0xec,
+0x9,0x0,0x17,0x10,0x0,0x1c,0x10,0x0,0x3f,
 
 };
 
 #define TEXT_RESETTING_GBS_WIDTH 106
 #define TEXT_RESETTING_GBS_HEIGHT 55
-const unsigned char TEXT_RESETTING_GBS [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfe,0x1,0x0,0x0,0x0,0x80,
-0x0,0x0,0x0,0xf0,0xc1,0x1f,0x7c,0x0,0x6,0x3,0x0,0x0,0xc0,0x18,0x0,0x0,
-0x0,0x18,0xc3,0x30,0xc2,0x0,0x6,0x2,0x0,0x0,0xc0,0x18,0x0,0x0,0x0,0x4,
-0xc6,0x20,0x83,0x0,0x6,0x82,0xc3,0x83,0xe3,0xbd,0xe8,0xe1,0x7,0x6,0xc4,0x20,
-0x3,0x0,0x6,0x62,0x24,0x66,0xc4,0x98,0x18,0x31,0x7,0x6,0xc0,0x10,0x6,0x0,
-0x6,0x23,0x2c,0x20,0xcc,0x98,0x18,0x13,0x6,0x2,0xc0,0x3f,0x3e,0x0,0xfe,0x21,
-0xe8,0x20,0xc8,0x98,0x8,0x13,0x6,0x82,0xc7,0x30,0xf0,0x0,0xc6,0xe0,0xcf,0xe3,
-0xcf,0x98,0x8,0x13,0x6,0x6,0xc4,0x60,0x80,0x1,0x86,0x21,0x0,0x26,0xc0,0x98,
-0x8,0x13,0x6,0x6,0xc4,0x60,0x80,0x1,0x6,0x23,0x8,0x24,0xc8,0x98,0x8,0x13,
-0x6,0x4,0xc4,0x60,0x81,0x1,0x6,0x63,0x24,0x66,0xc4,0x98,0x8,0x33,0x7,0x18,
-0xc6,0x30,0x83,0x0,0x6,0x86,0xc3,0x83,0x83,0xb1,0x8,0xe3,0x7,0xf0,0xc1,0x1f,
-0x7c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0xe0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0xe0,0xf,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,
-0x0,0x0,0x0,0x60,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,
-0x0,0x60,0x30,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x60,
-0x30,0xe1,0xe0,0xc3,0x83,0x3,0xc6,0x88,0x8f,0x1e,0x0,0x0,0x0,0x60,0x30,0x19,
-0x31,0x22,0x66,0x4,0xc6,0xc8,0x88,0xc,0x0,0x0,0x0,0x60,0x18,0x9,0x13,0x26,
-0x20,0xc,0xe4,0x4c,0x98,0xc,0x0,0x0,0x0,0xe0,0xf,0x9,0x82,0xe7,0x20,0x8,
-0xa4,0x4,0x9e,0xc,0x0,0x0,0x0,0x60,0x0,0xf9,0xf3,0xc6,0xe3,0xf,0xac,0xc5,
-0x9b,0xc,0x0,0x0,0x0,0x60,0x0,0x9,0x10,0x6,0x26,0x0,0xa8,0x45,0x98,0xc,
-0x0,0x0,0x0,0x60,0x0,0x9,0x12,0x6,0x24,0x8,0x38,0x47,0x98,0xc,0x0,0x0,
-0x0,0x60,0x0,0x19,0x31,0x27,0x66,0x4,0x18,0xc3,0x9c,0xc,0x0,0x0,0x0,0x60,
-0x0,0xe1,0xe0,0xc5,0x83,0x3,0x18,0x83,0x97,0x18,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x31,0x3,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,
+const unsigned char TEXT_RESETTING_GBS [] PROGMEM = { // 770 bytes raw
+0x0,0x2a,0xfe,0x1,0x0,0x3,0x80,0x0,0x3,0xf0,0xc1,0x1f,0x7c,0x0,0x1,0x6,
+0x3,0x0,0x2,0xc0,0x18,0x0,0x3,0x18,0xc3,0x30,0xc2,0x0,0x1,0x6,0x2,0x0,
+0x2,0xc0,0x18,0x0,0x3,0x4,0xc6,0x20,0x83,0x0,0x1,0x6,0x82,0xc3,0x83,0xe3,
+0xbd,0xe8,0xe1,0x7,0x6,0xc4,0x20,0x3,0x0,0x1,0x6,0x62,0x24,0x66,0xc4,0x98,
+0x18,0x31,0x7,0x6,0xc0,0x10,0x6,0x0,0x1,0x6,0x23,0x2c,0x20,0xcc,0x98,0x18,
+0x13,0x6,0x2,0xc0,0x3f,0x3e,0x0,0x1,0xfe,0x21,0xe8,0x20,0xc8,0x98,0x8,0x13,
+0x6,0x82,0xc7,0x30,0xf0,0x0,0x1,0xc6,0xe0,0xcf,0xe3,0xcf,0x98,0x8,0x13,0x6,
+0x6,0xc4,0x60,0x80,0x1,0x86,0x21,0x0,0x1,0x26,0xc0,0x98,0x8,0x13,0x6,0x6,
+0xc4,0x60,0x80,0x1,0x6,0x23,0x8,0x24,0xc8,0x98,0x8,0x13,0x6,0x4,0xc4,0x60,
+0x81,0x1,0x6,0x63,0x24,0x66,0xc4,0x98,0x8,0x33,0x7,0x18,0xc6,0x30,0x83,0x0,
+0x1,0x6,0x86,0xc3,0x83,0x83,0xb1,0x8,0xe3,0x7,0xf0,0xc1,0x1f,0x7c,0x0,0x9,
+0x6,0x0,0xc,0x30,0x2,0x0,0xc,0xe0,0x1,0x0,0x3e,0xe0,0xf,0x1,0x0,0x6,
+0x80,0x0,0x4,0x60,0x10,0x1,0x0,0x7,0xc,0x0,0x3,0x60,0x30,0x1,0x0,0x7,
+0xc,0x0,0x3,0x60,0x30,0xe1,0xe0,0xc3,0x83,0x3,0xc6,0x88,0x8f,0x1e,0x0,0x3,
+0x60,0x30,0x19,0x31,0x22,0x66,0x4,0xc6,0xc8,0x88,0xc,0x0,0x3,0x60,0x18,0x9,
+0x13,0x26,0x20,0xc,0xe4,0x4c,0x98,0xc,0x0,0x3,0xe0,0xf,0x9,0x82,0xe7,0x20,
+0x8,0xa4,0x4,0x9e,0xc,0x0,0x3,0x60,0x0,0x1,0xf9,0xf3,0xc6,0xe3,0xf,0xac,
+0xc5,0x9b,0xc,0x0,0x3,0x60,0x0,0x1,0x9,0x10,0x6,0x26,0x0,0x1,0xa8,0x45,
+0x98,0xc,0x0,0x3,0x60,0x0,0x1,0x9,0x12,0x6,0x24,0x8,0x38,0x47,0x98,0xc,
+0x0,0x3,0x60,0x0,0x1,0x19,0x31,0x27,0x66,0x4,0x18,0xc3,0x9c,0xc,0x0,0x3,
+0x60,0x0,0x1,0xe1,0xe0,0xc5,0x83,0x3,0x18,0x83,0x97,0x18,0x0,0xff,0x0,0x4,
+0x80,0x31,0x3,0x0,0x22,
 
 };
 
 #define TEXT_RESETTING_WIFI_WIDTH 104
 #define TEXT_RESETTING_WIFI_HEIGHT 55
-const unsigned char TEXT_RESETTING_WIFI [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfe,0x1,0x0,0x0,0x0,0x80,0x0,0x0,0x0,
-0x83,0x61,0xf1,0x4f,0x6,0x3,0x0,0x0,0xc0,0x18,0x0,0x0,0x0,0xc2,0x61,0x30,
-0x0,0x6,0x2,0x0,0x0,0xc0,0x18,0x0,0x0,0x0,0xc2,0x21,0x30,0x0,0x6,0x82,
-0xc3,0x83,0xe3,0xbd,0xe8,0xe1,0x7,0x46,0x21,0x31,0x40,0x6,0x62,0x24,0x66,0xc4,
-0x98,0x18,0x31,0x7,0x66,0x33,0x31,0x40,0x6,0x23,0x2c,0x20,0xcc,0x98,0x18,0x13,
-0x6,0x64,0x12,0x31,0x40,0xfe,0x21,0xe8,0x20,0xc8,0x98,0x8,0x13,0x6,0x24,0x12,
-0xf1,0x47,0xc6,0xe0,0xcf,0xe3,0xcf,0x98,0x8,0x13,0x6,0x24,0x12,0x31,0x40,0x86,
-0x21,0x0,0x26,0xc0,0x98,0x8,0x13,0x6,0x3c,0x1e,0x31,0x40,0x6,0x23,0x8,0x24,
-0xc8,0x98,0x8,0x13,0x6,0x18,0xc,0x31,0x40,0x6,0x63,0x24,0x66,0xc4,0x98,0x8,
-0x33,0x7,0x18,0xc,0x31,0x40,0x6,0x86,0xc3,0x83,0x83,0xb1,0x8,0xe3,0x7,0x18,
-0xc,0x31,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0xe0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf0,
-0x87,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x30,0x88,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x30,0x98,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0xc,0x0,0x0,0x30,0x98,0x70,0xf0,0xe1,0xc1,0x1,0xc6,0xc8,0x47,
-0x1e,0x0,0x0,0x30,0x98,0x8c,0x18,0x11,0x33,0x2,0xc6,0x68,0x44,0xc,0x0,0x0,
-0x30,0x8c,0x84,0x9,0x13,0x10,0x6,0xe4,0x2c,0x4c,0xc,0x0,0x0,0xf0,0x87,0x4,
-0xc1,0x73,0x10,0x4,0xa4,0x4,0x4f,0xc,0x0,0x0,0x30,0x80,0xfc,0x79,0xe3,0xf1,
-0x7,0xac,0xe5,0x4d,0xc,0x0,0x0,0x30,0x80,0x4,0x8,0x3,0x13,0x0,0xa8,0x25,
-0x4c,0xc,0x0,0x0,0x30,0x80,0x4,0x9,0x3,0x12,0x4,0x38,0x27,0x4c,0xc,0x0,
-0x0,0x30,0x80,0x8c,0x98,0x13,0x33,0x2,0x18,0x63,0x4e,0xc,0x0,0x0,0x30,0x80,
-0x70,0xf0,0xe2,0xc1,0x1,0x18,0xc3,0x4b,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x98,0x1,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char TEXT_RESETTING_WIFI [] PROGMEM = { // 715 bytes raw
+0x0,0x27,0xfe,0x1,0x0,0x3,0x80,0x0,0x3,0x83,0x61,0xf1,0x4f,0x6,0x3,0x0,
+0x2,0xc0,0x18,0x0,0x3,0xc2,0x61,0x30,0x0,0x1,0x6,0x2,0x0,0x2,0xc0,0x18,
+0x0,0x3,0xc2,0x21,0x30,0x0,0x1,0x6,0x82,0xc3,0x83,0xe3,0xbd,0xe8,0xe1,0x7,
+0x46,0x21,0x31,0x40,0x6,0x62,0x24,0x66,0xc4,0x98,0x18,0x31,0x7,0x66,0x33,0x31,
+0x40,0x6,0x23,0x2c,0x20,0xcc,0x98,0x18,0x13,0x6,0x64,0x12,0x31,0x40,0xfe,0x21,
+0xe8,0x20,0xc8,0x98,0x8,0x13,0x6,0x24,0x12,0xf1,0x47,0xc6,0xe0,0xcf,0xe3,0xcf,
+0x98,0x8,0x13,0x6,0x24,0x12,0x31,0x40,0x86,0x21,0x0,0x1,0x26,0xc0,0x98,0x8,
+0x13,0x6,0x3c,0x1e,0x31,0x40,0x6,0x23,0x8,0x24,0xc8,0x98,0x8,0x13,0x6,0x18,
+0xc,0x31,0x40,0x6,0x63,0x24,0x66,0xc4,0x98,0x8,0x33,0x7,0x18,0xc,0x31,0x40,
+0x6,0x86,0xc3,0x83,0x83,0xb1,0x8,0xe3,0x7,0x18,0xc,0x31,0x40,0x0,0x8,0x6,
+0x0,0xb,0x30,0x2,0x0,0xb,0xe0,0x1,0x0,0x39,0xf0,0x87,0x0,0x7,0x40,0x0,
+0x3,0x30,0x88,0x0,0x8,0xc,0x0,0x2,0x30,0x98,0x0,0x8,0xc,0x0,0x2,0x30,
+0x98,0x70,0xf0,0xe1,0xc1,0x1,0xc6,0xc8,0x47,0x1e,0x0,0x2,0x30,0x98,0x8c,0x18,
+0x11,0x33,0x2,0xc6,0x68,0x44,0xc,0x0,0x2,0x30,0x8c,0x84,0x9,0x13,0x10,0x6,
+0xe4,0x2c,0x4c,0xc,0x0,0x2,0xf0,0x87,0x4,0xc1,0x73,0x10,0x4,0xa4,0x4,0x4f,
+0xc,0x0,0x2,0x30,0x80,0xfc,0x79,0xe3,0xf1,0x7,0xac,0xe5,0x4d,0xc,0x0,0x2,
+0x30,0x80,0x4,0x8,0x3,0x13,0x0,0x1,0xa8,0x25,0x4c,0xc,0x0,0x2,0x30,0x80,
+0x4,0x9,0x3,0x12,0x4,0x38,0x27,0x4c,0xc,0x0,0x2,0x30,0x80,0x8c,0x98,0x13,
+0x33,0x2,0x18,0x63,0x4e,0xc,0x0,0x2,0x30,0x80,0x70,0xf0,0xe2,0xc1,0x1,0x18,
+0xc3,0x4b,0x18,0x0,0xf0,0xc0,0x98,0x1,0x0,0x1f,
 
 };
 
 #define TEXT_RESTORING_WIDTH 126
 #define TEXT_RESTORING_HEIGHT 55
-const unsigned char TEXT_RESTORING [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0xfe,0x1,0x0,0x0,0x0,0x0,0x0,0xf8,0x7,0x0,0x0,0x0,0x0,0x4,0x0,0x0,
-0x6,0x0,0x0,0x30,0x0,0x0,0x0,0x18,0xc,0x0,0x80,0x1,0x0,0x0,0x0,0x0,
-0x6,0x0,0x0,0x30,0x0,0x0,0x0,0x18,0x8,0x0,0x80,0x1,0x0,0x0,0x0,0x0,
-0x6,0xf0,0xc1,0x79,0x1c,0x7e,0x18,0x18,0x8,0x7,0xcf,0xc3,0xe1,0x45,0x8f,0x1f,
-0x6,0x18,0x31,0x32,0x23,0x46,0x8,0x18,0xc8,0x88,0x98,0x31,0x62,0xc4,0xc8,0x1c,
-0x6,0x8,0x13,0x30,0x61,0xc6,0x8,0x18,0x4c,0x98,0x80,0x11,0x66,0xc4,0x58,0x18,
-0xfe,0xc0,0x13,0x30,0x41,0x86,0xc,0xf8,0x47,0x90,0x83,0x11,0x64,0x44,0x58,0x18,
-0x6,0x78,0x13,0x30,0x41,0x82,0x4,0x18,0xc3,0x1f,0x8f,0x11,0x24,0x44,0x58,0x18,
-0x6,0x8,0x13,0x30,0x41,0x82,0x5,0x18,0x46,0x0,0x98,0x11,0x24,0x44,0x58,0x18,
-0x6,0x8,0x13,0x30,0x61,0x2,0x7,0x18,0x4c,0x10,0x90,0x11,0x26,0x44,0x58,0x18,
-0x6,0x98,0x33,0x36,0x23,0x2,0x3,0x18,0xcc,0x88,0x98,0x31,0x22,0x44,0xd8,0x1c,
-0x6,0xf0,0xc2,0x63,0x1e,0x2,0x3,0x18,0x18,0x7,0xf,0xe3,0x21,0x44,0x98,0x1f,
-0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,
-0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x8,
-0x0,0x0,0x0,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x7,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x80,0x3f,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
-0x0,0x0,0x80,0x41,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,
-0x0,0x0,0x80,0xc1,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,
-0x0,0x0,0x80,0xc1,0x84,0x83,0xf,0xf,0xe,0x30,0x46,0x3e,0xf2,0x0,0x0,0x0,
-0x0,0x0,0x80,0xc1,0x64,0xc4,0x88,0x98,0x11,0x30,0x46,0x23,0x62,0x0,0x0,0x0,
-0x0,0x0,0x80,0x61,0x24,0x4c,0x98,0x80,0x30,0x20,0x67,0x61,0x62,0x0,0x0,0x0,
-0x0,0x0,0x80,0x3f,0x24,0x8,0x9e,0x83,0x20,0x20,0x25,0x78,0x62,0x0,0x0,0x0,
-0x0,0x0,0x80,0x1,0xe4,0xcf,0x1b,0x8f,0x3f,0x60,0x2d,0x6f,0x62,0x0,0x0,0x0,
-0x0,0x0,0x80,0x1,0x24,0x40,0x18,0x98,0x0,0x40,0x2d,0x61,0x62,0x0,0x0,0x0,
-0x0,0x0,0x80,0x1,0x24,0x48,0x18,0x90,0x20,0xc0,0x39,0x61,0x62,0x0,0x0,0x0,
-0x0,0x0,0x80,0x1,0x64,0xc4,0x9c,0x98,0x11,0xc0,0x18,0x73,0x62,0x0,0x0,0x0,
-0x0,0x0,0x80,0x1,0x84,0x83,0x17,0xf,0xe,0xc0,0x18,0x5e,0xc2,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xcc,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char TEXT_RESTORING [] PROGMEM = { // 880 bytes raw
+0x0,0x30,0xfe,0x1,0x0,0x5,0xf8,0x7,0x0,0x4,0x4,0x0,0x2,0x6,0x0,0x2,
+0x30,0x0,0x3,0x18,0xc,0x0,0x1,0x80,0x1,0x0,0x4,0x6,0x0,0x2,0x30,0x0,
+0x3,0x18,0x8,0x0,0x1,0x80,0x1,0x0,0x4,0x6,0xf0,0xc1,0x79,0x1c,0x7e,0x18,
+0x18,0x8,0x7,0xcf,0xc3,0xe1,0x45,0x8f,0x1f,0x6,0x18,0x31,0x32,0x23,0x46,0x8,
+0x18,0xc8,0x88,0x98,0x31,0x62,0xc4,0xc8,0x1c,0x6,0x8,0x13,0x30,0x61,0xc6,0x8,
+0x18,0x4c,0x98,0x80,0x11,0x66,0xc4,0x58,0x18,0xfe,0xc0,0x13,0x30,0x41,0x86,0xc,
+0xf8,0x47,0x90,0x83,0x11,0x64,0x44,0x58,0x18,0x6,0x78,0x13,0x30,0x41,0x82,0x4,
+0x18,0xc3,0x1f,0x8f,0x11,0x24,0x44,0x58,0x18,0x6,0x8,0x13,0x30,0x41,0x82,0x5,
+0x18,0x46,0x0,0x1,0x98,0x11,0x24,0x44,0x58,0x18,0x6,0x8,0x13,0x30,0x61,0x2,
+0x7,0x18,0x4c,0x10,0x90,0x11,0x26,0x44,0x58,0x18,0x6,0x98,0x33,0x36,0x23,0x2,
+0x3,0x18,0xcc,0x88,0x98,0x31,0x22,0x44,0xd8,0x1c,0x6,0xf0,0xc2,0x63,0x1e,0x2,
+0x3,0x18,0x18,0x7,0xf,0xe3,0x21,0x44,0x98,0x1f,0x0,0x6,0x3,0x0,0x8,0x18,
+0x0,0x6,0x1,0x0,0x7,0xc0,0x8,0x0,0x5,0xc0,0x0,0x8,0x80,0x7,0x0,0x42,
+0x80,0x3f,0x4,0x0,0x7,0x2,0x0,0x5,0x80,0x41,0x4,0x0,0x7,0x60,0x0,0x5,
+0x80,0xc1,0x4,0x0,0x7,0x60,0x0,0x5,0x80,0xc1,0x84,0x83,0xf,0xf,0xe,0x30,
+0x46,0x3e,0xf2,0x0,0x5,0x80,0xc1,0x64,0xc4,0x88,0x98,0x11,0x30,0x46,0x23,0x62,
+0x0,0x5,0x80,0x61,0x24,0x4c,0x98,0x80,0x30,0x20,0x67,0x61,0x62,0x0,0x5,0x80,
+0x3f,0x24,0x8,0x9e,0x83,0x20,0x20,0x25,0x78,0x62,0x0,0x5,0x80,0x1,0xe4,0xcf,
+0x1b,0x8f,0x3f,0x60,0x2d,0x6f,0x62,0x0,0x5,0x80,0x1,0x24,0x40,0x18,0x98,0x0,
+0x1,0x40,0x2d,0x61,0x62,0x0,0x5,0x80,0x1,0x24,0x48,0x18,0x90,0x20,0xc0,0x39,
+0x61,0x62,0x0,0x5,0x80,0x1,0x64,0xc4,0x9c,0x98,0x11,0xc0,0x18,0x73,0x62,0x0,
+0x5,0x80,0x1,0x84,0x83,0x17,0xf,0xe,0xc0,0x18,0x5e,0xc2,0x0,0xff,0x0,0x2b,
+0xcc,0xc,0x0,0x27,
 
 };
 
 #define TEXT_WIFI_CONNECT_TO_WIDTH 355
 #define TEXT_WIFI_CONNECT_TO_HEIGHT 15
-const unsigned char TEXT_WIFI_CONNECT_TO [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x0,0x4,
-0x2,0x40,0x4,0x0,0x1c,0x90,0x0,0x0,0x2,0x0,0xe0,0xe1,0x11,0x1f,0x20,0x0,
-0x0,0x0,0x0,0x0,0x0,0x9,0x4,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x9,
-0x0,0x8,0x23,0x40,0x0,0x41,0x1,0xc4,0x0,0x0,0x0,0x0,0x4,0x2,0x40,0x4,
-0x0,0x4,0x90,0x0,0x0,0x0,0x0,0x10,0x13,0x13,0x21,0x20,0x0,0x0,0x0,0x0,
-0x0,0x0,0x1,0x4,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x10,0x23,
-0x40,0x0,0x41,0x1,0x82,0x38,0x8f,0x87,0xe3,0xe,0xe7,0xe0,0x3c,0xe,0x8e,0x93,
-0xb8,0x48,0xf2,0x58,0x10,0x12,0x12,0x61,0x10,0x8f,0xe3,0x38,0x91,0x38,0xe7,0x11,
-0x3c,0x9c,0x73,0x9c,0x3,0xd1,0x91,0x87,0x85,0x7b,0x38,0x90,0x32,0xc7,0x3,0x41,
-0x1,0x2,0x64,0x99,0x4c,0x96,0x5,0x92,0x41,0x64,0x19,0x44,0x96,0xe4,0x4c,0x92,
-0x65,0x30,0x30,0x10,0x41,0x10,0x59,0x26,0x49,0x99,0x64,0x91,0x11,0x64,0x32,0xc9,
-0x44,0x6,0x51,0x92,0x4c,0x6,0xc9,0x64,0x90,0x92,0x4c,0x6,0x41,0x1,0x2,0x44,
-0x91,0x48,0x14,0x4,0x12,0x41,0x44,0x11,0x44,0x94,0x44,0x4d,0x12,0x45,0xc0,0xc1,
-0x11,0x41,0x10,0x11,0x24,0x8,0x9a,0x44,0x11,0x11,0x44,0x22,0x89,0x44,0x4,0x51,
-0x90,0x48,0x4,0x89,0x44,0x90,0x96,0x48,0x4,0x41,0x1,0x2,0x46,0x91,0xe8,0x1f,
-0x4,0x1a,0x41,0xc4,0x1f,0x64,0x94,0x46,0x55,0x12,0x43,0x0,0x2,0x12,0x41,0x10,
-0x91,0xc7,0x71,0xaa,0x46,0x19,0x31,0x44,0x3f,0x8d,0xe4,0x7,0x91,0x93,0x28,0x4,
-0x89,0x7e,0xa0,0xd4,0x4f,0x4,0x41,0x1,0x82,0x44,0x91,0x48,0x10,0x4,0x12,0x41,
-0x44,0x1,0x44,0x94,0x44,0x35,0x12,0x45,0x10,0x12,0x12,0x61,0x10,0x51,0x4,0x41,
-0x6a,0x44,0x11,0x11,0x44,0x2,0x89,0x44,0x0,0x11,0x92,0x48,0x4,0x89,0x4,0x60,
+const unsigned char TEXT_WIFI_CONNECT_TO [] PROGMEM = { // 675 bytes raw
+0x0,0x5a,0x38,0x0,0x4,0x4,0x2,0x40,0x4,0x0,0x1,0x1c,0x90,0x0,0x2,0x2,
+0x0,0x1,0xe0,0xe1,0x11,0x1f,0x20,0x0,0x6,0x9,0x4,0x0,0x1,0x7,0x0,0x3,
+0x10,0x0,0x2,0x9,0x0,0x1,0x8,0x23,0x40,0x0,0x1,0x41,0x1,0xc4,0x0,0x4,
+0x4,0x2,0x40,0x4,0x0,0x1,0x4,0x90,0x0,0x4,0x10,0x13,0x13,0x21,0x20,0x0,
+0x6,0x1,0x4,0x0,0x1,0x1,0x0,0x6,0x9,0x0,0x1,0x10,0x23,0x40,0x0,0x1,
+0x41,0x1,0x82,0x38,0x8f,0x87,0xe3,0xe,0xe7,0xe0,0x3c,0xe,0x8e,0x93,0xb8,0x48,
+0xf2,0x58,0x10,0x12,0x12,0x61,0x10,0x8f,0xe3,0x38,0x91,0x38,0xe7,0x11,0x3c,0x9c,
+0x73,0x9c,0x3,0xd1,0x91,0x87,0x85,0x7b,0x38,0x90,0x32,0xc7,0x3,0x41,0x1,0x2,
+0x64,0x99,0x4c,0x96,0x5,0x92,0x41,0x64,0x19,0x44,0x96,0xe4,0x4c,0x92,0x65,0x30,
+0x30,0x10,0x41,0x10,0x59,0x26,0x49,0x99,0x64,0x91,0x11,0x64,0x32,0xc9,0x44,0x6,
+0x51,0x92,0x4c,0x6,0xc9,0x64,0x90,0x92,0x4c,0x6,0x41,0x1,0x2,0x44,0x91,0x48,
+0x14,0x4,0x12,0x41,0x44,0x11,0x44,0x94,0x44,0x4d,0x12,0x45,0xc0,0xc1,0x11,0x41,
+0x10,0x11,0x24,0x8,0x9a,0x44,0x11,0x11,0x44,0x22,0x89,0x44,0x4,0x51,0x90,0x48,
+0x4,0x89,0x44,0x90,0x96,0x48,0x4,0x41,0x1,0x2,0x46,0x91,0xe8,0x1f,0x4,0x1a,
+0x41,0xc4,0x1f,0x64,0x94,0x46,0x55,0x12,0x43,0x0,0x1,0x2,0x12,0x41,0x10,0x91,
+0xc7,0x71,0xaa,0x46,0x19,0x31,0x44,0x3f,0x8d,0xe4,0x7,0x91,0x93,0x28,0x4,0x89,
+0x7e,0xa0,0xd4,0x4f,0x4,0x41,0x1,0x82,0x44,0x91,0x48,0x10,0x4,0x12,0x41,0x44,
+0x1,0x44,0x94,0x44,0x35,0x12,0x45,0x10,0x12,0x12,0x61,0x10,0x51,0x4,0x41,0x6a,
+0x44,0x11,0x11,0x44,0x2,0x89,0x44,0x0,0x1,0x11,0x92,0x48,0x4,0x89,0x4,0x60,
 0x8c,0x40,0x4,0x61,0x1,0xc6,0x64,0x91,0x48,0x14,0x5,0x92,0x41,0x44,0x11,0x44,
 0x96,0x64,0x32,0x12,0x65,0x10,0x12,0x12,0x21,0x10,0x79,0x26,0x49,0x64,0x64,0x91,
 0x11,0x64,0x22,0xc9,0x44,0x4,0x59,0x92,0x48,0x6,0x89,0x44,0x60,0x8c,0x48,0x6,
 0x23,0x1,0x38,0x38,0x91,0x88,0xe3,0xc,0xe6,0xc0,0x44,0xe,0x84,0x93,0x38,0x32,
 0x12,0x79,0xe0,0xe1,0x11,0x1f,0x10,0xcf,0xe5,0x79,0x64,0x38,0xe1,0x11,0x3c,0x1c,
 0x71,0x84,0x3,0xd6,0x93,0x88,0x7,0x8b,0x38,0x60,0x8,0xc7,0x3,0x1e,0x1,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,
-0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x0,
-0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,
-0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,
+0xf,0x60,0x0,0x4,0x20,0x1,0x0,0xe,0x6,0x0,0x17,0x3c,0x0,0x4,0x20,0x1,
+0x0,0x5,0x8,0x0,0x7,0xc0,0x3,0x0,0x62,
 
 };
 
 #define TEXT_WIFI_CONNECTED_WIDTH 99
 #define TEXT_WIFI_CONNECTED_HEIGHT 13
-const unsigned char TEXT_WIFI_CONNECTED [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3c,0x2,0x8,0x0,0x0,0x70,
-0x0,0x0,0x0,0x0,0x8,0x0,0x2,0x62,0x2,0x8,0x0,0x0,0x88,0x1,0x0,0x0,
-0x0,0x8,0x0,0x2,0x42,0xe7,0x5c,0xe4,0x8,0x4,0x39,0x1e,0x8f,0xc3,0x9d,0xc3,
-0x3,0x6,0x92,0x49,0x24,0x1,0x4,0x64,0x32,0x59,0x26,0x4b,0x26,0x3,0x38,0x2,
-0x49,0x24,0x0,0x4,0x44,0x22,0x51,0x24,0x48,0x24,0x2,0x40,0xe2,0x49,0xc4,0x1,
-0x4,0x46,0x22,0xf1,0x37,0xe8,0x37,0x2,0x42,0x12,0x49,0x4,0x1,0x4,0x45,0x22,
-0x51,0x20,0x48,0x20,0x2,0x42,0x9a,0x49,0x26,0x1,0x8c,0x65,0x22,0x51,0x24,0x4a,
-0x24,0x3,0x3c,0x76,0x99,0xe5,0x9,0x70,0x38,0x22,0x91,0xc3,0x99,0xc3,0x3,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char TEXT_WIFI_CONNECTED [] PROGMEM = { // 169 bytes raw
+0x0,0x1a,0x3c,0x2,0x8,0x0,0x2,0x70,0x0,0x4,0x8,0x0,0x1,0x2,0x62,0x2,
+0x8,0x0,0x2,0x88,0x1,0x0,0x3,0x8,0x0,0x1,0x2,0x42,0xe7,0x5c,0xe4,0x8,
+0x4,0x39,0x1e,0x8f,0xc3,0x9d,0xc3,0x3,0x6,0x92,0x49,0x24,0x1,0x4,0x64,0x32,
+0x59,0x26,0x4b,0x26,0x3,0x38,0x2,0x49,0x24,0x0,0x1,0x4,0x44,0x22,0x51,0x24,
+0x48,0x24,0x2,0x40,0xe2,0x49,0xc4,0x1,0x4,0x46,0x22,0xf1,0x37,0xe8,0x37,0x2,
+0x42,0x12,0x49,0x4,0x1,0x4,0x45,0x22,0x51,0x20,0x48,0x20,0x2,0x42,0x9a,0x49,
+0x26,0x1,0x8c,0x65,0x22,0x51,0x24,0x4a,0x24,0x3,0x3c,0x76,0x99,0xe5,0x9,0x70,
+0x38,0x22,0x91,0xc3,0x99,0xc3,0x3,0x0,0x1a,
 
 };
 
 #define TEXT_WIFI_DISCONNECTED_WIDTH 113
 #define TEXT_WIFI_DISCONNECTED_HEIGHT 13
-const unsigned char TEXT_WIFI_DISCONNECTED [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3c,0x2,
-0x8,0x0,0x0,0x7c,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x1,0x62,0x2,0x8,
-0x0,0x0,0x84,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x1,0x42,0xe7,0x5c,0xe4,
-0x8,0x84,0xe5,0x70,0x1c,0xcf,0xc3,0xe1,0xce,0xe1,0x1,0x6,0x92,0x49,0x24,0x1,
-0x4,0x25,0xc9,0x32,0x59,0x26,0x93,0x25,0x93,0x1,0x38,0x2,0x49,0x24,0x0,0x4,
+const unsigned char TEXT_WIFI_DISCONNECTED [] PROGMEM = { // 195 bytes raw
+0x0,0x1e,0x3c,0x2,0x8,0x0,0x2,0x7c,0x4,0x0,0x5,0x4,0x0,0x1,0x1,0x62,
+0x2,0x8,0x0,0x2,0x84,0x0,0x6,0x4,0x0,0x1,0x1,0x42,0xe7,0x5c,0xe4,0x8,
+0x84,0xe5,0x70,0x1c,0xcf,0xc3,0xe1,0xce,0xe1,0x1,0x6,0x92,0x49,0x24,0x1,0x4,
+0x25,0xc9,0x32,0x59,0x26,0x93,0x25,0x93,0x1,0x38,0x2,0x49,0x24,0x0,0x1,0x4,
 0x25,0x8,0x22,0x51,0x24,0x12,0x24,0x12,0x1,0x40,0xe2,0x49,0xc4,0x1,0x4,0xc5,
 0xd,0x23,0x51,0xf4,0x1b,0xf4,0x1b,0x1,0x42,0x12,0x49,0x4,0x1,0x84,0x5,0x9,
 0x22,0x51,0x24,0x10,0x24,0x10,0x1,0x42,0x9a,0x49,0x26,0x1,0x84,0x24,0x89,0x32,
 0x51,0x24,0x12,0x25,0x92,0x1,0x3c,0x76,0x99,0xe5,0x9,0x7c,0xe4,0x71,0x1c,0x51,
-0xc4,0xe1,0xcc,0xe1,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,
+0xc4,0xe1,0xcc,0xe1,0x1,0x0,0x1e,
 
 };
 
 #define TEXT_WIFI_URL_WIDTH 261
 #define TEXT_WIFI_URL_HEIGHT 15
-const unsigned char TEXT_WIFI_URL [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x82,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x4,0x0,0x1c,0x90,0x0,0x0,
-0x2,0x0,0x10,0xe4,0x47,0x0,0x40,0x0,0x0,0x0,0x0,0x24,0x0,0x20,0x8c,0x0,
-0x1,0x4,0x5,0x82,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x4,0x0,0x4,0x90,0x0,
-0x0,0x0,0x0,0x10,0x24,0x4c,0x0,0x40,0x0,0x0,0x0,0x0,0x24,0x0,0x40,0x8c,
-0x0,0x1,0x4,0x5,0x82,0x1c,0xe,0x38,0xf,0x7,0x9c,0xe3,0x3c,0xe,0x8e,0x93,
-0xb8,0x48,0xf2,0x58,0x10,0x24,0x48,0x70,0xe0,0x1c,0x88,0x1c,0xe,0xee,0xe1,0x40,
-0xca,0x1c,0xf,0x4,0x5,0x82,0x24,0x19,0x64,0x99,0xc,0x32,0x41,0x64,0x19,0x44,
-0x96,0xe4,0x4c,0x92,0x65,0x10,0x24,0x4c,0x90,0x40,0x32,0x88,0x24,0x19,0x24,0x93,
-0x41,0x4a,0x32,0x19,0x4,0x5,0x82,0x4,0x11,0x44,0x91,0x8,0x22,0x41,0x44,0x11,
-0x44,0x94,0x44,0x4d,0x12,0x45,0x10,0xe4,0x47,0x10,0x40,0x22,0x88,0x4,0x11,0x24,
-0x12,0x41,0x5a,0x22,0x11,0x4,0x5,0x82,0xb8,0x1f,0x46,0xd1,0xf,0x23,0x41,0xc4,
-0x1f,0x64,0x94,0x46,0x55,0x12,0x43,0x10,0x24,0x42,0xe0,0x40,0x23,0x88,0xb8,0x1f,
-0x24,0xfa,0x81,0x52,0x3f,0x11,0x4,0x5,0xc2,0x20,0x1,0x44,0x91,0x0,0x22,0x41,
-0x44,0x1,0x44,0x94,0x44,0x35,0x12,0x45,0x10,0x26,0x44,0x80,0x40,0x22,0x88,0x20,
-0x1,0x24,0x12,0x80,0x31,0x2,0x11,0x84,0x5,0x46,0x24,0x11,0x64,0x91,0x8,0x32,
-0x41,0x44,0x11,0x44,0x96,0x64,0x32,0x12,0x65,0x30,0x22,0x4c,0x90,0x40,0x32,0xc8,
-0x24,0x11,0x24,0x12,0x81,0x31,0x22,0x19,0x8c,0x4,0x3c,0x3c,0xe,0x38,0x11,0x7,
-0x1c,0xc1,0x44,0xe,0x84,0x93,0x38,0x32,0x12,0x79,0xe0,0x21,0xc8,0xf7,0xc0,0x1c,
-0xb0,0x3c,0xe,0x2c,0xe2,0x80,0x21,0x1c,0xf,0x78,0x4,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char TEXT_WIFI_URL [] PROGMEM = { // 495 bytes raw
+0x0,0x42,0x82,0x0,0x6,0x47,0x4,0x0,0x1,0x1c,0x90,0x0,0x2,0x2,0x0,0x1,
+0x10,0xe4,0x47,0x0,0x1,0x40,0x0,0x4,0x24,0x0,0x1,0x20,0x8c,0x0,0x1,0x1,
+0x4,0x5,0x82,0x0,0x6,0x41,0x4,0x0,0x1,0x4,0x90,0x0,0x4,0x10,0x24,0x4c,
+0x0,0x1,0x40,0x0,0x4,0x24,0x0,0x1,0x40,0x8c,0x0,0x1,0x1,0x4,0x5,0x82,
+0x1c,0xe,0x38,0xf,0x7,0x9c,0xe3,0x3c,0xe,0x8e,0x93,0xb8,0x48,0xf2,0x58,0x10,
+0x24,0x48,0x70,0xe0,0x1c,0x88,0x1c,0xe,0xee,0xe1,0x40,0xca,0x1c,0xf,0x4,0x5,
+0x82,0x24,0x19,0x64,0x99,0xc,0x32,0x41,0x64,0x19,0x44,0x96,0xe4,0x4c,0x92,0x65,
+0x10,0x24,0x4c,0x90,0x40,0x32,0x88,0x24,0x19,0x24,0x93,0x41,0x4a,0x32,0x19,0x4,
+0x5,0x82,0x4,0x11,0x44,0x91,0x8,0x22,0x41,0x44,0x11,0x44,0x94,0x44,0x4d,0x12,
+0x45,0x10,0xe4,0x47,0x10,0x40,0x22,0x88,0x4,0x11,0x24,0x12,0x41,0x5a,0x22,0x11,
+0x4,0x5,0x82,0xb8,0x1f,0x46,0xd1,0xf,0x23,0x41,0xc4,0x1f,0x64,0x94,0x46,0x55,
+0x12,0x43,0x10,0x24,0x42,0xe0,0x40,0x23,0x88,0xb8,0x1f,0x24,0xfa,0x81,0x52,0x3f,
+0x11,0x4,0x5,0xc2,0x20,0x1,0x44,0x91,0x0,0x1,0x22,0x41,0x44,0x1,0x44,0x94,
+0x44,0x35,0x12,0x45,0x10,0x26,0x44,0x80,0x40,0x22,0x88,0x20,0x1,0x24,0x12,0x80,
+0x31,0x2,0x11,0x84,0x5,0x46,0x24,0x11,0x64,0x91,0x8,0x32,0x41,0x44,0x11,0x44,
+0x96,0x64,0x32,0x12,0x65,0x30,0x22,0x4c,0x90,0x40,0x32,0xc8,0x24,0x11,0x24,0x12,
+0x81,0x31,0x22,0x19,0x8c,0x4,0x3c,0x3c,0xe,0x38,0x11,0x7,0x1c,0xc1,0x44,0xe,
+0x84,0x93,0x38,0x32,0x12,0x79,0xe0,0x21,0xc8,0xf7,0xc0,0x1c,0xb0,0x3c,0xe,0x2c,
+0xe2,0x80,0x21,0x1c,0xf,0x78,0x4,0x0,0xf,0x60,0x0,0x20,0x3c,0x0,0x53,
 
 };
 
 #define TEXT_LOADED_WIDTH 53
 #define TEXT_LOADED_HEIGHT 17
-const unsigned char TEXT_LOADED [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x18,0x6,0x0,0x0,0x0,
-0x6,0x0,0x18,0x6,0x0,0x0,0x0,0x6,0x0,0x18,0x6,0x70,0xf0,0xe1,0x87,0x83,
-0x1f,0x6,0x8c,0x18,0x31,0x67,0xc4,0x1c,0x6,0x84,0x9,0x13,0x26,0x4c,0x18,0x6,
-0x4,0xc1,0x13,0x26,0x48,0x18,0x6,0x4,0x79,0x13,0xe6,0x4f,0x18,0x6,0x4,0x9,
-0x13,0x26,0x40,0x18,0x6,0x84,0x9,0x13,0x26,0x48,0x18,0x6,0x8c,0x98,0x33,0x67,
-0xc4,0x1c,0xfe,0x78,0xf0,0xe2,0x87,0x83,0x1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char TEXT_LOADED [] PROGMEM = { // 119 bytes raw
+0x0,0x15,0x6,0x0,0x3,0x6,0x0,0x1,0x18,0x6,0x0,0x3,0x6,0x0,0x1,0x18,
+0x6,0x0,0x3,0x6,0x0,0x1,0x18,0x6,0x70,0xf0,0xe1,0x87,0x83,0x1f,0x6,0x8c,
+0x18,0x31,0x67,0xc4,0x1c,0x6,0x84,0x9,0x13,0x26,0x4c,0x18,0x6,0x4,0xc1,0x13,
+0x26,0x48,0x18,0x6,0x4,0x79,0x13,0xe6,0x4f,0x18,0x6,0x4,0x9,0x13,0x26,0x40,
+0x18,0x6,0x84,0x9,0x13,0x26,0x48,0x18,0x6,0x8c,0x98,0x33,0x67,0xc4,0x1c,0xfe,
+0x78,0xf0,0xe2,0x87,0x83,0x1f,0x0,0xe,
 
 };
 
 #define TEXT_NO_INPUT_WIDTH 61
 #define TEXT_NO_INPUT_HEIGHT 20
-const unsigned char TEXT_NO_INPUT [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x2,0x0,0xc,0x0,0x0,0x0,0x0,
-0xe,0x2,0x0,0xc,0x0,0x0,0x0,0x6,0xe,0x2,0x0,0xc,0x0,0x0,0x0,0x6,
-0x16,0x82,0x3,0x4c,0x8f,0xe,0x61,0xf,0x16,0x62,0x4,0xcc,0x88,0x11,0x61,0x6,
-0x26,0x22,0xc,0xcc,0x98,0x31,0x61,0x6,0x6,0x22,0x8,0x4c,0x98,0x20,0x61,0x6,
-0x46,0x22,0x8,0x4c,0x98,0x20,0x61,0x6,0x86,0x22,0x8,0x4c,0x98,0x20,0x61,0x6,
-0x86,0x22,0xc,0x4c,0x98,0x31,0x63,0x6,0x6,0x63,0x4,0x4c,0x98,0x11,0x73,0x6,
-0x6,0xc3,0x3,0x4c,0x98,0xf,0x7e,0xc,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+const unsigned char TEXT_NO_INPUT [] PROGMEM = { // 160 bytes raw
+0x0,0x18,0x6,0x2,0x0,0x1,0xc,0x0,0x4,0xe,0x2,0x0,0x1,0xc,0x0,0x3,
+0x6,0xe,0x2,0x0,0x1,0xc,0x0,0x3,0x6,0x16,0x82,0x3,0x4c,0x8f,0xe,0x61,
+0xf,0x16,0x62,0x4,0xcc,0x88,0x11,0x61,0x6,0x26,0x22,0xc,0xcc,0x98,0x31,0x61,
+0x6,0x6,0x22,0x8,0x4c,0x98,0x20,0x61,0x6,0x46,0x22,0x8,0x4c,0x98,0x20,0x61,
+0x6,0x86,0x22,0x8,0x4c,0x98,0x20,0x61,0x6,0x86,0x22,0xc,0x4c,0x98,0x31,0x63,
+0x6,0x6,0x63,0x4,0x4c,0x98,0x11,0x73,0x6,0x6,0xc3,0x3,0x4c,0x98,0xf,0x7e,
+0xc,0x0,0x4,0x80,0x0,0x7,0x80,0x0,0x7,0x80,0x0,0x13,
 
 };
 
 #define OM_OSD_WIDTH 92
 #define OM_OSD_HEIGHT 15
-const unsigned char OM_OSD [] PROGMEM = {
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0xf0,0xf0,0xf8,0x80,
-0x61,0x0,0x0,0x0,0xc4,0x0,0x0,0x0,0x88,0x89,0x9,0x81,0x61,0x0,0x0,0x0,
-0x82,0x3c,0x1c,0xf,0x4,0x9,0x9,0x83,0x61,0x1c,0x4f,0x4,0x2,0x65,0x32,0x19,
-0x4,0x1a,0x8,0x82,0x52,0x32,0x59,0x4,0x2,0x45,0x22,0x11,0x4,0xe2,0x8,0x82,
-0x52,0x22,0x51,0x4,0x82,0x45,0x3f,0x11,0x4,0x3,0x9,0x82,0x52,0x3f,0x51,0x4,
-0x82,0x44,0x2,0x11,0x4,0x9,0x9,0x83,0x4c,0x2,0x51,0x4,0xc4,0x64,0x22,0x11,
-0x88,0x9,0x9,0x81,0x4c,0x22,0x51,0x6,0x78,0x3c,0x1c,0x11,0xf0,0xf0,0xf8,0x80,
-0x4c,0x1c,0x91,0x5,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,
+const unsigned char OM_OSD [] PROGMEM = { // 180 bytes raw
+0x0,0x18,0x78,0x0,0x3,0xf0,0xf0,0xf8,0x80,0x61,0x0,0x3,0xc4,0x0,0x3,0x88,
+0x89,0x9,0x81,0x61,0x0,0x3,0x82,0x3c,0x1c,0xf,0x4,0x9,0x9,0x83,0x61,0x1c,
+0x4f,0x4,0x2,0x65,0x32,0x19,0x4,0x1a,0x8,0x82,0x52,0x32,0x59,0x4,0x2,0x45,
+0x22,0x11,0x4,0xe2,0x8,0x82,0x52,0x22,0x51,0x4,0x82,0x45,0x3f,0x11,0x4,0x3,
+0x9,0x82,0x52,0x3f,0x51,0x4,0x82,0x44,0x2,0x11,0x4,0x9,0x9,0x83,0x4c,0x2,
+0x51,0x4,0xc4,0x64,0x22,0x11,0x88,0x9,0x9,0x81,0x4c,0x22,0x51,0x6,0x78,0x3c,
+0x1c,0x11,0xf0,0xf0,0xf8,0x80,0x4c,0x1c,0x91,0x5,0x0,0x1,0x4,0x0,0xb,0x4,
+0x0,0x22,
 
 };
 #endif
\ No newline at end of file
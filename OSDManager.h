@@ -81,14 +81,6 @@ private:
     OSDHanlder handlers[8];
     OSDState state;
     bool displayInColumn;
-    void rstOn()
-    {
-        GBS::OSD_SW_RESET::write(true);
-    }
-    void rstOff()
-    {
-        GBS::OSD_SW_RESET::write(false);
-    }
     uint8_t iconToRegValue(OSDIcon icon)
     {
         OSDIconValue values[] = {
@@ -107,6 +99,96 @@ private:
         return iconToRegValue((OSDIcon)(icon));
     }
 
+    // All OSD fields live in segment 0, 0x90-0x98. A navigation event changes them
+    // in a copy read with one burst; flush() writes the changed bytes back as one
+    // burst with OSD_COMMAND_FINISH cleared, commit() then sets it so the OSD takes
+    // all of the changes at once. 3 transactions instead of a read-modify-write
+    // (2 transactions) per field.
+    class OSDUpdate
+    {
+    private:
+        static const uint8_t first = 0x90;
+        static const uint8_t count = 9;
+        uint8_t data[count];
+        uint8_t sent[count];
+
+    public:
+        OSDUpdate()
+        {
+            GBS::read(0, first, data, count);
+            memcpy(sent, data, count);
+            set<GBS::OSD_COMMAND_FINISH>(false);
+        }
+
+        template <class Reg>
+        void set(typename Reg::Value value)
+        {
+            static_assert(Reg::segment == 0 && Reg::byteOffset >= first &&
+                              Reg::byteOffset + tw::detail::byteSize(Reg::bitOffset, Reg::bitWidth) <= first + count,
+                          "not an OSD register");
+            tw::detail::regEncode<Reg::bitOffset, Reg::bitWidth>(value, data + Reg::byteOffset - first);
+        }
+
+        void flush()
+        {
+            uint8_t lo = count, hi = 0;
+            for (uint8_t i = 0; i < count; i++) {
+                if (data[i] != sent[i]) {
+                    lo = MIN(lo, i);
+                    hi = i;
+                }
+            }
+            if (lo < count) {
+                GBS::write(0, first + lo, data + lo, hi - lo + 1);
+                memcpy(sent + lo, data + lo, hi - lo + 1);
+            }
+        }
+
+        void commit()
+        {
+            flush();
+            set<GBS::OSD_COMMAND_FINISH>(true);
+            flush();
+        }
+    };
+
+    void writePosition(OSDUpdate &update)
+    {
+        GBS::VDS_DIS_HB_ST::Value x_stop;
+        GBS::VDS_DIS_HB_SP::Value x_start;
+        GBS::VDS_DIS_VB_ST::Value y_stop;
+        GBS::Tie<GBS::VDS_DIS_HB_ST, GBS::VDS_DIS_HB_SP, GBS::VDS_DIS_VB_ST>::read(x_stop, x_start, y_stop);
+        auto width = x_stop - x_start;
+
+        auto x_zoom = GBS::OSD_ZOOM_5X;
+        auto y_zoom = GBS::OSD_ZOOM_4X;
+        switch (preset) {
+            case 1: // 480p
+                x_zoom = GBS::OSD_ZOOM_7X;
+                y_zoom = GBS::OSD_ZOOM_2X;
+                break;
+            case 5: // 1080p
+                x_zoom = GBS::OSD_ZOOM_3X;
+                y_zoom = GBS::OSD_ZOOM_8X;
+                break;
+            default:
+                break;
+        }
+        uint8_t x = (x_start + width / 2 - (x_zoom * MENU_WIDTH) / 2) >> 3;
+        uint8_t y = (y_stop - 64 - y_zoom * MENU_HEIGHT) >> 3;
+
+        update.set<GBS::OSD_MENU_DISP_STYLE>(1);
+        update.set<GBS::OSD_MENU_HORI_START>(x);
+        update.set<GBS::OSD_MENU_VER_START>(y);
+        update.set<GBS::OSD_HORIZONTAL_ZOOM>(x_zoom);
+        update.set<GBS::OSD_VERTICAL_ZOOM>(y_zoom);
+        update.set<GBS::OSD_MENU_BAR_BORD_COR>(OSD_BLUE);
+        update.set<GBS::OSD_MENU_BAR_FONT_BGCOR>(OSD_YELLOW);
+        update.set<GBS::OSD_MENU_BAR_FONT_FORCOR>(OSD_RED);
+        update.set<GBS::OSD_MENU_SEL_BGCOR>(OSD_GREEN);
+        update.set<GBS::OSD_MENU_SEL_FORCOR>(OSD_BLACk);
+    }
+
 public:
     OSDManager()
     {
@@ -167,68 +249,41 @@ public:
     }
     void resetPosition()
     {
-        auto x_start = GBS::VDS_DIS_HB_SP::read();
-        auto x_stop = GBS::VDS_DIS_HB_ST::read();
-        auto y_stop = GBS::VDS_DIS_VB_ST::read();
-        auto width = x_stop - x_start;
-
-        auto x_zoom = GBS::OSD_ZOOM_5X;
-        auto y_zoom = GBS::OSD_ZOOM_4X;
-        switch (preset) {
-            case 1: // 480p
-                x_zoom = GBS::OSD_ZOOM_7X;
-                y_zoom = GBS::OSD_ZOOM_2X;
-                break;
-            case 5: // 1080p
-                x_zoom = GBS::OSD_ZOOM_3X;
-                y_zoom = GBS::OSD_ZOOM_8X;
-                break;
-            default:
-                break;
-        }
-        uint8_t x = (x_start + width / 2 - (x_zoom * MENU_WIDTH) / 2) >> 3;
-        uint8_t y = (y_stop - 64 - y_zoom * MENU_HEIGHT) >> 3;
-
-        GBS::OSD_MENU_DISP_STYLE::write(1);
-        GBS::OSD_MENU_HORI_START::write(x);
-        GBS::OSD_MENU_VER_START::write(y);
-        GBS::OSD_HORIZONTAL_ZOOM::write(x_zoom);
-        GBS::OSD_VERTICAL_ZOOM::write(y_zoom);
-        GBS::OSD_MENU_BAR_BORD_COR::write(OSD_BLUE);
-        GBS::OSD_MENU_BAR_FONT_BGCOR::write(OSD_YELLOW);
-        GBS::OSD_MENU_BAR_FONT_FORCOR::write(OSD_RED);
-        GBS::OSD_MENU_SEL_BGCOR::write(OSD_GREEN);
-        GBS::OSD_MENU_SEL_FORCOR::write(OSD_BLACk);
+        OSDUpdate update;
+        writePosition(update);
+        update.commit();
     }
     void menuOn()
     {
-        rstOff();
-        GBS::OSD_COMMAND_FINISH::write(false);
-        resetPosition();
-        // GBS::OSD_YCBCR_RGB_FORMAT::write(false);
-        GBS::OSD_MENU_ICON_SEL::write(iconToRegValue(cursor));
-        GBS::OSD_DISP_EN::write(true);
-        GBS::OSD_MENU_EN::write(true);
-        GBS::OSD_COMMAND_FINISH::write(true);
+        OSDUpdate update;
+        update.set<GBS::OSD_SW_RESET>(false);
+        update.flush(); // out of reset before the rest
+        writePosition(update);
+        // update.set<GBS::OSD_YCBCR_RGB_FORMAT>(false);
+        update.set<GBS::OSD_MENU_ICON_SEL>(iconToRegValue(cursor));
+        update.set<GBS::OSD_DISP_EN>(true);
+        update.set<GBS::OSD_MENU_EN>(true);
+        update.commit();
         state = OSDState::MAIN;
     }
 
     void menuOff()
     {
-        GBS::OSD_COMMAND_FINISH::write(false);
-        GBS::OSD_MENU_MOD_SEL::write(0);
-        GBS::OSD_DISP_EN::write(false);
-        GBS::OSD_MENU_EN::write(false);
+        OSDUpdate update;
+        update.set<GBS::OSD_MENU_MOD_SEL>(0);
+        update.set<GBS::OSD_DISP_EN>(false);
+        update.set<GBS::OSD_MENU_EN>(false);
         state = OSDState::OFF;
-        GBS::OSD_COMMAND_FINISH::write(true);
-        rstOn();
+        update.commit();
+        update.set<GBS::OSD_SW_RESET>(true);
+        update.flush();
     }
 
     void updateCursor()
     {
-        GBS::OSD_COMMAND_FINISH::write(false);
-        GBS::OSD_MENU_ICON_SEL::write(iconToRegValue(cursor));
-        GBS::OSD_COMMAND_FINISH::write(true);
+        OSDUpdate update;
+        update.set<GBS::OSD_MENU_ICON_SEL>(iconToRegValue(cursor));
+        update.commit();
     }
     void next()
     {
@@ -248,33 +303,34 @@ public:
     }
     void enter()
     {
-        GBS::OSD_COMMAND_FINISH::write(false);
         OSDMenuConfig config;
         config.onChange = false;
         bool shouldEnter = (*handlers[cursor])(config);
+        OSDUpdate update;
         if (shouldEnter) {
             state = OSDState::SUB;
             uint8_t active = 128.0 / config.barLength * config.barActiveLength;
-            GBS::OSD_MENU_MOD_SEL::write(iconToRegValue(cursor));
-            GBS::OSD_BAR_LENGTH::write(128);
-            GBS::OSD_BAR_FOREGROUND_VALUE::write(active);
-            GBS::OSD_MENU_BAR_FONT_FORCOR::write(OSD_WHITE);
-            GBS::OSD_MENU_BAR_FONT_BGCOR::write(OSD_BLACk);
+            update.set<GBS::OSD_MENU_MOD_SEL>(iconToRegValue(cursor));
+            update.set<GBS::OSD_BAR_LENGTH>(128);
+            update.set<GBS::OSD_BAR_FOREGROUND_VALUE>(active);
+            update.set<GBS::OSD_MENU_BAR_FONT_FORCOR>(OSD_WHITE);
+            update.set<GBS::OSD_MENU_BAR_FONT_BGCOR>(OSD_BLACk);
         }
-        GBS::OSD_COMMAND_FINISH::write(true);
+        update.commit();
     }
+    // the handler's own (geometry, ADC) writes go out first, the bar follows as one update
     void submit(bool inc)
     {
-        GBS::OSD_COMMAND_FINISH::write(false);
         OSDMenuConfig config;
         config.inc = inc;
         config.onChange = true;
         (*handlers[cursor])(config);
-        GBS::OSD_MENU_MOD_SEL::write(iconToRegValue(cursor));
+        OSDUpdate update;
+        update.set<GBS::OSD_MENU_MOD_SEL>(iconToRegValue(cursor));
         uint8_t active = 128 / config.barLength * config.barActiveLength;
-        GBS::OSD_BAR_LENGTH::write(128);
-        GBS::OSD_BAR_FOREGROUND_VALUE::write(active);
-        GBS::OSD_COMMAND_FINISH::write(true);
+        update.set<GBS::OSD_BAR_LENGTH>(128);
+        update.set<GBS::OSD_BAR_FOREGROUND_VALUE>(active);
+        update.commit();
     }
 };
 #endif
\ No newline at end of file
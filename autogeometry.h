@@ -0,0 +1,267 @@
+#ifndef AUTOGEOMETRY_H_
+#define AUTOGEOMETRY_H_
+
+// Auto geometry: measures how much of the source's active area carries picture and
+// zooms the output so that black borders get cropped, see Geometry (geometry.h).
+//
+// The chip has no readout of pixels by position, so position comes from timing.
+// The decimation test bus (TEST_BUS_SEL 0xb, DEC_TEST_SEL 1 = luma, as auto gain
+// reads it) shows the sample the ADC converts at the moment it is read. Every
+// readout gets a ccount time stamp relative to the source's vertical edge on the
+// debug pin (IF frame time, TEST_BUS_SEL 0, as FrameSync measures it), that is its
+// line and its place in the line. Over a number of fields, the lines and the places
+// in the line with readouts above black are the picture.
+//
+// Where the pin edge is relative to vsync and when the chip latches the bus value
+// during a read are fixed but unknown offsets, so only the size of the picture is
+// used, not its position: the picture is what remains when the largest dark gap
+// (blanking and borders together) is taken away, counted circularly. The zoom stays
+// centered where the preset puts the standard active area, with the same factor on
+// both axes so the aspect ratio stays.
+
+#define AUTOGEOMETRY_FIELDS 32      // fields sampled per measurement, after 2 for the black level
+#define AUTOGEOMETRY_ROWS 160       // line bins per field
+#define AUTOGEOMETRY_COLUMNS 64     // bins per line
+#define AUTOGEOMETRY_LINE_PERIODS 3 // line period candidates, see sample()
+#define AUTOGEOMETRY_CONTRAST 8     // readouts this far above black are picture, of 127
+#define AUTOGEOMETRY_MIN_RATIO 700  // permille of the standard area, the strongest zoom
+#define AUTOGEOMETRY_MAX_RATIO 970  // permille, pictures larger than this are left alone
+
+namespace AutoGeometry
+{
+    // standard active area for rto->videoStandardInput 1 .. 4: lines per field and
+    // the active part of the line in permille
+    static const uint16_t standardLines[4] = {240, 288, 480, 576};
+    static const uint16_t standardWidth[4] = {829, 813, 839, 813};
+
+    uint8_t rowSamples[AUTOGEOMETRY_ROWS];
+    uint8_t rowBright[AUTOGEOMETRY_ROWS];
+    // by line period candidate and field parity: the fields of an interlaced source
+    // start half a line apart
+    uint8_t columnSamples[AUTOGEOMETRY_LINE_PERIODS][2][AUTOGEOMETRY_COLUMNS];
+    uint8_t columnBright[AUTOGEOMETRY_LINE_PERIODS][2][AUTOGEOMETRY_COLUMNS];
+
+    // bins with picture have at least 1/8 of their readouts above black. Returns the
+    // number of bins left after taking away the largest circular run of other bins,
+    // 0 if there is no picture or it has too many holes to be trusted.
+    template <class T>
+    static uint8_t pictureSpan(const T *samples, const T *bright, uint8_t n)
+    {
+        uint8_t pictureBins = 0, gap = 0, run = 0;
+        for (uint16_t i = 0; i < 2 * n; i++) {
+            uint8_t bin = i % n;
+            bool picture = bright[bin] >= 2 && bright[bin] >= samples[bin] / 8;
+            if (i < n && picture) {
+                pictureBins++;
+            }
+            run = picture ? 0 : MIN(run + 1, n);
+            gap = MAX(gap, run);
+        }
+        if (pictureBins == 0 || gap == 0) {
+            return 0;
+        }
+        uint8_t span = n - gap;
+        return (pictureBins * 4 >= span * 3) ? span : 0;
+    }
+
+    // rising edge on the debug pin, false on timeout
+    static bool waitEdge(uint32_t &at, uint32_t timeout)
+    {
+        uint32_t start = Latency::cycles();
+        while (digitalRead(DEBUG_IN_PIN)) {
+            if (Latency::cycles() - start > timeout) {
+                return false;
+            }
+        }
+        while (!digitalRead(DEBUG_IN_PIN)) {
+            if (Latency::cycles() - start > timeout) {
+                return false;
+            }
+        }
+        at = Latency::cycles();
+        return true;
+    }
+
+    // luma level at the 15th percentile, blanking alone is more than that
+    static uint8_t blackLevel(const uint16_t *histogram, uint16_t total)
+    {
+        uint16_t below = 0;
+        for (uint8_t b = 0; b < 16; b++) {
+            below += histogram[b];
+            if (below * 100UL >= total * 15UL) {
+                return (b << 3) + 4;
+            }
+        }
+        return 0x7f;
+    }
+
+    // fills the bins, expects the test bus on the IF frame time (TEST_BUS_SEL 0)
+    static bool sample(uint32_t period, uint16_t lines)
+    {
+        memset(rowSamples, 0, sizeof(rowSamples));
+        memset(rowBright, 0, sizeof(rowBright));
+        memset(columnSamples, 0, sizeof(columnSamples));
+        memset(columnBright, 0, sizeof(columnBright));
+
+        const uint16_t rowDiv = (lines + AUTOGEOMETRY_ROWS - 1) / AUTOGEOMETRY_ROWS;
+        // the sync processor counts whole lines, an interlaced field has half a line
+        // more or less. A wrong line period drifts through the field and smears the
+        // columns, measuredRatio() takes the sharpest result.
+        const uint32_t lineTicks[AUTOGEOMETRY_LINE_PERIODS] = {
+            period / lines, 2 * period / (2 * lines + 1), 2 * period / (2 * lines - 1)};
+        const uint32_t stopAt = period - period / 32; // time to switch back before the next edge
+        uint16_t histogram[16] = {0};
+        uint16_t histogramTotal = 0;
+        uint8_t threshold = 0x7f;
+        uint32_t fastest = UINT32_MAX;
+        uint32_t lastEdge = 0;
+        uint8_t parity = 0;
+
+        for (uint8_t field = 0; field < 2 + AUTOGEOMETRY_FIELDS; field++) {
+            uint32_t edge;
+            if (!waitEdge(edge, 2 * period)) {
+                return false;
+            }
+            if (field > 0) {
+                // a field missed in yield() would mix up the parities otherwise
+                parity = (parity + (edge - lastEdge + period / 2) / period) & 1;
+            }
+            lastEdge = edge;
+            GBS::TEST_BUS_SEL::write(0xb);
+            for (;;) {
+                uint32_t before = Latency::cycles();
+                uint8_t value = GBS::TEST_BUS_2F::read() & 0x7f;
+                uint32_t after = Latency::cycles();
+                uint32_t t = before - edge + (after - before) / 2;
+                if (t >= stopAt) {
+                    break;
+                }
+                fastest = MIN(fastest, after - before);
+                if (after - before > fastest + fastest / 2) {
+                    continue; // interrupted, the time stamp is off
+                }
+                if (field < 2) {
+                    histogram[value >> 3]++;
+                    histogramTotal++;
+                    continue;
+                }
+                bool bright = value > threshold;
+                uint8_t row = MIN(t / lineTicks[0] / rowDiv, AUTOGEOMETRY_ROWS - 1);
+                if (rowSamples[row] < 255) {
+                    rowSamples[row]++;
+                    rowBright[row] += bright;
+                }
+                for (uint8_t l = 0; l < AUTOGEOMETRY_LINE_PERIODS; l++) {
+                    uint8_t column = (t % lineTicks[l]) * AUTOGEOMETRY_COLUMNS / lineTicks[l];
+                    if (columnSamples[l][parity][column] < 255) {
+                        columnSamples[l][parity][column]++;
+                        columnBright[l][parity][column] += bright;
+                    }
+                }
+            }
+            GBS::TEST_BUS_SEL::write(0);
+            if (field == 1) {
+                threshold = blackLevel(histogram, histogramTotal) + AUTOGEOMETRY_CONTRAST;
+            }
+            yield();
+        }
+        return true;
+    }
+
+    // picture size as measured, 0 if there was no usable picture
+    static uint16_t measuredRatio(uint8_t mode, uint16_t lines)
+    {
+        const uint16_t rowDiv = (lines + AUTOGEOMETRY_ROWS - 1) / AUTOGEOMETRY_ROWS;
+        const uint8_t rows = (lines + rowDiv - 1) / rowDiv;
+        uint16_t pictureLines = pictureSpan(rowSamples, rowBright, rows) * rowDiv;
+
+        // per parity the narrowest picture over the line period candidates
+        uint16_t widthSum = 0;
+        uint8_t widthCount = 0;
+        for (uint8_t p = 0; p < 2; p++) {
+            uint8_t narrowest = 0;
+            for (uint8_t l = 0; l < AUTOGEOMETRY_LINE_PERIODS; l++) {
+                uint8_t span = pictureSpan(columnSamples[l][p], columnBright[l][p], AUTOGEOMETRY_COLUMNS);
+                if (span && (narrowest == 0 || span < narrowest)) {
+                    narrowest = span;
+                }
+            }
+            if (narrowest) {
+                widthSum += narrowest * 1000 / AUTOGEOMETRY_COLUMNS;
+                widthCount++;
+            }
+        }
+        if (pictureLines == 0 || widthCount == 0) {
+            return 0;
+        }
+        uint16_t pictureWidth = widthSum / widthCount;
+
+        uint16_t ratioLines = (uint32_t)pictureLines * 1000 / standardLines[mode - 1];
+        uint16_t ratioWidth = (uint32_t)pictureWidth * 1000 / standardWidth[mode - 1];
+        SerialM.printf("auto geometry: picture %u lines, %u permille of the line\n", pictureLines, pictureWidth);
+        return MAX(ratioLines, ratioWidth);
+    }
+
+    // measures the picture and zooms in on it, true when done (also when there is
+    // nothing to crop), false if the source can't be measured right now
+    bool run()
+    {
+        uint8_t mode = rto->videoStandardInput;
+        if (mode < 1 || mode > 4 || rto->presetID >= 0x20 || rto->outModeHdBypass || !rto->boardHasPower) {
+            return false; // SD and ED sources only, HD / RGBHV have no standard active area
+        }
+        uint16_t lines = GBS::STATUS_SYNC_PROC_VTOTAL::read();
+        if (lines < 200 || lines > 700) {
+            return false;
+        }
+        uint8_t status00 = GBS::STATUS_00::read(); // confirm no mode changes happened
+
+        uint8_t testBusSelBackup = GBS::TEST_BUS_SEL::read();
+        uint8_t ifBusSelBackup = GBS::IF_TEST_SEL::read();
+        uint8_t debugPinBackup = GBS::PAD_BOUT_EN::read();
+        uint8_t decTestSelBackup = GBS::DEC_TEST_SEL::read();
+        uint8_t decTestEnableBackup = GBS::DEC_TEST_ENABLE::read();
+        GBS::PAD_BOUT_EN::write(1);      // enable output to pin for test
+        GBS::IF_TEST_SEL::write(3);      // IF averaged frame time
+        GBS::TEST_BUS_SEL::write(0);     // needs decimation + if
+        GBS::DEC_TEST_SEL::write(1);     // luma and G
+        GBS::DEC_TEST_ENABLE::write(1);
+
+        uint32_t period = FrameSync::getPulseTicks();
+        bool measured = period != 0 && sample(period, lines);
+
+        GBS::TEST_BUS_SEL::write(testBusSelBackup);
+        GBS::IF_TEST_SEL::write(ifBusSelBackup);
+        GBS::PAD_BOUT_EN::write(debugPinBackup);
+        GBS::DEC_TEST_SEL::write(decTestSelBackup);
+        GBS::DEC_TEST_ENABLE::write(decTestEnableBackup);
+
+        StatusSnapshot::invalidate();
+        if (!measured || !getStatus16SpHsStable() || GBS::STATUS_00::read() != status00) {
+            SerialM.println(F("auto geometry: source not stable"));
+            return false;
+        }
+        uint16_t ratio = measuredRatio(mode, lines);
+        if (ratio < AUTOGEOMETRY_MIN_RATIO / 2 || ratio > 1100) {
+            SerialM.println(F("auto geometry: no clear picture edges"));
+            return false; // mostly dark scene or noise, try again with the next source change
+        }
+        if (ratio >= AUTOGEOMETRY_MAX_RATIO) {
+            return true; // fills the active area already
+        }
+        ratio = MAX(ratio, AUTOGEOMETRY_MIN_RATIO);
+
+        // solve() scales the width around the picture center, the height grows down
+        // from the first source line: start later by half the lines cropped
+        Geometry::Timings now = Geometry::read();
+        Geometry::readSource(now);
+        Geometry::Target target = Geometry::targetOf(now);
+        target.hscale = (uint32_t)Geometry::effectiveScale(now.hscale, now.hscaleBypass) * ratio / 1000;
+        target.vscale = (uint32_t)Geometry::effectiveScale(now.vscale, now.vscaleBypass) * ratio / 1000;
+        target.srcStart += (uint32_t)standardLines[mode - 1] * (1000 - ratio) / 2000;
+        Geometry::apply(now, target);
+        SerialM.printf("auto geometry: zoom to %u permille\n", ratio);
+        return true;
+    }
+} // namespace AutoGeometry
+#endif
@@ -0,0 +1,222 @@
+#ifndef BUSARBITER_H_
+#define BUSARBITER_H_
+
+#include <Wire.h>
+#include "SSD1306Wire.h"
+
+// I2C bus arbitration between the GBS (tw.h), the Si5351 clock generator and the
+// OLED, which all share the one Wire bus.
+//
+// The firmware is single threaded, so bus transactions never overlap; what hurts
+// is one long transfer holding up everything behind it. A full OLED frame is about
+// 1KB, 15-25ms of bus time. So the OLED is the background class: BusSSD1306Wire
+// sends only the changed bytes of a frame, at most BUS_OLED_CHUNK_BYTES per call,
+// and the "oledbus" scheduler task continues the frame on the next passes.
+//
+// Every transaction is accounted per device: count, bytes, bus time and, for the
+// queued OLED frames, the wait from display() until the frame is on the screen.
+// Serial command 'Q' prints it.
+
+#define BUS_OLED_CHUNK_BYTES 128 // per pass, one SSD1306 page
+#define BUS_OLED_BURST_BYTES 16  // data bytes per I2C transmission
+
+// tw.h accounting hooks, every GBS register transaction
+#define TW_BUS_BEGIN() uint32_t twBusStart = BusArbiter::begin()
+#define TW_BUS_END(bytes) BusArbiter::end(BusDeviceGBS, twBusStart, bytes)
+
+enum BusDevice : uint8_t {
+    BusDeviceGBS = 0,
+    BusDeviceClockGen,
+    BusDeviceOLED,
+    BusDeviceCount,
+};
+
+namespace BusArbiter
+{
+    struct DeviceStats
+    {
+        uint32_t transactions;
+        uint32_t bytes;
+        uint32_t busUs;    // total
+        uint32_t maxBusUs; // longest single transaction / chunk
+        uint32_t waits;    // queued requests (OLED frames)
+        uint32_t waitUs;
+        uint32_t maxWaitUs;
+    };
+
+    const char *const deviceNames[BusDeviceCount] = {"gbs", "clockgen", "oled"};
+    DeviceStats stats[BusDeviceCount];
+    uint32_t clockGenStart = 0;
+
+    uint32_t begin()
+    {
+        return micros();
+    }
+
+    void end(BusDevice device, uint32_t start, uint16_t bytes)
+    {
+        DeviceStats &s = stats[device];
+        uint32_t took = micros() - start;
+        s.transactions++;
+        s.bytes += bytes;
+        s.busUs += took;
+        if (took > s.maxBusUs) {
+            s.maxBusUs = took;
+        }
+    }
+
+    void waited(BusDevice device, uint32_t us)
+    {
+        DeviceStats &s = stats[device];
+        s.waits++;
+        s.waitUs += us;
+        if (us > s.maxWaitUs) {
+            s.maxWaitUs = us;
+        }
+    }
+
+    // Si5351mcu::busHook
+    void clockGenHook(bool begin, uint8_t bytes)
+    {
+        if (begin) {
+            clockGenStart = micros();
+        } else {
+            end(BusDeviceClockGen, clockGenStart, bytes);
+        }
+    }
+
+    void resetStats()
+    {
+        memset(stats, 0, sizeof(stats));
+    }
+
+    void report(Print &out)
+    {
+        out.println(F("bus device   transactions bytes    bus(us)  max(us)  waits  max wait(us)"));
+        for (uint8_t i = 0; i < BusDeviceCount; i++) {
+            const DeviceStats &s = stats[i];
+            out.printf("%-12s %-12u %-8u %-8u %-8u %-6u %u\n", deviceNames[i], s.transactions,
+                       s.bytes, s.busUs, s.maxBusUs, s.waits, s.maxWaitUs);
+        }
+    }
+} // namespace BusArbiter
+
+// SSD1306 on the shared bus: display() no longer pushes the whole frame in one go.
+// The changed columns of each page (against the double buffer) are sent in
+// chunks, the rest of a frame follows from service() calls by the oledbus task.
+class BusSSD1306Wire : public SSD1306Wire
+{
+private:
+    uint8_t address;
+    bool pending = false;
+    uint32_t pendingSince = 0;
+    uint8_t scanPage = 0;     // next page to look at for changes
+    uint8_t page = 0;         // page being sent
+    uint8_t column = 0;       // next column to send
+    uint8_t columnsLeft = 0;  // in the current page segment
+
+    void sendCommands(const uint8_t *commands, uint8_t count)
+    {
+        Wire.beginTransmission(address);
+        Wire.write(0x00); // command stream
+        Wire.write(commands, count);
+        Wire.endTransmission();
+    }
+
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    // finds the next page with changed columns and sets the SSD1306 window to them
+    bool nextSegment()
+    {
+        const uint8_t pages = height() / 8;
+        for (uint8_t k = 0; k < pages; k++) {
+            uint8_t p = (scanPage + k) % pages;
+            const uint8_t *now = buffer + p * width();
+            const uint8_t *sent = buffer_back + p * width();
+            int16_t first = -1, last = -1;
+            for (uint8_t x = 0; x < width(); x++) {
+                if (now[x] != sent[x]) {
+                    if (first < 0) {
+                        first = x;
+                    }
+                    last = x;
+                }
+            }
+            if (first >= 0) {
+                page = p;
+                column = first;
+                columnsLeft = last - first + 1;
+                scanPage = (p + 1) % pages;
+                const uint8_t window[] = {0x21, (uint8_t)first, (uint8_t)last, 0x22, p, p}; // COLUMNADDR, PAGEADDR
+                sendCommands(window, sizeof(window));
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
+
+public:
+    BusSSD1306Wire(uint8_t address, int sda, int scl)
+        : SSD1306Wire(address, sda, scl), address(address) {}
+
+    void display(void) override
+    {
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+        if (width() == 128 && height() == 64) {
+            if (!pending) {
+                pending = true;
+                pendingSince = micros();
+            }
+            service(BUS_OLED_CHUNK_BYTES);
+            return;
+        }
+#endif
+        // no shadow buffer to diff against, or a geometry that needs the driver's offsets
+        uint32_t start = BusArbiter::begin();
+        SSD1306Wire::display();
+        BusArbiter::end(BusDeviceOLED, start, width() * height() / 8);
+    }
+
+    // sends up to budget bytes of the pending frame, returns true while it is incomplete
+    bool service(uint16_t budget)
+    {
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+        if (!pending) {
+            return false;
+        }
+        uint32_t start = BusArbiter::begin();
+        uint16_t sent = 0;
+        while (sent < budget) {
+            if (columnsLeft == 0 && !nextSegment()) {
+                pending = false;
+                BusArbiter::waited(BusDeviceOLED, micros() - pendingSince);
+                break;
+            }
+            uint8_t n = columnsLeft;
+            if (n > BUS_OLED_BURST_BYTES) {
+                n = BUS_OLED_BURST_BYTES;
+            }
+            if (n > budget - sent) {
+                n = budget - sent;
+            }
+            uint16_t offset = page * width() + column;
+            Wire.beginTransmission(address);
+            Wire.write(0x40); // data stream
+            Wire.write(buffer + offset, n);
+            Wire.endTransmission();
+            memcpy(buffer_back + offset, buffer + offset, n);
+            column += n;
+            columnsLeft -= n;
+            sent += n;
+        }
+        if (sent > 0) {
+            BusArbiter::end(BusDeviceOLED, start, sent);
+        }
+        return pending;
+#else
+        (void)budget;
+        return false;
+#endif
+    }
+};
+#endif
@@ -0,0 +1,5191 @@
+#ifndef CHIPCONTROL_H_
+#define CHIPCONTROL_H_
+
+// Chip control: preset loading and application (applyPresets(),
+// writeProgramArrayNew(), doPostPresetLoadSteps()), resets, the sync processor,
+// ADC and PLL setup, input detection, manual geometry adjustments, the bypass
+// modes, the external clock generator and the option defaults. Part of the portable
+// core, see core.h.
+
+// used before their definition
+static inline void writeBytes(uint8_t slaveRegister, uint8_t *values, uint8_t numValues);
+const uint8_t *loadPresetFromSPIFFS(byte forVideoMode);
+void applyYuvPatches();
+void applyRGBPatches();
+void setAdcParametersGainAndOffset();
+void setAndUpdateSogLevel(uint8_t level);
+void resetPLLAD();
+void latchPLLAD();
+void resetPLL();
+void resetSyncProcessor();
+void resetModeDetect();
+void printVideoTimings();
+void resetDebugPort();
+boolean applyBestHTotal(uint16_t bestHTotal);
+float getSourceFieldRate(boolean useSPBus);
+float getOutputFrameRate();
+void applyPresets(uint8_t result);
+void unfreezeVideo();
+boolean getSyncPresent();
+void setOverSampleRatio(uint8_t newRatio, boolean prepareOnly);
+void setAndLatchPhaseSP();
+void setAndLatchPhaseADC();
+void updateSpDynamic(boolean withCurrentVideoModeCheck);
+void updateCoastPosition(boolean autoCoast);
+void updateClampPosition();
+void setOutModeHdBypass(bool regsInitialized);
+void bypassModeSwitch_RGBHV();
+
+void externalClockGenResetClock()
+{
+    if (!rto->extClockGenDetected) {
+        return;
+    }
+    fsDebugPrintf("externalClockGenResetClock()\n");
+
+    uint8_t activeDisplayClock = GBS::PLL648_CONTROL_01::read();
+
+    if (activeDisplayClock == 0x25)
+        rto->freqExtClockGen = 40500000;
+    else if (activeDisplayClock == 0x45)
+        rto->freqExtClockGen = 54000000;
+    else if (activeDisplayClock == 0x55)
+        rto->freqExtClockGen = 64800000;
+    else if (activeDisplayClock == 0x65)
+        rto->freqExtClockGen = 81000000;
+    else if (activeDisplayClock == 0x85)
+        rto->freqExtClockGen = 108000000;
+    else if (activeDisplayClock == 0x95)
+        rto->freqExtClockGen = 129600000;
+    else if (activeDisplayClock == 0xa5)
+        rto->freqExtClockGen = 162000000;
+    else if (activeDisplayClock == 0x35)
+        rto->freqExtClockGen = 81000000; // clock unused
+    else if (activeDisplayClock == 0)
+        rto->freqExtClockGen = 81000000; // no preset loaded
+    else if (!rto->outModeHdBypass) {
+        SerialM.print(F("preset display clock: 0x"));
+        SerialM.println(activeDisplayClock, HEX);
+    }
+
+    // problem: around 108MHz the library seems to double the clock
+    // maybe there are regs to check for this and resetPLL
+    if (rto->freqExtClockGen == 108000000) {
+        Si.setFreq(0, 87000000);
+        delay(1); // quick fix
+    }
+    // same thing it seems at 40500000
+    if (rto->freqExtClockGen == 40500000) {
+        Si.setFreq(0, 48500000);
+        delay(1); // quick fix
+    }
+
+    Si.setFreq(0, rto->freqExtClockGen);
+    GBS::PAD_CKIN_ENZ::write(0); // 0 = clock input enable (pin40)
+    FrameSync::clearFrequency();
+
+    SerialM.print(F("clock gen reset: "));
+    SerialM.println(rto->freqExtClockGen);
+}
+
+void externalClockGenSyncInOutRate()
+{
+    fsDebugPrintf("externalClockGenSyncInOutRate()\n");
+
+    if (!rto->extClockGenDetected) {
+        return;
+    }
+    if (GBS::PAD_CKIN_ENZ::read() != 0) {
+        return;
+    }
+    if (rto->outModeHdBypass) {
+        return;
+    }
+    if (GBS::PLL648_CONTROL_01::read() != 0x75) {
+        return;
+    }
+
+    float sfr = getSourceFieldRate(0);
+    if (sfr < 47.0f || sfr > 86.0f) {
+        SerialM.print(F("sync skipped sfr wrong: "));
+        SerialM.println(sfr);
+        return;
+    }
+
+    float ofr = getOutputFrameRate();
+    if (ofr < 47.0f || ofr > 86.0f) {
+        SerialM.print(F("sync skipped ofr wrong: "));
+        SerialM.println(ofr);
+        return;
+    }
+
+    uint32_t old = rto->freqExtClockGen;
+    FrameSync::initFrequency(ofr, old);
+
+    setExternalClockGenFrequencySmooth((sfr / ofr) * rto->freqExtClockGen);
+
+    int32_t diff = rto->freqExtClockGen - old;
+
+    SerialM.print(F("source Hz: "));
+    SerialM.print(sfr, 5);
+    SerialM.print(F(" new out: "));
+    SerialM.print(getOutputFrameRate(), 5);
+    SerialM.print(F(" clock: "));
+    SerialM.print(rto->freqExtClockGen);
+    SerialM.print(F(" ("));
+    SerialM.print(diff >= 0 ? "+" : "");
+    SerialM.print(diff);
+    SerialM.println(F(")"));
+    delay(1);
+}
+
+void externalClockGenDetectAndInitialize()
+{
+    const uint8_t xtal_cl = 0xD2; // 10pF, other choices are 8pF (0x92) and 6pF (0x52) NOTE: Per AN619, the low bytes should be written 0b010010
+
+    // MHz: 27, 32.4, 40.5, 54, 64.8, 81, 108, 129.6, 162
+    rto->freqExtClockGen = 81000000;
+    rto->extClockGenDetected = 0;
+
+    if (uopt->disableExternalClockGenerator) {
+        SerialM.println(F("ExternalClockGenerator disabled, skipping detection"));
+        return;
+    }
+
+    uint8_t retVal = 0;
+    Wire.beginTransmission(SIADDR);
+    retVal = Wire.endTransmission();
+
+    if (retVal != 0) {
+        return;
+    }
+
+    Wire.beginTransmission(SIADDR);
+    Wire.write(0); // Device Status
+    Wire.endTransmission();
+    size_t bytes_read = Wire.requestFrom((uint8_t)SIADDR, (size_t)1, false);
+
+    if (bytes_read == 1) {
+        retVal = Wire.read();
+        if ((retVal & 0x80) == 0) {
+            // SYS_INIT indicates device is ready.
+            rto->extClockGenDetected = 1;
+        } else {
+            return;
+        }
+    } else {
+        return;
+    }
+
+    Si5351mcu::busHook = BusArbiter::clockGenHook;
+    Si.init(25000000L); // many Si5351 boards come with 25MHz crystal; 27000000L for one with 27MHz
+    Wire.beginTransmission(SIADDR);
+    Wire.write(183);    // XTAL_CL
+    Wire.write(xtal_cl);
+    Wire.endTransmission();
+    Si.setPower(0, SIOUT_6mA);
+    Si.setFreq(0, rto->freqExtClockGen);
+    Si.disable(0);
+}
+
+static inline void writeOneByte(uint8_t slaveRegister, uint8_t value)
+{
+    writeBytes(slaveRegister, &value, 1);
+}
+
+static inline void writeBytes(uint8_t slaveRegister, uint8_t *values, uint8_t numValues)
+{
+    if (slaveRegister == 0xF0 && numValues == 1) {
+        lastSegment = *values;
+    } else
+        GBS::write(lastSegment, slaveRegister, values, numValues);
+}
+
+void copyBank(uint8_t *bank, const uint8_t *programArray, uint16_t *index)
+{
+    for (uint8_t x = 0; x < 16; ++x) {
+        bank[x] = pgm_read_byte(programArray + *index);
+        (*index)++;
+    }
+}
+
+boolean videoStandardInputIsPalNtscSd()
+{
+    if (rto->videoStandardInput == 1 || rto->videoStandardInput == 2) {
+        return true;
+    }
+    return false;
+}
+
+void zeroAll()
+{
+    // turn processing units off first
+    writeOneByte(0xF0, 0);
+    writeOneByte(0x46, 0x00); // reset controls 1
+    writeOneByte(0x47, 0x00); // reset controls 2
+
+    // zero out entire register space
+    for (int y = 0; y < 6; y++) {
+        writeOneByte(0xF0, (uint8_t)y);
+        for (int z = 0; z < 16; z++) {
+            uint8_t bank[16];
+            for (int w = 0; w < 16; w++) {
+                bank[w] = 0;
+                // exceptions
+                //if (y == 5 && z == 0 && w == 2) {
+                //  bank[w] = 0x51; // 5_02
+                //}
+                //if (y == 5 && z == 5 && w == 6) {
+                //  bank[w] = 0x01; // 5_56
+                //}
+                //if (y == 5 && z == 5 && w == 7) {
+                //  bank[w] = 0xC0; // 5_57
+                //}
+            }
+            writeBytes(z * 16, bank, 16);
+        }
+    }
+}
+
+void loadHdBypassSection()
+{
+    uint16_t index = 0;
+    uint8_t bank[16];
+    writeOneByte(0xF0, 1);
+    for (int j = 3; j <= 5; j++) { // start at 0x30
+        copyBank(bank, presetHdBypassSection, &index);
+        writeBytes(j * 16, bank, 16);
+    }
+}
+
+void loadPresetDeinterlacerSection()
+{
+    uint16_t index = 0;
+    uint8_t bank[16];
+    writeOneByte(0xF0, 2);
+    for (int j = 0; j <= 3; j++) { // start at 0x00
+        copyBank(bank, presetDeinterlacerSection, &index);
+        writeBytes(j * 16, bank, 16);
+    }
+}
+
+void loadPresetMdSection()
+{
+    uint16_t index = 0;
+    uint8_t bank[16];
+    writeOneByte(0xF0, 1);
+    for (int j = 6; j <= 7; j++) { // start at 0x60
+        copyBank(bank, presetMdSection, &index);
+        writeBytes(j * 16, bank, 16);
+    }
+    bank[0] = pgm_read_byte(presetMdSection + index);
+    bank[1] = pgm_read_byte(presetMdSection + index + 1);
+    bank[2] = pgm_read_byte(presetMdSection + index + 2);
+    bank[3] = pgm_read_byte(presetMdSection + index + 3);
+    writeBytes(8 * 16, bank, 4); // MD section ends at 0x83, not 0x90
+}
+
+// programs all valid registers (the register map has holes in it, so it's not straight forward)
+// 'index' keeps track of the current preset data location.
+void writeProgramArrayNew(const uint8_t *programArray, boolean skipMDSection)
+{
+    LATENCY_SECTION("writeProgramArrayNew");
+    uint16_t index = 0;
+    uint8_t bank[16];
+    uint8_t y = 0;
+
+    //GBS::PAD_SYNC_OUT_ENZ::write(1);
+    //GBS::DAC_RGBS_PWDNZ::write(0);    // no DAC
+    //GBS::SFTRST_MEM_FF_RSTZ::write(0);  // stop mem fifos
+
+    FrameSync::cleanup();
+
+    // should only be possible if previously was in RGBHV bypass, then hit a manual preset switch
+    if (rto->videoStandardInput == 15) {
+        rto->videoStandardInput = 0;
+    }
+
+    rto->outModeHdBypass = 0; // the default at this stage
+    if (GBS::ADC_INPUT_SEL::read() == 0) {
+        //if (rto->inputIsYpBpR == 0) SerialM.println("rto->inputIsYpBpR was 0, fixing to 1");
+        rto->inputIsYpBpR = 1; // new: update the var here, allow manual preset loads
+    } else {
+        //if (rto->inputIsYpBpR == 1) SerialM.println("rto->inputIsYpBpR was 1, fixing to 0");
+        rto->inputIsYpBpR = 0;
+    }
+
+    uint8_t reset46 = GBS::RESET_CONTROL_0x46::read(); // for keeping these as they are now
+    uint8_t reset47 = GBS::RESET_CONTROL_0x47::read();
+
+    for (; y < 6; y++) {
+        writeOneByte(0xF0, (uint8_t)y);
+        switch (y) {
+            case 0:
+                for (int j = 0; j <= 1; j++) { // 2 times
+                    for (int x = 0; x <= 15; x++) {
+                        if (j == 0 && x == 4) {
+                            // keep DAC off
+                            if (rto->useHdmiSyncFix) {
+                                bank[x] = pgm_read_byte(programArray + index) & ~(1 << 0);
+                            } else {
+                                bank[x] = pgm_read_byte(programArray + index);
+                            }
+                        } else if (j == 0 && x == 6) {
+                            bank[x] = reset46;
+                        } else if (j == 0 && x == 7) {
+                            bank[x] = reset47;
+                        } else if (j == 0 && x == 9) {
+                            // keep sync output off
+                            if (rto->useHdmiSyncFix) {
+                                bank[x] = pgm_read_byte(programArray + index) | (1 << 2);
+                            } else {
+                                bank[x] = pgm_read_byte(programArray + index);
+                            }
+                        } else {
+                            // use preset values
+                            bank[x] = pgm_read_byte(programArray + index);
+                        }
+
+                        index++;
+                    }
+                    writeBytes(0x40 + (j * 16), bank, 16);
+                }
+                copyBank(bank, programArray, &index);
+                writeBytes(0x90, bank, 16);
+                break;
+            case 1:
+                for (int j = 0; j <= 2; j++) { // 3 times
+                    copyBank(bank, programArray, &index);
+                    if (j == 0) {
+                        bank[0] = bank[0] & ~(1 << 5); // clear 1_00 5
+                        bank[1] = bank[1] | (1 << 0);  // set 1_01 0
+                        bank[12] = bank[12] & 0x0f;    // clear 1_0c upper bits
+                        bank[13] = 0;                  // clear 1_0d
+                    }
+                    writeBytes(j * 16, bank, 16);
+                }
+                if (!skipMDSection) {
+                    loadPresetMdSection();
+                    if (rto->syncTypeCsync)
+                        GBS::MD_SEL_VGA60::write(0); // EDTV possible
+                    else
+                        GBS::MD_SEL_VGA60::write(1); // VGA 640x480 more likely
+
+                    GBS::MD_HD1250P_CNTRL::write(rto->medResLineCount); // patch med res support
+                }
+                break;
+            case 2:
+                loadPresetDeinterlacerSection();
+                break;
+            case 3:
+                for (int j = 0; j <= 7; j++) { // 8 times
+                    copyBank(bank, programArray, &index);
+                    //if (rto->useHdmiSyncFix) {
+                    //  if (j == 0) {
+                    //    bank[0] = bank[0] | (1 << 0); // 3_00 0 sync lock
+                    //  }
+                    //  if (j == 1) {
+                    //    bank[10] = bank[10] | (1 << 4); // 3_1a 4 frame lock
+                    //  }
+                    //}
+                    writeBytes(j * 16, bank, 16);
+                }
+                // blank out VDS PIP registers, otherwise they can end up uninitialized
+                for (int x = 0; x <= 15; x++) {
+                    writeOneByte(0x80 + x, 0x00);
+                }
+                break;
+            case 4:
+                for (int j = 0; j <= 5; j++) { // 6 times
+                    copyBank(bank, programArray, &index);
+                    writeBytes(j * 16, bank, 16);
+                }
+                break;
+            case 5:
+                for (int j = 0; j <= 6; j++) { // 7 times
+                    for (int x = 0; x <= 15; x++) {
+                        bank[x] = pgm_read_byte(programArray + index);
+                        if (index == 322) { // s5_02 bit 6+7 = input selector (only bit 6 is relevant)
+                            if (rto->inputIsYpBpR)
+                                bitClear(bank[x], 6);
+                            else
+                                bitSet(bank[x], 6);
+                        }
+                        if (index == 323) { // s5_03 set clamps according to input channel
+                            if (rto->inputIsYpBpR) {
+                                bitClear(bank[x], 2); // G bottom clamp
+                                bitSet(bank[x], 1);   // R mid clamp
+                                bitSet(bank[x], 3);   // B mid clamp
+                            } else {
+                                bitClear(bank[x], 2); // G bottom clamp
+                                bitClear(bank[x], 1); // R bottom clamp
+                                bitClear(bank[x], 3); // B bottom clamp
+                            }
+                        }
+                        //if (index == 324) { // s5_04 reset(0) for ADC REF init
+                        //  bank[x] = 0x00;
+                        //}
+                        if (index == 352) { // s5_20 always force to 0x02 (only SP_SOG_P_ATO)
+                            bank[x] = 0x02;
+                        }
+                        if (index == 375) { // s5_37
+                            if (videoStandardInputIsPalNtscSd()) {
+                                bank[x] = 0x6b;
+                            } else {
+                                bank[x] = 0x02;
+                            }
+                        }
+                        if (index == 382) {     // s5_3e
+                            bitSet(bank[x], 5); // SP_DIS_SUB_COAST = 1
+                        }
+                        if (index == 407) {     // s5_57
+                            bitSet(bank[x], 0); // SP_NO_CLAMP_REG = 1
+                        }
+                        index++;
+                    }
+                    writeBytes(j * 16, bank, 16);
+                }
+                break;
+        }
+    }
+
+    // scaling RGBHV mode
+    if (uopt->preferScalingRgbhv && rto->isValidForScalingRGBHV) {
+        GBS::GBS_OPTION_SCALING_RGBHV::write(1);
+        rto->videoStandardInput = 3;
+    }
+}
+
+void activeFrameTimeLockInitialSteps()
+{
+    // skip if using external clock gen
+    if (rto->extClockGenDetected) {
+        SerialM.println(F("Active FrameTime Lock enabled, adjusting external clock gen frequency"));
+        return;
+    }
+    // skip when out mode = bypass
+    if (rto->presetID != PresetHdBypass && rto->presetID != PresetBypassRGBHV) {
+        SerialM.print(F("Active FrameTime Lock enabled, disable if display unstable or stays blank! Method: "));
+        if (uopt->frameTimeLockMethod == 0) {
+            SerialM.println(F("0 (vtotal + VSST)"));
+        }
+        if (uopt->frameTimeLockMethod == 1) {
+            SerialM.println(F("1 (vtotal only)"));
+        }
+        if (GBS::VDS_VS_ST::read() == 0) {
+            // VS_ST needs to be at least 1, so method 1 can decrease it when needed (but currently only increases VS_ST)
+            // don't force this here, instead make sure to have all presets follow the rule (easier dev)
+            SerialM.println(F("Warning: Check VDS_VS_ST!"));
+        }
+    }
+}
+
+void resetInterruptSogSwitchBit()
+{
+    GBS::INT_CONTROL_RST_SOGSWITCH::write(1);
+    GBS::INT_CONTROL_RST_SOGSWITCH::write(0);
+    StatusSnapshot::invalidate();
+}
+
+void resetInterruptSogBadBit()
+{
+    GBS::INT_CONTROL_RST_SOGBAD::write(1);
+    GBS::INT_CONTROL_RST_SOGBAD::write(0);
+    StatusSnapshot::invalidate();
+}
+
+void setResetParameters()
+{
+    SerialM.println("<reset>");
+    rto->videoStandardInput = 0;
+    rto->videoIsFrozen = false;
+    rto->applyPresetDoneStage = 0;
+    rto->presetVlineShift = 0;
+    rto->sourceDisconnected = true;
+    rto->outModeHdBypass = 0;
+    rto->clampPositionIsSet = 0;
+    rto->coastPositionIsSet = 0;
+    rto->phaseIsSet = 0;
+    rto->continousStableCounter = 0;
+    rto->noSyncCounter = 0;
+    rto->isInLowPowerMode = false;
+    rto->currentLevelSOG = 5;
+    rto->thisSourceMaxLevelSOG = 31; // 31 = auto sog has not (yet) run
+    rto->failRetryAttempts = 0;
+    rto->HPLLState = 0;
+    rto->motionAdaptiveDeinterlaceActive = false;
+    rto->scanlinesEnabled = false;
+    rto->syncTypeCsync = false;
+    rto->isValidForScalingRGBHV = false;
+    rto->medResLineCount = 0x33; // 51*8=408
+    rto->osr = 0;
+    rto->useHdmiSyncFix = 0;
+    rto->notRecognizedCounter = 0;
+
+    adco->r_gain = 0;
+    adco->g_gain = 0;
+    adco->b_gain = 0;
+
+    // clear temp storage
+    GBS::ADC_UNUSED_64::write(0);
+    GBS::ADC_UNUSED_65::write(0);
+    GBS::ADC_UNUSED_66::write(0);
+    GBS::ADC_UNUSED_67::write(0);
+    GBS::GBS_PRESET_CUSTOM::write(0);
+    GBS::GBS_PRESET_ID::write(0);
+    GBS::GBS_OPTION_SCALING_RGBHV::write(0);
+    GBS::GBS_OPTION_PALFORCED60_ENABLED::write(0);
+
+    // set minimum IF parameters
+    GBS::IF_VS_SEL::write(1);
+    GBS::IF_VS_FLIP::write(1);
+    GBS::IF_HSYNC_RST::write(0x3FF);
+    GBS::IF_VB_ST::write(0);
+    GBS::IF_VB_SP::write(2);
+
+    // could stop ext clock gen output here?
+    FrameSync::cleanup();
+
+    GBS::OUT_SYNC_CNTRL::write(0);    // no H / V sync out to PAD
+    GBS::DAC_RGBS_PWDNZ::write(0);    // disable DAC
+    GBS::ADC_TA_05_CTRL::write(0x02); // 5_05 1 // minor SOG clamp effect
+    GBS::ADC_TEST_04::write(0x02);    // 5_04
+    GBS::ADC_TEST_0C::write(0x12);    // 5_0c 1 4
+    GBS::ADC_CLK_PA::write(0);        // 5_00 0/1 PA_ADC input clock = PLLAD CLKO2
+    GBS::ADC_SOGEN::write(1);
+    GBS::SP_SOG_MODE::write(1);
+    GBS::ADC_INPUT_SEL::write(1); // 1 = RGBS / RGBHV adc data input
+    GBS::ADC_POWDZ::write(1);     // ADC on
+    setAndUpdateSogLevel(rto->currentLevelSOG);
+    GBS::RESET_CONTROL_0x46::write(0x00); // all units off
+    GBS::RESET_CONTROL_0x47::write(0x00);
+    GBS::GPIO_CONTROL_00::write(0x67);     // most GPIO pins regular GPIO
+    GBS::GPIO_CONTROL_01::write(0x00);     // all GPIO outputs disabled
+    GBS::DAC_RGBS_PWDNZ::write(0);         // disable DAC (output)
+    GBS::PLL648_CONTROL_01::write(0x00);   // VCLK(1/2/4) display clock // needs valid for debug bus
+    GBS::PAD_CKIN_ENZ::write(0);           // 0 = clock input enable (pin40)
+    GBS::PAD_CKOUT_ENZ::write(1);          // clock output disable
+    GBS::IF_SEL_ADC_SYNC::write(1);        // ! 1_28 2
+    GBS::PLLAD_VCORST::write(1);           // reset = 1
+    GBS::PLL_ADS::write(1);                // When = 1, input clock is from ADC ( otherwise, from unconnected clock at pin 40 )
+    GBS::PLL_CKIS::write(0);               // PLL use OSC clock
+    GBS::PLL_MS::write(2);                 // fb memory clock can go lower power
+    GBS::PAD_CONTROL_00_0x48::write(0x2b); //disable digital inputs, enable debug out pin
+    GBS::PAD_CONTROL_01_0x49::write(0x1f); //pad control pull down/up transistors on
+    loadHdBypassSection();                 // 1_30 to 1_55
+    loadPresetMdSection();                 // 1_60 to 1_83
+    setAdcParametersGainAndOffset();
+    GBS::SP_PRE_COAST::write(9);    // was 0x07 // need pre / poast to allow all sources to detect
+    GBS::SP_POST_COAST::write(18);  // was 0x10 // ps2 1080p 18
+    GBS::SP_NO_COAST_REG::write(0); // can be 1 in some soft reset situations, will prevent sog vsync decoding << really?
+    GBS::SP_CS_CLP_ST::write(32);   // define it to something at start
+    GBS::SP_CS_CLP_SP::write(48);
+    GBS::SP_SOG_SRC_SEL::write(0);  // SOG source = ADC
+    GBS::SP_EXT_SYNC_SEL::write(0); // connect HV input ( 5_20 bit 3 )
+    GBS::SP_NO_CLAMP_REG::write(1);
+    GBS::PLLAD_ICP::write(0); // lowest charge pump current
+    GBS::PLLAD_FS::write(0);  // low gain (have to deal with cold and warm startups)
+    GBS::PLLAD_5_16::write(0x1f);
+    GBS::PLLAD_MD::write(0x700);
+    resetPLL(); // cycles PLL648
+    delay(2);
+    resetPLLAD();                            // same for PLLAD
+    GBS::PLL_VCORST::write(1);               // reset on
+    GBS::PLLAD_CONTROL_00_5x11::write(0x01); // reset on
+    resetDebugPort();
+
+    //GBS::RESET_CONTROL_0x47::write(0x16);
+    GBS::RESET_CONTROL_0x46::write(0x41);   // new 23.07.19
+    GBS::RESET_CONTROL_0x47::write(0x17);   // new 23.07.19 (was 0x16)
+    GBS::INTERRUPT_CONTROL_01::write(0xff); // enable interrupts
+    GBS::INTERRUPT_CONTROL_00::write(0xff); // reset irq status
+    GBS::INTERRUPT_CONTROL_00::write(0x00);
+    GBS::PAD_SYNC_OUT_ENZ::write(0); // sync output enabled, will be low (HC125 fix)
+    rto->clampPositionIsSet = 0;     // some functions override these, so make sure
+    rto->coastPositionIsSet = 0;
+    rto->phaseIsSet = 0;
+    rto->continousStableCounter = 0;
+    serialCommand = '@';
+    userCommand = '@';
+}
+
+void OutputComponentOrVGA()
+{
+
+    // TODO replace with rto->isCustomPreset?
+    boolean isCustomPreset = GBS::GBS_PRESET_CUSTOM::read();
+    if (uopt->wantOutputComponent) {
+        SerialM.println(F("Output Format: Component"));
+        GBS::VDS_SYNC_LEV::write(0x80); // 0.25Vpp sync (leave more room for Y)
+        GBS::VDS_CONVT_BYPS::write(1);  // output YUV
+        GBS::OUT_SYNC_CNTRL::write(0);  // no H / V sync out to PAD
+    } else {
+        GBS::VDS_SYNC_LEV::write(0);
+        GBS::VDS_CONVT_BYPS::write(0); // output RGB
+        GBS::OUT_SYNC_CNTRL::write(1); // H / V sync out enable
+    }
+
+    if (!isCustomPreset) {
+        if (rto->inputIsYpBpR == true) {
+            applyYuvPatches();
+        } else {
+            applyRGBPatches();
+        }
+    }
+}
+
+void applyComponentColorMixing()
+{
+    GBS::VDS_Y_GAIN::write(0x64);    // 3_35
+    GBS::VDS_UCOS_GAIN::write(0x19); // 3_36
+    GBS::VDS_VCOS_GAIN::write(0x19); // 3_37
+    GBS::VDS_Y_OFST::write(0xfe);    // 3_3a
+    GBS::VDS_U_OFST::write(0x01);    // 3_3b
+}
+
+void toggleIfAutoOffset()
+{
+    if (GBS::IF_AUTO_OFST_EN::read() == 0) {
+        // and different ADC offsets
+        GBS::ADC_ROFCTRL::write(0x40);
+        GBS::ADC_GOFCTRL::write(0x42);
+        GBS::ADC_BOFCTRL::write(0x40);
+        // enable
+        GBS::IF_AUTO_OFST_EN::write(1);
+        GBS::IF_AUTO_OFST_PRD::write(0); // 0 = by line, 1 = by frame
+    } else {
+        if (adco->r_off != 0 && adco->g_off != 0 && adco->b_off != 0) {
+            GBS::ADC_ROFCTRL::write(adco->r_off);
+            GBS::ADC_GOFCTRL::write(adco->g_off);
+            GBS::ADC_BOFCTRL::write(adco->b_off);
+        }
+        // adco->r_off = 0: auto calibration on boot failed, leave at current values
+        GBS::IF_AUTO_OFST_EN::write(0);
+        GBS::IF_AUTO_OFST_PRD::write(0); // 0 = by line, 1 = by frame
+    }
+}
+
+// blue only mode: t0t44t1 t0t44t4
+void applyYuvPatches()
+{
+    GBS::ADC_RYSEL_R::write(1);     // midlevel clamp red
+    GBS::ADC_RYSEL_B::write(1);     // midlevel clamp blue
+    GBS::ADC_RYSEL_G::write(0);     // gnd clamp green
+    GBS::DEC_MATRIX_BYPS::write(1); // ADC
+    GBS::IF_MATRIX_BYPS::write(1);
+
+    if (GBS::GBS_PRESET_CUSTOM::read() == 0) {
+        // colors
+        GBS::VDS_Y_GAIN::write(0x80);    // 3_25
+        GBS::VDS_UCOS_GAIN::write(0x1c); // 3_26
+        GBS::VDS_VCOS_GAIN::write(0x29); // 3_27
+        GBS::VDS_Y_OFST::write(0xFE);
+        GBS::VDS_U_OFST::write(0x03);
+        GBS::VDS_V_OFST::write(0x03);
+        if (rto->videoStandardInput >= 5 && rto->videoStandardInput <= 7) {
+            // todo: Rec. 709 (vs Rec. 601 used normally
+            // needs this on VDS and HDBypass
+        }
+    }
+
+    // if using ADC auto offset for yuv input / rgb output
+    //GBS::ADC_AUTO_OFST_EN::write(1);
+    //GBS::VDS_U_OFST::write(0x36);     //3_3b
+    //GBS::VDS_V_OFST::write(0x4d);     //3_3c
+
+    if (uopt->wantOutputComponent) {
+        applyComponentColorMixing();
+    }
+}
+
+// blue only mode: t0t44t1 t0t44t4
+void applyRGBPatches()
+{
+    GBS::ADC_RYSEL_R::write(0);     // gnd clamp red
+    GBS::ADC_RYSEL_B::write(0);     // gnd clamp blue
+    GBS::ADC_RYSEL_G::write(0);     // gnd clamp green
+    GBS::DEC_MATRIX_BYPS::write(0); // 5_1f 2 = 1 for YUV / 0 for RGB << using DEC matrix
+    GBS::IF_MATRIX_BYPS::write(1);
+
+    if (GBS::GBS_PRESET_CUSTOM::read() == 0) {
+        // colors
+        GBS::VDS_Y_GAIN::write(0x80); // 0x80 = 0
+        GBS::VDS_UCOS_GAIN::write(0x1c);
+        GBS::VDS_VCOS_GAIN::write(0x29); // 0x27 when using IF matrix, 0x29 for DEC matrix
+        GBS::VDS_Y_OFST::write(0x00);    // 0
+        GBS::VDS_U_OFST::write(0x00);    // 2
+        GBS::VDS_V_OFST::write(0x00);    // 2
+    }
+
+    if (uopt->wantOutputComponent) {
+        applyComponentColorMixing();
+    }
+}
+
+/// Write ADC gain registers, and save in adco->r_gain to properly transfer it
+/// across loading presets or passthrough.
+void setAdcGain(uint8_t gain) {
+    // gain is actually range, increasing it dims the image.
+    GBS::ADC_RGCTRL::write(gain);
+    GBS::ADC_GGCTRL::write(gain);
+    GBS::ADC_BGCTRL::write(gain);
+
+    // Save gain for applying preset. (Gain affects passthrough presets, and
+    // loading a passthrough preset loads from adco but doesn't save to it.)
+    adco->r_gain = gain;
+    adco->g_gain = gain;
+    adco->b_gain = gain;
+}
+
+void setAdcParametersGainAndOffset()
+{
+    GBS::ADC_ROFCTRL::write(0x40);
+    GBS::ADC_GOFCTRL::write(0x40);
+    GBS::ADC_BOFCTRL::write(0x40);
+
+    // Do not call setAdcGain() and overwrite adco->r_gain. This function should
+    // only be called during startup, or during doPostPresetLoadSteps(), and if
+    // `uopt->enableAutoGain == 1` then doPostPresetLoadSteps() will revert
+    // these writes with `adco->r_gain`.
+    GBS::ADC_RGCTRL::write(0x7B);
+    GBS::ADC_GGCTRL::write(0x7B);
+    GBS::ADC_BGCTRL::write(0x7B);
+}
+
+void updateHVSyncEdge()
+{
+    static uint8_t printHS = 0, printVS = 0;
+    uint16_t temp = 0;
+
+    if (GBS::STATUS_INT_SOG_BAD::read() == 1) {
+        resetInterruptSogBadBit();
+        return;
+    }
+
+    uint8_t syncStatus = GBS::STATUS_16::read();
+    if (rto->syncTypeCsync) {
+        // sog check, only check H
+        if ((syncStatus & 0x02) != 0x02)
+            return;
+    } else {
+        // HV check, check H + V
+        if ((syncStatus & 0x0a) != 0x0a)
+            return;
+    }
+
+    if ((syncStatus & 0x02) != 0x02) // if !hs active
+    {
+        //SerialM.println("(SP) can't detect sync edge");
+    } else {
+        if ((syncStatus & 0x01) == 0x00) {
+            if (printHS != 1) {
+                SerialM.println(F("(SP) HS active low"));
+            }
+            printHS = 1;
+
+            temp = GBS::HD_HS_SP::read();
+            if (GBS::HD_HS_ST::read() < temp) { // if out sync = ST < SP
+                GBS::HD_HS_SP::write(GBS::HD_HS_ST::read());
+                GBS::HD_HS_ST::write(temp);
+                GBS::SP_HS2PLL_INV_REG::write(1);
+                //GBS::SP_SOG_P_INV::write(0); // 5_20 2 //could also use 5_20 1 "SP_SOG_P_ATO"
+            }
+        } else {
+            if (printHS != 2) {
+                SerialM.println(F("(SP) HS active high"));
+            }
+            printHS = 2;
+
+            temp = GBS::HD_HS_SP::read();
+            if (GBS::HD_HS_ST::read() > temp) { // if out sync = ST > SP
+                GBS::HD_HS_SP::write(GBS::HD_HS_ST::read());
+                GBS::HD_HS_ST::write(temp);
+                GBS::SP_HS2PLL_INV_REG::write(0);
+                //GBS::SP_SOG_P_INV::write(1); // 5_20 2 //could also use 5_20 1 "SP_SOG_P_ATO"
+            }
+        }
+
+        // VS check, but only necessary for separate sync (CS should have VS always active low)
+        if (rto->syncTypeCsync == false) {
+            if ((syncStatus & 0x08) != 0x08) // if !vs active
+            {
+                Serial.println(F("VS can't detect sync edge"));
+            } else {
+                if ((syncStatus & 0x04) == 0x00) {
+                    if (printVS != 1) {
+                        SerialM.println(F("(SP) VS active low"));
+                    }
+                    printVS = 1;
+
+                    temp = GBS::HD_VS_SP::read();
+                    if (GBS::HD_VS_ST::read() < temp) { // if out sync = ST < SP
+                        GBS::HD_VS_SP::write(GBS::HD_VS_ST::read());
+                        GBS::HD_VS_ST::write(temp);
+                    }
+                } else {
+                    if (printVS != 2) {
+                        SerialM.println(F("(SP) VS active high"));
+                    }
+                    printVS = 2;
+
+                    temp = GBS::HD_VS_SP::read();
+                    if (GBS::HD_VS_ST::read() > temp) { // if out sync = ST > SP
+                        GBS::HD_VS_SP::write(GBS::HD_VS_ST::read());
+                        GBS::HD_VS_ST::write(temp);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void prepareSyncProcessor()
+{
+    writeOneByte(0xF0, 5);
+    GBS::SP_SOG_P_ATO::write(0); // 5_20 disable sog auto polarity // hpw can be > ht, but auto is worse
+    GBS::SP_JITTER_SYNC::write(0);
+    // H active detect control
+    writeOneByte(0x21, 0x18); // SP_SYNC_TGL_THD    H Sync toggle time threshold  0x20; lower than 5_33(not always); 0 to turn off (?) 0x18 for 53.69 system @ 33.33
+    writeOneByte(0x22, 0x0F); // SP_L_DLT_REG       Sync pulse width difference threshold (less than this = equal)
+    writeOneByte(0x23, 0x00); // UNDOCUMENTED       range from 0x00 to at least 0x1d
+    writeOneByte(0x24, 0x40); // SP_T_DLT_REG       H total width difference threshold rgbhv: b // range from 0x02 upwards
+    writeOneByte(0x25, 0x00); // SP_T_DLT_REG
+    writeOneByte(0x26, 0x04); // SP_SYNC_PD_THD     H sync pulse width threshold // from 0(?) to 0x50 // in yuv 720p range only to 0x0a!
+    writeOneByte(0x27, 0x00); // SP_SYNC_PD_THD
+    writeOneByte(0x2a, 0x0F); // SP_PRD_EQ_THD      How many legal lines as valid; scales with 5_33 (needs to be below)
+    // V active detect control
+    // these 4 only have effect with HV input; test:  s5s2ds34 s5s2es24 s5s2fs16 s5s31s84
+    writeOneByte(0x2d, 0x03); // SP_VSYNC_TGL_THD   V sync toggle time threshold // at 5 starts to drop many 0_16 vsync events
+    writeOneByte(0x2e, 0x00); // SP_SYNC_WIDTH_DTHD V sync pulse width threshold
+    writeOneByte(0x2f, 0x02); // SP_V_PRD_EQ_THD    How many continue legal v sync as valid // at 4 starts to drop 0_16 vsync events
+    writeOneByte(0x31, 0x2f); // SP_VT_DLT_REG      V total difference threshold
+    // Timer value control
+    writeOneByte(0x33, 0x3a); // SP_H_TIMER_VAL     H timer value for h detect (was 0x28)
+    writeOneByte(0x34, 0x06); // SP_V_TIMER_VAL     V timer for V detect // 0_16 vsactive // was 0x05
+    // Sync separation control
+    if (rto->videoStandardInput == 0)
+        GBS::SP_DLT_REG::write(0x70); // 5_35  130 too much for ps2 1080i, 0xb0 for 1080p
+    else if (rto->videoStandardInput <= 4)
+        GBS::SP_DLT_REG::write(0xC0); // old: extended to 0x150 later if mode = 1 or 2
+    else if (rto->videoStandardInput <= 6)
+        GBS::SP_DLT_REG::write(0xA0);
+    else if (rto->videoStandardInput == 7)
+        GBS::SP_DLT_REG::write(0x70);
+    else
+        GBS::SP_DLT_REG::write(0x70);
+
+    if (videoStandardInputIsPalNtscSd()) {
+        GBS::SP_H_PULSE_IGNOR::write(0x6b);
+    } else {
+        GBS::SP_H_PULSE_IGNOR::write(0x02); // test with MS / Genesis mode (wsog 2) vs ps2 1080p (0x13 vs 0x05)
+    }
+    // leave out pre / post coast here
+    // 5_3a  attempted 2 for 1chip snes 239 mode intermittency, works fine except for MD in MS mode
+    // make sure this is stored in the presets as well, as it affects sync time
+    GBS::SP_H_TOTAL_EQ_THD::write(3);
+
+    GBS::SP_SDCS_VSST_REG_H::write(0);
+    GBS::SP_SDCS_VSSP_REG_H::write(0);
+    GBS::SP_SDCS_VSST_REG_L::write(4); // 5_3f // was 12
+    GBS::SP_SDCS_VSSP_REG_L::write(1); // 5_40 // was 11
+
+    GBS::SP_CS_HS_ST::write(0x10); // 5_45
+    GBS::SP_CS_HS_SP::write(0x00); // 5_47 720p source needs ~20 range, may be necessary to adjust at runtime, based on source res
+
+    writeOneByte(0x49, 0x00); // retime HS start for RGB+HV rgbhv: 20
+    writeOneByte(0x4a, 0x00); //
+    writeOneByte(0x4b, 0x44); // retime HS stop rgbhv: 50
+    writeOneByte(0x4c, 0x00); //
+
+    writeOneByte(0x51, 0x02); // 0x00 rgbhv: 2
+    writeOneByte(0x52, 0x00); // 0xc0
+    writeOneByte(0x53, 0x00); // 0x05 rgbhv: 6
+    writeOneByte(0x54, 0x00); // 0xc0
+
+    if (rto->videoStandardInput != 15 && (GBS::GBS_OPTION_SCALING_RGBHV::read() != 1)) {
+        GBS::SP_CLAMP_MANUAL::write(0); // 0 = automatic on/off possible
+        GBS::SP_CLP_SRC_SEL::write(0);  // clamp source 1: pixel clock, 0: 27mhz // was 1 but the pixel clock isn't available at first
+        GBS::SP_NO_CLAMP_REG::write(1); // 5_57_0 unlock clamp
+        GBS::SP_SOG_MODE::write(1);
+        GBS::SP_H_CST_ST::write(0x10);   // 5_4d
+        GBS::SP_H_CST_SP::write(0x100);  // 5_4f
+        GBS::SP_DIS_SUB_COAST::write(0); // 5_3e 5
+        GBS::SP_H_PROTECT::write(1);     // SP_H_PROTECT on for detection
+        GBS::SP_HCST_AUTO_EN::write(0);
+        GBS::SP_NO_COAST_REG::write(0);
+    }
+
+    GBS::SP_HS_REG::write(1);          // 5_57 7
+    GBS::SP_HS_PROC_INV_REG::write(0); // no SP sync inversion
+    GBS::SP_VS_PROC_INV_REG::write(0); //
+
+    writeOneByte(0x58, 0x05); //rgbhv: 0
+    writeOneByte(0x59, 0x00); //rgbhv: 0
+    writeOneByte(0x5a, 0x01); //rgbhv: 0 // was 0x05 but 480p ps2 doesnt like it
+    writeOneByte(0x5b, 0x00); //rgbhv: 0
+    writeOneByte(0x5c, 0x03); //rgbhv: 0
+    writeOneByte(0x5d, 0x02); //rgbhv: 0 // range: 0 - 0x20 (how long should clamp stay off)
+}
+
+// Sync detect resolution: 5bits; comparator voltage range 10mv~320mv.
+// -> 10mV per step; if cables and source are to standard (level 6 = 60mV)
+void setAndUpdateSogLevel(uint8_t level)
+{
+    rto->currentLevelSOG = level & 0x1f;
+    GBS::ADC_SOGCTRL::write(level);
+    setAndLatchPhaseSP();
+    setAndLatchPhaseADC();
+    latchPLLAD();
+    GBS::INTERRUPT_CONTROL_00::write(0xff); // reset irq status
+    GBS::INTERRUPT_CONTROL_00::write(0x00);
+    StatusSnapshot::invalidate();
+    //Serial.print("sog: "); Serial.println(rto->currentLevelSOG);
+}
+
+// in operation: t5t04t1 for 10% lower power on ADC
+// also: s0s40s1c for 5% (lower memclock of 108mhz)
+// for some reason: t0t45t2 t0t45t4 (enable SDAC, output max voltage) 5% lower  done in presets
+// t0t4ft4 clock out should be off
+// s4s01s20 (was 30) faster latency // unstable at 108mhz
+// both phase controls off saves some power 506ma > 493ma
+// oversample ratio can save 10% at 1x
+// t3t24t3 VDS_TAP6_BYPS on can save 2%
+
+// Generally, the ADC has to stay enabled to perform SOG separation and thus "see" a source.
+// It is possible to run in low power mode.
+// Function should not further nest, so it can be called in syncwatcher
+void goLowPowerWithInputDetection()
+{
+    GBS::OUT_SYNC_CNTRL::write(0); // no H / V sync out to PAD
+    GBS::DAC_RGBS_PWDNZ::write(0); // direct disableDAC()
+    //zeroAll();
+    setResetParameters(); // includes rto->videoStandardInput = 0
+    prepareSyncProcessor();
+    delay(100);
+    rto->isInLowPowerMode = true;
+    SerialM.println(F("Scanning inputs for sources ..."));
+    LEDOFF;
+}
+
+// counts STATUS_SYNC_PROC_HTOTAL readings that miss the pixel clock at one phaseSP step
+// stopAtFirst: only need to know whether the step is clean
+uint8_t countBadHtAtPhaseSP(uint8_t phase, uint16_t pixelClock, boolean stopAtFirst, uint16_t &reads)
+{
+    uint8_t badHt = 0;
+    Scheduler::yield(); // between steps, never inside the sample window
+    rto->phaseSP = phase & 0x1f;
+    setAndLatchPhaseSP();
+    delayMicroseconds(256);
+    for (uint8_t i = 0; i < 20; i++) {
+        reads++;
+        if (GBS::STATUS_SYNC_PROC_HTOTAL::read() != pixelClock) {
+            badHt++;
+            if (stopAtFirst) {
+                break;
+            }
+            delayMicroseconds(384);
+        }
+    }
+    return badHt;
+}
+
+boolean optimizePhaseSP()
+{
+    uint16_t pixelClock = GBS::PLLAD_MD::read();
+    uint8_t badHt = 0, prevBadHt = 0, worstBadHt = 0, worstPhaseSP = 0, prevPrevBadHt = 0, goodHt = 0;
+    boolean runTest = 1;
+
+    if (GBS::STATUS_SYNC_PROC_HTOTAL::read() < (pixelClock - 8)) {
+        return 0;
+    }
+    if (GBS::STATUS_SYNC_PROC_HTOTAL::read() > (pixelClock + 8)) {
+        return 0;
+    }
+
+    if (rto->currentLevelSOG <= 2) {
+        // not very stable, use fixed values
+        rto->phaseSP = 16;
+        rto->phaseADC = 16;
+        if (rto->videoStandardInput > 0 && rto->videoStandardInput <= 4) {
+            if (rto->osr == 4) {
+                rto->phaseADC += 16;
+                rto->phaseADC &= 0x1f;
+            }
+        }
+        delay(8);    // a bit longer, to match default run time
+        runTest = 0; // skip to end
+    }
+
+    //unsigned long startTime = millis();
+
+    if (runTest) {
+        uint16_t reads = 0;
+        boolean searchDone = 0;
+
+        // coarse to fine: every 4th phase step first, to find the bad region quickly
+        uint8_t coarseBadHt[8];
+        uint8_t goodCoarse = 0, worstCoarse = 0, worstCoarseSum = 0;
+        for (uint8_t u = 0; u < 8; u++) {
+            coarseBadHt[u] = countBadHtAtPhaseSP(u * 4, pixelClock, 0, reads);
+            if (coarseBadHt[u] == 0) {
+                goodCoarse++;
+            }
+        }
+        for (uint8_t u = 0; u < 8; u++) {
+            uint8_t sum = coarseBadHt[(u + 7) & 7] + coarseBadHt[u] + coarseBadHt[(u + 1) & 7];
+            if (sum > worstCoarseSum) {
+                worstCoarseSum = sum;
+                worstCoarse = u * 4;
+            }
+        }
+
+        if (goodCoarse < 4) {
+            //Serial.println("pxClk unstable");
+            return 0;
+        }
+
+        if (worstCoarseSum == 0) {
+            searchDone = 1; // all clean, worstBadHt stays 0
+        } else {
+            // fine steps around the worst coarse step, 3 sample window as in the full sweep
+            uint8_t fineBadHt[9];
+            for (uint8_t i = 0; i < 9; i++) {
+                int8_t offset = i - 4;
+                if (offset == 0) {
+                    fineBadHt[i] = coarseBadHt[worstCoarse / 4];
+                } else if (i == 0 || i == 8) {
+                    fineBadHt[i] = coarseBadHt[((worstCoarse / 4) + (i == 0 ? 7 : 1)) & 7];
+                } else {
+                    fineBadHt[i] = countBadHtAtPhaseSP(worstCoarse + offset, pixelClock, 0, reads);
+                }
+            }
+            for (uint8_t i = 1; i < 8; i++) {
+                uint8_t sum = fineBadHt[i - 1] + fineBadHt[i] + fineBadHt[i + 1];
+                if (sum > worstBadHt) {
+                    worstBadHt = sum;
+                    worstPhaseSP = (worstCoarse + i - 4) & 0x1f;
+                }
+            }
+
+            // confirm the opposite phase sits in a clean window, stop at the first bad reading
+            uint8_t candidate = worstPhaseSP + 16;
+            searchDone = countBadHtAtPhaseSP(candidate, pixelClock, 1, reads) == 0 &&
+                         countBadHtAtPhaseSP(candidate - 1, pixelClock, 1, reads) == 0 &&
+                         countBadHtAtPhaseSP(candidate + 1, pixelClock, 1, reads) == 0;
+        }
+
+        if (!searchDone) {
+            // no clean window where expected, fall back to the full sweep
+            worstBadHt = 0;
+            worstPhaseSP = 0;
+            // 32 distinct phase settings, 3 average samples (missing 2 phase steps) > 34
+            for (uint8_t u = 0; u < 34; u++) {
+                badHt = countBadHtAtPhaseSP(rto->phaseSP + 1, pixelClock, 0, reads);
+                // if average 3 samples has more badHt than seen yet, this phase step is worse
+                if ((badHt + prevBadHt + prevPrevBadHt) > worstBadHt) {
+                    worstBadHt = (badHt + prevBadHt + prevPrevBadHt);
+                    worstPhaseSP = (rto->phaseSP - 1) & 0x1f; // medium of 3 samples
+                }
+
+                if (badHt == 0) {
+                    // count good readings as well, to know whether the entire run is valid
+                    goodHt++;
+                }
+
+                prevPrevBadHt = prevBadHt;
+                prevBadHt = badHt;
+                //Serial.print(rto->phaseSP); Serial.print(" badHt: "); Serial.println(badHt);
+            }
+
+            //Serial.println(goodHt);
+
+            if (goodHt < 17) {
+                //Serial.println("pxClk unstable");
+                return 0;
+            }
+        }
+
+        SerialM.print(F("phaseSP search: "));
+        SerialM.print(reads);
+        SerialM.println(searchDone ? F(" reads") : F(" reads (full sweep)"));
+
+        // adjust global phase values according to test results
+        if (worstBadHt != 0) {
+            rto->phaseSP = (worstPhaseSP + 16) & 0x1f;
+            // assume color signals arrive at same time: phase adc = phase sp
+            // test in hdbypass mode shows this is more related to sog.. the assumptions seem fine at sog = 8
+            rto->phaseADC = 16; //(rto->phaseSP) & 0x1f;
+
+            // different OSR require different phase angles, also depending on bypass, etc
+            // shift ADC phase 180 degrees for the following
+            if (rto->videoStandardInput >= 5 && rto->videoStandardInput <= 7) {
+                if (rto->osr == 2) {
+                    //Serial.println("shift adc phase");
+                    rto->phaseADC += 16;
+                    rto->phaseADC &= 0x1f;
+                }
+            } else if (rto->videoStandardInput > 0 && rto->videoStandardInput <= 4) {
+                if (rto->osr == 4) {
+                    //Serial.println("shift adc phase");
+                    rto->phaseADC += 16;
+                    rto->phaseADC &= 0x1f;
+                }
+            }
+        } else {
+            // test was always good, so choose any reasonable value
+            rto->phaseSP = 16;
+            rto->phaseADC = 16;
+            if (rto->videoStandardInput > 0 && rto->videoStandardInput <= 4) {
+                if (rto->osr == 4) {
+                    rto->phaseADC += 16;
+                    rto->phaseADC &= 0x1f;
+                }
+            }
+        }
+    }
+
+    //Serial.println(millis() - startTime);
+    //Serial.print("worstPhaseSP: "); Serial.println(worstPhaseSP);
+
+    /*static uint8_t lastLevelSOG = 99;
+  if (lastLevelSOG != rto->currentLevelSOG) {
+    SerialM.print("Phase: "); SerialM.print(rto->phaseSP);
+    SerialM.print(" SOG: ");  SerialM.print(rto->currentLevelSOG);
+    SerialM.println();
+  }
+  lastLevelSOG = rto->currentLevelSOG;*/
+
+    setAndLatchPhaseSP();
+    delay(1);
+    setAndLatchPhaseADC();
+
+    return 1;
+}
+
+void optimizeSogLevel()
+{
+    if (rto->boardHasPower == false) // checkBoardPower is too invasive now
+    {
+        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 13;
+        return;
+    }
+    if (rto->videoStandardInput == 15 || GBS::SP_SOG_MODE::read() != 1 || rto->syncTypeCsync == false) {
+        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 13;
+        return;
+    }
+
+    if (rto->inputIsYpBpR) {
+        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 14;
+    } else {
+        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 13; // similar to yuv, allow variations
+    }
+    setAndUpdateSogLevel(rto->currentLevelSOG);
+
+    uint8_t debug_backup = GBS::TEST_BUS_SEL::read();
+    uint8_t debug_backup_SP = GBS::TEST_BUS_SP_SEL::read();
+    if (debug_backup != 0xa) {
+        GBS::TEST_BUS_SEL::write(0xa);
+        delay(1);
+    }
+    if (debug_backup_SP != 0x0f) {
+        GBS::TEST_BUS_SP_SEL::write(0x0f);
+        delay(1);
+    }
+
+    GBS::TEST_BUS_EN::write(1);
+
+    delay(100);
+    while (1) {
+        uint16_t syncGoodCounter = 0;
+        unsigned long timeout = millis();
+        while ((millis() - timeout) < 60) {
+            if (GBS::STATUS_SYNC_PROC_HSACT::read() == 1) {
+                syncGoodCounter++;
+                if (syncGoodCounter >= 60) {
+                    break;
+                }
+            } else if (syncGoodCounter >= 4) {
+                syncGoodCounter -= 3;
+            }
+        }
+
+        if (syncGoodCounter >= 60) {
+            syncGoodCounter = 0;
+            //if (getVideoMode() != 0) {
+            if (GBS::TEST_BUS_2F::read() > 0) {
+                delay(20);
+                for (int a = 0; a < 50; a++) {
+                    syncGoodCounter++;
+                    if (GBS::STATUS_SYNC_PROC_HSACT::read() == 0 || GBS::TEST_BUS_2F::read() == 0) {
+                        syncGoodCounter = 0;
+                        break;
+                    }
+                }
+                if (syncGoodCounter >= 49) {
+                    //SerialM.print("OK @SOG "); SerialM.println(rto->currentLevelSOG); printInfo();
+                    break; // found, exit
+                } else {
+                    //Serial.print(" inner test failed syncGoodCounter: "); Serial.println(syncGoodCounter);
+                }
+            } else { // getVideoMode() == 0
+                     //Serial.print("sog-- syncGoodCounter: "); Serial.println(syncGoodCounter);
+            }
+        } else { // syncGoodCounter < 40
+                 //Serial.print("outer test failed syncGoodCounter: "); Serial.println(syncGoodCounter);
+        }
+
+        if (rto->currentLevelSOG >= 2) {
+            rto->currentLevelSOG -= 1;
+            setAndUpdateSogLevel(rto->currentLevelSOG);
+            delay(8); // time for sog to settle
+        } else {
+            rto->currentLevelSOG = 13; // leave at default level
+            setAndUpdateSogLevel(rto->currentLevelSOG);
+            delay(8);
+            break; // break and exit
+        }
+    }
+
+    rto->thisSourceMaxLevelSOG = rto->currentLevelSOG;
+    if (rto->thisSourceMaxLevelSOG == 0) {
+        rto->thisSourceMaxLevelSOG = 1; // fail safe
+    }
+
+    if (debug_backup != 0xa) {
+        GBS::TEST_BUS_SEL::write(debug_backup);
+    }
+    if (debug_backup_SP != 0x0f) {
+        GBS::TEST_BUS_SP_SEL::write(debug_backup_SP);
+    }
+}
+
+// fingerprint of the currently detected source, key for the source settings cache
+void readSourceFingerprint(SourceFingerprint &fp)
+{
+    StatusSnapshot::invalidate();
+    fp.hperiod = StatusSnapshot::get<GBS::HPERIOD_IF>();
+    fp.vperiod = StatusSnapshot::get<GBS::VPERIOD_IF>();
+    fp.spHtotal = StatusSnapshot::get<GBS::STATUS_SYNC_PROC_HTOTAL>();
+    fp.spVtotal = StatusSnapshot::get<GBS::STATUS_SYNC_PROC_VTOTAL>();
+    fp.videoMode = rto->videoStandardInput;
+    fp.presetID = rto->presetID;
+    fp.syncTypeCsync = rto->syncTypeCsync;
+    fp.inputPort = GBS::ADC_INPUT_SEL::read();
+}
+
+// for a source seen before, reapply SOG level, phases, best htotal, ADC gains and the
+// auto geometry result in one go instead of running optimizeSogLevel() / optimizePhaseSP() /
+// runAutoBestHTotal() / AutoGeometry::run()
+boolean restoreSourceSettingsFromCache()
+{
+    if (!rto->boardHasPower || rto->videoStandardInput == 0 || rto->videoStandardInput >= 14) {
+        return 0;
+    }
+
+    SourceFingerprint fp;
+    readSourceFingerprint(fp);
+    SourceCacheEntry *entry = SourceCache::find(fp);
+    if (entry == nullptr) {
+        return 0;
+    }
+    const SourceSettings &cached = entry->settings;
+
+    rto->phaseSP = cached.phaseSP & 0x1f;
+    rto->phaseADC = cached.phaseADC & 0x1f;
+    if (rto->syncTypeCsync && GBS::SP_SOG_MODE::read() == 1) {
+        setAndUpdateSogLevel(cached.levelSOG); // also latches both phases
+        rto->thisSourceMaxLevelSOG = (rto->currentLevelSOG == 0) ? 1 : rto->currentLevelSOG;
+    } else {
+        setAndLatchPhaseSP();
+        delay(1);
+        setAndLatchPhaseADC();
+    }
+    delay(8); // time for sog to settle
+
+    // validate: same criterion as a clean optimizePhaseSP() step
+    uint16_t pixelClock = GBS::PLLAD_MD::read();
+    uint8_t badHt = 0;
+    for (uint8_t i = 0; i < 20; i++) {
+        if (GBS::STATUS_SYNC_PROC_HTOTAL::read() != pixelClock) {
+            badHt++;
+        }
+    }
+    StatusSnapshot::invalidate();
+    if (badHt > 2 || !getStatus16SpHsStable()) {
+        SerialM.println(F("cached source settings rejected"));
+        SourceCache::forget(fp);
+        return 0;
+    }
+
+    if (uopt->enableAutoGain && cached.g_gain != 0) {
+        GBS::ADC_RGCTRL::write(cached.r_gain);
+        GBS::ADC_GGCTRL::write(cached.g_gain);
+        GBS::ADC_BGCTRL::write(cached.b_gain);
+        adco->r_gain = cached.r_gain;
+        adco->g_gain = cached.g_gain;
+        adco->b_gain = cached.b_gain;
+    }
+
+    if (cached.bestHtotal != 0 && rto->autoBestHtotalEnabled && !rto->outModeHdBypass) {
+        applyBestHTotal(cached.bestHtotal);
+    }
+
+    if (uopt->enableAutoGeometry && cached.geometrySet && !rto->outModeHdBypass) {
+        Geometry::Timings now = Geometry::read();
+        Geometry::readSource(now);
+        Geometry::Target target = Geometry::targetOf(now);
+        target.hscale = cached.hscale;
+        target.vscale = cached.vscale;
+        target.hCenter = cached.hCenter;
+        target.vStart = cached.vStart;
+        target.srcStart = cached.srcStart;
+        Geometry::apply(now, target);
+        rto->autoGeometryIsSet = 1;
+    }
+
+    rto->phaseIsSet = 1;
+    SerialM.print(F("restored cached source settings, SOG: "));
+    SerialM.print(rto->currentLevelSOG);
+    SerialM.print(F(" phase: "));
+    SerialM.println(rto->phaseSP);
+    return 1;
+}
+
+// remember the tuning results for the current source, see restoreSourceSettingsFromCache()
+void storeSourceSettingsToCache()
+{
+    if (rto->videoStandardInput == 0 || rto->videoStandardInput >= 14 || !rto->phaseIsSet) {
+        return;
+    }
+
+    SourceFingerprint fp;
+    readSourceFingerprint(fp);
+
+    SourceSettings settings;
+    memset(&settings, 0, sizeof(settings)); // padding too, store() compares bytes
+    settings.bestHtotal = (FrameSync::ready() && !rto->outModeHdBypass) ? GBS::VDS_HSYNC_RST::read() : 0;
+    settings.phaseSP = rto->phaseSP;
+    settings.phaseADC = rto->phaseADC;
+    settings.levelSOG = rto->currentLevelSOG;
+    if (uopt->enableAutoGain) {
+        settings.r_gain = adco->r_gain;
+        settings.g_gain = adco->g_gain;
+        settings.b_gain = adco->b_gain;
+    } else {
+        settings.r_gain = settings.g_gain = settings.b_gain = 0;
+    }
+    if (rto->autoGeometryIsSet && !rto->outModeHdBypass) {
+        // as it is now, manual adjustments after auto geometry included
+        Geometry::Timings now = Geometry::read();
+        Geometry::readSource(now);
+        Geometry::Target target = Geometry::targetOf(now);
+        settings.hscale = target.hscale;
+        settings.vscale = target.vscale;
+        settings.hCenter = target.hCenter;
+        settings.vStart = target.vStart;
+        settings.srcStart = target.srcStart;
+        settings.geometrySet = 1;
+    }
+
+    if (SourceCache::store(fp, settings)) {
+        SerialM.println(F("source settings cached"));
+    }
+}
+
+// GBS boards have 2 potential sync sources:
+// - RCA connectors
+// - VGA input / 5 pin RGBS header / 8 pin VGA header (all 3 are shared electrically)
+// This routine looks for sync on the currently active input. If it finds it, the input is returned.
+// If it doesn't find sync, it switches the input and returns 0, so that an active input will be found eventually.
+uint8_t detectAndSwitchToActiveInput()
+{ // if any
+    uint8_t currentInput = GBS::ADC_INPUT_SEL::read();
+    unsigned long timeout = millis();
+    while (millis() - timeout < 450) {
+        delay(10);
+        Scheduler::yield();
+
+        boolean stable = getStatus16SpHsStable();
+        if (stable) {
+            currentInput = GBS::ADC_INPUT_SEL::read();
+            SerialM.print(F("Activity detected, input: "));
+            if (currentInput == 1)
+                SerialM.println("RGB");
+            else
+                SerialM.println(F("Component"));
+
+            if (currentInput == 1) { // RGBS or RGBHV
+                boolean vsyncActive = 0;
+                rto->inputIsYpBpR = false; // declare for MD
+                rto->currentLevelSOG = 13; // test startup with MD and MS separately!
+                setAndUpdateSogLevel(rto->currentLevelSOG);
+
+                unsigned long timeOutStart = millis();
+                // vsync test
+                // 360ms good up to 5_34 SP_V_TIMER_VAL = 0x0b
+                while (!vsyncActive && ((millis() - timeOutStart) < 360)) {
+                    vsyncActive = GBS::STATUS_SYNC_PROC_VSACT::read();
+                    Scheduler::yield(); // wifi stack
+                    delay(1);
+                }
+
+                // if VSync is active, it's RGBHV or RGBHV with CSync on HS pin
+                if (vsyncActive) {
+                    SerialM.println(F("VSync: present"));
+                    GBS::MD_SEL_VGA60::write(1); // VGA 640x480 more likely than EDTV
+                    boolean hsyncActive = 0;
+
+                    timeOutStart = millis();
+                    while (!hsyncActive && millis() - timeOutStart < 400) {
+                        hsyncActive = GBS::STATUS_SYNC_PROC_HSACT::read();
+                        Scheduler::yield(); // wifi stack
+                        delay(1);
+                    }
+
+                    if (hsyncActive) {
+                        SerialM.print(F("HSync: present"));
+                        // The HSync and SOG pins are setup to detect CSync, if present
+                        // (SOG mode on, coasting setup, debug bus setup, etc)
+                        // SP_H_PROTECT is needed for CSync with a VS source present as well
+                        GBS::SP_H_PROTECT::write(1);
+                        delay(120);
+
+                        short decodeSuccess = 0;
+                        for (int i = 0; i < 3; i++) {
+                            // no success if: no signal at all (returns 0.0f), no embedded VSync (returns ~18.5f)
+                            // todo: this takes a while with no csync present
+                            rto->syncTypeCsync = 1; // temporary for test
+                            float sfr = getSourceFieldRate(1);
+                            rto->syncTypeCsync = 0; // undo
+                            if (sfr > 40.0f)
+                                decodeSuccess++; // properly decoded vsync from 40 to xx Hz
+                        }
+
+                        if (decodeSuccess >= 2) {
+                            SerialM.println(F(" (with CSync)"));
+                            GBS::SP_PRE_COAST::write(0x10); // increase from 9 to 16 (EGA 364)
+                            delay(40);
+                            rto->syncTypeCsync = true;
+                        } else {
+                            SerialM.println();
+                            rto->syncTypeCsync = false;
+                        }
+
+                        // check for 25khz, all regular SOG modes first // update: only check for mode 8
+                        // MD reg for medium res starts at 0x2C and needs 16 loops to ramp to max of 0x3C (vt 360 .. 496)
+                        // if source is HS+VS, can't detect via MD unit, need to set 5_11=0x92 and look at vt: counter
+                        for (uint8_t i = 0; i < 16; i++) {
+                            //printInfo();
+                            uint8_t innerVideoMode = getVideoMode();
+                            if (innerVideoMode == 8) {
+                                setAndUpdateSogLevel(rto->currentLevelSOG);
+                                rto->medResLineCount = GBS::MD_HD1250P_CNTRL::read();
+                                SerialM.println(F("med res"));
+
+                                return 1;
+                            }
+                            // update 25khz detection
+                            GBS::MD_HD1250P_CNTRL::write(GBS::MD_HD1250P_CNTRL::read() + 1);
+                            //Serial.println(GBS::MD_HD1250P_CNTRL::read(), HEX);
+                            delay(30);
+                        }
+
+                        rto->videoStandardInput = 15;
+                        // exception: apply preset here, not later in syncwatcher
+                        applyPresets(rto->videoStandardInput);
+                        delay(100);
+
+                        return 3;
+                    } else {
+                        // need to continue looking
+                        SerialM.println(F("but no HSync!"));
+                    }
+                }
+
+                if (!vsyncActive) { // then do RGBS check
+                    rto->syncTypeCsync = true;
+                    GBS::MD_SEL_VGA60::write(0); // EDTV60 more likely than VGA60
+                    uint16_t testCycle = 0;
+                    timeOutStart = millis();
+                    while ((millis() - timeOutStart) < 6000) {
+                        delay(2);
+                        if (getVideoMode() > 0) {
+                            if (getVideoMode() != 8) { // if it's mode 8, need to set stuff first
+                                return 1;
+                            }
+                        }
+                        testCycle++;
+                        // post coast 18 can mislead occasionally (SNES 239 mode)
+                        // but even then it still detects the video mode pretty well
+                        if ((testCycle % 150) == 0) {
+                            if (rto->currentLevelSOG == 1) {
+                                rto->currentLevelSOG = 2;
+                            } else {
+                                rto->currentLevelSOG += 2;
+                            }
+                            if (rto->currentLevelSOG >= 15) {
+                                rto->currentLevelSOG = 1;
+                            }
+                            setAndUpdateSogLevel(rto->currentLevelSOG);
+                        }
+
+                        // new: check for 25khz, use regular scaling route for those
+                        if (getVideoMode() == 8) {
+                            rto->currentLevelSOG = rto->thisSourceMaxLevelSOG = 13;
+                            setAndUpdateSogLevel(rto->currentLevelSOG);
+                            rto->medResLineCount = GBS::MD_HD1250P_CNTRL::read();
+                            SerialM.println(F("med res"));
+                            return 1;
+                        }
+
+                        uint8_t currentMedResLineCount = GBS::MD_HD1250P_CNTRL::read();
+                        if (currentMedResLineCount < 0x3c) {
+                            GBS::MD_HD1250P_CNTRL::write(currentMedResLineCount + 1);
+                        } else {
+                            GBS::MD_HD1250P_CNTRL::write(0x33);
+                        }
+                        //Serial.println(GBS::MD_HD1250P_CNTRL::read(), HEX);
+                    }
+
+                    //rto->currentLevelSOG = rto->thisSourceMaxLevelSOG = 13;
+                    //setAndUpdateSogLevel(rto->currentLevelSOG);
+
+                    return 1; //anyway, let later stage deal with it
+                }
+
+                GBS::SP_SOG_MODE::write(1);
+                resetSyncProcessor();
+                resetModeDetect(); // there was some signal but we lost it. MD is stuck anyway, so reset
+                delay(40);
+            } else if (currentInput == 0) { // YUV
+                uint16_t testCycle = 0;
+                rto->inputIsYpBpR = true;    // declare for MD
+                GBS::MD_SEL_VGA60::write(0); // EDTV more likely than VGA 640x480
+
+                unsigned long timeOutStart = millis();
+                while ((millis() - timeOutStart) < 6000) {
+                    delay(2);
+                    if (getVideoMode() > 0) {
+                        return 2;
+                    }
+
+                    testCycle++;
+                    if ((testCycle % 180) == 0) {
+                        if (rto->currentLevelSOG == 1) {
+                            rto->currentLevelSOG = 2;
+                        } else {
+                            rto->currentLevelSOG += 2;
+                        }
+                        if (rto->currentLevelSOG >= 16) {
+                            rto->currentLevelSOG = 1;
+                        }
+                        setAndUpdateSogLevel(rto->currentLevelSOG);
+                        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG;
+                    }
+                }
+
+                rto->currentLevelSOG = rto->thisSourceMaxLevelSOG = 14;
+                setAndUpdateSogLevel(rto->currentLevelSOG);
+
+                return 2; //anyway, let later stage deal with it
+            }
+
+            SerialM.println(" lost..");
+            rto->currentLevelSOG = 2;
+            setAndUpdateSogLevel(rto->currentLevelSOG);
+        }
+
+        GBS::ADC_INPUT_SEL::write(!currentInput); // can only be 1 or 0
+        delay(200);
+
+        return 0; // don't do the check on the new input here, wait till next run
+    }
+
+    return 0;
+}
+
+uint8_t inputAndSyncDetect()
+{
+    uint8_t syncFound = detectAndSwitchToActiveInput();
+
+    if (syncFound == 0) {
+        if (!getSyncPresent()) {
+            if (rto->isInLowPowerMode == false) {
+                rto->sourceDisconnected = true;
+                rto->videoStandardInput = 0;
+                // reset to base settings, then go to low power
+                GBS::SP_SOG_MODE::write(1);
+                goLowPowerWithInputDetection();
+                rto->isInLowPowerMode = true;
+            }
+        }
+        return 0;
+    } else if (syncFound == 1) { // input is RGBS
+        rto->inputIsYpBpR = 0;
+        rto->sourceDisconnected = false;
+        rto->isInLowPowerMode = false;
+        resetDebugPort();
+        applyRGBPatches();
+        LEDON;
+        return 1;
+    } else if (syncFound == 2) {
+        rto->inputIsYpBpR = 1;
+        rto->sourceDisconnected = false;
+        rto->isInLowPowerMode = false;
+        resetDebugPort();
+        applyYuvPatches();
+        LEDON;
+        return 2;
+    } else if (syncFound == 3) { // input is RGBHV
+        //already applied
+        rto->isInLowPowerMode = false;
+        rto->inputIsYpBpR = 0;
+        rto->sourceDisconnected = false;
+        rto->videoStandardInput = 15;
+        resetDebugPort();
+        LEDON;
+        return 3;
+    }
+
+    return 0;
+}
+
+uint8_t getSingleByteFromPreset(const uint8_t *programArray, unsigned int offset)
+{
+    return pgm_read_byte(programArray + offset);
+}
+
+static inline void readFromRegister(uint8_t reg, int bytesToRead, uint8_t *output)
+{
+    return GBS::read(lastSegment, reg, output, bytesToRead);
+}
+
+void printReg(uint8_t seg, uint8_t reg)
+{
+    uint8_t readout;
+    readFromRegister(reg, 1, &readout);
+    // didn't think this HEX trick would work, but it does! (?)
+    SerialM.print("0x");
+    SerialM.print(readout, HEX);
+    SerialM.print(", // s");
+    SerialM.print(seg);
+    SerialM.print("_");
+    SerialM.println(reg, HEX);
+    // old:
+    //SerialM.print(readout); SerialM.print(", // s"); SerialM.print(seg); SerialM.print("_"); SerialM.println(reg, HEX);
+}
+
+// dumps the current chip configuration in a format that's ready to use as new preset :)
+void dumpRegisters(byte segment)
+{
+    if (segment > 5)
+        return;
+    writeOneByte(0xF0, segment);
+
+    switch (segment) {
+        case 0:
+            for (int x = 0x40; x <= 0x5F; x++) {
+                printReg(0, x);
+            }
+            for (int x = 0x90; x <= 0x9F; x++) {
+                printReg(0, x);
+            }
+            break;
+        case 1:
+            for (int x = 0x0; x <= 0x2F; x++) {
+                printReg(1, x);
+            }
+            break;
+        case 2:
+            for (int x = 0x0; x <= 0x3F; x++) {
+                printReg(2, x);
+            }
+            break;
+        case 3:
+            for (int x = 0x0; x <= 0x7F; x++) {
+                printReg(3, x);
+            }
+            break;
+        case 4:
+            for (int x = 0x0; x <= 0x5F; x++) {
+                printReg(4, x);
+            }
+            break;
+        case 5:
+            for (int x = 0x0; x <= 0x6F; x++) {
+                printReg(5, x);
+            }
+            break;
+    }
+}
+
+void resetPLLAD()
+{
+    GBS::PLLAD_VCORST::write(1);
+    GBS::PLLAD_PDZ::write(1); // in case it was off
+    latchPLLAD();
+    GBS::PLLAD_VCORST::write(0);
+    delay(1);
+    latchPLLAD();
+    rto->clampPositionIsSet = 0; // test, but should be good
+    rto->continousStableCounter = 1;
+}
+
+void latchPLLAD()
+{
+    GBS::PLLAD_LAT::write(0);
+    delayMicroseconds(128);
+    GBS::PLLAD_LAT::write(1);
+}
+
+void resetPLL()
+{
+    GBS::PLL_VCORST::write(1);
+    delay(1);
+    GBS::PLL_VCORST::write(0);
+    delay(1);
+    rto->clampPositionIsSet = 0; // test, but should be good
+    rto->continousStableCounter = 1;
+}
+
+void ResetSDRAM()
+{
+    //GBS::SDRAM_RESET_CONTROL::write(0x87); // enable "Software Control SDRAM Idle Period" and "SDRAM_START_INITIAL_CYCLE"
+    //GBS::SDRAM_RESET_SIGNAL::write(1);
+    //GBS::SDRAM_RESET_SIGNAL::write(0);
+    //GBS::SDRAM_START_INITIAL_CYCLE::write(0);
+    GBS::SDRAM_RESET_CONTROL::write(0x02);
+    GBS::SDRAM_RESET_SIGNAL::write(1);
+    GBS::SDRAM_RESET_SIGNAL::write(0);
+    GBS::SDRAM_RESET_CONTROL::write(0x82);
+}
+
+// soft reset cycle
+// This restarts all chip units, which is sometimes required when important config bits are changed.
+void resetDigital()
+{
+    boolean keepBypassActive = 0;
+    if (GBS::SFTRST_HDBYPS_RSTZ::read() == 1) { // if HDBypass enabled
+        keepBypassActive = 1;
+    }
+
+    //GBS::RESET_CONTROL_0x47::write(0x00);
+    GBS::RESET_CONTROL_0x47::write(0x17); // new, keep 0,1,2,4 on (DEC,MODE,SYNC,INT) //MODE okay?
+
+    if (rto->outModeHdBypass) { // if currently in bypass
+        GBS::RESET_CONTROL_0x46::write(0x00);
+        GBS::RESET_CONTROL_0x47::write(0x1F);
+        return; // 0x46 stays all 0
+    }
+
+    GBS::RESET_CONTROL_0x46::write(0x41); // keep VDS (6) + IF (0) enabled, reset rest
+    if (keepBypassActive == 1) {          // if HDBypass enabled
+        GBS::RESET_CONTROL_0x47::write(0x1F);
+    }
+    //else {
+    //  GBS::RESET_CONTROL_0x47::write(0x17);
+    //}
+    GBS::RESET_CONTROL_0x46::write(0x7f);
+}
+
+void resetSyncProcessor()
+{
+    GBS::SFTRST_SYNC_RSTZ::write(0);
+    delayMicroseconds(10);
+    GBS::SFTRST_SYNC_RSTZ::write(1);
+    StatusSnapshot::invalidate();
+    //rto->clampPositionIsSet = false;  // resetSyncProcessor is part of autosog
+    //rto->coastPositionIsSet = false;
+}
+
+void resetModeDetect()
+{
+    GBS::SFTRST_MODE_RSTZ::write(0);
+    delay(1); // needed
+    GBS::SFTRST_MODE_RSTZ::write(1);
+    StatusSnapshot::invalidate();
+    //rto->clampPositionIsSet = false;
+    //rto->coastPositionIsSet = false;
+}
+
+void shiftHorizontal(uint16_t amountToShift, bool subtracting)
+{
+    Geometry::Timings now = Geometry::read();
+    Geometry::Target target = Geometry::targetOf(now);
+    target.hCenter += subtracting ? -(int16_t)amountToShift : amountToShift;
+    Geometry::apply(now, target);
+}
+
+void shiftHorizontalLeft()
+{
+    shiftHorizontal(4, true);
+}
+
+void shiftHorizontalRight()
+{
+    shiftHorizontal(4, false);
+}
+
+// unused but may become useful
+// moves the IF horizontal blanking by amount input clocks. Both ends wrap at the
+// line length the same way, so a shift and the opposite one cancel.
+void shiftHorizontalIF(int16_t amount)
+{
+    uint16_t PLLAD_MD = GBS::PLLAD_MD::read();
+
+    if (rto->videoStandardInput <= 2) {
+        GBS::IF_HSYNC_RST::write(PLLAD_MD / 2); // input line length from pll div
+    } else if (rto->videoStandardInput <= 7) {
+        GBS::IF_HSYNC_RST::write(PLLAD_MD);
+    }
+    uint16_t IF_HSYNC_RST = GBS::IF_HSYNC_RST::read();
+
+    GBS::IF_LINE_SP::write(IF_HSYNC_RST + 1);
+    GBS::IF_HB_ST2::write(Geometry::wrap(GBS::IF_HB_ST2::read() + amount, 0, IF_HSYNC_RST));
+    GBS::IF_HB_SP2::write(Geometry::wrap(GBS::IF_HB_SP2::read() + amount, 0, IF_HSYNC_RST));
+}
+
+void shiftHorizontalLeftIF(uint8_t amount)
+{
+    shiftHorizontalIF(amount);
+}
+
+void shiftHorizontalRightIF(uint8_t amount)
+{
+    shiftHorizontalIF(-(int16_t)amount);
+}
+
+void scaleHorizontal(uint16_t amountToScale, bool subtracting)
+{
+    Geometry::Timings now = Geometry::read();
+    Geometry::Target target = Geometry::targetOf(now);
+    uint16_t hscale = now.hscale;
+
+    // smooth out areas of interest
+    if (subtracting && (hscale == 513 || hscale == 512))
+        amountToScale = 1;
+    if (!subtracting && (hscale == 511 || hscale == 512))
+        amountToScale = 1;
+
+    if (subtracting && (((int)hscale - amountToScale) <= 256)) {
+        hscale = 256;
+        SerialM.println("limit");
+    } else if (subtracting) {
+        hscale -= amountToScale;
+    } else if (hscale + amountToScale <= 1023) {
+        hscale += amountToScale; // exact max is bypass
+    } else {
+        hscale = 1023;
+        SerialM.println("limit");
+    }
+
+    // fetch window follows the scale around the picture center, see geometry.h
+    target.hscale = hscale;
+    Geometry::apply(now, target);
+    SerialM.print("HScale: ");
+    SerialM.println(hscale);
+}
+
+// moves horizontal sync (VDS or HDB as needed)
+void moveHS(uint16_t amountToAdd, bool subtracting)
+{
+    if (rto->outModeHdBypass) {
+        uint16_t SP_CS_HS_ST = GBS::SP_CS_HS_ST::read();
+        uint16_t SP_CS_HS_SP = GBS::SP_CS_HS_SP::read();
+        uint16_t htotal = GBS::HD_HSYNC_RST::read();
+
+        if (videoStandardInputIsPalNtscSd()) {
+            htotal -= 8; // account for the way hdbypass is setup in setOutModeHdBypass()
+            htotal *= 2;
+        }
+
+        if (htotal == 0)
+            return; // safety
+        int16_t amount = subtracting ? (0 - amountToAdd) : amountToAdd;
+
+        if (SP_CS_HS_ST + amount < 0) {
+            SP_CS_HS_ST = htotal + SP_CS_HS_ST; // yep, this works :p
+        }
+        if (SP_CS_HS_SP + amount < 0) {
+            SP_CS_HS_SP = htotal + SP_CS_HS_SP;
+        }
+
+        GBS::SP_CS_HS_ST::write((SP_CS_HS_ST + amount) % htotal);
+        GBS::SP_CS_HS_SP::write((SP_CS_HS_SP + amount) % htotal);
+
+        SerialM.print("HSST: ");
+        SerialM.print(GBS::SP_CS_HS_ST::read());
+        SerialM.print(" HSSP: ");
+        SerialM.println(GBS::SP_CS_HS_SP::read());
+    } else {
+        uint16_t VDS_HS_ST = GBS::VDS_HS_ST::read();
+        uint16_t VDS_HS_SP = GBS::VDS_HS_SP::read();
+        uint16_t htotal = GBS::VDS_HSYNC_RST::read();
+
+        if (htotal == 0)
+            return; // safety
+        int16_t amount = subtracting ? (0 - amountToAdd) : amountToAdd;
+
+        if (VDS_HS_ST + amount < 0) {
+            VDS_HS_ST = htotal + VDS_HS_ST; // yep, this works :p
+        }
+        if (VDS_HS_SP + amount < 0) {
+            VDS_HS_SP = htotal + VDS_HS_SP;
+        }
+
+        GBS::VDS_HS_ST::write((VDS_HS_ST + amount) % htotal);
+        GBS::VDS_HS_SP::write((VDS_HS_SP + amount) % htotal);
+
+        //SerialM.print("HSST: "); SerialM.print(GBS::VDS_HS_ST::read());
+        //SerialM.print(" HSSP: "); SerialM.println(GBS::VDS_HS_SP::read());
+    }
+    printVideoTimings();
+}
+
+void moveVS(uint16_t amountToAdd, bool subtracting)
+{
+    uint16_t vtotal = GBS::VDS_VSYNC_RST::read();
+    if (vtotal == 0)
+        return; // safety
+    uint16_t VDS_DIS_VB_ST = GBS::VDS_DIS_VB_ST::read();
+    uint16_t newVDS_VS_ST = GBS::VDS_VS_ST::read();
+    uint16_t newVDS_VS_SP = GBS::VDS_VS_SP::read();
+
+    if (subtracting) {
+        if ((newVDS_VS_ST - amountToAdd) > VDS_DIS_VB_ST) {
+            newVDS_VS_ST -= amountToAdd;
+            newVDS_VS_SP -= amountToAdd;
+        } else
+            SerialM.println("limit");
+    } else {
+        if ((newVDS_VS_SP + amountToAdd) < vtotal) {
+            newVDS_VS_ST += amountToAdd;
+            newVDS_VS_SP += amountToAdd;
+        } else
+            SerialM.println("limit");
+    }
+    //SerialM.print("VSST: "); SerialM.print(newVDS_VS_ST);
+    //SerialM.print(" VSSP: "); SerialM.println(newVDS_VS_SP);
+
+    GBS::VDS_VS_ST::write(newVDS_VS_ST);
+    GBS::VDS_VS_SP::write(newVDS_VS_SP);
+}
+
+void invertHS()
+{
+    uint8_t high, low;
+    uint16_t newST, newSP;
+
+    writeOneByte(0xf0, 3);
+    readFromRegister(0x0a, 1, &low);
+    readFromRegister(0x0b, 1, &high);
+    newST = ((((uint16_t)high) & 0x000f) << 8) | (uint16_t)low;
+    readFromRegister(0x0b, 1, &low);
+    readFromRegister(0x0c, 1, &high);
+    newSP = ((((uint16_t)high) & 0x00ff) << 4) | ((((uint16_t)low) & 0x00f0) >> 4);
+
+    uint16_t temp = newST;
+    newST = newSP;
+    newSP = temp;
+
+    writeOneByte(0x0a, (uint8_t)(newST & 0x00ff));
+    writeOneByte(0x0b, ((uint8_t)(newSP & 0x000f) << 4) | ((uint8_t)((newST & 0x0f00) >> 8)));
+    writeOneByte(0x0c, (uint8_t)((newSP & 0x0ff0) >> 4));
+}
+
+void invertVS()
+{
+    uint8_t high, low;
+    uint16_t newST, newSP;
+
+    writeOneByte(0xf0, 3);
+    readFromRegister(0x0d, 1, &low);
+    readFromRegister(0x0e, 1, &high);
+    newST = ((((uint16_t)high) & 0x000f) << 8) | (uint16_t)low;
+    readFromRegister(0x0e, 1, &low);
+    readFromRegister(0x0f, 1, &high);
+    newSP = ((((uint16_t)high) & 0x00ff) << 4) | ((((uint16_t)low) & 0x00f0) >> 4);
+
+    uint16_t temp = newST;
+    newST = newSP;
+    newSP = temp;
+
+    writeOneByte(0x0d, (uint8_t)(newST & 0x00ff));
+    writeOneByte(0x0e, ((uint8_t)(newSP & 0x000f) << 4) | ((uint8_t)((newST & 0x0f00) >> 8)));
+    writeOneByte(0x0f, (uint8_t)((newSP & 0x0ff0) >> 4));
+}
+
+void scaleVertical(uint16_t amountToScale, bool subtracting)
+{
+    Geometry::Timings now = Geometry::read();
+    Geometry::Target target = Geometry::targetOf(now);
+    uint16_t vscale = now.vscale;
+
+    // smooth out areas of interest
+    if (subtracting && (vscale == 513 || vscale == 512))
+        amountToScale = 1;
+    if (subtracting && (vscale == 684 || vscale == 683))
+        amountToScale = 1;
+    if (!subtracting && (vscale == 511 || vscale == 512))
+        amountToScale = 1;
+    if (!subtracting && (vscale == 682 || vscale == 683))
+        amountToScale = 1;
+
+    if (subtracting && (vscale - amountToScale > 128)) {
+        vscale -= amountToScale;
+    } else if (subtracting) {
+        vscale = 128;
+    } else if (vscale + amountToScale <= 1023) {
+        vscale += amountToScale;
+    } else if (vscale + amountToScale > 1023) {
+        vscale = 1023;
+        // don't enable vscale bypass here, since that disables ie line filter
+    }
+
+    SerialM.print("VScale: ");
+    SerialM.println(vscale);
+    target.vscale = vscale;
+    Geometry::apply(now, target);
+}
+
+// moves VBSP, VBST follows at VBSP-2
+void shiftVertical(uint16_t amountToAdd, bool subtracting)
+{
+    Geometry::Timings now = Geometry::read();
+    Geometry::Target target = Geometry::targetOf(now);
+    target.vStart += subtracting ? -(int16_t)amountToAdd : amountToAdd;
+    Geometry::apply(now, target);
+}
+
+void shiftVerticalUp()
+{
+    shiftVertical(1, true);
+}
+
+void shiftVerticalDown()
+{
+    shiftVertical(1, false);
+}
+
+void shiftVerticalUpIF()
+{
+    Geometry::Timings now = Geometry::read();
+    Geometry::readSource(now);
+    Geometry::Target target = Geometry::targetOf(now);
+    target.srcStart += 2; // wraps to the top at the end of the source lines
+    Geometry::apply(now, target);
+}
+
+void shiftVerticalDownIF()
+{
+    Geometry::Timings now = Geometry::read();
+    Geometry::readSource(now);
+    Geometry::Target target = Geometry::targetOf(now);
+    target.srcStart -= 2;
+    Geometry::apply(now, target);
+}
+
+void setHSyncStartPosition(uint16_t value)
+{
+    if (rto->outModeHdBypass) {
+        //GBS::HD_HS_ST::write(value);
+        GBS::SP_CS_HS_ST::write(value);
+    } else {
+        GBS::VDS_HS_ST::write(value);
+    }
+}
+
+void setHSyncStopPosition(uint16_t value)
+{
+    if (rto->outModeHdBypass) {
+        //GBS::HD_HS_SP::write(value);
+        GBS::SP_CS_HS_SP::write(value);
+    } else {
+        GBS::VDS_HS_SP::write(value);
+    }
+}
+
+void setMemoryHblankStartPosition(uint16_t value)
+{
+    GBS::VDS_HB_ST::write(value);
+    GBS::HD_HB_ST::write(value);
+}
+
+void setMemoryHblankStopPosition(uint16_t value)
+{
+    GBS::VDS_HB_SP::write(value);
+    GBS::HD_HB_SP::write(value);
+}
+
+void setDisplayHblankStartPosition(uint16_t value)
+{
+    GBS::VDS_DIS_HB_ST::write(value);
+}
+
+void setDisplayHblankStopPosition(uint16_t value)
+{
+    GBS::VDS_DIS_HB_SP::write(value);
+}
+
+void setVSyncStartPosition(uint16_t value)
+{
+    GBS::VDS_VS_ST::write(value);
+    GBS::HD_VS_ST::write(value);
+}
+
+void setVSyncStopPosition(uint16_t value)
+{
+    GBS::VDS_VS_SP::write(value);
+    GBS::HD_VS_SP::write(value);
+}
+
+void setMemoryVblankStartPosition(uint16_t value)
+{
+    GBS::VDS_VB_ST::write(value);
+    GBS::HD_VB_ST::write(value);
+}
+
+void setMemoryVblankStopPosition(uint16_t value)
+{
+    GBS::VDS_VB_SP::write(value);
+    GBS::HD_VB_SP::write(value);
+}
+
+void setDisplayVblankStartPosition(uint16_t value)
+{
+    GBS::VDS_DIS_VB_ST::write(value);
+}
+
+void setDisplayVblankStopPosition(uint16_t value)
+{
+    GBS::VDS_DIS_VB_SP::write(value);
+}
+
+uint16_t getCsVsStart()
+{
+    return (GBS::SP_SDCS_VSST_REG_H::read() << 8) + GBS::SP_SDCS_VSST_REG_L::read();
+}
+
+uint16_t getCsVsStop()
+{
+    return (GBS::SP_SDCS_VSSP_REG_H::read() << 8) + GBS::SP_SDCS_VSSP_REG_L::read();
+}
+
+void setCsVsStart(uint16_t start)
+{
+    GBS::SP_SDCS_VSST_REG_H::write(start >> 8);
+    GBS::SP_SDCS_VSST_REG_L::write(start & 0xff);
+}
+
+void setCsVsStop(uint16_t stop)
+{
+    GBS::SP_SDCS_VSSP_REG_H::write(stop >> 8);
+    GBS::SP_SDCS_VSSP_REG_L::write(stop & 0xff);
+}
+
+void printVideoTimings()
+{
+    if (rto->presetID < 0x20) {
+        SerialM.println("");
+        SerialM.print(F("HT / scale   : "));
+        SerialM.print(GBS::VDS_HSYNC_RST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::VDS_HSCALE::read());
+        SerialM.print(F("HS ST/SP     : "));
+        SerialM.print(GBS::VDS_HS_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::VDS_HS_SP::read());
+        SerialM.print(F("HB ST/SP(d)  : "));
+        SerialM.print(GBS::VDS_DIS_HB_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::VDS_DIS_HB_SP::read());
+        SerialM.print(F("HB ST/SP     : "));
+        SerialM.print(GBS::VDS_HB_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::VDS_HB_SP::read());
+        SerialM.println(F("------"));
+        // vertical
+        SerialM.print(F("VT / scale   : "));
+        SerialM.print(GBS::VDS_VSYNC_RST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::VDS_VSCALE::read());
+        SerialM.print(F("VS ST/SP     : "));
+        SerialM.print(GBS::VDS_VS_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::VDS_VS_SP::read());
+        SerialM.print(F("VB ST/SP(d)  : "));
+        SerialM.print(GBS::VDS_DIS_VB_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::VDS_DIS_VB_SP::read());
+        SerialM.print(F("VB ST/SP     : "));
+        SerialM.print(GBS::VDS_VB_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::VDS_VB_SP::read());
+        // IF V offset
+        SerialM.print(F("IF VB ST/SP  : "));
+        SerialM.print(GBS::IF_VB_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::IF_VB_SP::read());
+    } else {
+        SerialM.println("");
+        SerialM.print(F("HD_HSYNC_RST : "));
+        SerialM.println(GBS::HD_HSYNC_RST::read());
+        SerialM.print(F("HD_INI_ST    : "));
+        SerialM.println(GBS::HD_INI_ST::read());
+        SerialM.print(F("HS ST/SP     : "));
+        SerialM.print(GBS::SP_CS_HS_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::SP_CS_HS_SP::read());
+        SerialM.print(F("HB ST/SP     : "));
+        SerialM.print(GBS::HD_HB_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::HD_HB_SP::read());
+        SerialM.println(F("------"));
+        // vertical
+        SerialM.print(F("VS ST/SP     : "));
+        SerialM.print(GBS::HD_VS_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::HD_VS_SP::read());
+        SerialM.print(F("VB ST/SP     : "));
+        SerialM.print(GBS::HD_VB_ST::read());
+        SerialM.print(" ");
+        SerialM.println(GBS::HD_VB_SP::read());
+    }
+
+    SerialM.print(F("CsVT         : "));
+    SerialM.println(GBS::STATUS_SYNC_PROC_VTOTAL::read());
+    SerialM.print(F("CsVS_ST/SP   : "));
+    SerialM.print(getCsVsStart());
+    SerialM.print(F(" "));
+    SerialM.println(getCsVsStop());
+}
+
+void set_htotal(uint16_t htotal)
+{
+    // ModeLine "1280x960" 108.00 1280 1376 1488 1800 960 961 964 1000 +HSync +VSync
+    // front porch: H2 - H1: 1376 - 1280
+    // back porch : H4 - H3: 1800 - 1488
+    // sync pulse : H3 - H2: 1488 - 1376
+
+    uint16_t h_blank_display_start_position = htotal - 1;
+    uint16_t h_blank_display_stop_position = htotal - ((htotal * 3) / 4);
+    uint16_t center_blank = ((h_blank_display_stop_position / 2) * 3) / 4; // a bit to the left
+    uint16_t h_sync_start_position = center_blank - (center_blank / 2);
+    uint16_t h_sync_stop_position = center_blank + (center_blank / 2);
+    uint16_t h_blank_memory_start_position = h_blank_display_start_position - 1;
+    uint16_t h_blank_memory_stop_position = h_blank_display_stop_position - (h_blank_display_stop_position / 50);
+
+    GBS::VDS_HSYNC_RST::write(htotal);
+    GBS::VDS_HS_ST::write(h_sync_start_position);
+    GBS::VDS_HS_SP::write(h_sync_stop_position);
+    GBS::VDS_DIS_HB_ST::write(h_blank_display_start_position);
+    GBS::VDS_DIS_HB_SP::write(h_blank_display_stop_position);
+    GBS::VDS_HB_ST::write(h_blank_memory_start_position);
+    GBS::VDS_HB_SP::write(h_blank_memory_stop_position);
+}
+
+void set_vtotal(uint16_t vtotal)
+{
+    uint16_t VDS_DIS_VB_ST = vtotal - 2;                         // just below vtotal
+    uint16_t VDS_DIS_VB_SP = (vtotal >> 6) + 8;                  // positive, above new sync stop position
+    uint16_t VDS_VB_ST = ((uint16_t)(vtotal * 0.016f)) & 0xfffe; // small fraction of vtotal
+    uint16_t VDS_VB_SP = VDS_VB_ST + 2;                          // always VB_ST + 2
+    uint16_t v_sync_start_position = 1;
+    uint16_t v_sync_stop_position = 5;
+    // most low line count formats have negative sync!
+    // exception: 1024x768 (1344x806 total) has both sync neg. // also 1360x768 (1792x795 total)
+    if ((vtotal < 530) || (vtotal >= 803 && vtotal <= 809) || (vtotal >= 793 && vtotal <= 798)) {
+        uint16_t temp = v_sync_start_position;
+        v_sync_start_position = v_sync_stop_position;
+        v_sync_stop_position = temp;
+    }
+
+    GBS::VDS_VSYNC_RST::write(vtotal);
+    GBS::VDS_VS_ST::write(v_sync_start_position);
+    GBS::VDS_VS_SP::write(v_sync_stop_position);
+    GBS::VDS_VB_ST::write(VDS_VB_ST);
+    GBS::VDS_VB_SP::write(VDS_VB_SP);
+    GBS::VDS_DIS_VB_ST::write(VDS_DIS_VB_ST);
+    GBS::VDS_DIS_VB_SP::write(VDS_DIS_VB_SP);
+
+    // VDS_VSYN_SIZE1 + VDS_VSYN_SIZE2 to VDS_VSYNC_RST + 2
+    GBS::VDS_VSYN_SIZE1::write(GBS::VDS_VSYNC_RST::read() + 2);
+    GBS::VDS_VSYN_SIZE2::write(GBS::VDS_VSYNC_RST::read() + 2);
+}
+
+void resetDebugPort()
+{
+    GBS::PAD_BOUT_EN::write(1); // output to pad enabled
+    GBS::IF_TEST_EN::write(1);
+    GBS::IF_TEST_SEL::write(3);    // IF vertical period signal
+    GBS::TEST_BUS_SEL::write(0xa); // test bus to SP
+    GBS::TEST_BUS_EN::write(1);
+    GBS::TEST_BUS_SP_SEL::write(0x0f); // SP test signal select (vsync in, after SOG separation)
+    GBS::MEM_FF_TOP_FF_SEL::write(1);  // g0g13/14 shows FIFO stats (capture, rff, wff, etc)
+    // SP test bus enable bit is included in TEST_BUS_SP_SEL
+    GBS::VDS_TEST_EN::write(1); // VDS test enable
+}
+
+void readEeprom()
+{
+    int addr = 0;
+    const uint8_t eepromAddr = 0x50;
+    Wire.beginTransmission(eepromAddr);
+    //if (addr >= 0x1000) { addr = 0; }
+    Wire.write(addr >> 8);     // high addr byte, 4 bits +
+    Wire.write((uint8_t)addr); // low addr byte, 8 bits = 12 bits (0xfff max)
+    Wire.endTransmission();
+    Wire.requestFrom(eepromAddr, (uint8_t)128);
+    uint8_t readData = 0;
+    uint8_t i = 0;
+    while (Wire.available()) {
+        Serial.print("addr 0x");
+        Serial.print(i, HEX);
+        Serial.print(": 0x");
+        readData = Wire.read();
+        Serial.println(readData, HEX);
+        //addr++;
+        i++;
+    }
+}
+
+void setIfHblankParameters()
+{
+    if (!rto->outModeHdBypass) {
+        uint16_t pll_divider = GBS::PLLAD_MD::read();
+
+        // if line doubling (PAL, NTSC), div 2 + a couple pixels
+        GBS::IF_HSYNC_RST::write(((pll_divider >> 1) + 13) & 0xfffe); // 1_0e
+        GBS::IF_LINE_SP::write(GBS::IF_HSYNC_RST::read() + 1);        // 1_22
+        if (rto->presetID == 0x05) {
+            // override for 1080p manually for now (pll_divider alone isn't correct :/)
+            GBS::IF_HSYNC_RST::write(GBS::IF_HSYNC_RST::read() + 32);
+            GBS::IF_LINE_SP::write(GBS::IF_LINE_SP::read() + 32);
+        }
+        if (rto->presetID == 0x15) {
+            GBS::IF_HSYNC_RST::write(GBS::IF_HSYNC_RST::read() + 20);
+            GBS::IF_LINE_SP::write(GBS::IF_LINE_SP::read() + 20);
+        }
+
+        if (GBS::IF_LD_RAM_BYPS::read()) {
+            // no LD = EDTV or similar
+            GBS::IF_HB_SP2::write((uint16_t)((float)pll_divider * 0.06512f) & 0xfffe); // 1_1a // 0.06512f
+            // pll_divider / 2 - 3 is minimum IF_HB_ST2
+            GBS::IF_HB_ST2::write((uint16_t)((float)pll_divider * 0.4912f) & 0xfffe); // 1_18
+        } else {
+            // LD mode (PAL, NTSC)
+            GBS::IF_HB_SP2::write(4 + ((uint16_t)((float)pll_divider * 0.0224f) & 0xfffe)); // 1_1a
+            GBS::IF_HB_ST2::write((uint16_t)((float)pll_divider * 0.4550f) & 0xfffe);       // 1_18
+
+            if (GBS::IF_HB_ST2::read() >= 0x420) {
+                // limit (fifo?) (0x420 = 1056) (might be 0x424 instead)
+                // limit doesn't apply to EDTV modes, where 1_18 typically = 0x4B0
+                GBS::IF_HB_ST2::write(0x420);
+            }
+
+            if (rto->presetID == 0x05 || rto->presetID == 0x15) {
+                // override 1_1a for 1080p manually for now (pll_divider alone isn't correct :/)
+                GBS::IF_HB_SP2::write(0x2A);
+            }
+
+            // position move via 1_26 and reserve for deinterlacer: add IF RST pixels
+            // seems no extra pixels available at around PLLAD:84A or 2122px
+            //uint16_t currentRst = GBS::IF_HSYNC_RST::read();
+            //GBS::IF_HSYNC_RST::write((currentRst + (currentRst / 15)) & 0xfffe);  // 1_0e
+            //GBS::IF_LINE_SP::write(GBS::IF_HSYNC_RST::read() + 1);                // 1_22
+        }
+    }
+}
+
+void fastGetBestHtotal()
+{
+    uint32_t inStart, inStop;
+    signed long inPeriod = 1;
+    double inHz = 1.0;
+    GBS::TEST_BUS_SEL::write(0xa);
+    if (FrameSync::vsyncInputSample(&inStart, &inStop)) {
+        inPeriod = (inStop - inStart) >> 1;
+        if (inPeriod > 1) {
+            inHz = (double)1000000 / (double)inPeriod;
+        }
+        SerialM.print("inPeriod: ");
+        SerialM.println(inPeriod);
+        SerialM.print("in hz: ");
+        SerialM.println(inHz);
+    } else {
+        SerialM.println("error");
+    }
+
+    uint16_t newVtotal = GBS::VDS_VSYNC_RST::read();
+    double bestHtotal = 108000000 / ((double)newVtotal * inHz); // 107840000
+    double bestHtotal50 = 108000000 / ((double)newVtotal * 50);
+    double bestHtotal60 = 108000000 / ((double)newVtotal * 60);
+    SerialM.print("newVtotal: ");
+    SerialM.println(newVtotal);
+    // display clock probably not exact 108mhz
+    SerialM.print("bestHtotal: ");
+    SerialM.println(bestHtotal);
+    SerialM.print("bestHtotal50: ");
+    SerialM.println(bestHtotal50);
+    SerialM.print("bestHtotal60: ");
+    SerialM.println(bestHtotal60);
+    if (bestHtotal > 800 && bestHtotal < 3200) {
+        //applyBestHTotal((uint16_t)bestHtotal);
+        //FrameSync::resetWithoutRecalculation(); // was single use of this function, function has changed since
+    }
+}
+
+boolean runAutoBestHTotal()
+{
+    if (!FrameSync::ready() && rto->autoBestHtotalEnabled == true && rto->videoStandardInput > 0 && rto->videoStandardInput < 15) {
+
+        //Serial.println("running");
+        //unsigned long startTime = millis();
+
+        boolean stableNow = 1;
+
+        for (uint8_t i = 0; i < 64; i++) {
+            if (!getStatus16SpHsStable()) {
+                stableNow = 0;
+                //Serial.println("prevented: !getStatus16SpHsStable");
+                break;
+            }
+        }
+
+        if (stableNow) {
+            if (GBS::STATUS_INT_SOG_BAD::read()) {
+                //Serial.println("prevented_2!");
+                resetInterruptSogBadBit();
+                delay(40);
+                stableNow = false;
+            }
+            resetInterruptSogBadBit();
+
+            if (stableNow && (getVideoMode() == rto->videoStandardInput)) {
+                uint8_t testBusSelBackup = GBS::TEST_BUS_SEL::read();
+                uint8_t vdsBusSelBackup = GBS::VDS_TEST_BUS_SEL::read();
+                uint8_t ifBusSelBackup = GBS::IF_TEST_SEL::read();
+
+                if (testBusSelBackup != 0)
+                    GBS::TEST_BUS_SEL::write(0); // needs decimation + if
+                if (vdsBusSelBackup != 0)
+                    GBS::VDS_TEST_BUS_SEL::write(0); // VDS test # 0 = VBlank
+                if (ifBusSelBackup != 3)
+                    GBS::IF_TEST_SEL::write(3); // IF averaged frame time
+
+                yield();
+                uint16_t bestHTotal = FrameSync::init(); // critical task
+                yield();
+
+                GBS::TEST_BUS_SEL::write(testBusSelBackup); // always restore from backup (TB has changed)
+                if (vdsBusSelBackup != 0)
+                    GBS::VDS_TEST_BUS_SEL::write(vdsBusSelBackup);
+                if (ifBusSelBackup != 3)
+                    GBS::IF_TEST_SEL::write(ifBusSelBackup);
+
+                if (GBS::STATUS_INT_SOG_BAD::read()) {
+                    //Serial.println("prevented_5 INT_SOG_BAD!");
+                    stableNow = false;
+                }
+                for (uint8_t i = 0; i < 16; i++) {
+                    if (!getStatus16SpHsStable()) {
+                        stableNow = 0;
+                        //Serial.println("prevented_5: !getStatus16SpHsStable");
+                        break;
+                    }
+                }
+                resetInterruptSogBadBit();
+
+                if (bestHTotal > 4095) {
+                    if (!rto->forceRetime) {
+                        stableNow = false;
+                    } else {
+                        // roll with it
+                        bestHTotal = 4095;
+                    }
+                }
+
+                if (stableNow) {
+                    for (uint8_t i = 0; i < 24; i++) {
+                        delay(1);
+                        if (!getStatus16SpHsStable()) {
+                            stableNow = false;
+                            //Serial.println("prevented_3!");
+                            break;
+                        }
+                    }
+                }
+
+                if (bestHTotal > 0 && stableNow) {
+                    boolean success = applyBestHTotal(bestHTotal);
+                    if (success) {
+                        rto->syncLockFailIgnore = 16;
+                        //Serial.print("ok, took: ");
+                        //Serial.println(millis() - startTime);
+                        return true; // success
+                    }
+                }
+            }
+        }
+
+        // reaching here can happen even if stableNow == 1
+        if (!stableNow) {
+            FrameSync::reset(uopt->frameTimeLockMethod);
+
+            if (rto->syncLockFailIgnore > 0) {
+                rto->syncLockFailIgnore--;
+                if (rto->syncLockFailIgnore == 0) {
+                    GBS::DAC_RGBS_PWDNZ::write(1); // xth chance
+                    if (!uopt->wantOutputComponent) {
+                        GBS::PAD_SYNC_OUT_ENZ::write(0); // enable sync out // xth chance
+                    }
+                    rto->autoBestHtotalEnabled = false;
+                }
+            }
+            Serial.print(F("bestHtotal retry ("));
+            Serial.print(rto->syncLockFailIgnore);
+            Serial.println(")");
+        }
+    } else if (FrameSync::ready()) {
+        // FS ready but mode is 0 or 15 or autoBestHtotal is off
+        return true;
+    }
+
+    if (rto->continousStableCounter != 0 && rto->continousStableCounter != 255) {
+        rto->continousStableCounter++; // stop repetitions
+    }
+
+    return false;
+}
+
+boolean applyBestHTotal(uint16_t bestHTotal)
+{
+    if (rto->outModeHdBypass) {
+        return true; // false? doesn't matter atm
+    }
+
+    uint16_t orig_htotal = GBS::VDS_HSYNC_RST::read();
+    int diffHTotal = bestHTotal - orig_htotal;
+    uint16_t diffHTotalUnsigned = abs(diffHTotal);
+
+    if (((diffHTotalUnsigned == 0) || (rto->extClockGenDetected && diffHTotalUnsigned == 1)) && // all this
+        !rto->forceRetime)                                                                      // and that
+    {
+        if (!uopt->enableFrameTimeLock) { // FTL can double throw this when it resets to adjust
+            SerialM.print(F("HTotal Adjust (skipped)"));
+
+            if (!rto->extClockGenDetected) {
+                float sfr = getSourceFieldRate(0);
+                yield(); // wifi
+                float ofr = getOutputFrameRate();
+                if (sfr < 1.0f) {
+                    sfr = getSourceFieldRate(0); // retry
+                }
+                if (ofr < 1.0f) {
+                    ofr = getOutputFrameRate(); // retry
+                }
+                SerialM.print(F(", source Hz: "));
+                SerialM.print(sfr, 3); // prec. 3
+                SerialM.print(F(", output Hz: "));
+                SerialM.println(ofr, 3); // prec. 3
+            } else {
+                SerialM.println();
+            }
+        }
+        return true; // nothing to do
+    }
+
+    if (GBS::GBS_OPTION_PALFORCED60_ENABLED::read() == 1) {
+        // source is 50Hz, preset has to stay at 60Hz: return
+        return true;
+    }
+
+    boolean isLargeDiff = (diffHTotalUnsigned > (orig_htotal * 0.06f)) ? true : false; // typical diff: 1802 to 1794 (=8)
+
+    if (isLargeDiff && (getVideoMode() == 8 || rto->videoStandardInput == 14)) {
+        // arcade stuff syncs down from 60 to 52 Hz..
+        isLargeDiff = (diffHTotalUnsigned > (orig_htotal * 0.16f)) ? true : false;
+    }
+
+    if (isLargeDiff) {
+        SerialM.println(F("ABHT: large diff"));
+    }
+
+    // rto->forceRetime = true means the correction should be forced (command '.')
+    if (isLargeDiff && (rto->forceRetime == false)) {
+        if (rto->videoStandardInput != 14) {
+            rto->failRetryAttempts++;
+            if (rto->failRetryAttempts < 8) {
+                SerialM.println(F("retry"));
+                FrameSync::reset(uopt->frameTimeLockMethod);
+                delay(60);
+            } else {
+                SerialM.println(F("give up"));
+                rto->autoBestHtotalEnabled = false;
+            }
+        }
+        return false; // large diff, no forced
+    }
+
+    // bestHTotal 0? could be an invald manual retime
+    if (bestHTotal == 0) {
+        Serial.println(F("bestHTotal 0"));
+        return false;
+    }
+
+    if (rto->forceRetime == false) {
+        if (GBS::STATUS_INT_SOG_BAD::read() == 1) {
+            //Serial.println("prevented in apply");
+            return false;
+        }
+    }
+
+    rto->failRetryAttempts = 0; // else all okay!, reset to 0
+
+    // move blanking (display)
+    uint16_t h_blank_display_start_position = GBS::VDS_DIS_HB_ST::read();
+    uint16_t h_blank_display_stop_position = GBS::VDS_DIS_HB_SP::read();
+    uint16_t h_blank_memory_start_position = GBS::VDS_HB_ST::read();
+    uint16_t h_blank_memory_stop_position = GBS::VDS_HB_SP::read();
+
+    // new 25.10.2019
+    //uint16_t blankingAreaTotal = bestHTotal * 0.233f;
+    //h_blank_display_start_position += (diffHTotal / 2);
+    //h_blank_display_stop_position += (diffHTotal / 2);
+    //h_blank_memory_start_position = bestHTotal - (blankingAreaTotal * 0.212f);
+    //h_blank_memory_stop_position = blankingAreaTotal * 0.788f;
+
+    // h_blank_memory_start_position usually is == h_blank_display_start_position
+    if (h_blank_memory_start_position == h_blank_display_start_position) {
+        h_blank_display_start_position += (diffHTotal / 2);
+        h_blank_display_stop_position += (diffHTotal / 2);
+        h_blank_memory_start_position = h_blank_display_start_position; // normal case
+        h_blank_memory_stop_position += (diffHTotal / 2);
+    } else {
+        h_blank_display_start_position += (diffHTotal / 2);
+        h_blank_display_stop_position += (diffHTotal / 2);
+        h_blank_memory_start_position += (diffHTotal / 2); // the exception (currently 1280x1024)
+        h_blank_memory_stop_position += (diffHTotal / 2);
+    }
+
+    if (diffHTotal < 0) {
+        h_blank_display_start_position &= 0xfffe;
+        h_blank_display_stop_position &= 0xfffe;
+        h_blank_memory_start_position &= 0xfffe;
+        h_blank_memory_stop_position &= 0xfffe;
+    } else if (diffHTotal > 0) {
+        h_blank_display_start_position += 1;
+        h_blank_display_start_position &= 0xfffe;
+        h_blank_display_stop_position += 1;
+        h_blank_display_stop_position &= 0xfffe;
+        h_blank_memory_start_position += 1;
+        h_blank_memory_start_position &= 0xfffe;
+        h_blank_memory_stop_position += 1;
+        h_blank_memory_stop_position &= 0xfffe;
+    }
+
+    // don't move HSync with small diffs
+    uint16_t h_sync_start_position = GBS::VDS_HS_ST::read();
+    uint16_t h_sync_stop_position = GBS::VDS_HS_SP::read();
+
+    // fix over / underflows
+    if (h_blank_display_start_position > (bestHTotal - 8) || isLargeDiff) {
+        // typically happens when scaling Hz up (60 to 70)
+        //Serial.println("overflow h_blank_display_start_position");
+        h_blank_display_start_position = bestHTotal * 0.936f;
+    }
+    if (h_blank_display_stop_position > bestHTotal || isLargeDiff) {
+        //Serial.println("overflow h_blank_display_stop_position");
+        h_blank_display_stop_position = bestHTotal * 0.178f;
+    }
+    if ((h_blank_memory_start_position > bestHTotal) || (h_blank_memory_start_position > h_blank_display_start_position) || isLargeDiff) {
+        //Serial.println("overflow h_blank_memory_start_position");
+        h_blank_memory_start_position = h_blank_display_start_position * 0.971f;
+    }
+    if (h_blank_memory_stop_position > bestHTotal || isLargeDiff) {
+        //Serial.println("overflow h_blank_memory_stop_position");
+        h_blank_memory_stop_position = h_blank_display_stop_position * 0.64f;
+    }
+
+    // check whether HS spills over HBSPD
+    if (h_sync_start_position > h_sync_stop_position && (h_sync_start_position < (bestHTotal / 2))) { // is neg HSync
+        if (h_sync_start_position >= h_blank_display_stop_position) {
+            h_sync_start_position = h_blank_display_stop_position * 0.8f;
+            h_sync_stop_position = 4; // good idea to move this close to 0 as well
+        }
+    } else {
+        if (h_sync_stop_position >= h_blank_display_stop_position) {
+            h_sync_stop_position = h_blank_display_stop_position * 0.8f;
+            h_sync_start_position = 4; //
+        }
+    }
+
+    // just fix HS
+    if (isLargeDiff) {
+        if (h_sync_start_position > h_sync_stop_position && (h_sync_start_position < (bestHTotal / 2))) { // is neg HSync
+            h_sync_stop_position = 4;
+            // stop = at least start, then a bit outwards
+            h_sync_start_position = 16 + (h_blank_display_stop_position * 0.3f);
+        } else {
+            h_sync_start_position = 4;
+            h_sync_stop_position = 16 + (h_blank_display_stop_position * 0.3f);
+        }
+    }
+
+    // finally, fix forced timings with large diff
+    // update: doesn't seem necessary anymore
+    //if (isLargeDiff) {
+    //  h_blank_display_start_position = bestHTotal * 0.946f;
+    //  h_blank_display_stop_position = bestHTotal * 0.22f;
+    //  h_blank_memory_start_position = h_blank_display_start_position * 0.971f;
+    //  h_blank_memory_stop_position = h_blank_display_stop_position * 0.64f;
+
+    //  if (h_sync_start_position > h_sync_stop_position && (h_sync_start_position < (bestHTotal / 2))) { // is neg HSync
+    //    h_sync_stop_position = 0;
+    //    // stop = at least start, then a bit outwards
+    //    h_sync_start_position = 16 + (h_blank_display_stop_position * 0.4f);
+    //  }
+    //  else {
+    //    h_sync_start_position = 0;
+    //    h_sync_stop_position = 16 + (h_blank_display_stop_position * 0.4f);
+    //  }
+    //}
+
+    if (diffHTotal != 0) { // apply
+        // delay the change to field start, a bit more compatible
+        uint16_t timeout = 0;
+        while ((GBS::STATUS_VDS_FIELD::read() == 1) && (++timeout < 400))
+            ;
+        while ((GBS::STATUS_VDS_FIELD::read() == 0) && (++timeout < 800))
+            ;
+
+        GBS::VDS_HSYNC_RST::write(bestHTotal);
+        GBS::VDS_DIS_HB_ST::write(h_blank_display_start_position);
+        GBS::VDS_DIS_HB_SP::write(h_blank_display_stop_position);
+        GBS::VDS_HB_ST::write(h_blank_memory_start_position);
+        GBS::VDS_HB_SP::write(h_blank_memory_stop_position);
+        GBS::VDS_HS_ST::write(h_sync_start_position);
+        GBS::VDS_HS_SP::write(h_sync_stop_position);
+    }
+
+    boolean print = 1;
+    if (uopt->enableFrameTimeLock) {
+        if ((GBS::GBS_RUNTIME_FTL_ADJUSTED::read() == 1) && !rto->forceRetime) {
+            // FTL enabled and regular update, so don't print
+            print = 0;
+        }
+        GBS::GBS_RUNTIME_FTL_ADJUSTED::write(0);
+    }
+
+    rto->forceRetime = false;
+
+    if (print) {
+        SerialM.print(F("HTotal Adjust: "));
+        if (diffHTotal >= 0) {
+            SerialM.print(" "); // formatting to align with negative value readouts
+        }
+        SerialM.print(diffHTotal);
+
+        if (!rto->extClockGenDetected) {
+            float sfr = getSourceFieldRate(0);
+            delay(0);
+            float ofr = getOutputFrameRate();
+            if (sfr < 1.0f) {
+                sfr = getSourceFieldRate(0); // retry
+            }
+            if (ofr < 1.0f) {
+                ofr = getOutputFrameRate(); // retry
+            }
+            SerialM.print(F(", source Hz: "));
+            SerialM.print(sfr, 3); // prec. 3
+            SerialM.print(F(", output Hz: "));
+            SerialM.println(ofr, 3); // prec. 3
+        } else {
+            SerialM.println();
+        }
+    }
+
+    return true;
+}
+
+float getSourceFieldRate(boolean useSPBus)
+{
+    double esp8266_clock_freq = ESP.getCpuFreqMHz() * 1000000;
+    uint8_t testBusSelBackup = GBS::TEST_BUS_SEL::read();
+    uint8_t spBusSelBackup = GBS::TEST_BUS_SP_SEL::read();
+    uint8_t ifBusSelBackup = GBS::IF_TEST_SEL::read();
+    uint8_t debugPinBackup = GBS::PAD_BOUT_EN::read();
+
+    if (debugPinBackup != 1)
+        GBS::PAD_BOUT_EN::write(1); // enable output to pin for test
+
+    if (ifBusSelBackup != 3)
+        GBS::IF_TEST_SEL::write(3); // IF averaged frame time
+
+    if (useSPBus) {
+        if (rto->syncTypeCsync) {
+            //Serial.println("TestBus for csync");
+            if (testBusSelBackup != 0xa)
+                GBS::TEST_BUS_SEL::write(0xa);
+        } else {
+            //Serial.println("TestBus for HV Sync");
+            if (testBusSelBackup != 0x0)
+                GBS::TEST_BUS_SEL::write(0x0); // RGBHV: TB 0x20 has vsync
+        }
+        if (spBusSelBackup != 0x0f)
+            GBS::TEST_BUS_SP_SEL::write(0x0f);
+    } else {
+        if (testBusSelBackup != 0)
+            GBS::TEST_BUS_SEL::write(0); // needs decimation + if
+    }
+
+    float retVal = 0;
+
+    uint32_t fieldTimeTicks = FrameSync::getPulseTicks();
+    if (fieldTimeTicks == 0) {
+        // try again
+        fieldTimeTicks = FrameSync::getPulseTicks();
+    }
+
+    if (fieldTimeTicks > 0) {
+        retVal = esp8266_clock_freq / (double)fieldTimeTicks;
+        if (retVal < 47.0f || retVal > 86.0f) {
+            // try again
+            fieldTimeTicks = FrameSync::getPulseTicks();
+            if (fieldTimeTicks > 0) {
+                retVal = esp8266_clock_freq / (double)fieldTimeTicks;
+            }
+        }
+    }
+
+    GBS::TEST_BUS_SEL::write(testBusSelBackup);
+    GBS::PAD_BOUT_EN::write(debugPinBackup);
+    if (spBusSelBackup != 0x0f)
+        GBS::TEST_BUS_SP_SEL::write(spBusSelBackup);
+    if (ifBusSelBackup != 3)
+        GBS::IF_TEST_SEL::write(ifBusSelBackup);
+
+    return retVal;
+}
+
+float getOutputFrameRate()
+{
+    double esp8266_clock_freq = ESP.getCpuFreqMHz() * 1000000;
+    uint8_t testBusSelBackup = GBS::TEST_BUS_SEL::read();
+    uint8_t debugPinBackup = GBS::PAD_BOUT_EN::read();
+
+    if (debugPinBackup != 1)
+        GBS::PAD_BOUT_EN::write(1); // enable output to pin for test
+
+    if (testBusSelBackup != 2)
+        GBS::TEST_BUS_SEL::write(2); // 0x4d = 0x22 VDS test
+
+    float retVal = 0;
+
+    uint32_t fieldTimeTicks = FrameSync::getPulseTicks();
+    if (fieldTimeTicks == 0) {
+        // try again
+        fieldTimeTicks = FrameSync::getPulseTicks();
+    }
+
+    if (fieldTimeTicks > 0) {
+        retVal = esp8266_clock_freq / (double)fieldTimeTicks;
+        if (retVal < 47.0f || retVal > 86.0f) {
+            // try again
+            fieldTimeTicks = FrameSync::getPulseTicks();
+            if (fieldTimeTicks > 0) {
+                retVal = esp8266_clock_freq / (double)fieldTimeTicks;
+            }
+        }
+    }
+
+    GBS::TEST_BUS_SEL::write(testBusSelBackup);
+    GBS::PAD_BOUT_EN::write(debugPinBackup);
+
+    return retVal;
+}
+
+// used for RGBHV to determine the ADPLL speed "level" / can jitter with SOG Sync
+uint32_t getPllRate()
+{
+    uint32_t esp8266_clock_freq = ESP.getCpuFreqMHz() * 1000000;
+    uint8_t testBusSelBackup = GBS::TEST_BUS_SEL::read();
+    uint8_t spBusSelBackup = GBS::TEST_BUS_SP_SEL::read();
+    uint8_t debugPinBackup = GBS::PAD_BOUT_EN::read();
+
+    if (testBusSelBackup != 0xa) {
+        GBS::TEST_BUS_SEL::write(0xa);
+    }
+    if (rto->syncTypeCsync) {
+        if (spBusSelBackup != 0x6b)
+            GBS::TEST_BUS_SP_SEL::write(0x6b);
+    } else {
+        if (spBusSelBackup != 0x09)
+            GBS::TEST_BUS_SP_SEL::write(0x09);
+    }
+    GBS::PAD_BOUT_EN::write(1); // enable output to pin for test
+    yield();                    // BOUT signal and wifi
+    delayMicroseconds(200);
+    uint32_t ticks = FrameSync::getPulseTicks();
+
+    // restore
+    GBS::PAD_BOUT_EN::write(debugPinBackup);
+    if (testBusSelBackup != 0xa) {
+        GBS::TEST_BUS_SEL::write(testBusSelBackup);
+    }
+    GBS::TEST_BUS_SP_SEL::write(spBusSelBackup);
+
+    uint32_t retVal = 0;
+    if (ticks > 0) {
+        retVal = esp8266_clock_freq / ticks;
+    }
+
+    return retVal;
+}
+
+#define AUTO_GAIN_INIT 0x48
+
+void doPostPresetLoadSteps()
+{
+    LATENCY_SECTION("doPostPresetLoadSteps");
+    //unsigned long postLoadTimer = millis();
+
+    // adco->r_gain gets applied if uopt->enableAutoGain is set.
+    if (uopt->enableAutoGain) {
+        if (uopt->presetPreference == OutputCustomized) {
+            // Loaded custom preset, we want to keep newly loaded gain. Save
+            // gain written by loadPresetFromSPIFFS -> writeProgramArrayNew.
+            adco->r_gain = GBS::ADC_RGCTRL::read();
+            adco->g_gain = GBS::ADC_GGCTRL::read();
+            adco->b_gain = GBS::ADC_BGCTRL::read();
+        } else {
+            // Loaded fixed preset. Keep adco->r_gain from before overwriting
+            // registers.
+        }
+    }
+
+    //GBS::PAD_SYNC_OUT_ENZ::write(1);  // no sync out
+    //GBS::DAC_RGBS_PWDNZ::write(0);    // no DAC
+    //GBS::SFTRST_MEM_FF_RSTZ::write(0);  // mem fifos keep in reset
+
+    if (rto->videoStandardInput == 0) {
+        uint8_t videoMode = getVideoMode();
+        SerialM.print(F("post preset: rto->videoStandardInput 0 > "));
+        SerialM.println(videoMode);
+        if (videoMode > 0) {
+            rto->videoStandardInput = videoMode;
+        }
+    }
+    rto->presetID = GBS::GBS_PRESET_ID::read();
+    rto->isCustomPreset = GBS::GBS_PRESET_CUSTOM::read();
+
+    GBS::ADC_UNUSED_64::write(0);
+    GBS::ADC_UNUSED_65::write(0); // clear temp storage
+    GBS::ADC_UNUSED_66::write(0);
+    GBS::ADC_UNUSED_67::write(0); // clear temp storage
+    GBS::PAD_CKIN_ENZ::write(0);  // 0 = clock input enable (pin40)
+
+    if (!rto->isCustomPreset) {
+        prepareSyncProcessor(); // todo: handle modes 14 and 15 better, now that they support scaling
+    }
+    if (rto->videoStandardInput == 14) {
+        // copy of code in bypassModeSwitch_RGBHV
+        if (rto->syncTypeCsync == false) {
+            GBS::SP_SOG_SRC_SEL::write(0);  // 5_20 0 | 0: from ADC 1: from hs // use ADC and turn it off = no SOG
+            GBS::ADC_SOGEN::write(1);       // 5_02 0 ADC SOG // having it 0 drags down the SOG (hsync) input; = 1: need to supress SOG decoding
+            GBS::SP_EXT_SYNC_SEL::write(0); // connect HV input ( 5_20 bit 3 )
+            GBS::SP_SOG_MODE::write(0);     // 5_56 bit 0 // 0: normal, 1: SOG
+            GBS::SP_NO_COAST_REG::write(1); // vblank coasting off
+            GBS::SP_PRE_COAST::write(0);
+            GBS::SP_POST_COAST::write(0);
+            GBS::SP_H_PULSE_IGNOR::write(0xff); // cancel out SOG decoding
+            GBS::SP_SYNC_BYPS::write(0);        // external H+V sync for decimator (+ sync out) | 1 to mirror in sync, 0 to output processed sync
+            GBS::SP_HS_POL_ATO::write(1);       // 5_55 4 auto polarity for retiming
+            GBS::SP_VS_POL_ATO::write(1);       // 5_55 6
+            GBS::SP_HS_LOOP_SEL::write(1);      // 5_57_6 | 0 enables retiming on SP | 1 to bypass input to HDBYPASS
+            GBS::SP_H_PROTECT::write(0);        // 5_3e 4 disable for H/V
+            rto->phaseADC = 16;
+            rto->phaseSP = 8;
+        } else {
+            // todo: SOG SRC can be ADC or HS input pin. HS requires TTL level, ADC can use lower levels
+            // HS seems to have issues at low PLL speeds
+            // maybe add detection whether ADC Sync is needed
+            GBS::SP_SOG_SRC_SEL::write(0);  // 5_20 0 | 0: from ADC 1: hs is sog source
+            GBS::SP_EXT_SYNC_SEL::write(1); // disconnect HV input
+            GBS::ADC_SOGEN::write(1);       // 5_02 0 ADC SOG
+            GBS::SP_SOG_MODE::write(1);     // apparently needs to be off for HS input (on for ADC)
+            GBS::SP_NO_COAST_REG::write(0); // vblank coasting on
+            GBS::SP_PRE_COAST::write(4);    // 5_38, > 4 can be seen with clamp invert on the lower lines
+            GBS::SP_POST_COAST::write(7);
+            GBS::SP_SYNC_BYPS::write(0);   // use regular sync for decimator (and sync out) path
+            GBS::SP_HS_LOOP_SEL::write(1); // 5_57_6 | 0 enables retiming on SP | 1 to bypass input to HDBYPASS
+            GBS::SP_H_PROTECT::write(1);   // 5_3e 4 enable for SOG
+            rto->currentLevelSOG = 24;
+            rto->phaseADC = 16;
+            rto->phaseSP = 8;
+        }
+    }
+
+    GBS::SP_H_PROTECT::write(0);
+    GBS::SP_COAST_INV_REG::write(0); // just in case
+    if (!rto->outModeHdBypass && GBS::GBS_OPTION_SCALING_RGBHV::read() == 0) {
+        // setOutModeHdBypass has it's own and needs to update later
+        updateSpDynamic(0); // remember: rto->videoStandardInput for RGB(C/HV) in scaling is 1, 2 or 3 here
+    }
+
+    GBS::SP_NO_CLAMP_REG::write(1); // (keep) clamp disabled, to be enabled when position determined
+    GBS::OUT_SYNC_CNTRL::write(1);  // prepare sync out to PAD
+
+    // auto offset adc prep
+    GBS::ADC_AUTO_OFST_PRD::write(1);   // by line (0 = by frame)
+    GBS::ADC_AUTO_OFST_DELAY::write(0); // sample delay 0 (1 to 4 pipes)
+    GBS::ADC_AUTO_OFST_STEP::write(0);  // 0 = abs diff, then 1 to 3 steps
+    GBS::ADC_AUTO_OFST_TEST::write(1);
+    GBS::ADC_AUTO_OFST_RANGE_REG::write(0x00); // 5_0f U/V ranges = 0 (full range, 1 to 15)
+
+    if (rto->inputIsYpBpR == true) {
+        applyYuvPatches();
+    } else {
+        applyRGBPatches();
+    }
+
+    if (rto->outModeHdBypass) {
+        GBS::OUT_SYNC_SEL::write(1); // 0_4f 1=sync from HDBypass, 2=sync from SP
+        rto->autoBestHtotalEnabled = false;
+    } else {
+        rto->autoBestHtotalEnabled = true;
+    }
+
+    rto->phaseADC = GBS::PA_ADC_S::read(); // we can't know which is right, get from preset
+    rto->phaseSP = 8;                      // get phase into global variables early: before latching
+
+    if (rto->inputIsYpBpR) {
+        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 14;
+    } else {
+        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 13; // similar to yuv, allow variations
+    }
+
+    setAndUpdateSogLevel(rto->currentLevelSOG);
+
+    if (!rto->isCustomPreset) {
+        // Writes ADC_RGCTRL. If auto gain is enabled, ADC_RGCTRL will be
+        // overwritten further down at `uopt->enableAutoGain == 1`.
+        setAdcParametersGainAndOffset();
+    }
+
+    GBS::GPIO_CONTROL_00::write(0x67); // most GPIO pins regular GPIO
+    GBS::GPIO_CONTROL_01::write(0x00); // all GPIO outputs disabled
+    rto->clampPositionIsSet = 0;
+    rto->coastPositionIsSet = 0;
+    rto->phaseIsSet = 0;
+    rto->autoGeometryIsSet = 0;
+    rto->continousStableCounter = 0;
+    rto->noSyncCounter = 0;
+    rto->motionAdaptiveDeinterlaceActive = false;
+    rto->scanlinesEnabled = false;
+    rto->failRetryAttempts = 0;
+    rto->videoIsFrozen = true;       // ensures unfreeze
+    rto->sourceDisconnected = false; // this must be true if we reached here (no syncwatcher operation)
+    rto->boardHasPower = true;       //same
+
+    if (rto->presetID == 0x06 || rto->presetID == 0x16) {
+        rto->isCustomPreset = 0; // override so it applies section 2 deinterlacer settings
+    }
+
+    if (!rto->isCustomPreset) {
+        if (rto->videoStandardInput == 3 || rto->videoStandardInput == 4 ||
+            rto->videoStandardInput == 8 || rto->videoStandardInput == 9) {
+            GBS::IF_LD_RAM_BYPS::write(1); // 1_0c 0 no LD, do this before setIfHblankParameters
+        }
+
+        //setIfHblankParameters();              // 1_0e, 1_18, 1_1a
+        GBS::IF_INI_ST::write(0); // 16.08.19: don't calculate, use fixed to 0
+        // the following sets a field offset that eliminates 240p content forced to 480i flicker
+        //GBS::IF_INI_ST::write(GBS::PLLAD_MD::read() * 0.4261f);  // upper: * 0.4282f  lower: 0.424f
+
+        GBS::IF_HS_INT_LPF_BYPS::write(0); // 1_02 2
+        // 0 allows int/lpf for smoother scrolling with non-ideal scaling, also reduces jailbars and even noise
+        // interpolation or lpf available, lpf looks better
+        GBS::IF_HS_SEL_LPF::write(1);     // 1_02 1
+        GBS::IF_HS_PSHIFT_BYPS::write(1); // 1_02 3 nonlinear scale phase shift bypass
+        // 1_28 1 1:hbin generated write reset 0:line generated write reset
+        GBS::IF_LD_WRST_SEL::write(1); // at 1 fixes output position regardless of 1_24
+        //GBS::MADPT_Y_DELAY_UV_DELAY::write(0); // 2_17 default: 0 // don't overwrite
+
+        GBS::SP_RT_HS_ST::write(0); // 5_49 // retiming hs ST, SP
+        GBS::SP_RT_HS_SP::write(GBS::PLLAD_MD::read() * 0.93f);
+
+        GBS::VDS_PK_LB_CORE::write(0); // 3_44 0-3 // 1 for anti source jailbars
+        GBS::VDS_PK_LH_CORE::write(0); // 3_46 0-3 // 1 for anti source jailbars
+        if (rto->presetID == 0x05 || rto->presetID == 0x15) {
+            GBS::VDS_PK_LB_GAIN::write(0x16); // 3_45 // peaking HF
+            GBS::VDS_PK_LH_GAIN::write(0x0A); // 3_47
+        } else {
+            GBS::VDS_PK_LB_GAIN::write(0x16); // 3_45
+            GBS::VDS_PK_LH_GAIN::write(0x18); // 3_47
+        }
+        GBS::VDS_PK_VL_HL_SEL::write(0); // 3_43 0 if 1 then 3_45 HF almost no effect (coring 0xf9)
+        GBS::VDS_PK_VL_HH_SEL::write(0); // 3_43 1
+
+        GBS::VDS_STEP_GAIN::write(1); // step response, max 15 (VDS_STEP_DLY_CNTRL set in presets)
+
+        // DAC filters / keep in presets for now
+        //GBS::VDS_1ST_INT_BYPS::write(1); // disable RGB stage interpolator
+        //GBS::VDS_2ND_INT_BYPS::write(1); // disable YUV stage interpolator
+
+        // most cases will use osr 2
+        setOverSampleRatio(2, true); // prepare only = true
+
+        // full height option
+        if (uopt->wantFullHeight) {
+            if (rto->videoStandardInput == 1 || rto->videoStandardInput == 3) {
+                //if (rto->presetID == 0x5)
+                //{ // out 1080p 60
+                //  GBS::VDS_DIS_VB_ST::write(GBS::VDS_VSYNC_RST::read() - 1);
+                //  GBS::VDS_DIS_VB_SP::write(42);
+                //  GBS::VDS_VB_SP::write(42 - 10); // is VDS_DIS_VB_SP - 10 = 32 // watch for vblank overflow (ps3)
+                //  GBS::VDS_VSCALE::write(455);
+                //  GBS::IF_VB_SP::write(GBS::IF_VB_SP::read() + 4);
+                //  GBS::IF_VB_ST::write(GBS::IF_VB_ST::read() + 4);
+                //  SerialM.println(F("full height"));
+                //}
+            } else if (rto->videoStandardInput == 2 || rto->videoStandardInput == 4) {
+                if (rto->presetID == 0x15) { // out 1080p 50
+                    GBS::VDS_VSCALE::write(455);
+                    GBS::VDS_DIS_VB_ST::write(GBS::VDS_VSYNC_RST::read()); // full = 1125 of 1125
+                    GBS::VDS_DIS_VB_SP::write(42);
+                    GBS::IF_VB_SP::write(GBS::IF_VB_SP::read() + 22);
+                    GBS::IF_VB_ST::write(GBS::IF_VB_ST::read() + 22);
+                    SerialM.println(F("full height"));
+                }
+            }
+        }
+
+        if (rto->videoStandardInput == 1 || rto->videoStandardInput == 2) {
+            //GBS::PLLAD_ICP::write(5);         // 5 rather than 6 to work well with CVBS sync as well as CSync
+
+            GBS::ADC_FLTR::write(3);             // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+            GBS::PLLAD_KS::write(2);             // 5_16
+            setOverSampleRatio(4, true);         // prepare only = true
+            GBS::IF_SEL_WEN::write(0);           // 1_02 0; 0 for SD, 1 for EDTV
+            if (rto->inputIsYpBpR) {             // todo: check other videoStandardInput in component vs rgb
+                GBS::IF_HS_TAP11_BYPS::write(0); // 1_02 4 Tap11 LPF bypass in YUV444to422
+                GBS::IF_HS_Y_PDELAY::write(2);   // 1_02 5+6 delays
+                GBS::VDS_V_DELAY::write(0);      // 3_24 2
+                GBS::VDS_Y_DELAY::write(3);      // 3_24 4/5 delays
+            }
+
+            // downscale preset: source is SD
+            if (rto->presetID == 0x06 || rto->presetID == 0x16) {
+                setCsVsStart(2);                        // or 3, 0
+                setCsVsStop(0);                         // fixes field position
+                GBS::IF_VS_SEL::write(1);               // 1_00 5 // turn off VHS sync feature
+                GBS::IF_VS_FLIP::write(0);              // 1_01 0
+                GBS::IF_LD_RAM_BYPS::write(0);          // 1_0c 0
+                GBS::IF_HS_DEC_FACTOR::write(1);        // 1_0b 4
+                GBS::IF_LD_SEL_PROV::write(0);          // 1_0b 7
+                GBS::IF_HB_ST::write(2);                // 1_10 deinterlace offset
+                GBS::MADPT_Y_VSCALE_BYPS::write(0);     // 2_02 6
+                GBS::MADPT_UV_VSCALE_BYPS::write(0);    // 2_02 7
+                GBS::MADPT_PD_RAM_BYPS::write(0);       // 2_24 2 one line fifo for line phase adjust
+                GBS::MADPT_VSCALE_DEC_FACTOR::write(1); // 2_31 0..1
+                GBS::MADPT_SEL_PHASE_INI::write(0);     // 2_31 2 disable for SD (check 240p content)
+                if (rto->videoStandardInput == 1) {
+                    GBS::IF_HB_ST2::write(0x490); // 1_18
+                    GBS::IF_HB_SP2::write(0x80);  // 1_1a
+                    GBS::IF_HB_SP::write(0x4A);   // 1_12 deinterlace offset, green bar
+                    GBS::IF_HBIN_SP::write(0xD0); // 1_26
+                } else if (rto->videoStandardInput == 2) {
+                    GBS::IF_HB_SP2::write(0x74);  // 1_1a
+                    GBS::IF_HB_SP::write(0x50);   // 1_12 deinterlace offset, green bar
+                    GBS::IF_HBIN_SP::write(0xD0); // 1_26
+                }
+            }
+        }
+        if (rto->videoStandardInput == 3 || rto->videoStandardInput == 4 ||
+            rto->videoStandardInput == 8 || rto->videoStandardInput == 9) {
+            // EDTV p-scan, need to either double adc data rate and halve vds scaling
+            // or disable line doubler (better) (50 / 60Hz shared)
+
+            GBS::ADC_FLTR::write(3); // 5_03 4/5
+            GBS::PLLAD_KS::write(1); // 5_16
+
+            if (rto->presetID != 0x06 && rto->presetID != 0x16) {
+                setCsVsStart(14);        // pal // hm
+                setCsVsStop(11);         // probably setting these for modes 8,9
+                GBS::IF_HB_SP::write(0); // 1_12 deinterlace offset, fixes colors (downscale needs diff)
+            }
+            setOverSampleRatio(2, true);           // with KS = 1 for modes 3, 4, 8
+            GBS::IF_HS_DEC_FACTOR::write(0);       // 1_0b 4+5
+            GBS::IF_LD_SEL_PROV::write(1);         // 1_0b 7
+            GBS::IF_PRGRSV_CNTRL::write(1);        // 1_00 6
+            GBS::IF_SEL_WEN::write(1);             // 1_02 0
+            GBS::IF_HS_SEL_LPF::write(0);          // 1_02 1   0 = use interpolator not lpf for EDTV
+            GBS::IF_HS_TAP11_BYPS::write(0);       // 1_02 4 filter
+            GBS::IF_HS_Y_PDELAY::write(3);         // 1_02 5+6 delays (ps2 test on one board clearly says 3, not 2)
+            GBS::VDS_V_DELAY::write(1);            // 3_24 2 // new 24.07.2019 : 1, also set 2_17 to 1
+            GBS::MADPT_Y_DELAY_UV_DELAY::write(1); // 2_17 : 1
+            GBS::VDS_Y_DELAY::write(3);            // 3_24 4/5 delays (ps2 test saying 3 for 1_02 goes with 3 here)
+            if (rto->videoStandardInput == 9) {
+                if (GBS::STATUS_SYNC_PROC_VTOTAL::read() > 650) {
+                    delay(20);
+                    if (GBS::STATUS_SYNC_PROC_VTOTAL::read() > 650) {
+                        GBS::PLLAD_KS::write(0);        // 5_16
+                        GBS::VDS_VSCALE_BYPS::write(1); // 3_00 5 no vscale
+                    }
+                }
+            }
+
+            // downscale preset: source is EDTV
+            if (rto->presetID == 0x06 || rto->presetID == 0x16) {
+                GBS::MADPT_Y_VSCALE_BYPS::write(0);     // 2_02 6
+                GBS::MADPT_UV_VSCALE_BYPS::write(0);    // 2_02 7
+                GBS::MADPT_PD_RAM_BYPS::write(0);       // 2_24 2 one line fifo for line phase adjust
+                GBS::MADPT_VSCALE_DEC_FACTOR::write(1); // 2_31 0..1
+                GBS::MADPT_SEL_PHASE_INI::write(1);     // 2_31 2 enable
+                GBS::MADPT_SEL_PHASE_INI::write(0);     // 2_31 2 disable
+            }
+        }
+        if (rto->videoStandardInput == 3 && rto->presetID != 0x06) { // ED YUV 60
+            setCsVsStart(16);                                        // ntsc
+            setCsVsStop(13);                                         //
+            GBS::IF_HB_ST::write(30);                                // 1_10; magic number
+            GBS::IF_HBIN_ST::write(0x20);                            // 1_24
+            GBS::IF_HBIN_SP::write(0x60);                            // 1_26
+            if (rto->presetID == 0x5) {                              // out 1080p
+                GBS::IF_HB_SP2::write(0xB0);                         // 1_1a
+                GBS::IF_HB_ST2::write(0x4BC);                        // 1_18
+            } else if (rto->presetID == 0x3) {                       // out 720p
+                GBS::VDS_VSCALE::write(683);                         // same as base preset
+                GBS::IF_HB_ST2::write(0x478);                        // 1_18
+                GBS::IF_HB_SP2::write(0x84);                         // 1_1a
+            } else if (rto->presetID == 0x2) {                       // out x1024
+                GBS::IF_HB_SP2::write(0x84);                         // 1_1a
+                GBS::IF_HB_ST2::write(0x478);                        // 1_18
+            } else if (rto->presetID == 0x1) {                       // out x960
+                GBS::IF_HB_SP2::write(0x84);                         // 1_1a
+                GBS::IF_HB_ST2::write(0x478);                        // 1_18
+            } else if (rto->presetID == 0x4) {                       // out x480
+                GBS::IF_HB_ST2::write(0x478);                        // 1_18
+                GBS::IF_HB_SP2::write(0x90);                         // 1_1a
+            }
+        } else if (rto->videoStandardInput == 4 && rto->presetID != 0x16) { // ED YUV 50
+            GBS::IF_HBIN_SP::write(0x40);                                   // 1_26 was 0x80 test: ps2 videomodetester 576p mode
+            GBS::IF_HBIN_ST::write(0x20);                                   // 1_24, odd but need to set this here (blue bar)
+            GBS::IF_HB_ST::write(0x30);                                     // 1_10
+            if (rto->presetID == 0x15) {                                    // out 1080p
+                GBS::IF_HB_ST2::write(0x4C0);                               // 1_18
+                GBS::IF_HB_SP2::write(0xC8);                                // 1_1a
+            } else if (rto->presetID == 0x13) {                             // out 720p
+                GBS::IF_HB_ST2::write(0x478);                               // 1_18
+                GBS::IF_HB_SP2::write(0x88);                                // 1_1a
+            } else if (rto->presetID == 0x12) {                             // out x1024
+                // VDS_VB_SP -= 12 used to shift pic up, but seems not necessary anymore
+                //GBS::VDS_VB_SP::write(GBS::VDS_VB_SP::read() - 12);
+                GBS::IF_HB_ST2::write(0x454);   // 1_18
+                GBS::IF_HB_SP2::write(0x88);    // 1_1a
+            } else if (rto->presetID == 0x11) { // out x960
+                GBS::IF_HB_ST2::write(0x454);   // 1_18
+                GBS::IF_HB_SP2::write(0x88);    // 1_1a
+            } else if (rto->presetID == 0x14) { // out x576
+                GBS::IF_HB_ST2::write(0x478);   // 1_18
+                GBS::IF_HB_SP2::write(0x90);    // 1_1a
+            }
+        } else if (rto->videoStandardInput == 5) { // 720p
+            GBS::ADC_FLTR::write(1);               // 5_03
+            GBS::IF_PRGRSV_CNTRL::write(1);        // progressive
+            GBS::IF_HS_DEC_FACTOR::write(0);
+            GBS::INPUT_FORMATTER_02::write(0x74);
+            GBS::VDS_Y_DELAY::write(3);
+        } else if (rto->videoStandardInput == 6 || rto->videoStandardInput == 7) { // 1080i/p
+            GBS::ADC_FLTR::write(1);                                               // 5_03
+            GBS::PLLAD_KS::write(0);                                               // 5_16
+            GBS::IF_PRGRSV_CNTRL::write(1);
+            GBS::IF_HS_DEC_FACTOR::write(0);
+            GBS::INPUT_FORMATTER_02::write(0x74);
+            GBS::VDS_Y_DELAY::write(3);
+        } else if (rto->videoStandardInput == 8) { // 25khz
+            // todo: this mode for HV sync
+            uint32_t pllRate = 0;
+            for (int i = 0; i < 8; i++) {
+                pllRate += getPllRate();
+            }
+            pllRate /= 8;
+            SerialM.print(F("(H-PLL) rate: "));
+            SerialM.println(pllRate);
+            if (pllRate > 200) {             // is PLL even working?
+                if (pllRate < 1800) {        // rate very low?
+                    GBS::PLLAD_FS::write(0); // then low gain
+                }
+            }
+            GBS::PLLAD_ICP::write(6); // all 25khz submodes have more lines than NTSC
+            GBS::ADC_FLTR::write(1);  // 5_03
+            GBS::IF_HB_ST::write(30); // 1_10; magic number
+            //GBS::IF_HB_ST2::write(0x60);  // 1_18
+            //GBS::IF_HB_SP2::write(0x88);  // 1_1a
+            GBS::IF_HBIN_SP::write(0x60); // 1_26 works for all output presets
+            if (rto->presetID == 0x1) {   // out x960
+                GBS::VDS_VSCALE::write(410);
+            } else if (rto->presetID == 0x2) { // out x1024
+                GBS::VDS_VSCALE::write(402);
+            } else if (rto->presetID == 0x3) { // out 720p
+                GBS::VDS_VSCALE::write(546);
+            } else if (rto->presetID == 0x5) { // out 1080p
+                GBS::VDS_VSCALE::write(400);
+            }
+        }
+    }
+
+    if (rto->presetID == 0x06 || rto->presetID == 0x16) {
+        rto->isCustomPreset = GBS::GBS_PRESET_CUSTOM::read(); // override back
+    }
+
+    resetDebugPort();
+
+    boolean avoidAutoBest = 0;
+    if (rto->syncTypeCsync) {
+        if (GBS::TEST_BUS_2F::read() == 0) {
+            delay(4);
+            if (GBS::TEST_BUS_2F::read() == 0) {
+                optimizeSogLevel();
+                avoidAutoBest = 1;
+                delay(4);
+            }
+        }
+    }
+
+    latchPLLAD(); // besthtotal reliable with this (EDTV modes, possibly others)
+
+    if (rto->isCustomPreset) {
+        // patch in segments not covered in custom preset files (currently seg 2)
+        if (rto->videoStandardInput == 3 || rto->videoStandardInput == 4 || rto->videoStandardInput == 8) {
+            GBS::MADPT_Y_DELAY_UV_DELAY::write(1); // 2_17 : 1
+        }
+
+        // get OSR
+        if (GBS::DEC1_BYPS::read() && GBS::DEC2_BYPS::read()) {
+            rto->osr = 1;
+        } else if (GBS::DEC1_BYPS::read() && !GBS::DEC2_BYPS::read()) {
+            rto->osr = 2;
+        } else {
+            rto->osr = 4;
+        }
+
+        // always start with internal clock active first
+        if (GBS::PLL648_CONTROL_01::read() == 0x75 && GBS::GBS_PRESET_DISPLAY_CLOCK::read() != 0) {
+            GBS::PLL648_CONTROL_01::write(GBS::GBS_PRESET_DISPLAY_CLOCK::read());
+        } else if (GBS::GBS_PRESET_DISPLAY_CLOCK::read() == 0) {
+            SerialM.println(F("no stored display clock to use!"));
+        }
+    }
+
+    if (rto->presetIsPalForce60) {
+        if (GBS::GBS_OPTION_PALFORCED60_ENABLED::read() != 1) {
+            SerialM.println(F("pal forced 60hz: apply vshift"));
+            uint16_t vshift = 56; // default shift
+            if (rto->presetID == 0x5) {
+                GBS::IF_VB_SP::write(4);
+            } // out 1080p
+            else {
+                GBS::IF_VB_SP::write(GBS::IF_VB_SP::read() + vshift);
+            }
+            GBS::IF_VB_ST::write(GBS::IF_VB_SP::read() - 2);
+            GBS::GBS_OPTION_PALFORCED60_ENABLED::write(1);
+        }
+    }
+
+    //freezeVideo();
+
+    GBS::ADC_TEST_04::write(0x02);    // 5_04
+    GBS::ADC_TEST_0C::write(0x12);    // 5_0c 1 4
+    GBS::ADC_TA_05_CTRL::write(0x02); // 5_05
+
+    // auto ADC gain
+    if (uopt->enableAutoGain == 1) {
+        if (adco->r_gain == 0) {
+            // SerialM.printf("ADC gain: reset %x := %x\n", GBS::ADC_RGCTRL::read(), AUTO_GAIN_INIT);
+            setAdcGain(AUTO_GAIN_INIT);
+            GBS::DEC_TEST_ENABLE::write(1);
+        } else {
+            // SerialM.printf("ADC gain: transferred %x := %x\n", GBS::ADC_RGCTRL::read(), adco->r_gain);
+            GBS::ADC_RGCTRL::write(adco->r_gain);
+            GBS::ADC_GGCTRL::write(adco->g_gain);
+            GBS::ADC_BGCTRL::write(adco->b_gain);
+            GBS::DEC_TEST_ENABLE::write(1);
+        }
+    } else {
+        GBS::DEC_TEST_ENABLE::write(0); // no need for decimation test to be enabled
+    }
+
+    // ADC offset if measured
+    if (adco->r_off != 0 && adco->g_off != 0 && adco->b_off != 0) {
+        GBS::ADC_ROFCTRL::write(adco->r_off);
+        GBS::ADC_GOFCTRL::write(adco->g_off);
+        GBS::ADC_BOFCTRL::write(adco->b_off);
+    }
+
+    SerialM.print(F("ADC offset: R:"));
+    SerialM.print(GBS::ADC_ROFCTRL::read(), HEX);
+    SerialM.print(" G:");
+    SerialM.print(GBS::ADC_GOFCTRL::read(), HEX);
+    SerialM.print(" B:");
+    SerialM.println(GBS::ADC_BOFCTRL::read(), HEX);
+
+    GBS::IF_AUTO_OFST_U_RANGE::write(0); // 0 seems to be full range, else 1 to 15
+    GBS::IF_AUTO_OFST_V_RANGE::write(0); // 0 seems to be full range, else 1 to 15
+    GBS::IF_AUTO_OFST_PRD::write(0);     // 0 = by line, 1 = by frame ; by line is easier to spot
+    GBS::IF_AUTO_OFST_EN::write(0);      // not reliable yet
+    // to get it working with RGB:
+    // leave RGB to YUV at the ADC DEC stage (s5_1f 2 = 0)
+    // s5s07s42, 1_2a to 0, s5_06 + s5_08 to 0x40
+    // 5_06 + 5_08 will be the target center value, 5_07 sets general offset
+    // s3s3as00 s3s3bs00 s3s3cs00
+
+    if (uopt->wantVdsLineFilter) {
+        GBS::VDS_D_RAM_BYPS::write(0);
+    } else {
+        GBS::VDS_D_RAM_BYPS::write(1);
+    }
+
+    if (uopt->wantPeaking) {
+        GBS::VDS_PK_Y_H_BYPS::write(0);
+    } else {
+        GBS::VDS_PK_Y_H_BYPS::write(1);
+    }
+
+    // unused now
+    GBS::VDS_TAP6_BYPS::write(0);
+    /*if (uopt->wantTap6) { GBS::VDS_TAP6_BYPS::write(0); }
+  else {
+    GBS::VDS_TAP6_BYPS::write(1);
+    if (!isCustomPreset) {
+      GBS::MADPT_Y_DELAY_UV_DELAY::write(GBS::MADPT_Y_DELAY_UV_DELAY::read() + 1);
+    }
+  }*/
+
+    if (uopt->wantStepResponse) {
+        // step response requested, but exclude 1080p presets
+        if (rto->presetID != 0x05 && rto->presetID != 0x15) {
+            GBS::VDS_UV_STEP_BYPS::write(0);
+        } else {
+            GBS::VDS_UV_STEP_BYPS::write(1);
+        }
+    } else {
+        GBS::VDS_UV_STEP_BYPS::write(1);
+    }
+
+    // transfer preset's display clock to ext. gen
+    externalClockGenResetClock();
+
+    //unfreezeVideo();
+    Menu::init();
+    FrameSync::cleanup();
+    rto->syncLockFailIgnore = 16;
+
+    // undo eventual rto->useHdmiSyncFix (not using this method atm)
+    GBS::VDS_SYNC_EN::write(0);
+    GBS::VDS_FLOCK_EN::write(0);
+
+    if (!rto->outModeHdBypass && rto->autoBestHtotalEnabled &&
+        GBS::GBS_OPTION_SCALING_RGBHV::read() == 0 && !avoidAutoBest &&
+        (rto->videoStandardInput >= 1 && rto->videoStandardInput <= 4)) {
+        // autobesthtotal
+        updateCoastPosition(0);
+        delay(1);
+        resetInterruptNoHsyncBadBit();
+        resetInterruptSogBadBit();
+        delay(10);
+        // works reliably now on my test HDMI dongle
+        if (rto->useHdmiSyncFix && !uopt->wantOutputComponent) {
+            GBS::PAD_SYNC_OUT_ENZ::write(0); // sync out
+        }
+        delay(70); // minimum delay without random failures: TBD
+
+        // known source: cached htotal, phase and sog replace the search below
+        boolean restoredFromCache = restoreSourceSettingsFromCache();
+        for (uint8_t i = 0; i < 4 && !restoredFromCache; i++) {
+            if (GBS::STATUS_INT_SOG_BAD::read() == 1) {
+                optimizeSogLevel();
+                resetInterruptSogBadBit();
+                delay(40);
+            } else if (getStatus16SpHsStable() && getStatus16SpHsStable()) {
+                delay(1); // wifi
+                if (getVideoMode() == rto->videoStandardInput) {
+                    boolean ok = 0;
+                    float sfr = getSourceFieldRate(0);
+                    //Serial.println(sfr, 3);
+                    if (rto->videoStandardInput == 1 || rto->videoStandardInput == 3) {
+                        if (sfr > 58.6f && sfr < 61.4f)
+                            ok = 1;
+                    } else if (rto->videoStandardInput == 2 || rto->videoStandardInput == 4) {
+                        if (sfr > 49.1f && sfr < 51.1f)
+                            ok = 1;
+                    }
+                    if (ok) { // else leave it for later
+                        runAutoBestHTotal();
+                        delay(1); // wifi
+                        break;
+                    }
+                }
+            }
+            delay(10);
+        }
+    } else {
+        // scaling rgbhv, HD modes, no autobesthtotal
+        delay(10);
+        // works reliably now on my test HDMI dongle
+        if (rto->useHdmiSyncFix && !uopt->wantOutputComponent) {
+            GBS::PAD_SYNC_OUT_ENZ::write(0); // sync out
+        }
+        delay(20);
+        updateCoastPosition(0);
+        updateClampPosition();
+    }
+
+    //SerialM.print("pp time: "); SerialM.println(millis() - postLoadTimer);
+
+    // make sure
+    if (rto->useHdmiSyncFix && !uopt->wantOutputComponent) {
+        GBS::PAD_SYNC_OUT_ENZ::write(0); // sync out
+    }
+
+    // late adjustments that require some delay time first
+    if (!rto->isCustomPreset) {
+        if (videoStandardInputIsPalNtscSd() && !rto->outModeHdBypass) {
+            // SNES has less total lines and a slight offset (only relevant in 60Hz)
+            if (GBS::VPERIOD_IF::read() == 523) {
+                GBS::IF_VB_SP::write(GBS::IF_VB_SP::read() + 4);
+                GBS::IF_VB_ST::write(GBS::IF_VB_ST::read() + 4);
+            }
+        }
+    }
+
+    // new, might be useful (3_6D - 3_72)
+    GBS::VDS_EXT_HB_ST::write(GBS::VDS_DIS_HB_ST::read());
+    GBS::VDS_EXT_HB_SP::write(GBS::VDS_DIS_HB_SP::read());
+    GBS::VDS_EXT_VB_ST::write(GBS::VDS_DIS_VB_ST::read());
+    GBS::VDS_EXT_VB_SP::write(GBS::VDS_DIS_VB_SP::read());
+    // VDS_VSYN_SIZE1 + VDS_VSYN_SIZE2 to VDS_VSYNC_RST + 2
+    GBS::VDS_VSYN_SIZE1::write(GBS::VDS_VSYNC_RST::read() + 2);
+    GBS::VDS_VSYN_SIZE2::write(GBS::VDS_VSYNC_RST::read() + 2);
+    GBS::VDS_FRAME_RST::write(4); // 3_19
+    // VDS_FRAME_NO, VDS_FR_SELECT
+    GBS::VDS_FRAME_NO::write(1);  // 3_1f 0-3
+    GBS::VDS_FR_SELECT::write(1); // 3_1b, 3_1c, 3_1d, 3_1e
+
+    // noise starts here!
+    resetDigital();
+
+    resetPLLAD();             // also turns on pllad
+    GBS::PLLAD_LEN::write(1); // 5_11 1
+
+    if (!rto->isCustomPreset) {
+        GBS::VDS_IN_DREG_BYPS::write(0); // 3_40 2 // 0 = input data triggered on falling clock edge, 1 = bypass
+        GBS::PLLAD_R::write(3);
+        GBS::PLLAD_S::write(3);
+        GBS::PLL_R::write(1); // PLL lock detector skew
+        GBS::PLL_S::write(2);
+        GBS::DEC_IDREG_EN::write(1); // 5_1f 7
+        GBS::DEC_WEN_MODE::write(1); // 5_1e 7 // 1 keeps ADC phase consistent. around 4 lock positions vs totally random
+
+        // 4 segment
+        GBS::CAP_SAFE_GUARD_EN::write(0); // 4_21_5 // does more harm than good
+        // memory timings, anti noise
+        GBS::PB_CUT_REFRESH::write(1);   // helps with PLL=ICLK mode artefacting
+        GBS::RFF_LREQ_CUT::write(0);     // was in motionadaptive toggle function but on, off seems nicer
+        GBS::CAP_REQ_OVER::write(0);     // 4_22 0  1=capture stop at hblank 0=free run
+        GBS::CAP_STATUS_SEL::write(1);   // 4_22 1  1=capture request when FIFO 50%, 0= FIFO 100%
+        GBS::PB_REQ_SEL::write(3);       // PlayBack 11 High request Low request
+                                         // 4_2C, 4_2D should be set by preset
+        GBS::RFF_WFF_OFFSET::write(0x0); // scanline fix
+        if (rto->videoStandardInput == 3 || rto->videoStandardInput == 4) {
+            // this also handles mode 14 csync rgbhv
+            GBS::PB_CAP_OFFSET::write(GBS::PB_FETCH_NUM::read() + 4); // 4_37 to 4_39 (green bar)
+        }
+        // 4_12 should be set by preset
+    }
+
+    if (!rto->outModeHdBypass) {
+        ResetSDRAM();
+    }
+
+    setAndUpdateSogLevel(rto->currentLevelSOG); // use this to cycle SP / ADPLL latches
+
+    if (rto->presetID != 0x06 && rto->presetID != 0x16) {
+        // IF_VS_SEL = 1 for SD/HD SP mode in HD mode (5_3e 1)
+        GBS::IF_VS_SEL::write(0); // 0 = "VCR" IF sync, requires VS_FLIP to be on, more stable?
+        GBS::IF_VS_FLIP::write(1);
+    }
+
+    GBS::SP_CLP_SRC_SEL::write(0); // 0: 27Mhz clock; 1: pixel clock
+    GBS::SP_CS_CLP_ST::write(32);
+    GBS::SP_CS_CLP_SP::write(48); // same as reset parameters
+
+    if (!uopt->wantOutputComponent) {
+        GBS::PAD_SYNC_OUT_ENZ::write(0); // enable sync out if needed
+    }
+    GBS::DAC_RGBS_PWDNZ::write(1); // DAC on if needed
+    GBS::DAC_RGBS_SPD::write(0);   // 0_45 2 DAC_SVM power down disable, somehow less jailbars
+    GBS::DAC_RGBS_S0ENZ::write(0); //
+    GBS::DAC_RGBS_S1EN::write(1);  // these 2 also help
+
+    rto->useHdmiSyncFix = 0; // reset flag
+
+    GBS::SP_H_PROTECT::write(0);
+    if (rto->videoStandardInput >= 5) {
+        GBS::SP_DIS_SUB_COAST::write(1); // might not disable it at all soon
+    }
+
+    if (rto->syncTypeCsync) {
+        GBS::SP_EXT_SYNC_SEL::write(1); // 5_20 3 disconnect HV input
+                                        // stays disconnected until reset condition
+    }
+
+    rto->coastPositionIsSet = false; // re-arm these
+    rto->clampPositionIsSet = false;
+
+    if (rto->outModeHdBypass) {
+        GBS::INTERRUPT_CONTROL_01::write(0xff); // enable interrupts
+        GBS::INTERRUPT_CONTROL_00::write(0xff); // reset irq status
+        GBS::INTERRUPT_CONTROL_00::write(0x00);
+        unfreezeVideo(); // eventhough not used atm
+        // DAC and Sync out will be enabled later
+        return; // to setOutModeHdBypass();
+    }
+
+    if (GBS::GBS_OPTION_SCALING_RGBHV::read() == 1) {
+        rto->videoStandardInput = 14;
+    }
+
+    if (GBS::GBS_OPTION_SCALING_RGBHV::read() == 0) {
+        unsigned long timeout = millis();
+        while ((!getStatus16SpHsStable()) && (millis() - timeout < 2002)) {
+            delay(4);
+            Scheduler::yield();
+            updateSpDynamic(0);
+        }
+        while ((getVideoMode() == 0) && (millis() - timeout < 1505)) {
+            delay(4);
+            Scheduler::yield();
+            updateSpDynamic(0);
+        }
+
+        timeout = millis() - timeout;
+        if (timeout > 1000) {
+            Serial.print(F("to1 is: "));
+            Serial.println(timeout);
+        }
+        if (timeout >= 1500) {
+            if (rto->currentLevelSOG >= 7) {
+                optimizeSogLevel();
+                delay(300);
+            }
+        }
+    }
+
+    // early attempt
+    updateClampPosition();
+    if (rto->clampPositionIsSet) {
+        if (GBS::SP_NO_CLAMP_REG::read() == 1) {
+            GBS::SP_NO_CLAMP_REG::write(0);
+        }
+    }
+
+    updateSpDynamic(0);
+
+    if (!rto->syncWatcherEnabled) {
+        GBS::SP_NO_CLAMP_REG::write(0);
+    }
+
+    // this was used with ADC write enable, producing about (exactly?) 4 lock positions
+    // cycling through the phase let it land favorably
+    //for (uint8_t i = 0; i < 8; i++) {
+    //  advancePhase();
+    //}
+
+    setAndUpdateSogLevel(rto->currentLevelSOG); // use this to cycle SP / ADPLL latches
+    //optimizePhaseSP();  // do this later in run loop
+
+    GBS::INTERRUPT_CONTROL_01::write(0xff); // enable interrupts
+    GBS::INTERRUPT_CONTROL_00::write(0xff); // reset irq status
+    GBS::INTERRUPT_CONTROL_00::write(0x00);
+
+    OutputComponentOrVGA();
+
+    // presetPreference 10 means the user prefers bypass mode at startup
+    // it's best to run a normal format detect > apply preset loop, then enter bypass mode
+    // this can lead to an endless loop, so applyPresetDoneStage = 10 applyPresetDoneStage = 11
+    // are introduced to break out of it.
+    // also need to check for mode 15
+    // also make sure to turn off autoBestHtotal
+    if (uopt->presetPreference == 10 && rto->videoStandardInput != 15) {
+        rto->autoBestHtotalEnabled = 0;
+        if (rto->applyPresetDoneStage == 11) {
+            // we were here before, stop the loop
+            rto->applyPresetDoneStage = 1;
+        } else {
+            rto->applyPresetDoneStage = 10;
+        }
+    } else {
+        // normal modes
+        rto->applyPresetDoneStage = 1;
+    }
+
+    Geometry::capture(); // the preset's window, scaling is relative to it
+
+    unfreezeVideo();
+
+    if (uopt->enableFrameTimeLock) {
+        activeFrameTimeLockInitialSteps();
+    }
+
+    SerialM.print(F("\npreset applied: "));
+    if (rto->presetID == 0x01 || rto->presetID == 0x11)
+        SerialM.print(F("1280x960"));
+    else if (rto->presetID == 0x02 || rto->presetID == 0x12)
+        SerialM.print(F("1280x1024"));
+    else if (rto->presetID == 0x03 || rto->presetID == 0x13)
+        SerialM.print(F("1280x720"));
+    else if (rto->presetID == 0x05 || rto->presetID == 0x15)
+        SerialM.print(F("1920x1080"));
+    else if (rto->presetID == 0x06 || rto->presetID == 0x16)
+        SerialM.print(F("downscale"));
+    else if (rto->presetID == 0x04)
+        SerialM.print(F("720x480"));
+    else if (rto->presetID == 0x14)
+        SerialM.print(F("768x576"));
+    else
+        SerialM.print(F("bypass"));
+
+    if (rto->outModeHdBypass) {
+        SerialM.print(F(" (bypass)"));
+    } else if (rto->isCustomPreset) {
+        SerialM.print(F(" (custom)"));
+    }
+
+    SerialM.print(F(" for "));
+    if (rto->videoStandardInput == 1)
+        SerialM.print(F("NTSC 60Hz "));
+    else if (rto->videoStandardInput == 2)
+        SerialM.print(F("PAL 50Hz "));
+    else if (rto->videoStandardInput == 3)
+        SerialM.print(F("EDTV 60Hz"));
+    else if (rto->videoStandardInput == 4)
+        SerialM.print(F("EDTV 50Hz"));
+    else if (rto->videoStandardInput == 5)
+        SerialM.print(F("720p 60Hz HDTV "));
+    else if (rto->videoStandardInput == 6)
+        SerialM.print(F("1080i 60Hz HDTV "));
+    else if (rto->videoStandardInput == 7)
+        SerialM.print(F("1080p 60Hz HDTV "));
+    else if (rto->videoStandardInput == 8)
+        SerialM.print(F("Medium Res "));
+    else if (rto->videoStandardInput == 13)
+        SerialM.print(F("VGA/SVGA/XGA/SXGA"));
+    else if (rto->videoStandardInput == 14) {
+        if (rto->syncTypeCsync)
+            SerialM.print(F("scaling RGB (CSync)"));
+        else
+            SerialM.print(F("scaling RGB (HV Sync)"));
+    } else if (rto->videoStandardInput == 15) {
+        if (rto->syncTypeCsync)
+            SerialM.print(F("RGB Bypass (CSync)"));
+        else
+            SerialM.print(F("RGB Bypass (HV Sync)"));
+    } else if (rto->videoStandardInput == 0)
+        SerialM.print(F("!should not go here!"));
+
+    if (rto->presetID == 0x05 || rto->presetID == 0x15) {
+        SerialM.print(F("(set your TV aspect ratio to 16:9!)"));
+    }
+    if (rto->videoStandardInput == 14) {
+        SerialM.print(F("\nNote: scaling RGB is still in development"));
+    }
+    // presetPreference = OutputCustomized may fail to load (missing) preset file and arrive here with defaults
+    SerialM.println("\n");
+}
+
+// TODO replace result with VideoStandardInput enum
+void applyPresets(uint8_t result)
+{
+    LATENCY_SECTION("applyPresets");
+    if (!rto->boardHasPower) {
+        SerialM.println(F("GBS board not responding!"));
+        return;
+    }
+
+    // if RGBHV scaling and invoked through web ui or custom preset
+    // need to know syncTypeCsync
+    if (result == 14) {
+        if (GBS::STATUS_SYNC_PROC_HSACT::read() == 1) {
+            rto->inputIsYpBpR = 0;
+            if (GBS::STATUS_SYNC_PROC_VSACT::read() == 0) {
+                rto->syncTypeCsync = 1;
+            } else {
+                rto->syncTypeCsync = 0;
+            }
+        }
+    }
+
+    boolean waitExtra = 0;
+    if (rto->outModeHdBypass || rto->videoStandardInput == 15 || rto->videoStandardInput == 0) {
+        waitExtra = 1;
+        if (result <= 4 || result == 14 || result == 8 || result == 9) {
+            GBS::SFTRST_IF_RSTZ::write(1); // early init
+            GBS::SFTRST_VDS_RSTZ::write(1);
+            GBS::SFTRST_DEC_RSTZ::write(1);
+        }
+    }
+    rto->presetIsPalForce60 = 0;      // the default
+    rto->outModeHdBypass = 0;         // the default at this stage
+
+    // in case it is set; will get set appropriately later in doPostPresetLoadSteps()
+    GBS::GBS_PRESET_CUSTOM::write(0);
+    rto->isCustomPreset = false;
+
+    // carry over debug view if possible
+    if (GBS::ADC_UNUSED_62::read() != 0x00) {
+        // only if the preset to load isn't custom
+        // (else the command will instantly disable debug view)
+        if (uopt->presetPreference != 2) {
+            serialCommand = 'D';
+        }
+    }
+
+    if (result == 0) {
+        // Unknown
+        SerialM.println(F("Source format not properly recognized, using fallback preset!"));
+        result = 3;                   // in case of success: override to 480p60
+        GBS::ADC_INPUT_SEL::write(1); // RGB
+        Scheduler::sleep(100);
+        if (GBS::STATUS_SYNC_PROC_HSACT::read() == 1) {
+            rto->inputIsYpBpR = 0;
+            rto->syncWatcherEnabled = 1;
+            if (GBS::STATUS_SYNC_PROC_VSACT::read() == 0) {
+                rto->syncTypeCsync = 1;
+            } else {
+                rto->syncTypeCsync = 0;
+            }
+        } else {
+            GBS::ADC_INPUT_SEL::write(0); // YPbPr
+            Scheduler::sleep(100);
+            if (GBS::STATUS_SYNC_PROC_HSACT::read() == 1) {
+                rto->inputIsYpBpR = 1;
+                rto->syncTypeCsync = 1;
+                rto->syncWatcherEnabled = 1;
+            } else {
+                // found nothing at all, turn off output
+
+                // If we call setResetParameters(), soon afterwards loop() ->
+                // inputAndSyncDetect() -> goLowPowerWithInputDetection() will
+                // call setResetParameters() again. But if we don't call
+                // setResetParameters() here, the second call will never happen.
+                setResetParameters();
+
+                // Deselect the output resolution in the web UI. We cannot call
+                // doPostPresetLoadSteps() to select the right resolution, since
+                // it *enables* the output (showing a green screen) even if
+                // previously disabled, and we want to *disable* it.
+                rto->presetID = 0;
+                return;
+            }
+        }
+    }
+
+    if (uopt->PalForce60 == 1) {
+        if (uopt->presetPreference != 2) { // != custom. custom saved as pal preset has ntsc customization
+            if (result == 2 || result == 4) {
+                Serial.println(F("PAL@50 to 60Hz"));
+                rto->presetIsPalForce60 = 1;
+            }
+            if (result == 2) {
+                result = 1;
+            }
+            if (result == 4) {
+                result = 3;
+            }
+        }
+    }
+
+    /// If uopt->presetPreference == OutputCustomized and we load a custom
+    /// preset, check if it's intended to bypass scaling at the current input
+    /// resolution. If so, setup bypass and skip the rest of applyPresets().
+    auto applySavedBypassPreset = [&result]() -> bool {
+        /*
+        Types:
+
+        - Registers:
+            - Written by applyPresets() -> writeProgramArrayNew(),
+              loadHdBypassSection(), etc.
+            - GBS_PRESET_ID @ S1_2B[0:6]
+            - GBS_PRESET_CUSTOM @ S1_2B[7]
+        - uopt is source of truth, rto is derived cached state???
+        - uopt->presetPreference
+            - Read by applyPresets() to pick an output resolution.
+        - rto->presetID
+            - Written by applyPresets() -> doPostPresetLoadSteps().
+            - = register GBS_PRESET_ID.
+        - rto->isCustomPreset
+            - Written by applyPresets() -> doPostPresetLoadSteps().
+            - = register GBS_PRESET_CUSTOM.
+        - rto->isCustomPreset and rto->presetID control which button is
+            highlighted in the web UI (updateWebSocketData() ->
+            GBSControl.buttonMapping).
+
+        Control flow:
+
+        applyPresets():
+        - If uopt->presetPreference == OutputCustomized (yes):
+            - loadPresetFromSPIFFS()
+                - All custom presets are saved with GBS_PRESET_CUSTOM = 1.
+            - writeProgramArrayNew()
+                - GBS_PRESET_ID = output resolution ID
+                - GBS_PRESET_CUSTOM = 1
+            - applySavedBypassPreset():
+            - If GBS_PRESET_ID == PresetHdBypass (yes):
+                - rto->videoStandardInput = result; (not sure why)
+                - setOutModeHdBypass(regsInitialized=true)
+                    - rto->outModeHdBypass = 1;
+                    - loadHdBypassSection()
+                        - Overwrites S1_30..5F.
+                    - GBS::GBS_PRESET_ID::write(PresetHdBypass);
+                    - if (!regsInitialized) (false)
+                        - ~~GBS::GBS_PRESET_CUSTOM::write(0);~~ (skipped)
+                    - doPostPresetLoadSteps()
+                        - rto->presetID = GBS::GBS_PRESET_ID::read();
+                            - PresetHdBypass
+                        - rto->isCustomPreset = GBS::GBS_PRESET_CUSTOM::read();
+                            - true
+                        - Branches based on rto->presetID
+                        - if (rto->outModeHdBypass) (yes) return.
+                    - ...
+                    - rto->outModeHdBypass = 1; (again?!)
+        */
+
+        uint8_t rawPresetId = GBS::GBS_PRESET_ID::read();
+        if (rawPresetId == PresetHdBypass) {
+            // Required for switching from 240p to 480p to work.
+            rto->videoStandardInput = result;
+
+            // Setup video mode passthrough.
+            setOutModeHdBypass(true);
+            return true;
+        }
+        if (rawPresetId == PresetBypassRGBHV) {
+            // TODO implement bypassModeSwitch_RGBHV (I don't have RGBHV inputs to verify)
+        }
+        return false;
+    };
+
+    if (result == 1 || result == 3 || result == 8 || result == 9 || result == 14) {
+        // NTSC input
+        if (uopt->presetPreference == 0) {
+            writeProgramArrayNew(ntsc_240p, false);
+        } else if (uopt->presetPreference == 1) {
+            writeProgramArrayNew(ntsc_720x480, false);
+        } else if (uopt->presetPreference == 3) {
+            writeProgramArrayNew(ntsc_1280x720, false);
+        }
+#if defined(ESP8266) || defined(GBS_NATIVE)
+        else if (uopt->presetPreference == OutputCustomized) {
+            const uint8_t *preset = loadPresetFromSPIFFS(result);
+            writeProgramArrayNew(preset, false);
+            if (applySavedBypassPreset()) {
+                return;
+            }
+        } else if (uopt->presetPreference == 4) {
+            if (uopt->matchPresetSource && (result != 8) && (GBS::GBS_OPTION_SCALING_RGBHV::read() == 0)) {
+                SerialM.println(F("matched preset override > 1280x960"));
+                writeProgramArrayNew(ntsc_240p, false); // pref = x1024 override to x960
+            } else {
+                writeProgramArrayNew(ntsc_1280x1024, false);
+            }
+        }
+#endif
+        else if (uopt->presetPreference == 5) {
+            writeProgramArrayNew(ntsc_1920x1080, false);
+        } else if (uopt->presetPreference == 6) {
+            writeProgramArrayNew(ntsc_downscale, false);
+        }
+    } else if (result == 2 || result == 4) {
+        // PAL input
+        if (uopt->presetPreference == 0) {
+            if (uopt->matchPresetSource) {
+                SerialM.println(F("matched preset override > 1280x1024"));
+                writeProgramArrayNew(pal_1280x1024, false); // pref = x960 override to x1024
+            } else {
+                writeProgramArrayNew(pal_240p, false);
+            }
+        } else if (uopt->presetPreference == 1) {
+            writeProgramArrayNew(pal_768x576, false);
+        } else if (uopt->presetPreference == 3) {
+            writeProgramArrayNew(pal_1280x720, false);
+        }
+#if defined(ESP8266) || defined(GBS_NATIVE)
+        else if (uopt->presetPreference == OutputCustomized) {
+            const uint8_t *preset = loadPresetFromSPIFFS(result);
+            writeProgramArrayNew(preset, false);
+            if (applySavedBypassPreset()) {
+                return;
+            }
+        } else if (uopt->presetPreference == 4) {
+            writeProgramArrayNew(pal_1280x1024, false);
+        }
+#endif
+        else if (uopt->presetPreference == 5) {
+            writeProgramArrayNew(pal_1920x1080, false);
+        } else if (uopt->presetPreference == 6) {
+            writeProgramArrayNew(pal_downscale, false);
+        }
+    } else if (result == 5 || result == 6 || result == 7 || result == 13) {
+        // use bypass mode for these HD sources
+        rto->videoStandardInput = result;
+        setOutModeHdBypass(false);
+        return;
+    } else if (result == 15) {
+        SerialM.print(F("RGB/HV "));
+        if (rto->syncTypeCsync) {
+            SerialM.print(F("(CSync) "));
+        }
+        //if (uopt->preferScalingRgbhv) {
+        //  SerialM.print("(prefer scaling mode)");
+        //}
+        SerialM.println();
+        bypassModeSwitch_RGBHV();
+        // don't go through doPostPresetLoadSteps
+        return;
+    }
+
+    rto->videoStandardInput = result;
+    if (waitExtra) {
+        // extra time needed for digital resets, so that autobesthtotal works first attempt
+        //Serial.println("waitExtra 400ms");
+        Scheduler::sleep(400); // min ~ 300
+    }
+    doPostPresetLoadSteps();
+}
+
+void unfreezeVideo()
+{
+    /*if (rto->videoIsFrozen == true) {
+    GBS::IF_VB_ST::write(GBS::IF_VB_SP::read() - 2);
+  }
+  rto->videoIsFrozen = false;*/
+    //Serial.print("u");
+    GBS::CAPTURE_ENABLE::write(1);
+}
+
+void freezeVideo()
+{
+    /*if (rto->videoIsFrozen == false) {
+    GBS::IF_VB_ST::write(GBS::IF_VB_SP::read());
+  }
+  rto->videoIsFrozen = true;*/
+    //Serial.print("f");
+    GBS::CAPTURE_ENABLE::write(0);
+}
+
+// if testbus has 0x05, sync is present and line counting active. if it has 0x04, sync is present but no line counting
+boolean getSyncPresent()
+{
+    uint8_t debug_backup = GBS::TEST_BUS_SEL::read();
+    uint8_t debug_backup_SP = GBS::TEST_BUS_SP_SEL::read();
+    if (debug_backup != 0xa) {
+        GBS::TEST_BUS_SEL::write(0xa);
+    }
+    if (debug_backup_SP != 0x0f) {
+        GBS::TEST_BUS_SP_SEL::write(0x0f);
+    }
+
+    uint16_t readout = GBS::TEST_BUS::read();
+
+    if (debug_backup != 0xa) {
+        GBS::TEST_BUS_SEL::write(debug_backup);
+    }
+    if (debug_backup_SP != 0x0f) {
+        GBS::TEST_BUS_SP_SEL::write(debug_backup_SP);
+    }
+    //if (((readout & 0x0500) == 0x0500) || ((readout & 0x0500) == 0x0400)) {
+    if (readout > 0x0180) {
+        return true;
+    }
+
+    return false;
+}
+
+// returns 0_00 bit 2 = H+V both stable (for the IF, not SP)
+boolean getStatus00IfHsVsStable()
+{
+    return ((StatusSnapshot::get<GBS::STATUS_00>() & 0x04) == 0x04) ? 1 : 0;
+}
+
+// used to be a check for the length of the debug bus readout of 5_63 = 0x0f
+// now just checks the chip status at 0_16 HS active (and Interrupt bit4 HS active for RGBHV)
+void setOverSampleRatio(uint8_t newRatio, boolean prepareOnly)
+{
+    uint8_t ks = GBS::PLLAD_KS::read();
+
+    bool hi_res = rto->videoStandardInput == 8 || rto->videoStandardInput == 4 || rto->videoStandardInput == 3;
+    bool bypass = rto->presetID == PresetHdBypass;
+
+    switch (newRatio) {
+        case 1:
+            if (ks == 0)
+                GBS::PLLAD_CKOS::write(0);
+            if (ks == 1)
+                GBS::PLLAD_CKOS::write(1);
+            if (ks == 2)
+                GBS::PLLAD_CKOS::write(2);
+            if (ks == 3)
+                GBS::PLLAD_CKOS::write(3);
+            GBS::ADC_CLK_ICLK2X::write(0);
+            GBS::ADC_CLK_ICLK1X::write(0);
+            GBS::DEC1_BYPS::write(1); // dec1 couples to ADC_CLK_ICLK2X
+            GBS::DEC2_BYPS::write(1);
+
+            // Necessary to avoid a 2x-scaled image for some reason.
+            if (hi_res && !bypass) {
+                GBS::ADC_CLK_ICLK1X::write(1);
+                //GBS::DEC2_BYPS::write(0);
+            }
+
+            rto->osr = 1;
+            //if (!prepareOnly) SerialM.println("OSR 1x");
+
+            break;
+        case 2:
+            if (ks == 0) {
+                setOverSampleRatio(1, false);
+                return;
+            } // 2x impossible
+            if (ks == 1)
+                GBS::PLLAD_CKOS::write(0);
+            if (ks == 2)
+                GBS::PLLAD_CKOS::write(1);
+            if (ks == 3)
+                GBS::PLLAD_CKOS::write(2);
+            GBS::ADC_CLK_ICLK2X::write(0);
+            GBS::ADC_CLK_ICLK1X::write(1);
+            GBS::DEC2_BYPS::write(0);
+            GBS::DEC1_BYPS::write(1); // dec1 couples to ADC_CLK_ICLK2X
+
+            if (hi_res && !bypass) {
+                //GBS::ADC_CLK_ICLK2X::write(1);
+                //GBS::DEC1_BYPS::write(0);
+                // instead increase CKOS by 1 step
+                GBS::PLLAD_CKOS::write(GBS::PLLAD_CKOS::read() + 1);
+            }
+
+            rto->osr = 2;
+            //if (!prepareOnly) SerialM.println("OSR 2x");
+
+            break;
+        case 4:
+            if (ks == 0) {
+                setOverSampleRatio(1, false);
+                return;
+            } // 4x impossible
+            if (ks == 1) {
+                setOverSampleRatio(1, false);
+                return;
+            } // 4x impossible
+            if (ks == 2)
+                GBS::PLLAD_CKOS::write(0);
+            if (ks == 3)
+                GBS::PLLAD_CKOS::write(1);
+            GBS::ADC_CLK_ICLK2X::write(1);
+            GBS::ADC_CLK_ICLK1X::write(1);
+            GBS::DEC1_BYPS::write(0); // dec1 couples to ADC_CLK_ICLK2X
+            GBS::DEC2_BYPS::write(0);
+
+            rto->osr = 4;
+            //if (!prepareOnly) SerialM.println("OSR 4x");
+
+            break;
+        default:
+            break;
+    }
+
+    if (!prepareOnly)
+        latchPLLAD();
+}
+
+void togglePhaseAdjustUnits()
+{
+    GBS::PA_SP_BYPSZ::write(0); // yes, 0 means bypass on here
+    GBS::PA_SP_BYPSZ::write(1);
+    delay(2);
+    GBS::PA_ADC_BYPSZ::write(0);
+    GBS::PA_ADC_BYPSZ::write(1);
+    delay(2);
+}
+
+void advancePhase()
+{
+    rto->phaseADC = (rto->phaseADC + 1) & 0x1f;
+    setAndLatchPhaseADC();
+}
+
+void movePhaseThroughRange()
+{
+    for (uint8_t i = 0; i < 128; i++) { // 4x for 4x oversampling?
+        advancePhase();
+    }
+}
+
+void setAndLatchPhaseSP()
+{
+    GBS::PA_SP_LAT::write(0); // latch off
+    GBS::PA_SP_S::write(rto->phaseSP);
+    GBS::PA_SP_LAT::write(1); // latch on
+}
+
+void setAndLatchPhaseADC()
+{
+    GBS::PA_ADC_LAT::write(0);
+    GBS::PA_ADC_S::write(rto->phaseADC);
+    GBS::PA_ADC_LAT::write(1);
+}
+
+void nudgeMD()
+{
+    GBS::MD_VS_FLIP::write(!GBS::MD_VS_FLIP::read());
+    GBS::MD_VS_FLIP::write(!GBS::MD_VS_FLIP::read());
+}
+
+void updateSpDynamic(boolean withCurrentVideoModeCheck)
+{
+    if (!rto->boardHasPower || rto->sourceDisconnected) {
+        return;
+    }
+
+    uint8_t vidModeReadout = getVideoMode();
+    if (vidModeReadout == 0) {
+        StatusSnapshot::invalidate(); // second opinion straight from the chip
+        vidModeReadout = getVideoMode();
+    }
+
+    if (rto->videoStandardInput == 0 && vidModeReadout == 0) {
+        if (GBS::SP_DLT_REG::read() > 0x30)
+            GBS::SP_DLT_REG::write(0x30); // 5_35
+        else
+            GBS::SP_DLT_REG::write(0xC0);
+        return;
+    }
+    // reset condition, allow most formats to detect
+    // compare 1chip snes and ps2 1080p
+    if (vidModeReadout == 0 && withCurrentVideoModeCheck) {
+        if ((rto->noSyncCounter % 16) <= 8 && rto->noSyncCounter != 0) {
+            GBS::SP_DLT_REG::write(0x30); // 5_35
+        } else if ((rto->noSyncCounter % 16) > 8 && rto->noSyncCounter != 0) {
+            GBS::SP_DLT_REG::write(0xC0); // may want to use lower, around 0x70
+        } else {
+            GBS::SP_DLT_REG::write(0x30);
+        }
+        GBS::SP_H_PULSE_IGNOR::write(0x02);
+        //GBS::SP_DIS_SUB_COAST::write(1);
+        GBS::SP_H_CST_ST::write(0x10);
+        GBS::SP_H_CST_SP::write(0x100);
+        GBS::SP_H_COAST::write(0);        // 5_3e 2 (just in case)
+        GBS::SP_H_TIMER_VAL::write(0x3a); // new: 5_33 default 0x3a, set shorter for better hsync drop detect
+        if (rto->syncTypeCsync) {
+            GBS::SP_COAST_INV_REG::write(1); // new, allows SP to see otherwise potentially skipped vlines
+        }
+        rto->coastPositionIsSet = false;
+        return;
+    }
+
+    if (rto->syncTypeCsync) {
+        GBS::SP_COAST_INV_REG::write(0);
+    }
+
+    if (rto->videoStandardInput != 0) {
+        if (rto->videoStandardInput <= 2) { // SD interlaced
+            GBS::SP_PRE_COAST::write(7);
+            GBS::SP_POST_COAST::write(3);
+            GBS::SP_DLT_REG::write(0xC0);     // old: 0x140 works better than 0x130 with psx
+            GBS::SP_H_TIMER_VAL::write(0x28); // 5_33
+
+            if (rto->syncTypeCsync) {
+                uint16_t hPeriod = GBS::HPERIOD_IF::read();
+                for (int i = 0; i < 16; i++) {
+                    if (hPeriod == 511 || hPeriod < 200) {
+                        hPeriod = GBS::HPERIOD_IF::read(); // retry / overflow
+                        if (i == 15) {
+                            hPeriod = 300;
+                            break; // give up, use short base to get low ignore value later
+                        }
+                    } else {
+                        break;
+                    }
+                    delayMicroseconds(100);
+                }
+
+                uint16_t ignoreLength = hPeriod * 0.081f; // hPeriod is base length
+                if (hPeriod <= 200) {                     // mode is NTSC / PAL, very likely overflow
+                    ignoreLength = 0x18;                  // use neutral but low value
+                }
+
+                // get hpw to ht ratio. stability depends on hpll lock
+                double ratioHs, ratioHsAverage = 0.0;
+                uint8_t testOk = 0;
+                for (int i = 0; i < 30; i++) {
+                    ratioHs = (double)GBS::STATUS_SYNC_PROC_HLOW_LEN::read() / (double)(GBS::STATUS_SYNC_PROC_HTOTAL::read() + 1);
+                    if (ratioHs > 0.041 && ratioHs < 0.152) { // 0.152 : (354 / 2345) is 9.5uS on NTSC (crtemudriver)
+                        testOk++;
+                        ratioHsAverage += ratioHs;
+                        if (testOk == 12) {
+                            ratioHs = ratioHsAverage / testOk;
+                            break;
+                        }
+                        delayMicroseconds(30);
+                    }
+                }
+                if (testOk != 12) {
+                    //Serial.print("          testok: "); Serial.println(testOk);
+                    ratioHs = 0.032; // 0.032: (~100 / 2560) is ~2.5uS on NTSC (find with crtemudriver)
+                }
+
+                //Serial.print(" (debug) hPeriod: ");  Serial.println(hPeriod);
+                //Serial.print(" (debug) ratioHs: ");  Serial.println(ratioHs, 5);
+                //Serial.print(" (debug) ignoreBase: 0x");  Serial.println(ignoreLength,HEX);
+                uint16_t pllDiv = GBS::PLLAD_MD::read();
+                ignoreLength = ignoreLength + (pllDiv * (ratioHs * 0.38)); // for factor: crtemudriver tests
+                //SerialM.print(" (debug) ign.length: 0x"); SerialM.println(ignoreLength, HEX);
+
+                // > check relies on sync instability (potentially from too large ign. length) getting cought earlier
+                if (ignoreLength > GBS::SP_H_PULSE_IGNOR::read() || GBS::SP_H_PULSE_IGNOR::read() >= 0x90) {
+                    if (ignoreLength > 0x90) { // if higher, HPERIOD_IF probably was 511 / limit
+                        ignoreLength = 0x90;
+                    }
+                    if (ignoreLength >= 0x1A && ignoreLength <= 0x42) {
+                        ignoreLength = 0x1A; // at the low end should stick to 0x1A
+                    }
+                    if (ignoreLength != GBS::SP_H_PULSE_IGNOR::read()) {
+                        GBS::SP_H_PULSE_IGNOR::write(ignoreLength);
+                        rto->coastPositionIsSet = 0; // mustn't be skipped, needed when input changes dotclock / Hz
+                        SerialM.print(F(" (debug) ign. length: 0x"));
+                        SerialM.println(ignoreLength, HEX);
+                    }
+                }
+            }
+        } else if (rto->videoStandardInput <= 4) {
+            GBS::SP_PRE_COAST::write(7);  // these two were 7 and 6
+            GBS::SP_POST_COAST::write(6); // and last 11 and 11
+            // 3,3 fixes the ps2 issue but these are too low for format change detects
+            // update: seems to be an SP bypass only problem (t5t57t6 to 0 also fixes it)
+            GBS::SP_DLT_REG::write(0xA0);
+            GBS::SP_H_PULSE_IGNOR::write(0x0E);    // ps3: up to 0x3e, ps2: < 0x14
+        } else if (rto->videoStandardInput == 5) { // 720p
+            GBS::SP_PRE_COAST::write(7);           // down to 4 ok with ps2
+            GBS::SP_POST_COAST::write(7);          // down to 6 ok with ps2 // ps3: 8 too much
+            GBS::SP_DLT_REG::write(0x30);
+            GBS::SP_H_PULSE_IGNOR::write(0x08);    // ps3: 0xd too much
+        } else if (rto->videoStandardInput <= 7) { // 1080i,p
+            GBS::SP_PRE_COAST::write(9);
+            GBS::SP_POST_COAST::write(18); // of 1124 input lines
+            GBS::SP_DLT_REG::write(0x70);
+            // ps2 up to 0x06
+            // new test shows ps2 alternating between okay and not okay at 0x0a with 5_35=0x70
+            GBS::SP_H_PULSE_IGNOR::write(0x06);
+        } else if (rto->videoStandardInput >= 13) { // 13, 14 and 15 (was just 13 and 15)
+            if (rto->syncTypeCsync == false) {
+                GBS::SP_PRE_COAST::write(0x00);
+                GBS::SP_POST_COAST::write(0x00);
+                GBS::SP_H_PULSE_IGNOR::write(0xff); // required this because 5_02 0 is on
+                GBS::SP_DLT_REG::write(0x00);       // sometimes enough on it's own, but not always
+            } else {                                // csync
+                GBS::SP_PRE_COAST::write(0x04);     // as in bypass mode set function
+                GBS::SP_POST_COAST::write(0x07);    // as in bypass mode set function
+                GBS::SP_DLT_REG::write(0x70);
+                GBS::SP_H_PULSE_IGNOR::write(0x02);
+            }
+        }
+    }
+}
+
+void updateCoastPosition(boolean autoCoast)
+{
+    if (((rto->videoStandardInput == 0) || (rto->videoStandardInput > 14)) ||
+        !rto->boardHasPower || rto->sourceDisconnected) {
+        return;
+    }
+
+    uint32_t accInHlength = 0;
+    uint16_t prevInHlength = GBS::HPERIOD_IF::read();
+    for (uint8_t i = 0; i < 8; i++) {
+        // psx jitters between 427, 428
+        uint16_t thisInHlength = GBS::HPERIOD_IF::read();
+        if ((thisInHlength > (prevInHlength - 3)) && (thisInHlength < (prevInHlength + 3))) {
+            accInHlength += thisInHlength;
+        } else {
+            return;
+        }
+        if (!getStatus16SpHsStable()) {
+            return;
+        }
+
+        prevInHlength = thisInHlength;
+    }
+    accInHlength = (accInHlength * 4) / 8;
+
+    // 30.09.19 new: especially in low res VGA input modes, it can clip at "511 * 4 = 2044"
+    // limit to more likely actual value of 430
+    if (accInHlength >= 2040) {
+        accInHlength = 1716;
+    }
+
+    if (accInHlength <= 240) {
+        // check for low res, low Hz > can overflow HPERIOD_IF
+        if (GBS::STATUS_SYNC_PROC_VTOTAL::read() <= 322) {
+            delay(4);
+            if (GBS::STATUS_SYNC_PROC_VTOTAL::read() <= 322) {
+                SerialM.println(F(" (debug) updateCoastPosition: low res, low hz"));
+                accInHlength = 2000;
+                // usually need to lower charge pump. todo: write better check
+                if (rto->syncTypeCsync && rto->videoStandardInput > 0 && rto->videoStandardInput <= 4) {
+                    if (GBS::PLLAD_ICP::read() >= 5 && GBS::PLLAD_FS::read() == 1) {
+                        GBS::PLLAD_ICP::write(5);
+                        GBS::PLLAD_FS::write(0);
+                        latchPLLAD();
+                        rto->phaseIsSet = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    // accInHlength around 1732 here / NTSC
+    // scope on sync-in, enable 5_3e 2 > shows coast borders
+    if (accInHlength > 32) {
+        if (autoCoast) {
+            // autoCoast (5_55 7 = on)
+            GBS::SP_H_CST_ST::write((uint16_t)(accInHlength * 0.0562f)); // ~0x61, right after color burst
+            GBS::SP_H_CST_SP::write((uint16_t)(accInHlength * 0.1550f)); // ~0x10C, shortly before sync falling edge
+            GBS::SP_HCST_AUTO_EN::write(1);
+        } else {
+            // test: psx pal black license screen, then ntsc SMPTE color bars 100%; or MS
+            // scope test psx: t5t11t3, 5_3e = 0x01, 5_36/5_35 = 0x30 5_37 = 0x10 :
+            // cst sp should be > 0x62b to clean out HS from eq pulses
+            // cst st should be 0, sp should be 0x69f when t5t57t7 = disabled
+            //GBS::SP_H_CST_ST::write((uint16_t)(accInHlength * 0.088f)); // ~0x9a, leave some room for SNES 239 mode
+            // new: with SP_H_PROTECT disabled, even SNES can be a small value. Small value greatly improves Mega Drive
+            GBS::SP_H_CST_ST::write(0x10);
+
+            GBS::SP_H_CST_SP::write((uint16_t)(accInHlength * 0.968f)); // ~0x678
+            // need a bit earlier, making 5_3e 2 more stable
+            //GBS::SP_H_CST_SP::write((uint16_t)(accInHlength * 0.7383f));  // ~0x4f0, before sync
+            GBS::SP_HCST_AUTO_EN::write(0);
+        }
+        rto->coastPositionIsSet = 1;
+
+        /*Serial.print("coast ST: "); Serial.print("0x"); Serial.print(GBS::SP_H_CST_ST::read(), HEX);
+    Serial.print(", ");
+    Serial.print("SP: "); Serial.print("0x"); Serial.print(GBS::SP_H_CST_SP::read(), HEX);
+    Serial.print("  total: "); Serial.print("0x"); Serial.print(accInHlength, HEX);
+    Serial.print(" ~ "); Serial.println(accInHlength / 4);*/
+    }
+}
+
+void updateClampPosition()
+{
+    if ((rto->videoStandardInput == 0) || !rto->boardHasPower || rto->sourceDisconnected) {
+        return;
+    }
+    // this is required especially on mode changes with ypbpr
+    if (getVideoMode() == 0) {
+        return;
+    }
+
+    if (rto->inputIsYpBpR) {
+        GBS::SP_CLAMP_MANUAL::write(0);
+    } else {
+        GBS::SP_CLAMP_MANUAL::write(1); // no auto clamp for RGB
+    }
+
+    // STATUS_SYNC_PROC_HTOTAL is "ht: " value; use with SP_CLP_SRC_SEL = 1 pixel clock
+    // GBS::HPERIOD_IF::read()  is "h: " value; use with SP_CLP_SRC_SEL = 0 osc clock
+    // update: in RGBHV bypass it seems both clamp source modes use pixel clock for calculation
+    // but with sog modes, it uses HPERIOD_IF ... k
+    // update2: if the clamp is already short, yet creeps into active video, check sog invert (t5t20t2)
+    uint32_t accInHlength = 0;
+    uint16_t prevInHlength = 0;
+    uint16_t thisInHlength = 0;
+    if (rto->syncTypeCsync)
+        prevInHlength = GBS::HPERIOD_IF::read();
+    else
+        prevInHlength = GBS::STATUS_SYNC_PROC_HTOTAL::read();
+    for (uint8_t i = 0; i < 16; i++) {
+        if (rto->syncTypeCsync)
+            thisInHlength = GBS::HPERIOD_IF::read();
+        else
+            thisInHlength = GBS::STATUS_SYNC_PROC_HTOTAL::read();
+        if ((thisInHlength > (prevInHlength - 3)) && (thisInHlength < (prevInHlength + 3))) {
+            accInHlength += thisInHlength;
+        } else {
+            //Serial.println("updateClampPosition unstable");
+            return;
+        }
+        if (!getStatus16SpHsStable()) {
+            return;
+        }
+
+        prevInHlength = thisInHlength;
+        delayMicroseconds(100);
+    }
+    accInHlength = accInHlength / 16; // for the 16x loop
+
+    // HPERIOD_IF: 9 bits (0-511, represents actual scanline time / 4, can overflow to low values)
+    // if it overflows, the calculated clamp positions are likely around 1 to 4. good enough
+    // STATUS_SYNC_PROC_HTOTAL: 12 bits (0-4095)
+    if (accInHlength > 4095) {
+        return;
+    }
+
+    uint16_t oldClampST = GBS::SP_CS_CLP_ST::read();
+    uint16_t oldClampSP = GBS::SP_CS_CLP_SP::read();
+    float multiSt = rto->syncTypeCsync == 1 ? 0.032f : 0.010f;
+    float multiSp = rto->syncTypeCsync == 1 ? 0.174f : 0.058f;
+    uint16_t start = 1 + (accInHlength * multiSt); // HPERIOD_IF: *0.04 seems good
+    uint16_t stop = 2 + (accInHlength * multiSp);  // HPERIOD_IF: *0.178 starts to creep into some EDTV modes
+
+    if (rto->inputIsYpBpR) {
+        // YUV: // ST shift forward to pass blacker than black HSync, sog: min * 0.08
+        multiSt = rto->syncTypeCsync == 1 ? 0.089f : 0.032f;
+        start = 1 + (accInHlength * multiSt);
+
+        // new: HDBypass rewrite to sync to falling HS edge: move clamp position forward
+        // RGB can stay the same for now (clamp will start on sync pulse, a benefit in RGB
+        if (rto->outModeHdBypass) {
+            if (videoStandardInputIsPalNtscSd()) {
+                start += 0x60;
+                stop += 0x60;
+            }
+            // raise blank level a bit that's not handled 100% by clamping
+            GBS::HD_BLK_GY_DATA::write(0x05);
+            GBS::HD_BLK_BU_DATA::write(0x00);
+            GBS::HD_BLK_RV_DATA::write(0x00);
+        }
+    }
+
+    if ((start < (oldClampST - 1) || start > (oldClampST + 1)) ||
+        (stop < (oldClampSP - 1) || stop > (oldClampSP + 1))) {
+        GBS::SP_CS_CLP_ST::write(start);
+        GBS::SP_CS_CLP_SP::write(stop);
+        /*Serial.print("clamp ST: "); Serial.print("0x"); Serial.print(start, HEX);
+    Serial.print(", ");
+    Serial.print("SP: "); Serial.print("0x"); Serial.print(stop, HEX);
+    Serial.print("   total: "); Serial.print("0x"); Serial.print(accInHlength, HEX);
+    Serial.print(" / "); Serial.println(accInHlength);*/
+    }
+
+    rto->clampPositionIsSet = true;
+}
+
+// use t5t00t2 and adjust t5t11t5 to find this sources ideal sampling clock for this preset (affected by htotal)
+// 2431 for psx, 2437 for MD
+// in this mode, sampling clock is free to choose
+void setOutModeHdBypass(bool regsInitialized)
+{
+    if (!rto->boardHasPower) {
+        SerialM.println(F("GBS board not responding!"));
+        return;
+    }
+
+    rto->autoBestHtotalEnabled = false; // disable while in this mode
+    rto->outModeHdBypass = 1;           // skips waiting at end of doPostPresetLoadSteps
+
+    externalClockGenResetClock();
+    updateSpDynamic(0);
+    loadHdBypassSection(); // this would be ignored otherwise
+    if (GBS::ADC_UNUSED_62::read() != 0x00) {
+        // remember debug view
+        if (uopt->presetPreference != 2) {
+            serialCommand = 'D';
+        }
+    }
+
+    GBS::SP_NO_COAST_REG::write(0);  // enable vblank coast (just in case)
+    GBS::SP_COAST_INV_REG::write(0); // also just in case
+
+    FrameSync::cleanup();
+    GBS::ADC_UNUSED_62::write(0x00);      // clear debug view
+    GBS::RESET_CONTROL_0x46::write(0x00); // 0_46 all off, nothing needs to be enabled for bp mode
+    GBS::RESET_CONTROL_0x47::write(0x00);
+    GBS::PA_ADC_BYPSZ::write(1); // enable phase unit ADC
+    GBS::PA_SP_BYPSZ::write(1);  // enable phase unit SP
+
+    GBS::GBS_PRESET_ID::write(PresetHdBypass);
+    // If loading from top-level, clear custom preset flag to avoid stale
+    // values. If loading after applyPresets() called writeProgramArrayNew(), it
+    // has already set the flag to 1.
+    if (!regsInitialized) {
+        GBS::GBS_PRESET_CUSTOM::write(0);
+    }
+    doPostPresetLoadSteps(); // todo: remove this, code path for hdbypass is hard to follow
+
+    // doPostPresetLoadSteps() sets rto->presetID = GBS_PRESET_ID::read() =
+    // PresetHdBypass, and rto->isCustomPreset = GBS_PRESET_CUSTOM::read().
+
+    resetDebugPort();
+
+    rto->autoBestHtotalEnabled = false; // need to re-set this
+    GBS::OUT_SYNC_SEL::write(1);        // 0_4f 1=sync from HDBypass, 2=sync from SP, 0 = sync from VDS
+
+    GBS::PLL_CKIS::write(0);    // 0_40 0 //  0: PLL uses OSC clock | 1: PLL uses input clock
+    GBS::PLL_DIVBY2Z::write(0); // 0_40 1 // 1= no divider (full clock, ie 27Mhz) 0 = halved
+    //GBS::PLL_ADS::write(0); // 0_40 3 test:  input clock is from PCLKIN (disconnected, not ADC clock)
+    GBS::PAD_OSC_CNTRL::write(1); // test: noticed some wave pattern in 720p source, this fixed it
+    GBS::PLL648_CONTROL_01::write(0x35);
+    GBS::PLL648_CONTROL_03::write(0x00);
+    GBS::PLL_LEN::write(1); // 0_43
+    GBS::DAC_RGBS_R0ENZ::write(1);
+    GBS::DAC_RGBS_G0ENZ::write(1); // 0_44
+    GBS::DAC_RGBS_B0ENZ::write(1);
+    GBS::DAC_RGBS_S1EN::write(1); // 0_45
+    // from RGBHV tests: the memory bus can be tri stated for noise reduction
+    GBS::PAD_TRI_ENZ::write(1);        // enable tri state
+    GBS::PLL_MS::write(2);             // select feedback clock (but need to enable tri state!)
+    GBS::MEM_PAD_CLK_INVERT::write(0); // helps also
+    GBS::RESET_CONTROL_0x47::write(0x1f);
+
+    // update: found the real use of HDBypass :D
+    GBS::DAC_RGBS_BYPS2DAC::write(1);
+    GBS::SP_HS_LOOP_SEL::write(1);
+    GBS::SP_HS_PROC_INV_REG::write(0); // (5_56_5) do not invert HS
+    GBS::SP_CS_P_SWAP::write(0);       // old default, set here to reset between HDBypass formats
+    GBS::SP_HS2PLL_INV_REG::write(0);  // same
+
+    GBS::PB_BYPASS::write(1);
+    GBS::PLLAD_MD::write(2345); // 2326 looks "better" on my LCD but 2345 looks just correct on scope
+    GBS::PLLAD_KS::write(2);    // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
+    setOverSampleRatio(2, true);
+    GBS::PLLAD_ICP::write(5);
+    GBS::PLLAD_FS::write(1);
+
+    if (rto->inputIsYpBpR) {
+        GBS::DEC_MATRIX_BYPS::write(1); // 5_1f 2 = 1 for YUV / 0 for RGB
+        GBS::HD_MATRIX_BYPS::write(0);  // 1_30 1 / input to jacks is yuv, adc leaves it as yuv > convert to rgb for output here
+        GBS::HD_DYN_BYPS::write(0);     // don't bypass color expansion
+                                        //GBS::HD_U_OFFSET::write(3);     // color adjust via scope
+                                        //GBS::HD_V_OFFSET::write(3);     // color adjust via scope
+    } else {
+        GBS::DEC_MATRIX_BYPS::write(1); // this is normally RGB input for HDBYPASS out > no color matrix at all
+        GBS::HD_MATRIX_BYPS::write(1);  // 1_30 1 / input is rgb, adc leaves it as rgb > bypass matrix
+        GBS::HD_DYN_BYPS::write(1);     // bypass as well
+    }
+
+    GBS::HD_SEL_BLK_IN::write(0); // 0 enables HDB blank timing (1 would be DVI, not working atm)
+
+    GBS::SP_SDCS_VSST_REG_H::write(0); // S5_3B
+    GBS::SP_SDCS_VSSP_REG_H::write(0); // S5_3B
+    GBS::SP_SDCS_VSST_REG_L::write(0); // S5_3F // 3 for SP sync
+    GBS::SP_SDCS_VSSP_REG_L::write(2); // S5_40 // 10 for SP sync // check with interlaced sources
+
+    GBS::HD_HSYNC_RST::write(0x3ff); // max 0x7ff
+    GBS::HD_INI_ST::write(0);        // todo: test this at 0 / was 0x298
+    // timing into HDB is PLLAD_MD with PLLAD_KS divider: KS = 0 > full PLLAD_MD
+    if (rto->videoStandardInput <= 2) {
+        // PAL and NTSC are rewrites, the rest is still handled normally
+        // These 2 formats now have SP_HS2PLL_INV_REG set. That's the only way I know so far that
+        // produces recovered HSyncs that align to the falling edge of the input
+        // ToDo: find reliable input active flank detect to then set SP_HS2PLL_INV_REG correctly
+        // (for PAL/NTSC polarity is known to be active low, but other formats are variable)
+        GBS::SP_HS2PLL_INV_REG::write(1);  //5_56 1 lock to falling HS edge // check > sync issues with MD
+        GBS::SP_CS_P_SWAP::write(1);       //5_3e 0 new: this should negate the problem with inverting HS2PLL
+        GBS::SP_HS_PROC_INV_REG::write(1); // (5_56_5) invert HS to DEC
+        // invert mode detect HS/VS triggers, helps PSX NTSC detection. required with 5_3e 0 set
+        GBS::MD_HS_FLIP::write(1);
+        GBS::MD_VS_FLIP::write(1);
+        GBS::OUT_SYNC_SEL::write(2);   // new: 0_4f 1=sync from HDBypass, 2=sync from SP, 0 = sync from VDS
+        GBS::SP_HS_LOOP_SEL::write(0); // 5_57 6 new: use full SP sync, enable HS positioning and pulse length control
+        GBS::ADC_FLTR::write(3);       // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+        //GBS::HD_INI_ST::write(0x76); // 1_39
+
+        GBS::HD_HSYNC_RST::write((GBS::PLLAD_MD::read() / 2) + 8); // ADC output pixel count determined
+        GBS::HD_HB_ST::write(GBS::PLLAD_MD::read() * 0.945f);      // 1_3B  // no idea why it's not coupled to HD_RST
+        GBS::HD_HB_SP::write(0x90);                                // 1_3D
+        GBS::HD_HS_ST::write(0x80);                                // 1_3F  // but better to use SP sync directly (OUT_SYNC_SEL = 2)
+        GBS::HD_HS_SP::write(0x00);                                // 1_41  //
+        // to use SP sync directly; prepare reasonable out HS length
+        GBS::SP_CS_HS_ST::write(0xA0);
+        GBS::SP_CS_HS_SP::write(0x00);
+
+        if (rto->videoStandardInput == 1) {
+            setCsVsStart(250);         // don't invert VS with direct SP sync mode
+            setCsVsStop(1);            // stop relates to HS pulses from CS decoder directly, so mind EQ pulses
+            GBS::HD_VB_ST::write(500); // 1_43
+            GBS::HD_VS_ST::write(3);   // 1_47 // but better to use SP sync directly (OUT_SYNC_SEL = 2)
+            GBS::HD_VS_SP::write(522); // 1_49 //
+            GBS::HD_VB_SP::write(16);  // 1_45
+        }
+        if (rto->videoStandardInput == 2) {
+            setCsVsStart(301);         // don't invert
+            setCsVsStop(5);            // stop past EQ pulses (6 on psx) normally, but HDMI adapter works with -=1 (5)
+            GBS::HD_VB_ST::write(605); // 1_43
+            GBS::HD_VS_ST::write(1);   // 1_47
+            GBS::HD_VS_SP::write(621); // 1_49
+            GBS::HD_VB_SP::write(16);  // 1_45
+        }
+    } else if (rto->videoStandardInput == 3 || rto->videoStandardInput == 4) { // 480p, 576p
+        GBS::ADC_FLTR::write(2);                                               // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+        GBS::PLLAD_KS::write(1);                                               // 5_16 post divider
+        GBS::PLLAD_CKOS::write(0);                                             // 5_16 2x OS (with KS=1)
+        //GBS::HD_INI_ST::write(0x76); // 1_39
+        GBS::HD_HB_ST::write(0x864); // 1_3B
+            // you *must* begin hblank before hsync.
+        GBS::HD_HB_SP::write(0xa0);  // 1_3D
+        GBS::HD_VB_ST::write(0x00);  // 1_43
+        GBS::HD_VB_SP::write(0x40);  // 1_45
+        if (rto->videoStandardInput == 3) {
+            GBS::HD_HS_ST::write(0x54);  // 1_3F
+            GBS::HD_HS_SP::write(0x864); // 1_41
+            GBS::HD_VS_ST::write(0x06);  // 1_47 // VS neg
+            GBS::HD_VS_SP::write(0x00);  // 1_49
+            setCsVsStart(525 - 5);
+            setCsVsStop(525 - 3);
+        }
+        if (rto->videoStandardInput == 4) {
+            GBS::HD_HS_ST::write(0x10);  // 1_3F
+            GBS::HD_HS_SP::write(0x880); // 1_41
+            GBS::HD_VS_ST::write(0x06);  // 1_47 // VS neg
+            GBS::HD_VS_SP::write(0x00);  // 1_49
+            setCsVsStart(48);
+            setCsVsStop(46);
+        }
+    } else if (rto->videoStandardInput <= 7 || rto->videoStandardInput == 13) {
+        //GBS::SP_HS2PLL_INV_REG::write(0); // 5_56 1 use rising edge of tri-level sync // always 0 now
+        if (rto->videoStandardInput == 5) { // 720p
+            GBS::PLLAD_MD::write(2474);     // override from 2345
+            GBS::HD_HSYNC_RST::write(550);  // 1_37
+            //GBS::HD_INI_ST::write(78);     // 1_39
+            // 720p has high pllad vco output clock, so don't do oversampling
+            GBS::PLLAD_KS::write(0);       // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
+            GBS::PLLAD_CKOS::write(0);     // 5_16 1x OS (with KS=CKOS=0)
+            GBS::ADC_FLTR::write(0);       // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+            GBS::ADC_CLK_ICLK1X::write(0); // 5_00 4 (OS=1)
+            GBS::DEC2_BYPS::write(1);      // 5_1f 1 // dec2 disabled (OS=1)
+            GBS::PLLAD_ICP::write(6);      // fine at 6 only, FS is 1
+            GBS::PLLAD_FS::write(1);
+            GBS::HD_HB_ST::write(0);     // 1_3B
+            GBS::HD_HB_SP::write(0x140); // 1_3D
+            GBS::HD_HS_ST::write(0x20);  // 1_3F
+            GBS::HD_HS_SP::write(0x80);  // 1_41
+            GBS::HD_VB_ST::write(0x00);  // 1_43
+            GBS::HD_VB_SP::write(0x6c);  // 1_45 // ps3 720p tested
+            GBS::HD_VS_ST::write(0x00);  // 1_47
+            GBS::HD_VS_SP::write(0x05);  // 1_49
+            setCsVsStart(2);
+            setCsVsStop(0);
+        }
+        if (rto->videoStandardInput == 6) { // 1080i
+            // interl. source
+            GBS::HD_HSYNC_RST::write(0x710); // 1_37
+            //GBS::HD_INI_ST::write(2);    // 1_39
+            GBS::PLLAD_KS::write(1);    // 5_16 post divider
+            GBS::PLLAD_CKOS::write(0);  // 5_16 2x OS (with KS=1)
+            GBS::ADC_FLTR::write(1);    // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+            GBS::HD_HB_ST::write(0);    // 1_3B
+            GBS::HD_HB_SP::write(0xb8); // 1_3D
+            GBS::HD_HS_ST::write(0x04); // 1_3F
+            GBS::HD_HS_SP::write(0x50); // 1_41
+            GBS::HD_VB_ST::write(0x00); // 1_43
+            GBS::HD_VB_SP::write(0x1e); // 1_45
+            GBS::HD_VS_ST::write(0x04); // 1_47
+            GBS::HD_VS_SP::write(0x09); // 1_49
+            setCsVsStart(8);
+            setCsVsStop(6);
+        }
+        if (rto->videoStandardInput == 7) {  // 1080p
+            GBS::PLLAD_MD::write(2749);      // override from 2345
+            GBS::HD_HSYNC_RST::write(0x710); // 1_37
+            //GBS::HD_INI_ST::write(0xf0);     // 1_39
+            // 1080p has highest pllad vco output clock, so don't do oversampling
+            GBS::PLLAD_KS::write(0);       // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
+            GBS::PLLAD_CKOS::write(0);     // 5_16 1x OS (with KS=CKOS=0)
+            GBS::ADC_FLTR::write(0);       // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+            GBS::ADC_CLK_ICLK1X::write(0); // 5_00 4 (OS=1)
+            GBS::DEC2_BYPS::write(1);      // 5_1f 1 // dec2 disabled (OS=1)
+            GBS::PLLAD_ICP::write(6);      // was 5, fine at 6 as well, FS is 1
+            GBS::PLLAD_FS::write(1);
+            GBS::HD_HB_ST::write(0x00); // 1_3B
+            GBS::HD_HB_SP::write(0xb0); // 1_3D // d0
+            GBS::HD_HS_ST::write(0x20); // 1_3F
+            GBS::HD_HS_SP::write(0x70); // 1_41
+            GBS::HD_VB_ST::write(0x00); // 1_43
+            GBS::HD_VB_SP::write(0x2f); // 1_45
+            GBS::HD_VS_ST::write(0x04); // 1_47
+            GBS::HD_VS_SP::write(0x0A); // 1_49
+        }
+        if (rto->videoStandardInput == 13) { // odd HD mode (PS2 "VGA" over Component)
+            applyRGBPatches();               // treat mostly as RGB, clamp R/B to gnd
+            rto->syncTypeCsync = true;       // used in loop to set clamps and SP dynamic
+            GBS::DEC_MATRIX_BYPS::write(1);  // overwrite for this mode
+            GBS::SP_PRE_COAST::write(4);
+            GBS::SP_POST_COAST::write(4);
+            GBS::SP_DLT_REG::write(0x70);
+            GBS::HD_MATRIX_BYPS::write(1);     // bypass since we'll treat source as RGB
+            GBS::HD_DYN_BYPS::write(1);        // bypass since we'll treat source as RGB
+            GBS::SP_VS_PROC_INV_REG::write(0); // don't invert
+            // same as with RGBHV, the ps2 resolution can vary widely
+            GBS::PLLAD_KS::write(0);       // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
+            GBS::PLLAD_CKOS::write(0);     // 5_16 1x OS (with KS=CKOS=0)
+            GBS::ADC_CLK_ICLK1X::write(0); // 5_00 4 (OS=1)
+            GBS::ADC_CLK_ICLK2X::write(0); // 5_00 3 (OS=1)
+            GBS::DEC1_BYPS::write(1);      // 5_1f 1 // dec1 disabled (OS=1)
+            GBS::DEC2_BYPS::write(1);      // 5_1f 1 // dec2 disabled (OS=1)
+            GBS::PLLAD_MD::write(512);     // could try 856
+        }
+    }
+
+    if (rto->videoStandardInput == 13) {
+        // section is missing HD_HSYNC_RST and HD_INI_ST adjusts
+        uint16_t vtotal = GBS::STATUS_SYNC_PROC_VTOTAL::read();
+        if (vtotal < 532) { // 640x480 or less
+            GBS::PLLAD_KS::write(3);
+            GBS::PLLAD_FS::write(1);
+        } else if (vtotal >= 532 && vtotal < 810) { // 800x600, 1024x768
+            //GBS::PLLAD_KS::write(3); // just a little too much at 1024x768
+            GBS::PLLAD_FS::write(0);
+            GBS::PLLAD_KS::write(2);
+        } else { //if (vtotal > 1058 && vtotal < 1074) { // 1280x1024
+            GBS::PLLAD_KS::write(2);
+            GBS::PLLAD_FS::write(1);
+        }
+    }
+
+    GBS::DEC_IDREG_EN::write(1); // 5_1f 7
+    GBS::DEC_WEN_MODE::write(1); // 5_1e 7 // 1 keeps ADC phase consistent. around 4 lock positions vs totally random
+    rto->phaseSP = 8;
+    rto->phaseADC = 24;                         // fix value // works best with yuv input in tests
+    setAndUpdateSogLevel(rto->currentLevelSOG); // also re-latch everything
+
+    rto->outModeHdBypass = 1;
+
+    unsigned long timeout = millis();
+    while ((!getStatus16SpHsStable()) && (millis() - timeout < 2002)) {
+        delay(1);
+    }
+    while ((getVideoMode() == 0) && (millis() - timeout < 1502)) {
+        delay(1);
+    }
+    // currently SP is using generic settings, switch to format specific ones
+    updateSpDynamic(0);
+    while ((getVideoMode() == 0) && (millis() - timeout < 1502)) {
+        delay(1);
+    }
+
+    GBS::DAC_RGBS_PWDNZ::write(1);   // enable DAC
+    GBS::PAD_SYNC_OUT_ENZ::write(0); // enable sync out
+    delay(200);
+    optimizePhaseSP();
+    SerialM.println(F("pass-through on"));
+}
+
+void bypassModeSwitch_RGBHV()
+{
+    if (!rto->boardHasPower) {
+        SerialM.println(F("GBS board not responding!"));
+        return;
+    }
+
+    GBS::DAC_RGBS_PWDNZ::write(0);   // disable DAC
+    GBS::PAD_SYNC_OUT_ENZ::write(1); // disable sync out
+
+    loadHdBypassSection();
+    externalClockGenResetClock();
+    FrameSync::cleanup();
+    GBS::ADC_UNUSED_62::write(0x00); // clear debug view
+    GBS::PA_ADC_BYPSZ::write(1);     // enable phase unit ADC
+    GBS::PA_SP_BYPSZ::write(1);      // enable phase unit SP
+    applyRGBPatches();
+    resetDebugPort();
+    rto->videoStandardInput = 15;       // making sure
+    rto->autoBestHtotalEnabled = false; // not necessary, since VDS is off / bypassed // todo: mode 14 (works anyway)
+    rto->clampPositionIsSet = false;
+    rto->HPLLState = 0;
+
+    GBS::PLL_CKIS::write(0);           // 0_40 0 //  0: PLL uses OSC clock | 1: PLL uses input clock
+    GBS::PLL_DIVBY2Z::write(0);        // 0_40 1 // 1= no divider (full clock, ie 27Mhz) 0 = halved clock
+    GBS::PLL_ADS::write(0);            // 0_40 3 test:  input clock is from PCLKIN (disconnected, not ADC clock)
+    GBS::PLL_MS::write(2);             // 0_40 4-6 select feedback clock (but need to enable tri state!)
+    GBS::PAD_TRI_ENZ::write(1);        // enable some pad's tri state (they become high-z / inputs), helps noise
+    GBS::MEM_PAD_CLK_INVERT::write(0); // helps also
+    GBS::PLL648_CONTROL_01::write(0x35);
+    GBS::PLL648_CONTROL_03::write(0x00); // 0_43
+    GBS::PLL_LEN::write(1);              // 0_43
+
+    GBS::DAC_RGBS_ADC2DAC::write(1);
+    GBS::OUT_SYNC_SEL::write(1); // 0_4f 1=sync from HDBypass, 2=sync from SP, (00 = from VDS)
+
+    GBS::SFTRST_HDBYPS_RSTZ::write(1); // enable
+    GBS::HD_INI_ST::write(0);          // needs to be some small value or apparently 0 works
+                                       //GBS::DAC_RGBS_BYPS2DAC::write(1);
+                                       //GBS::OUT_SYNC_SEL::write(2); // 0_4f sync from SP
+                                       //GBS::SFTRST_HDBYPS_RSTZ::write(1); // need HDBypass
+                                       //GBS::SP_HS_LOOP_SEL::write(1); // (5_57_6) // can bypass since HDBypass does sync
+    GBS::HD_MATRIX_BYPS::write(1);     // bypass since we'll treat source as RGB
+    GBS::HD_DYN_BYPS::write(1);        // bypass since we'll treat source as RGB
+                                       //GBS::HD_SEL_BLK_IN::write(1); // "DVI", not regular
+
+    GBS::PAD_SYNC1_IN_ENZ::write(0); // filter H/V sync input1 (0 = on)
+    GBS::PAD_SYNC2_IN_ENZ::write(0); // filter H/V sync input2 (0 = on)
+
+    GBS::SP_SOG_P_ATO::write(1); // 5_20 1 corrects hpw readout and slightly affects sync
+    if (rto->syncTypeCsync == false) {
+        GBS::SP_SOG_SRC_SEL::write(0);  // 5_20 0 | 0: from ADC 1: from hs // use ADC and turn it off = no SOG
+        GBS::ADC_SOGEN::write(1);       // 5_02 0 ADC SOG // having it 0 drags down the SOG (hsync) input; = 1: need to supress SOG decoding
+        GBS::SP_EXT_SYNC_SEL::write(0); // connect HV input ( 5_20 bit 3 )
+        GBS::SP_SOG_MODE::write(0);     // 5_56 bit 0 // 0: normal, 1: SOG
+        GBS::SP_NO_COAST_REG::write(1); // vblank coasting off
+        GBS::SP_PRE_COAST::write(0);
+        GBS::SP_POST_COAST::write(0);
+        GBS::SP_H_PULSE_IGNOR::write(0xff); // cancel out SOG decoding
+        GBS::SP_SYNC_BYPS::write(0);        // external H+V sync for decimator (+ sync out) | 1 to mirror in sync, 0 to output processed sync
+        GBS::SP_HS_POL_ATO::write(1);       // 5_55 4 auto polarity for retiming
+        GBS::SP_VS_POL_ATO::write(1);       // 5_55 6
+        GBS::SP_HS_LOOP_SEL::write(1);      // 5_57_6 | 0 enables retiming on SP | 1 to bypass input to HDBYPASS
+        GBS::SP_H_PROTECT::write(0);        // 5_3e 4 disable for H/V
+        rto->phaseADC = 16;
+        rto->phaseSP = 8;
+    } else {
+        // todo: SOG SRC can be ADC or HS input pin. HS requires TTL level, ADC can use lower levels
+        // HS seems to have issues at low PLL speeds
+        // maybe add detection whether ADC Sync is needed
+        GBS::SP_SOG_SRC_SEL::write(0);  // 5_20 0 | 0: from ADC 1: hs is sog source
+        GBS::SP_EXT_SYNC_SEL::write(1); // disconnect HV input
+        GBS::ADC_SOGEN::write(1);       // 5_02 0 ADC SOG
+        GBS::SP_SOG_MODE::write(1);     // apparently needs to be off for HS input (on for ADC)
+        GBS::SP_NO_COAST_REG::write(0); // vblank coasting on
+        GBS::SP_PRE_COAST::write(4);    // 5_38, > 4 can be seen with clamp invert on the lower lines
+        GBS::SP_POST_COAST::write(7);
+        GBS::SP_SYNC_BYPS::write(0);   // use regular sync for decimator (and sync out) path
+        GBS::SP_HS_LOOP_SEL::write(1); // 5_57_6 | 0 enables retiming on SP | 1 to bypass input to HDBYPASS
+        GBS::SP_H_PROTECT::write(1);   // 5_3e 4 enable for SOG
+        rto->currentLevelSOG = 24;
+        rto->phaseADC = 16;
+        rto->phaseSP = 8;
+    }
+    GBS::SP_CLAMP_MANUAL::write(1);  // needs to be 1
+    GBS::SP_COAST_INV_REG::write(0); // just in case
+
+    GBS::SP_DIS_SUB_COAST::write(1);   // 5_3e 5
+    GBS::SP_HS_PROC_INV_REG::write(0); // 5_56 5
+    GBS::SP_VS_PROC_INV_REG::write(0); // 5_56 6
+    GBS::PLLAD_KS::write(1);           // 0 - 3
+    setOverSampleRatio(2, true);       // prepare only = true
+    GBS::DEC_MATRIX_BYPS::write(1);    // 5_1f with adc to dac mode
+    GBS::ADC_FLTR::write(0);           // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+
+    GBS::PLLAD_ICP::write(4);
+    GBS::PLLAD_FS::write(0);    // low gain
+    GBS::PLLAD_MD::write(1856); // 1349 perfect for for 1280x+ ; 1856 allows lower res to detect
+
+    // T4R0x2B Bit: 3 (was 0x7) is now: 0xF
+    // S0R0x4F (was 0x80) is now: 0xBC
+    // 0_43 1a
+    // S5R0x2 (was 0x48) is now: 0x54
+    // s5s11sb2
+    //0x25, // s0_44
+    //0x11, // s0_45
+    // new: do without running default preset first
+    GBS::ADC_TA_05_CTRL::write(0x02); // 5_05 1 // minor SOG clamp effect
+    GBS::ADC_TEST_04::write(0x02);    // 5_04
+    GBS::ADC_TEST_0C::write(0x12);    // 5_0c 1 4
+    GBS::DAC_RGBS_R0ENZ::write(1);
+    GBS::DAC_RGBS_G0ENZ::write(1);
+    GBS::DAC_RGBS_B0ENZ::write(1);
+    GBS::OUT_SYNC_CNTRL::write(1);
+    //resetPLL();   // try to avoid this
+    resetDigital();       // this will leave 0_46 all 0
+    resetSyncProcessor(); // required to initialize SOG status
+    delay(2);
+    ResetSDRAM();
+    delay(2);
+    resetPLLAD();
+    togglePhaseAdjustUnits();
+    delay(20);
+    GBS::PLLAD_LEN::write(1);        // 5_11 1
+    GBS::DAC_RGBS_PWDNZ::write(1);   // enable DAC
+    GBS::PAD_SYNC_OUT_ENZ::write(0); // enable sync out
+
+    // todo: detect if H-PLL parameters fit the source before aligning clocks (5_11 etc)
+
+    setAndLatchPhaseSP(); // different for CSync and pure HV modes
+    setAndLatchPhaseADC();
+    latchPLLAD();
+
+    if (uopt->enableAutoGain == 1 && adco->r_gain == 0) {
+        //SerialM.println("ADC gain: reset");
+        setAdcGain(AUTO_GAIN_INIT);
+        GBS::DEC_TEST_ENABLE::write(1);
+    } else if (uopt->enableAutoGain == 1 && adco->r_gain != 0) {
+        /*SerialM.println("ADC gain: keep previous");
+    SerialM.print(adco->r_gain, HEX); SerialM.print(" ");
+    SerialM.print(adco->g_gain, HEX); SerialM.print(" ");
+    SerialM.print(adco->b_gain, HEX); SerialM.println(" ");*/
+        GBS::ADC_RGCTRL::write(adco->r_gain);
+        GBS::ADC_GGCTRL::write(adco->g_gain);
+        GBS::ADC_BGCTRL::write(adco->b_gain);
+        GBS::DEC_TEST_ENABLE::write(1);
+    } else {
+        GBS::DEC_TEST_ENABLE::write(0); // no need for decimation test to be enabled
+    }
+
+    rto->presetID = PresetBypassRGBHV; // bypass flavor 2, used to signal buttons in web ui
+    GBS::GBS_PRESET_ID::write(PresetBypassRGBHV);
+    delay(200);
+}
+
+const uint8_t *loadPresetFromSPIFFS(byte forVideoMode)
+{
+    static uint8_t preset[432];
+    String s = "";
+    Ascii8 slot = 0;
+    File f;
+
+    f = SPIFFS.open("/preferencesv2.txt", "r");
+    if (f) {
+        SerialM.println(F("preferencesv2.txt opened"));
+        uint8_t result[3];
+        result[0] = f.read(); // todo: move file cursor manually
+        result[1] = f.read();
+        result[2] = f.read();
+
+        f.close();
+        slot = result[2];
+    } else {
+        // file not found, we don't know what preset to load
+        SerialM.println(F("please select a preset slot first!")); // say "slot" here to make people save usersettings
+        if (forVideoMode == 2 || forVideoMode == 4)
+            return pal_240p;
+        else
+            return ntsc_240p;
+    }
+
+    SerialM.print(F("loading from preset slot "));
+    SerialM.print((char)slot);
+    SerialM.print(": ");
+
+    if (forVideoMode == 1) {
+        f = SPIFFS.open("/preset_ntsc." + String((char)slot), "r");
+    } else if (forVideoMode == 2) {
+        f = SPIFFS.open("/preset_pal." + String((char)slot), "r");
+    } else if (forVideoMode == 3) {
+        f = SPIFFS.open("/preset_ntsc_480p." + String((char)slot), "r");
+    } else if (forVideoMode == 4) {
+        f = SPIFFS.open("/preset_pal_576p." + String((char)slot), "r");
+    } else if (forVideoMode == 5) {
+        f = SPIFFS.open("/preset_ntsc_720p." + String((char)slot), "r");
+    } else if (forVideoMode == 6) {
+        f = SPIFFS.open("/preset_ntsc_1080p." + String((char)slot), "r");
+    } else if (forVideoMode == 8) {
+        f = SPIFFS.open("/preset_medium_res." + String((char)slot), "r");
+    } else if (forVideoMode == 14) {
+        f = SPIFFS.open("/preset_vga_upscale." + String((char)slot), "r");
+    } else if (forVideoMode == 0) {
+        f = SPIFFS.open("/preset_unknown." + String((char)slot), "r");
+    }
+
+    if (!f) {
+        SerialM.println(F("no preset file for this slot and source"));
+        if (forVideoMode == 2 || forVideoMode == 4)
+            return pal_240p;
+        else
+            return ntsc_240p;
+    } else {
+        SerialM.println(f.name());
+        s = f.readStringUntil('}');
+        f.close();
+    }
+
+    char *tmp;
+    uint16_t i = 0;
+    tmp = strtok(&s[0], ",");
+    while (tmp) {
+        preset[i++] = (uint8_t)atoi(tmp);
+        tmp = strtok(NULL, ",");
+        yield(); // wifi stack
+    }
+
+    return preset;
+}
+
+void loadDefaultUserOptions()
+{
+    uopt->presetPreference = Output960P;    // #1
+    uopt->enableFrameTimeLock = 0; // permanently adjust frame timing to avoid glitch vertical bar. does not work on all displays!
+    uopt->presetSlot = 'A';          //
+    uopt->frameTimeLockMethod = 0; // compatibility with more displays
+    uopt->enableAutoGain = 0;
+    uopt->wantScanlines = 0;
+    uopt->wantOutputComponent = 0;
+    uopt->deintMode = 0;
+    uopt->wantVdsLineFilter = 0;
+    uopt->wantPeaking = 1;
+    uopt->preferScalingRgbhv = 1;
+    uopt->wantTap6 = 1;
+    uopt->PalForce60 = 0;
+    uopt->matchPresetSource = 1;             // #14
+    uopt->wantStepResponse = 1;              // #15
+    uopt->wantFullHeight = 1;                // #16
+    uopt->enableCalibrationADC = 1;          // #17
+    uopt->scanlineStrength = 0x30;           // #18
+    uopt->disableExternalClockGenerator = 0; // #19
+    uopt->enableAutoGeometry = 0;            // #20
+}
+
+// run time state as after boot, before the first source is detected
+void loadDefaultRunTimeOptions()
+{
+    rto->enableDebugPings = false;
+    rto->autoBestHtotalEnabled = true; // automatically find the best horizontal total pixel value for a given input timing
+    rto->syncLockFailIgnore = 16;      // allow syncLock to fail x-1 times in a row before giving up (sync glitch immunity)
+    rto->forceRetime = false;
+    rto->syncWatcherEnabled = true; // continously checks the current sync status. required for normal operation
+    rto->phaseADC = 16;
+    rto->phaseSP = 16;
+    rto->failRetryAttempts = 0;
+    rto->presetID = 0;
+    rto->isCustomPreset = false;
+    rto->HPLLState = 0;
+    rto->motionAdaptiveDeinterlaceActive = false;
+    rto->deinterlaceAutoEnabled = true;
+    rto->scanlinesEnabled = false;
+    rto->boardHasPower = true;
+    rto->presetIsPalForce60 = false;
+    rto->syncTypeCsync = false;
+    rto->isValidForScalingRGBHV = false;
+    rto->medResLineCount = 0x33; // 51*8=408
+    rto->osr = 0;
+    rto->useHdmiSyncFix = 0;
+    rto->notRecognizedCounter = 0;
+
+    // more run time variables
+    rto->inputIsYpBpR = false;
+    rto->videoStandardInput = 0;
+    rto->outModeHdBypass = false;
+    rto->videoIsFrozen = false;
+    rto->printInfos = false;
+    rto->sourceDisconnected = true;
+    rto->isInLowPowerMode = false;
+    rto->applyPresetDoneStage = 0;
+    rto->presetVlineShift = 0;
+    rto->clampPositionIsSet = 0;
+    rto->coastPositionIsSet = 0;
+    rto->autoGeometryIsSet = 0;
+    rto->continousStableCounter = 0;
+    rto->currentLevelSOG = 5;
+    rto->thisSourceMaxLevelSOG = 31; // 31 = auto sog has not (yet) run
+
+    adco->r_gain = 0;
+    adco->g_gain = 0;
+    adco->b_gain = 0;
+    adco->r_off = 0;
+    adco->g_off = 0;
+    adco->b_off = 0;
+
+    serialCommand = '@'; // ASCII @ = 0
+    userCommand = '@';
+}
+#endif
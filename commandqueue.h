@@ -0,0 +1,88 @@
+#ifndef COMMANDQUEUE_H_
+#define COMMANDQUEUE_H_
+
+// Commands from the web server (/sc, /uc, /batch, /wifi/connect) for loop().
+//
+// The async web server handlers run outside of loop(), often while loop() is
+// stuck in a long operation like applyPresets(). They only push, loop() only
+// pops, so a single producer / single consumer ring with volatile indices is
+// enough: the entry is written before head is published and read before tail
+// is released. A full queue drops the new command and counts it.
+
+#define COMMANDQUEUE_SIZE 32 // power of 2, one slot stays free
+
+enum CommandType : uint8_t {
+    SerialCommandType = 0, // handled by the big switch in loop() (/sc)
+    UserCommandType = 1,   // handled by handleType2Command() (/uc)
+};
+
+class CommandQueue
+{
+private:
+    struct Entry
+    {
+        uint8_t type;
+        char command;
+    };
+
+    Entry entries[COMMANDQUEUE_SIZE];
+    volatile uint8_t head = 0; // written by the producer only
+    volatile uint8_t tail = 0; // written by the consumer only
+    volatile uint32_t dropped = 0;
+    uint8_t maxDepth = 0; // deepest the queue has been since boot, /batch reports it
+
+public:
+    // producer side
+    bool push(CommandType type, char command)
+    {
+        uint8_t next = (head + 1) & (COMMANDQUEUE_SIZE - 1);
+        if (next == tail) {
+            dropped = dropped + 1;
+            return false;
+        }
+        entries[head].type = type;
+        entries[head].command = command;
+        __asm__ __volatile__("" ::: "memory"); // entry before index
+        head = next;
+
+        uint8_t d = depth();
+        if (d > maxDepth) {
+            maxDepth = d;
+        }
+        return true;
+    }
+
+    // consumer side
+    bool pop(CommandType &type, char &command)
+    {
+        if (tail == head) {
+            return false;
+        }
+        type = (CommandType)entries[tail].type;
+        command = entries[tail].command;
+        __asm__ __volatile__("" ::: "memory"); // entry before index
+        tail = (tail + 1) & (COMMANDQUEUE_SIZE - 1);
+        return true;
+    }
+
+    uint8_t depth() const
+    {
+        return (head - tail) & (COMMANDQUEUE_SIZE - 1);
+    }
+
+    uint8_t capacity() const
+    {
+        return COMMANDQUEUE_SIZE - 1;
+    }
+
+    uint8_t highWater() const
+    {
+        return maxDepth;
+    }
+
+    uint32_t droppedCount() const
+    {
+        return dropped;
+    }
+};
+#endif
@@ -0,0 +1,81 @@
+#ifndef CORE_H_
+#define CORE_H_
+
+// The portable core of the firmware: register layer (tv5725.h), preset application,
+// mode detection, geometry and frame sync. It reaches the board only through the
+// Arduino API and hal.h, so the same code builds for the ESP8266 (gbs-control.ino)
+// and on the host (native/, CMakeLists.txt or pio run -e native).
+//
+// The including file provides, before this header:
+//   options.h, slot.h, sourcecache.h, hal.h, latency.h, scheduler.h, busarbiter.h,
+//   i2ctrace.h, Wire, tv5725.h and osd.h
+//   typedef TV5725<GBS_ADDR> GBS
+//   rto, uopt, adco, serialCommand, userCommand, lastSegment
+//   SerialM (logging), Si (Si5351mcu), DEBUG_IN_PIN, LEDON, LEDOFF, MIN, MAX
+//   void handleWiFi(boolean instant), called during long waits
+
+#include "ntsc_240p.h"
+#include "pal_240p.h"
+#include "ntsc_720x480.h"
+#include "pal_768x576.h"
+#include "ntsc_1280x720.h"
+#include "ntsc_1280x1024.h"
+#include "ntsc_1920x1080.h"
+#include "ntsc_downscale.h"
+#include "pal_1280x720.h"
+#include "pal_1280x1024.h"
+#include "pal_1920x1080.h"
+#include "pal_downscale.h"
+#include "presetMdSection.h"
+#include "presetDeinterlacerSection.h"
+#include "presetHdBypassSection.h"
+#include "ofw_RGBS.h"
+
+#include "framesync.h"
+
+//
+// Sync locking tunables/magic numbers
+//
+struct FrameSyncAttrs
+{
+    static const uint8_t debugInPin = DEBUG_IN_PIN;
+    static const uint32_t lockInterval = 100 * 16.70; // every 100 frames
+    static const int16_t syncCorrection = 2;          // Sync correction in scanlines to apply when phase lags target
+    static const int32_t syncTargetPhase = 90;        // Target vsync phase offset (output trails input) in degrees
+                                                      // to debug: syncTargetPhase = 343 lockInterval = 15 * 16
+};
+typedef FrameSyncManager<GBS, FrameSyncAttrs> FrameSync;
+
+#include "statussnapshot.h"
+
+struct StatusSnapshotAttrs
+{
+    static const uint8_t blockSize = 0x1D; // 0_00 .. 0_1C, up to STATUS_SYNC_PROC_VTOTAL
+    static const uint16_t maxAgeMs = 5;    // default, adjustable at runtime
+};
+typedef StatusSnapshotManager<GBS, StatusSnapshotAttrs> StatusSnapshot;
+
+struct MenuAttrs
+{
+    static const int8_t shiftDelta = 4;
+    static const int8_t scaleDelta = 4;
+    static const int16_t vertShiftRange = 300;
+    static const int16_t horizShiftRange = 400;
+    static const int16_t vertScaleRange = 100;
+    static const int16_t horizScaleRange = 130;
+    static const int16_t barLength = 100;
+};
+typedef MenuManager<GBS, MenuAttrs> Menu;
+
+/// Video processing mode, loaded into register GBS_PRESET_ID by applyPresets()
+/// and read to rto->presetID by doPostPresetLoadSteps(). Shown on web UI.
+enum PresetID : uint8_t {
+    PresetHdBypass = 0x21,
+    PresetBypassRGBHV = 0x22,
+};
+
+#include "modedetect.h"
+#include "geometry.h"
+#include "autogeometry.h"
+#include "chipcontrol.h"
+#endif
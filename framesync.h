@@ -7,6 +7,11 @@
 #ifndef DEBUG_IN_PIN
 #define DEBUG_IN_PIN D6
 #endif
+#elif defined(GBS_NATIVE)
+// host build, digitalRead() from native/hal
+#ifndef DEBUG_IN_PIN
+#define DEBUG_IN_PIN D6
+#endif
 #else // Arduino
 // fastest, but non portable (Uno pin 11 = PB3, Mega2560 pin 11 = PB5)
 //#define digitalRead(x) bitRead(PINB, 3)
@@ -47,8 +52,7 @@ namespace MeasurePeriod {
     {
         noInterrupts();
         //startTime = ESP.getCycleCount();
-        __asm__ __volatile__("rsr %0,ccount"
-                            : "=a"(startTime));
+        startTime = Hal::cycles();
         detachInterrupt(DEBUG_IN_PIN);
         armed = 1;
         attachInterrupt(DEBUG_IN_PIN, _risingEdgeISR_measure, RISING);
@@ -59,8 +63,7 @@ namespace MeasurePeriod {
     {
         noInterrupts();
         //stopTime = ESP.getCycleCount();
-        __asm__ __volatile__("rsr %0,ccount"
-                            : "=a"(stopTime));
+        stopTime = Hal::cycles();
         detachInterrupt(DEBUG_IN_PIN);
         interrupts();
     }
@@ -116,6 +119,11 @@ private:
     /// Reset with syncLastCorrection.
     static float maybeFreqExt_per_videoFps;
 
+    // last successful vsyncPeriodAndPhase() result in CPU cycles, for telemetry
+    static uint32_t lastPeriodInput;
+    static uint32_t lastPeriodOutput;
+    static int32_t lastPhase;
+
     // Sample vsync start and stop times from debug pin.
     static bool vsyncOutputSample(uint32_t *start, uint32_t *stop)
     {
@@ -178,6 +186,10 @@ private:
         if (phase)
             *phase = (diff < inPeriod) ? diff : diff - inPeriod;
 
+        lastPeriodInput = inPeriod;
+        lastPeriodOutput = outPeriod;
+        lastPhase = (diff < inPeriod) ? diff : diff - inPeriod;
+
         return true;
     }
 
@@ -340,6 +352,21 @@ public:
         return syncLastCorrection;
     }
 
+    static uint32_t getLastPeriodInput()
+    {
+        return lastPeriodInput;
+    }
+
+    static uint32_t getLastPeriodOutput()
+    {
+        return lastPeriodOutput;
+    }
+
+    static int32_t getLastPhase()
+    {
+        return lastPhase;
+    }
+
     static void cleanup()
     {
         fsDebugPrintf("FrameSyncManager::cleanup(), resetting video frequency\n");
@@ -677,4 +704,13 @@ uint8_t FrameSyncManager<GBS, Attrs>::delayLock;
 
 template <class GBS, class Attrs>
 bool FrameSyncManager<GBS, Attrs>::syncLockReady;
+
+template <class GBS, class Attrs>
+uint32_t FrameSyncManager<GBS, Attrs>::lastPeriodInput;
+
+template <class GBS, class Attrs>
+uint32_t FrameSyncManager<GBS, Attrs>::lastPeriodOutput;
+
+template <class GBS, class Attrs>
+int32_t FrameSyncManager<GBS, Attrs>::lastPhase;
 #endif
@@ -0,0 +1,65 @@
+import re
+from argparse import ArgumentParser
+
+# Builds the register name table used by the register inspector (reginspect.h,
+# served as /regs/names) from the typedefs in tv5725.h.
+#   python3 generate_register_names.py [-i tv5725.h] [-o tv5725_names.h]
+
+REG_PATTERN = re.compile(
+    r'typedef\s+UReg<\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*>\s*(\w+)\s*;')
+
+header = """#ifndef TV5725_NAMES_H_
+#define TV5725_NAMES_H_
+
+// generated by generate_register_names.py from tv5725.h, do not edit
+
+typedef struct
+{
+    uint8_t segment;
+    uint8_t byteOffset;
+    uint8_t bitOffset;
+    uint8_t bitWidth;
+    const char *name; // PROGMEM
+} RegisterName;
+
+"""
+
+footer = """#endif
+"""
+
+
+def collect(path):
+    registers = []
+    names = set()
+    with open(path) as fp:
+        for line in fp:
+            line = line.split('//')[0]
+            m = REG_PATTERN.search(line)
+            if not m:
+                continue
+            seg, offset, bit, width, name = m.groups()
+            if name in names:
+                raise ValueError(f"Duplicated register name: {name}")
+            names.add(name)
+            registers.append((int(seg, 0), int(offset, 0), int(bit), int(width), name))
+    registers.sort(key=lambda r: (r[0], r[1], r[2], -r[3]))
+    return registers
+
+
+if __name__ == '__main__':
+    parser = ArgumentParser()
+    parser.add_argument('--input', '-i', default='tv5725.h')
+    parser.add_argument('--output', '-o', default='tv5725_names.h')
+    args = parser.parse_args()
+    registers = collect(args.input)
+
+    with open(args.output, 'w') as fp:
+        fp.write(header)
+        for index, (_, _, _, _, name) in enumerate(registers):
+            fp.write(f'static const char RN_{index}[] PROGMEM = "{name}";\n')
+        fp.write('\nconst RegisterName registerNames[] PROGMEM = {\n')
+        for index, (seg, offset, bit, width, _) in enumerate(registers):
+            fp.write(f'    {{{seg}, 0x{offset:02x}, {bit}, {width}, RN_{index}}},\n')
+        fp.write('};\n')
+        fp.write(f'#define REGISTER_NAMES_COUNT {len(registers)}\n')
+        fp.write(footer)
@@ -1,14 +1,15 @@
 import json
-
-from PIL import Image, ImageDraw, ImageFont
-
-import json
-import os.path
 import pathlib
-import sys
+import re
 from argparse import ArgumentParser
 
-from PIL import Image, ImageDraw, ImageFont
+# Renders the OLED menu texts to XBM images (OLEDMenuTranslations.h) and writes the
+# glyph subsets of the fonts the menu draws text with (OLEDMenuFonts.h).
+#   python3 generate_translations.py [lang] -f 12@font.ttf 16@font.ttf
+#   python3 generate_translations.py --from-header OLEDMenuTranslations.h
+# The images are stored zero run length encoded (see OLEDMenuRle.h): a 0x00 byte is
+# followed by the number of zero bytes it stands for, any other byte is literal.
+# --from-header re-encodes an existing header, no fonts or PIL needed.
 
 MENU_WIDTH = 128
 MENU_HEIGHT = 64
@@ -134,13 +135,26 @@ menu_items = [
 
 ]
 
-res = """
-#define %(name)s_WIDTH %(width)s
-#define %(name)s_HEIGHT %(height)s
-const unsigned char %(name)s [] PROGMEM = {
-%(array)s
-};
-"""
+# Glyphs kept in OLEDMenuFonts.h, taken from the full fonts in fonts.h.
+# (font, characters, keep the whole jump table)
+# Fonts that draw runtime text (SSIDs, preset names) keep all of Latin-1, drawString()
+# maps UTF-8 to it, so accented names still render. They keep their jump table, so any
+# character code lands on a valid (maybe empty) entry.
+# The fixed texts only need their own characters, the table ends at the last one.
+LATIN1 = ''.join(chr(c) for c in range(0x20, 0x100))
+FONT_SUBSETS = [
+    # menu items, WiFi info, preset names
+    ('DejaVu_Sans_Mono_12', LATIN1, True),
+    # status bar "%d/%d"
+    ('DejaVu_Sans_Mono_10', ' /0123456789', False),
+    # current settings page: resolution, frame rate, input
+    ('URW_Gothic_L_Book_20', ' .-0123456789xDownscalebypassHzRGBYpBV', False),
+]
+
+FONT_PATTERN = re.compile(r'const uint8_t (\w+)\[\] PROGMEM = \{(.*?)\};', re.S)
+ARRAY_PATTERN = re.compile(
+    r'#define (\w+)_WIDTH (\d+)\s*#define \1_HEIGHT (\d+)\s*const unsigned char \1 \[\] PROGMEM = \{(.*?)\};', re.S)
+RLE_MARKER = '#define OLED_MENU_TRANSLATIONS_RLE'
 
 tags_map = {}
 fonts_map = {}
@@ -148,6 +162,7 @@ default_font = None
 
 
 def convert(text, font):
+    from PIL import Image, ImageDraw
     img = Image.new('L', (0, 0), color=0)
     draw = ImageDraw.Draw(img)
     _, _, width, height = draw.textbbox((0, 0), text, font)
@@ -199,19 +214,158 @@ def collect(lang):
         tags_map[tag] = translated, size
 
 
+def rle_encode(data):
+    out = []
+    i = 0
+    while i < len(data):
+        if data[i] == 0:
+            run = 1
+            while i + run < len(data) and data[i + run] == 0 and run < 255:
+                run += 1
+            out += [0, run]
+            i += run
+        else:
+            out.append(data[i])
+            i += 1
+    return out
+
+
+def rle_decode(data):
+    out = []
+    i = 0
+    while i < len(data):
+        if data[i] == 0:
+            out += [0] * data[i + 1]
+            i += 2
+        else:
+            out.append(data[i])
+            i += 1
+    return out
+
+
+def hex_bytes(text):
+    text = re.sub(r'//[^\n]*', '', text)
+    return [int(x, 16) for x in re.findall(r'0x[0-9A-Fa-f]+', text)]
+
+
+def read_header(path):
+    """images of an existing OLEDMenuTranslations.h, raw XBM bytes"""
+    with open(path) as fp:
+        text = fp.read()
+    encoded = RLE_MARKER in text
+    images = []
+    for name, width, height, body in ARRAY_PATTERN.findall(text):
+        data = hex_bytes(body)
+        if encoded:
+            data = rle_decode(data)
+        width, height = int(width), int(height)
+        if len(data) != (width + 7) // 8 * height:
+            raise ValueError(f"{name}: {len(data)} bytes for {width}x{height}")
+        images.append((name, width, height, data))
+    return images
+
+
 template = """
 #define %(name)s_WIDTH %(width)s
 #define %(name)s_HEIGHT %(height)s
-const unsigned char %(name)s [] PROGMEM = {
+const unsigned char %(name)s [] PROGMEM = { // %(raw)d bytes raw
 %(array)s
 };
 """
+
+
+def write_header(path, images):
+    raw_total = 0
+    total = 0
+    with open(path, 'w') as fp:
+        fp.write('#ifndef OLED_MENU_TRANSLATIONS_H_\n')
+        fp.write('#define OLED_MENU_TRANSLATIONS_H_\n')
+        fp.write('// generated by generate_translations.py, zero run length encoded, draw with drawRleXbm()\n')
+        fp.write(RLE_MARKER + '\n')
+        for name, width, height, data in images:
+            encoded = rle_encode(data)
+            raw_total += len(data)
+            total += len(encoded)
+            tmp_str = ""
+            for i in range(0, len(encoded), 16):
+                tmp_str += ','.join([hex(x) for x in encoded[i:i + 16]]) + ',\n'
+            fp.write(template % {'array': tmp_str, 'raw': len(data),
+                                 'width': width, 'height': height, 'name': name})
+        fp.write('#endif')
+    print(f"Images: {raw_total} bytes raw, {total} bytes encoded. Output file: {pathlib.Path(path).absolute()}")
+
+
+def subset_font(name, body, chars, keep_table):
+    data = hex_bytes(body)
+    width, height, first, count = data[:4]
+    table = data[4:4 + 4 * count]
+    glyphs = data[4 + 4 * count:]
+    codes = sorted({ord(c) for c in chars if first <= ord(c) < first + count})
+    if not keep_table:
+        count = codes[-1] - first + 1
+    lines = [
+        f'    0x{width:02X}, // Width: {width}',
+        f'    0x{height:02X}, // Height: {height}',
+        f'    0x{first:02X}, // First Char: {first}',
+        f'    0x{count:02X}, // Numbers of Chars: {count}',
+        '',
+        '    // Jump Table:',
+    ]
+    font_data = []
+    offset = 0
+    for index in range(count):
+        msb, lsb, size, advance = table[4 * index:4 * index + 4]
+        code = first + index
+        if code in codes and (msb, lsb) != (0xFF, 0xFF):
+            start = (msb << 8) | lsb
+            font_data.append((code, glyphs[start:start + size]))
+            lines.append(f'    0x{offset >> 8:02X}, 0x{offset & 0xFF:02X}, 0x{size:02X}, 0x{advance:02X}, // {code}:{offset}')
+            offset += size
+        else:
+            lines.append(f'    0xFF, 0xFF, 0x00, 0x{advance:02X}, // {code}:65535')
+    lines += ['', '    // Font Data:']
+    for index, (code, glyph) in enumerate(font_data):
+        comma = ',' if index < len(font_data) - 1 else ''
+        lines.append('    ' + ', '.join(f'0x{b:02X}' for b in glyph) + f'{comma} // {code}')
+    size = 4 + 4 * count + offset
+    return f'const uint8_t {name}[] PROGMEM = {{\n' + '\n'.join(lines) + '\n};\n', size, len(data)
+
+
+def write_fonts(source, path):
+    with open(source) as fp:
+        fonts = dict(FONT_PATTERN.findall(fp.read()))
+    out = []
+    for name, chars, keep_table in FONT_SUBSETS:
+        if name not in fonts:
+            raise KeyError(f"Font {name} not found in {source}")
+        text, size, full = subset_font(name, fonts[name], chars, keep_table)
+        print(f"{name}: {full} -> {size} bytes")
+        out.append(text)
+    with open(path, 'w') as fp:
+        fp.write('#ifndef OLED_MENU_FONTS_H_\n')
+        fp.write('#define OLED_MENU_FONTS_H_\n')
+        fp.write(f'// generated by generate_translations.py from {source}, only the glyphs the menu uses\n')
+        fp.write('// Created by http://oleddisplay.squix.ch/ Consider a donation\n')
+        fp.write('\n'.join(out))
+        fp.write('\n#endif\n')
+
+
 if __name__ == '__main__':
     parser = ArgumentParser()
     parser.add_argument('lang', help='Language code', nargs='?')
     parser.add_argument('--fonts', '-f', nargs='*', default=[])
     parser.add_argument('--output', '-o', default='OLEDMenuTranslations.h')
+    parser.add_argument('--from-header', help='re-encode the images of an existing header instead of rendering')
+    parser.add_argument('--font-source', default='fonts.h', help='full fonts to take the glyph subsets from')
+    parser.add_argument('--font-output', default='OLEDMenuFonts.h')
     args = parser.parse_args()
+
+    write_fonts(args.font_source, args.font_output)
+    if args.from_header:
+        write_header(args.output, read_header(args.from_header))
+        raise SystemExit
+
+    from PIL import ImageFont
     for font in args.fonts:
         tokens = font.split('@')
         if len(tokens) == 1:
@@ -226,7 +380,6 @@ if __name__ == '__main__':
                 raise ValueError(f"No a valid integer: {font}.") from None
             fonts_map[font_size] = font_path
     collect(args.lang)
-    tag_res_map = {}
 
     for _, (_, size) in tags_map.items():
         # pre-checks to avoid a corrupted header file.
@@ -240,26 +393,12 @@ if __name__ == '__main__':
         except (OSError, FileNotFoundError):
             raise FileNotFoundError(f"Font does not exist: {font}") from None
 
-    with open(args.output, 'w') as fp:
-        fp.write('#ifndef OLED_MENU_TRANSLATIONS_H_\n')
-        fp.write('#define OLED_MENU_TRANSLATIONS_H_\n')
-        for tag, (text, size) in tags_map.items():
-            if not size:
-                size = DEFAULT_FONT_SIZE
-            font = fonts_map.get(size, default_font)
-            font = ImageFont.truetype(font, size=size)
-            width, height, byte_array = convert(text, font)
-            tmp_str = ""
-            i = 0
-            while i < len(byte_array):
-                if i + 16 < len(byte_array):
-                    end = i + 16
-                else:
-                    end = len(byte_array)
-                tmp_str += ','.join([hex(x)
-                                     for x in byte_array[i:end]]) + ',\n'
-                i = end
-            fp.write(template % {'array': tmp_str,
-                                 'width': width, 'height': height, 'name': tag})
-        fp.write('#endif')
-        print(f"Finished. Output file: {pathlib.Path(args.output).absolute()}")
+    images = []
+    for tag, (text, size) in tags_map.items():
+        if not size:
+            size = DEFAULT_FONT_SIZE
+        font = fonts_map.get(size, default_font)
+        font = ImageFont.truetype(font, size=size)
+        width, height, byte_array = convert(text, font)
+        images.append((tag, width, height, byte_array))
+    write_header(args.output, images)
@@ -0,0 +1,407 @@
+#ifndef GEOMETRY_H_
+#define GEOMETRY_H_
+
+// Output picture geometry: scaling, position and the visible window, solved in one
+// pass and written with one burst per segment.
+//
+// The registers involved:
+//   VDS_HSCALE, VDS_VSCALE (+ bypass bits)  1023 = 1:1, smaller scales up
+//   VDS_HB_SP .. VDS_HB_ST                  memory fetch window = the picture, output clocks
+//   VDS_VB_SP (VDS_VB_ST = VB_SP - 2)       first picture line
+//   VDS_DIS_HB_SP/ST, VDS_DIS_VB_SP/ST      visible output window
+//   IF_VB_SP (IF_VB_ST follows)             first source line taken
+// All VDS ones are in 3_00 .. 3_18, the IF ones in 1_1C .. 1_1F: read() is one burst,
+// readSource() another for the IF side, apply() writes each block at most once.
+//
+// A Target describes the wanted result in absolute terms. solve() derives every
+// register from it: the fetch window width follows from the scale (the picture
+// gets wider in proportion to 1024 / hscale) around the wanted picture center, and
+// the window is kept within htotal/vtotal, blanking included. Adjustments of any
+// size are a change of the target, not a number of small steps.
+//
+// The width comes from the preset's own window at 1:1, taken by capture() after a
+// preset load, rounded to nearest. The same hscale and center always give the same
+// window, however they were reached: +n then -n is back where it started.
+//
+//   Geometry::Timings now = Geometry::read();
+//   Geometry::Target target = Geometry::targetOf(now);
+//   target.hscale -= 40;
+//   target.hCenter += 16;
+//   Geometry::apply(now, target);
+//
+// /geometry queues relative changes from the web server, run() applies them.
+
+#define GEOMETRY_MIN_HBLANK 16 // output clocks between the end and the start of the fetch window
+#define GEOMETRY_HSCALE_MIN 256
+#define GEOMETRY_VSCALE_MIN 128
+#define GEOMETRY_SCALE_MAX 1023
+#define GEOMETRY_POS_MAX 4095 // 12 bit position registers
+
+namespace Geometry
+{
+    // consecutive registers of one segment: read with one burst, the changed span
+    // written back with one burst
+    template <uint8_t Segment, uint8_t First, uint8_t Count>
+    class Block
+    {
+    private:
+        uint8_t data[Count];
+        uint8_t sent[Count];
+
+        template <class Reg>
+        static constexpr bool contains()
+        {
+            return Reg::segment == Segment && Reg::byteOffset >= First &&
+                   Reg::byteOffset + tw::detail::byteSize(Reg::bitOffset, Reg::bitWidth) <= First + Count;
+        }
+
+    public:
+        void read()
+        {
+            GBS::read(Segment, First, data, Count);
+            memcpy(sent, data, Count);
+        }
+
+        template <class Reg>
+        typename Reg::Value get()
+        {
+            static_assert(contains<Reg>(), "register not in block");
+            return tw::detail::regDecode<Reg::bitOffset, Reg::bitWidth>(data + Reg::byteOffset - First);
+        }
+
+        template <class Reg>
+        void set(typename Reg::Value value)
+        {
+            static_assert(contains<Reg>(), "register not in block");
+            tw::detail::regEncode<Reg::bitOffset, Reg::bitWidth>(value, data + Reg::byteOffset - First);
+        }
+
+        // returns the number of bytes written
+        uint8_t flush()
+        {
+            uint8_t lo = Count, hi = 0;
+            for (uint8_t i = 0; i < Count; i++) {
+                if (data[i] != sent[i]) {
+                    lo = MIN(lo, i);
+                    hi = i;
+                }
+            }
+            if (lo == Count) {
+                return 0;
+            }
+            GBS::write(Segment, First + lo, data + lo, hi - lo + 1);
+            memcpy(sent + lo, data + lo, hi - lo + 1);
+            return hi - lo + 1;
+        }
+    };
+
+    typedef Block<3, 0x00, 0x19> VdsBlock;
+    typedef Block<1, 0x1c, 0x04> IfBlock;
+
+    struct Timings
+    {
+        uint16_t htotal;      // VDS_HSYNC_RST
+        uint16_t vtotal;      // VDS_VSYNC_RST less the frame sync correction
+        uint16_t sourceLines; // wrap point for IF_VB_SP, 0 = IF side not read
+        uint16_t hscale;
+        uint16_t vscale;
+        bool hscaleBypass;
+        bool vscaleBypass;
+        uint16_t hbSt;
+        uint16_t hbSp;
+        uint16_t vbSt;
+        uint16_t vbSp;
+        uint16_t disHbSt;
+        uint16_t disHbSp;
+        uint16_t disVbSt;
+        uint16_t disVbSp;
+        uint16_t ifVbSt;
+        uint16_t ifVbSp;
+    };
+
+    struct Target
+    {
+        int16_t hscale;   // GEOMETRY_HSCALE_MIN .. 1023, 1023 = bypass
+        int16_t vscale;   // GEOMETRY_VSCALE_MIN .. 1023
+        int16_t hCenter;  // picture center, output clocks, wraps at htotal
+        int16_t vStart;   // VDS_VB_SP, wraps at vtotal
+        int16_t srcStart; // IF_VB_SP, wraps at the source line count
+        int16_t left;     // visible window: VDS_DIS_HB_SP
+        int16_t right;    // VDS_DIS_HB_ST
+        int16_t top;      // VDS_DIS_VB_SP
+        int16_t bottom;   // VDS_DIS_VB_ST
+    };
+
+    static inline int16_t wrap(int32_t value, int32_t low, int32_t period)
+    {
+        if (period <= 0) {
+            return value;
+        }
+        int32_t v = (value - low) % period;
+        return low + (v < 0 ? v + period : v);
+    }
+
+    // fetch window width, HB_SP up to HB_ST, possibly across the line end
+    static inline uint16_t fetchWidth(const Timings &t)
+    {
+        return t.hbSt >= t.hbSp ? t.hbSt - t.hbSp : t.hbSt + t.htotal - t.hbSp;
+    }
+
+    // bypass is 1:1, a scale of 1024
+    static inline uint16_t effectiveScale(uint16_t scale, bool bypass)
+    {
+        return bypass ? 1024 : scale;
+    }
+
+    // the horizontal picture as capture() or the last apply() left it
+    struct Reference
+    {
+        uint32_t width;  // fetch window width at 1:1, times 1024
+        int16_t hCenter; // the center asked for, before the parity adjustment
+        uint16_t hbSt;   // the registers that go with it
+        uint16_t hbSp;
+        uint16_t hscale;
+        bool hscaleBypass;
+        bool valid;
+    };
+
+    Reference reference;
+
+    // false once something else moved the window or the scale (presets, best htotal,
+    // register writes from the web UI), the registers are the reference again then
+    static bool isReference(const Timings &t)
+    {
+        return reference.valid && t.hbSt == reference.hbSt && t.hbSp == reference.hbSp &&
+               t.hscale == reference.hscale && t.hscaleBypass == reference.hscaleBypass;
+    }
+
+    static uint32_t referenceWidth(const Timings &t)
+    {
+        if (isReference(t)) {
+            return reference.width;
+        }
+        return (uint32_t)fetchWidth(t) * effectiveScale(t.hscale, t.hscaleBypass);
+    }
+
+    Target targetOf(const Timings &t)
+    {
+        Target target;
+        target.hscale = t.hscale;
+        target.vscale = t.vscale;
+        target.hCenter = isReference(t) ? reference.hCenter : wrap(t.hbSp + fetchWidth(t) / 2, 0, t.htotal);
+        target.vStart = t.vbSp;
+        target.srcStart = t.ifVbSp;
+        target.left = t.disHbSp;
+        target.right = t.disHbSt;
+        target.top = t.disVbSp;
+        target.bottom = t.disVbSt;
+        return target;
+    }
+
+    // the registers for target, starting from the current state now. Only what the
+    // target changes is recomputed, a preset's own blanking stays as it is otherwise.
+    Timings solve(const Timings &now, const Target &target)
+    {
+        Timings t = now;
+        if (now.htotal <= 2 * GEOMETRY_MIN_HBLANK || now.vtotal <= 2) {
+            return t; // no valid timing, nothing to solve against
+        }
+        const Target from = targetOf(now);
+
+        t.hscale = constrain(target.hscale, GEOMETRY_HSCALE_MIN, GEOMETRY_SCALE_MAX);
+        t.hscaleBypass = t.hscale == GEOMETRY_SCALE_MAX;
+        t.vscale = constrain(target.vscale, GEOMETRY_VSCALE_MIN, GEOMETRY_SCALE_MAX);
+        if (t.vscale != now.vscale) {
+            t.vscaleBypass = false; // bypass would also disable the line filter, never set here
+        }
+
+        // horizontal: picture width from the scale ratio, centered on hCenter
+        if (t.hscale != now.hscale || target.hCenter != from.hCenter) {
+            uint16_t scale = effectiveScale(t.hscale, t.hscaleBypass);
+            uint32_t width = (referenceWidth(now) + scale / 2) / scale;
+            width = constrain(width, (uint32_t)GEOMETRY_MIN_HBLANK, (uint32_t)(now.htotal - GEOMETRY_MIN_HBLANK));
+            int32_t hbSp = target.hCenter - (int32_t)(width / 2);
+            int32_t hbSt = hbSp + width;
+            if (t.hscale < 512) {
+                // avoids a glitch when scaling up: HB_ST even, HB_SP of the same parity as htotal
+                hbSt += hbSt & 1;
+                if ((hbSp & 1) != (now.htotal & 1)) {
+                    hbSp--;
+                }
+            }
+            t.hbSp = wrap(hbSp, 0, now.htotal);
+            t.hbSt = wrap(hbSt, 0, now.htotal);
+        }
+
+        t.disHbSp = constrain(target.left, 0, now.htotal - 2);
+        t.disHbSt = constrain(target.right, t.disHbSp + 1, now.htotal - 1);
+        // the picture must not be blanked before its fetch window ends
+        if (t.hbSt > t.hbSp && t.hbSt > t.disHbSt) {
+            t.disHbSt = MIN(t.hbSt, now.htotal - 1);
+        }
+
+        // vertical: memory blanking is 2 lines ending at vStart
+        if (target.vStart != from.vStart) {
+            t.vbSp = wrap(target.vStart, 2, now.vtotal - 1);
+            t.vbSt = t.vbSp - 2;
+        }
+        t.disVbSp = constrain(target.top, 0, now.vtotal - 1);
+        t.disVbSt = constrain(target.bottom, t.disVbSp + 1, now.vtotal);
+
+        // source side: keep the IF blanking length, move its end
+        uint16_t ifBlank = now.ifVbSp >= now.ifVbSt ? now.ifVbSp - now.ifVbSt : 2;
+        if (target.srcStart != from.srcStart && now.sourceLines > ifBlank) { // IF side was read
+            t.ifVbSp = wrap(target.srcStart, ifBlank, now.sourceLines - ifBlank + 1);
+            t.ifVbSt = t.ifVbSp - ifBlank;
+        }
+        return t;
+    }
+
+    // source lines as seen by the IF, same as shiftVerticalUpIF() used
+    static uint16_t sourceLines()
+    {
+        uint8_t offset = rto->videoStandardInput == 2 ? 4 : 1;
+        uint16_t lines = GBS::VPERIOD_IF::read() - offset;
+        // the IF data is not available with RGBHV scaling
+        if ((GBS::GBS_OPTION_SCALING_RGBHV::read() == 1) && rto->videoStandardInput == 14) {
+            lines = GBS::STATUS_SYNC_PROC_VTOTAL::read();
+        }
+        return lines;
+    }
+
+    VdsBlock vds;
+    IfBlock inputFormatter;
+
+    Timings read()
+    {
+        Timings t;
+        vds.read();
+        t.htotal = vds.get<GBS::VDS_HSYNC_RST>();
+        t.vtotal = vds.get<GBS::VDS_VSYNC_RST>() - FrameSync::getSyncLastCorrection();
+        t.sourceLines = 0;
+        t.hscale = vds.get<GBS::VDS_HSCALE>();
+        t.vscale = vds.get<GBS::VDS_VSCALE>();
+        t.hscaleBypass = vds.get<GBS::VDS_HSCALE_BYPS>();
+        t.vscaleBypass = vds.get<GBS::VDS_VSCALE_BYPS>();
+        t.hbSt = vds.get<GBS::VDS_HB_ST>();
+        t.hbSp = vds.get<GBS::VDS_HB_SP>();
+        t.vbSt = vds.get<GBS::VDS_VB_ST>();
+        t.vbSp = vds.get<GBS::VDS_VB_SP>();
+        t.disHbSt = vds.get<GBS::VDS_DIS_HB_ST>();
+        t.disHbSp = vds.get<GBS::VDS_DIS_HB_SP>();
+        t.disVbSt = vds.get<GBS::VDS_DIS_VB_ST>();
+        t.disVbSp = vds.get<GBS::VDS_DIS_VB_SP>();
+        t.ifVbSt = 0;
+        t.ifVbSp = 0;
+        return t;
+    }
+
+    // adds the IF side to t, only needed to move the source start
+    void readSource(Timings &t)
+    {
+        inputFormatter.read();
+        t.sourceLines = sourceLines();
+        t.ifVbSt = inputFormatter.get<GBS::IF_VB_ST>();
+        t.ifVbSp = inputFormatter.get<GBS::IF_VB_SP>();
+    }
+
+    // solves target against now (from read()) and writes what changed, returns the result
+    Timings apply(const Timings &now, const Target &target)
+    {
+        Timings t = solve(now, target);
+        if (now.htotal > 2 * GEOMETRY_MIN_HBLANK) {
+            reference.width = referenceWidth(now);
+            reference.hCenter = wrap(target.hCenter, 0, now.htotal);
+            reference.hbSt = t.hbSt;
+            reference.hbSp = t.hbSp;
+            reference.hscale = t.hscale;
+            reference.hscaleBypass = t.hscaleBypass;
+            reference.valid = true;
+        }
+        vds.set<GBS::VDS_HSCALE>(t.hscale);
+        vds.set<GBS::VDS_VSCALE>(t.vscale);
+        vds.set<GBS::VDS_HSCALE_BYPS>(t.hscaleBypass);
+        vds.set<GBS::VDS_VSCALE_BYPS>(t.vscaleBypass);
+        vds.set<GBS::VDS_HB_ST>(t.hbSt);
+        vds.set<GBS::VDS_HB_SP>(t.hbSp);
+        vds.set<GBS::VDS_VB_ST>(t.vbSt);
+        vds.set<GBS::VDS_VB_SP>(t.vbSp);
+        vds.set<GBS::VDS_DIS_HB_ST>(t.disHbSt);
+        vds.set<GBS::VDS_DIS_HB_SP>(t.disHbSp);
+        vds.set<GBS::VDS_DIS_VB_ST>(t.disVbSt);
+        vds.set<GBS::VDS_DIS_VB_SP>(t.disVbSp);
+        vds.flush();
+        if (now.sourceLines) {
+            inputFormatter.set<GBS::IF_VB_ST>(t.ifVbSt);
+            inputFormatter.set<GBS::IF_VB_SP>(t.ifVbSp);
+            inputFormatter.flush();
+        }
+        return t;
+    }
+
+    // takes the current window as the reference, after a preset load
+    void capture()
+    {
+        reference.valid = false;
+        Timings t = read();
+        reference.width = referenceWidth(t);
+        reference.hCenter = targetOf(t).hCenter;
+        reference.hbSt = t.hbSt;
+        reference.hbSp = t.hbSp;
+        reference.hscale = t.hscale;
+        reference.hscaleBypass = t.hscaleBypass;
+        reference.valid = true;
+    }
+
+    // relative changes posted by /geometry, one request at a time. The handler limits
+    // them to +-GEOMETRY_SCALE_MAX / +-GEOMETRY_POS_MAX, so run()'s sums can't wrap.
+    struct Request
+    {
+        int16_t hscale;
+        int16_t vscale;
+        int16_t hCenter;
+        int16_t vStart;
+        int16_t srcStart;
+    };
+
+    Request pending;
+    volatile bool posted = false; // set by the network stack, cleared by run()
+
+    // network stack side, false while the previous request is not applied yet
+    bool post(const Request &r)
+    {
+        if (posted) {
+            return false;
+        }
+        pending = r;
+        __asm__ __volatile__("" ::: "memory");
+        posted = true;
+        return true;
+    }
+
+    // called once per loop() pass
+    void run()
+    {
+        if (!posted) {
+            return;
+        }
+        Request r = pending;
+        __asm__ __volatile__("" ::: "memory");
+        posted = false;
+        if (rto->presetID >= 0x20 || rto->outModeHdBypass) {
+            return; // no VDS scaling in bypass modes
+        }
+        Timings now = read();
+        if (r.srcStart) {
+            readSource(now);
+        }
+        Target target = targetOf(now);
+        target.hscale += r.hscale;
+        target.vscale += r.vscale;
+        target.hCenter += r.hCenter;
+        target.vStart += r.vStart;
+        target.srcStart += r.srcStart;
+        apply(now, target);
+    }
+} // namespace Geometry
+#endif
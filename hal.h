@@ -0,0 +1,29 @@
+#ifndef HAL_H_
+#define HAL_H_
+
+// Board access for the portable core (core.h) that the Arduino API doesn't cover.
+//
+// Everything else the core needs from the board goes through the Arduino API:
+// millis(), micros(), delay() and yield() for time, Wire for the GBS and the clock
+// generator, SPIFFS for stored presets and SerialM (a Stream) for logging. On the
+// ESP8266 that is the Arduino core. The host build (GBS_NATIVE, see native/)
+// provides the same API from native/hal, with a virtual clock, an emulated TV5725
+// on the bus and SPIFFS in a host directory.
+
+namespace Hal
+{
+#if defined(GBS_NATIVE)
+    uint32_t cycles(); // virtual clock, native/hal
+#else
+    // CPU cycle counter (ccount), wraps after 2^32 cycles (26s at 160MHz)
+    // always inlined, MeasurePeriod reads it in ISRs
+    static inline __attribute__((always_inline)) uint32_t cycles()
+    {
+        uint32_t c;
+        __asm__ __volatile__("rsr %0,ccount"
+                             : "=a"(c));
+        return c;
+    }
+#endif
+} // namespace Hal
+#endif
@@ -0,0 +1,178 @@
+#ifndef I2CTRACE_H_
+#define I2CTRACE_H_
+
+// Capture of the GBS register traffic, for replaying field problems offline
+// (tools/i2creplay).
+//
+// tw.h calls the hooks below after every raw read and write. While capturing, each
+// transaction is appended to a RAM ring as a compact record and the oldest records
+// make room for new ones. /trace/download stops the capture and sends the ring,
+// oldest record first, behind an I2CTraceHeader.
+//
+// Record: kind (I2CTRACE_WRITE | segment), register, size, microseconds since the
+// previous record as a base 128 varint (low bits first, bit 7 = more), then size
+// data bytes. The segment is the one selected when the transaction ran; writes to
+// the segment register are followed here also while not capturing, so the first
+// records of a capture have it too.
+
+#define I2CTRACE_BYTES 6144 // ring size, a few seconds of everything or ~10s of status reads
+#define I2CTRACE_MAGIC 'I'
+#define I2CTRACE_VERSION 1
+#define I2CTRACE_WRITE 0x80
+#define I2CTRACE_SEGMENT_MASK 0x07
+#define I2CTRACE_SEGMENT_UNKNOWN 7
+#define I2CTRACE_SEGMENT_REGISTER 0xf0
+
+enum I2CTraceFilter : uint8_t {
+    I2CTraceAll = 0,    // every read and write
+    I2CTraceStatus = 1, // reads in segment 0 only (status, test bus), lasts much longer
+};
+
+typedef struct __attribute__((packed))
+{
+    uint8_t magic;    // I2CTRACE_MAGIC
+    uint8_t version;  // I2CTRACE_VERSION
+    uint8_t address;  // I2C address of the GBS
+    uint8_t filter;   // I2CTraceFilter
+    uint32_t startUs; // micros() at the first record
+    uint32_t bytes;   // record bytes that follow
+    uint32_t records;
+    uint32_t dropped; // oldest records overwritten by newer ones
+} I2CTraceHeader;
+
+// tw.h hooks
+#define TW_TRACE_READ(addr, reg, data, size) I2CTrace::record(addr, reg, data, size, false)
+#define TW_TRACE_WRITE(addr, reg, data, size) I2CTrace::record(addr, reg, data, size, true)
+
+namespace I2CTrace
+{
+    uint8_t ring[I2CTRACE_BYTES];
+    uint16_t tail = 0; // first byte of the oldest record
+    uint16_t used = 0;
+    uint32_t records = 0;
+    uint32_t dropped = 0;
+    uint32_t firstUs = 0; // time of the oldest record
+    uint32_t lastUs = 0;  // time of the newest record
+    uint8_t address = 0;
+    uint8_t segment = I2CTRACE_SEGMENT_UNKNOWN;
+    I2CTraceFilter filter = I2CTraceAll;
+    bool capturing = false;
+
+    static inline uint8_t peek(uint16_t offset)
+    {
+        return ring[(tail + offset) % I2CTRACE_BYTES];
+    }
+
+    // varint at offset from the tail, n gets its length
+    static uint32_t peekVarint(uint16_t offset, uint8_t &n)
+    {
+        uint32_t value = 0;
+        n = 0;
+        uint8_t b;
+        do {
+            b = peek(offset + n);
+            value |= (uint32_t)(b & 0x7f) << (7 * n);
+            n++;
+        } while ((b & 0x80) && n < 5);
+        return value;
+    }
+
+    static void dropOldest()
+    {
+        uint8_t n;
+        peekVarint(3, n);
+        uint16_t length = 3 + n + peek(2);
+        tail = (tail + length) % I2CTRACE_BYTES;
+        used -= length;
+        records--;
+        dropped++;
+        if (used > 0) {
+            firstUs += peekVarint(3, n); // the next record counted from the dropped one
+        }
+    }
+
+    void clear()
+    {
+        tail = used = 0;
+        records = dropped = 0;
+    }
+
+    void start(I2CTraceFilter newFilter)
+    {
+        clear();
+        filter = newFilter;
+        capturing = true;
+    }
+
+    void stop()
+    {
+        capturing = false;
+    }
+
+    void record(uint8_t addr, uint8_t reg, const uint8_t *data, uint8_t size, bool write)
+    {
+        if (write && reg == I2CTRACE_SEGMENT_REGISTER && size == 1) {
+            segment = data[0] < I2CTRACE_SEGMENT_UNKNOWN ? data[0] : I2CTRACE_SEGMENT_UNKNOWN;
+        }
+        if (!capturing || (filter == I2CTraceStatus && (write || segment != 0))) {
+            return;
+        }
+        uint32_t now = micros();
+        uint16_t length = 3 + 5 + size; // worst case varint
+        if (length > I2CTRACE_BYTES) {
+            return;
+        }
+        while (I2CTRACE_BYTES - used < length) {
+            dropOldest();
+        }
+        if (used == 0) {
+            firstUs = lastUs = now;
+        }
+
+        uint16_t head = (tail + used) % I2CTRACE_BYTES;
+        uint16_t start = head;
+        ring[head] = (write ? I2CTRACE_WRITE : 0) | segment;
+        ring[(head + 1) % I2CTRACE_BYTES] = reg;
+        ring[(head + 2) % I2CTRACE_BYTES] = size;
+        head = (head + 3) % I2CTRACE_BYTES;
+        uint32_t delta = now - lastUs;
+        do {
+            ring[head] = (delta & 0x7f) | (delta > 0x7f ? 0x80 : 0);
+            head = (head + 1) % I2CTRACE_BYTES;
+            delta >>= 7;
+        } while (delta);
+        for (uint8_t i = 0; i < size; i++) {
+            ring[head] = data[i];
+            head = (head + 1) % I2CTRACE_BYTES;
+        }
+        used += (head + I2CTRACE_BYTES - start) % I2CTRACE_BYTES;
+        records++;
+        lastUs = now;
+        address = addr;
+    }
+
+    size_t snapshotSize()
+    {
+        return sizeof(I2CTraceHeader) + used;
+    }
+
+    // header and the records, oldest first, into out (snapshotSize() bytes)
+    size_t snapshot(uint8_t *out)
+    {
+        I2CTraceHeader h;
+        h.magic = I2CTRACE_MAGIC;
+        h.version = I2CTRACE_VERSION;
+        h.address = address;
+        h.filter = filter;
+        h.startUs = firstUs;
+        h.bytes = used;
+        h.records = records;
+        h.dropped = dropped;
+        memcpy(out, &h, sizeof(h));
+        uint16_t first = (used < I2CTRACE_BYTES - tail) ? used : I2CTRACE_BYTES - tail;
+        memcpy(out + sizeof(h), ring + tail, first);
+        memcpy(out + sizeof(h) + first, ring, used - first);
+        return snapshotSize();
+    }
+} // namespace I2CTrace
+#endif
@@ -0,0 +1,107 @@
+#ifndef JSONSTREAM_H_
+#define JSONSTREAM_H_
+
+#include <ESPAsyncWebServer.h>
+#include <memory>
+
+// Chunked JSON array responses for the AsyncWebServer handlers.
+//
+// Building a listing in one String (+= per entry) needs one heap block the size of
+// the whole answer, plus the copies made while it grows. Here the web server pulls
+// the answer chunk by chunk, and each chunk is filled from a generator that writes
+// one already encoded array element at a time into a small fixed buffer.
+//
+//   request->send(beginJsonArrayResponse(request, [dir]() mutable ... ));
+
+#define JSONSTREAM_ITEM_SIZE 96 // longest single element, including quotes
+
+// writes the next element into buf (at most maxLen bytes) and returns its length,
+// 0 when there are no more elements
+typedef std::function<size_t(char *buf, size_t maxLen)> JsonItemGenerator;
+
+namespace JsonStream
+{
+    struct State
+    {
+        JsonItemGenerator next;
+        char item[JSONSTREAM_ITEM_SIZE + 1]; // item[0] holds the separator
+        size_t itemLen = 0;
+        size_t itemPos = 0;
+        uint8_t stage = 0; // 0 = '[' pending, 1 = elements, 2 = ']' queued, 3 = done
+        bool first = true;
+
+        size_t fill(uint8_t *out, size_t maxLen)
+        {
+            size_t n = 0;
+            while (n < maxLen) {
+                if (itemPos < itemLen) {
+                    size_t chunk = itemLen - itemPos;
+                    if (chunk > maxLen - n) {
+                        chunk = maxLen - n;
+                    }
+                    memcpy(out + n, item + itemPos, chunk);
+                    itemPos += chunk;
+                    n += chunk;
+                    continue;
+                }
+
+                if (stage == 0) {
+                    item[0] = '[';
+                    itemPos = 0;
+                    itemLen = 1;
+                    stage = 1;
+                } else if (stage == 1) {
+                    size_t len = next(item + 1, JSONSTREAM_ITEM_SIZE);
+                    if (len == 0) {
+                        item[0] = ']';
+                        itemPos = 0;
+                        itemLen = 1;
+                        stage = 2;
+                    } else {
+                        item[0] = ',';
+                        itemPos = first ? 1 : 0;
+                        itemLen = len + 1;
+                        first = false;
+                    }
+                } else {
+                    stage = 3;
+                    break;
+                }
+            }
+            return n;
+        }
+    };
+
+    // copies s as a JSON string (quoted, escaped), returns 0 if it does not fit
+    static size_t quote(char *buf, size_t maxLen, const char *s)
+    {
+        size_t n = 0;
+        if (maxLen < 2) {
+            return 0;
+        }
+        buf[n++] = '"';
+        for (; *s; s++) {
+            bool escape = (*s == '"' || *s == '\\');
+            if (n + (escape ? 2 : 1) + 1 > maxLen) {
+                return 0;
+            }
+            if (escape) {
+                buf[n++] = '\\';
+            }
+            buf[n++] = *s;
+        }
+        buf[n++] = '"';
+        return n;
+    }
+} // namespace JsonStream
+
+AsyncWebServerResponse *beginJsonArrayResponse(AsyncWebServerRequest *request, JsonItemGenerator next)
+{
+    std::shared_ptr<JsonStream::State> state(new JsonStream::State());
+    state->next = next;
+    return request->beginChunkedResponse("application/json", [state](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        (void)index;
+        return state->fill(buffer, maxLen);
+    });
+}
+#endif
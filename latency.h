@@ -0,0 +1,214 @@
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+// Latency histograms per named code section.
+//
+// A section is timed with the CPU cycle counter (ccount, as in MeasurePeriod) and
+// each run lands in a log2 bucket: bucket 0 is <= 1us, bucket i is (2^(i-1), 2^i] us,
+// the last one takes everything longer (/metrics leaves out the empty buckets above
+// the highest one in use). Recording is a few dozen cycles, so it can stay on in the
+// field. ccount wraps after 2^32 cycles (26s at 160MHz), sections longer than that
+// are not measured correctly.
+//
+//   void applyPresets(uint8_t result)
+//   {
+//       LATENCY_SECTION("applyPresets");
+//
+// Scheduler tasks get a section of their own name. The histograms are exported
+// as text by /metrics (Prometheus format) and summarized by serial command 'O'.
+
+#define LATENCY_MAX_SECTIONS 16
+#define LATENCY_BUCKETS 24  // the last one is open ended, > 2^22us = 4.2s
+#define LATENCY_NONE 0xff
+#define LATENCY_LINE_SIZE 96
+
+#define LATENCY_SECTION(name)                                     \
+    static const uint8_t latencySection_ = Latency::define(name); \
+    LatencyScope latencyScope_(latencySection_)
+
+namespace Latency
+{
+    struct Histogram
+    {
+        const char *name;
+        uint32_t buckets[LATENCY_BUCKETS];
+        uint32_t count;
+        uint64_t sumUs;
+        uint32_t maxUs;
+    };
+
+    Histogram sections[LATENCY_MAX_SECTIONS];
+    uint8_t sectionCount = 0;
+
+    static inline uint32_t cycles()
+    {
+        return Hal::cycles();
+    }
+
+    // returns the id for name, the same one if it is already defined
+    uint8_t define(const char *name)
+    {
+        for (uint8_t i = 0; i < sectionCount; i++) {
+            if (strcmp(sections[i].name, name) == 0) {
+                return i;
+            }
+        }
+        if (sectionCount >= LATENCY_MAX_SECTIONS) {
+            return LATENCY_NONE;
+        }
+        memset(&sections[sectionCount], 0, sizeof(Histogram));
+        sections[sectionCount].name = name;
+        return sectionCount++;
+    }
+
+    static uint8_t bucketOf(uint32_t us)
+    {
+        if (us <= 1) {
+            return 0;
+        }
+        uint8_t b = 32 - __builtin_clz(us - 1);
+        return b < LATENCY_BUCKETS ? b : LATENCY_BUCKETS - 1;
+    }
+
+    void record(uint8_t id, uint32_t elapsedCycles)
+    {
+        if (id >= sectionCount) {
+            return;
+        }
+        Histogram &h = sections[id];
+        uint32_t us = elapsedCycles / ESP.getCpuFreqMHz();
+        h.buckets[bucketOf(us)]++;
+        h.count++;
+        h.sumUs += us;
+        if (us > h.maxUs) {
+            h.maxUs = us;
+        }
+    }
+
+    // upper bound (us) of the bucket that holds the given fraction of all runs
+    static uint32_t percentile(const Histogram &h, uint8_t percent)
+    {
+        uint32_t wanted = ((uint64_t)h.count * percent + 99) / 100;
+        uint32_t seen = 0;
+        for (uint8_t b = 0; b < LATENCY_BUCKETS; b++) {
+            seen += h.buckets[b];
+            if (seen >= wanted) {
+                return b == LATENCY_BUCKETS - 1 ? h.maxUs : (1ul << b);
+            }
+        }
+        return h.maxUs;
+    }
+
+    // serial command 'O', percentiles are bucket bounds
+    void report(Print &out)
+    {
+        out.println(F("section          count      p50(us)  p90(us)  p99(us)  max(us)"));
+        for (uint8_t i = 0; i < sectionCount; i++) {
+            const Histogram &h = sections[i];
+            out.printf("%-16s %-10u %-8u %-8u %-8u %u\n", h.name, h.count,
+                       percentile(h, 50), percentile(h, 90), percentile(h, 99), h.maxUs);
+        }
+    }
+
+    // prints v without needing 64 bit printf support
+    static int printU64(char *buf, size_t maxLen, uint64_t v)
+    {
+        uint32_t high = v / 1000000000ull;
+        uint32_t low = v % 1000000000ull;
+        return high ? snprintf(buf, maxLen, "%u%09u", high, low) : snprintf(buf, maxLen, "%u", low);
+    }
+
+    // /metrics: pulled line by line by the chunked response
+    struct MetricsStream
+    {
+        uint8_t section = 0;
+        uint8_t row = 0;
+        bool started = false;
+        char line[LATENCY_LINE_SIZE];
+        size_t lineLen = 0;
+        size_t linePos = 0;
+
+        // writes the next line, false when there are no more
+        bool nextLine()
+        {
+            int n = 0;
+            if (!started) {
+                started = true;
+                n = snprintf(line, sizeof(line), "# TYPE gbs_latency_us histogram\n");
+            } else if (section >= sectionCount) {
+                return false;
+            } else {
+                const Histogram &h = sections[section];
+                uint32_t cumulative = 0;
+                int8_t top = -1; // highest bucket in use, the rest is all equal to count
+                for (uint8_t b = 0; b < LATENCY_BUCKETS - 1; b++) {
+                    if (h.buckets[b]) {
+                        top = b;
+                    }
+                }
+                if (row <= top) {
+                    for (uint8_t b = 0; b <= row; b++) {
+                        cumulative += h.buckets[b];
+                    }
+                    n = snprintf(line, sizeof(line), "gbs_latency_us_bucket{section=\"%s\",le=\"%lu\"} %u\n",
+                                 h.name, 1ul << row, cumulative);
+                } else if (row == top + 1) {
+                    n = snprintf(line, sizeof(line), "gbs_latency_us_bucket{section=\"%s\",le=\"+Inf\"} %u\n",
+                                 h.name, h.count);
+                } else if (row == top + 2) {
+                    n = snprintf(line, sizeof(line), "gbs_latency_us_sum{section=\"%s\"} ", h.name);
+                    n += printU64(line + n, sizeof(line) - n - 1, h.sumUs);
+                    line[n++] = '\n';
+                } else if (row == top + 3) {
+                    n = snprintf(line, sizeof(line), "gbs_latency_us_count{section=\"%s\"} %u\n",
+                                 h.name, h.count);
+                } else {
+                    n = snprintf(line, sizeof(line), "gbs_latency_max_us{section=\"%s\"} %u\n",
+                                 h.name, h.maxUs);
+                    section++;
+                    row = 0;
+                    lineLen = n;
+                    linePos = 0;
+                    return true;
+                }
+                row++;
+            }
+            lineLen = (n > 0 && (size_t)n < sizeof(line)) ? n : 0;
+            linePos = 0;
+            return true;
+        }
+
+        size_t fill(uint8_t *out, size_t maxLen)
+        {
+            size_t n = 0;
+            while (n < maxLen) {
+                if (linePos == lineLen && !nextLine()) {
+                    break;
+                }
+                size_t chunk = lineLen - linePos;
+                if (chunk > maxLen - n) {
+                    chunk = maxLen - n;
+                }
+                memcpy(out + n, line + linePos, chunk);
+                linePos += chunk;
+                n += chunk;
+            }
+            return n;
+        }
+    };
+} // namespace Latency
+
+class LatencyScope
+{
+private:
+    uint8_t id;
+    uint32_t start;
+
+public:
+    LatencyScope(uint8_t id) : id(id), start(Latency::cycles()) {}
+    ~LatencyScope()
+    {
+        Latency::record(id, Latency::cycles() - start);
+    }
+};
+#endif
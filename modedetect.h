@@ -0,0 +1,186 @@
+#ifndef MODEDETECT_H_
+#define MODEDETECT_H_
+
+// Video mode detection from the status registers: getVideoMode() and the sync
+// stability check the sync watcher relies on. Only the register layer, the status
+// snapshot and rto are used here, so tools/i2creplay can run the same code against
+// a captured trace (i2ctrace.h).
+
+void resetInterruptNoHsyncBadBit()
+{
+    GBS::INT_CONTROL_RST_NOHSYNC::write(1);
+    GBS::INT_CONTROL_RST_NOHSYNC::write(0);
+    StatusSnapshot::invalidate();
+}
+
+boolean getStatus16SpHsStable()
+{
+    if (rto->videoStandardInput == 15) { // check RGBHV first
+        if (StatusSnapshot::get<GBS::STATUS_INT_INP_NO_SYNC>() == 0) {
+            return true;
+        } else {
+            resetInterruptNoHsyncBadBit();
+            return false;
+        }
+    }
+
+    // STAT_16 bit 1 is the "hsync active" flag, which appears to be a reliable indicator
+    // checking the flag replaces checking the debug bus pulse length manually
+    uint8_t status16 = StatusSnapshot::get<GBS::STATUS_16>();
+    if ((status16 & 0x02) == 0x02) {
+        if (rto->videoStandardInput == 1 || rto->videoStandardInput == 2) {
+            if ((status16 & 0x01) != 0x01) { // pal / ntsc should be sync active low
+                return true;
+            }
+        } else {
+            return true; // not pal / ntsc
+        }
+    }
+
+    return false;
+}
+
+uint8_t getVideoMode()
+{
+    uint8_t detectedMode = 0;
+
+    if (rto->videoStandardInput >= 14) { // check RGBHV first // not mode 13 here, else mode 13 can't reliably exit
+        detectedMode = StatusSnapshot::get<GBS::STATUS_16>();
+        if ((detectedMode & 0x0a) > 0) {    // bit 1 or 3 active?
+            return rto->videoStandardInput; // still RGBHV bypass, 14 or 15
+        } else {
+            return 0;
+        }
+    }
+
+    detectedMode = StatusSnapshot::get<GBS::STATUS_00>();
+
+    // note: if stat0 == 0x07, it's supposedly stable. if we then can't find a mode, it must be an MD problem
+    if ((detectedMode & 0x07) == 0x07) {
+        if ((detectedMode & 0x80) == 0x80) { // bit 7: SD flag (480i, 480P, 576i, 576P)
+            if ((detectedMode & 0x08) == 0x08)
+                return 1; // ntsc interlace
+            if ((detectedMode & 0x20) == 0x20)
+                return 2; // pal interlace
+            if ((detectedMode & 0x10) == 0x10)
+                return 3; // edtv 60 progressive
+            if ((detectedMode & 0x40) == 0x40)
+                return 4; // edtv 50 progressive
+        }
+
+        detectedMode = StatusSnapshot::get<GBS::STATUS_03>();
+        if ((detectedMode & 0x10) == 0x10) {
+            return 5;
+        } // hdtv 720p
+
+        if (rto->videoStandardInput == 4) {
+            detectedMode = StatusSnapshot::get<GBS::STATUS_04>();
+            if ((detectedMode & 0xFF) == 0x80) {
+                return 4; // still edtv 50 progressive
+            }
+        }
+    }
+
+    detectedMode = StatusSnapshot::get<GBS::STATUS_04>();
+    if ((detectedMode & 0x20) == 0x20) { // hd mode on
+        if ((detectedMode & 0x61) == 0x61) {
+            // hdtv 1080i // 576p mode tends to get misdetected as this, even with all the checks
+            // real 1080i (PS2): h:199 v:1124
+            // misdetected 576p (PS2): h:215 v:1249
+            if (StatusSnapshot::get<GBS::VPERIOD_IF>() < 1160) {
+                return 6;
+            }
+        }
+        if ((detectedMode & 0x10) == 0x10) {
+            if ((detectedMode & 0x04) == 0x04) { // normally HD2376_1250P (PAL FHD?), but using this for 24k
+                return 8;
+            }
+            return 7; // hdtv 1080p
+        }
+    }
+
+    // graphic modes, mostly used for ps2 doing rgb over yuv with sog
+    if ((StatusSnapshot::get<GBS::STATUS_05>() & 0x0c) == 0x00) // 2: Horizontal unstable AND 3: Vertical unstable are 0?
+    {
+        if (StatusSnapshot::get<GBS::STATUS_00>() == 0x07) {            // the 3 stat0 stable indicators on, none of the SD indicators on
+            if ((StatusSnapshot::get<GBS::STATUS_03>() & 0x02) == 0x02) // Graphic mode bit on (any of VGA/SVGA/XGA/SXGA at all detected Hz)
+            {
+                if (rto->inputIsYpBpR)
+                    return 13;
+                else
+                    return 15; // switch to RGBS/HV handling
+            } else {
+                // this mode looks like it wants to be graphic mode, but the horizontal counter target in MD is very strict
+                static uint8_t XGA_60HZ = GBS::MD_XGA_60HZ_CNTRL::read();
+                static uint8_t XGA_70HZ = GBS::MD_XGA_70HZ_CNTRL::read();
+                static uint8_t XGA_75HZ = GBS::MD_XGA_75HZ_CNTRL::read();
+                static uint8_t XGA_85HZ = GBS::MD_XGA_85HZ_CNTRL::read();
+
+                static uint8_t SXGA_60HZ = GBS::MD_SXGA_60HZ_CNTRL::read();
+                static uint8_t SXGA_75HZ = GBS::MD_SXGA_75HZ_CNTRL::read();
+                static uint8_t SXGA_85HZ = GBS::MD_SXGA_85HZ_CNTRL::read();
+
+                static uint8_t SVGA_60HZ = GBS::MD_SVGA_60HZ_CNTRL::read();
+                static uint8_t SVGA_75HZ = GBS::MD_SVGA_75HZ_CNTRL::read();
+                static uint8_t SVGA_85HZ = GBS::MD_SVGA_85HZ_CNTRL::read();
+
+                static uint8_t VGA_75HZ = GBS::MD_VGA_75HZ_CNTRL::read();
+                static uint8_t VGA_85HZ = GBS::MD_VGA_85HZ_CNTRL::read();
+
+                short hSkew = random(-2, 2); // skew the target a little
+                //Serial.println(XGA_60HZ + hSkew, HEX);
+                GBS::MD_XGA_60HZ_CNTRL::write(XGA_60HZ + hSkew);
+                GBS::MD_XGA_70HZ_CNTRL::write(XGA_70HZ + hSkew);
+                GBS::MD_XGA_75HZ_CNTRL::write(XGA_75HZ + hSkew);
+                GBS::MD_XGA_85HZ_CNTRL::write(XGA_85HZ + hSkew);
+                GBS::MD_SXGA_60HZ_CNTRL::write(SXGA_60HZ + hSkew);
+                GBS::MD_SXGA_75HZ_CNTRL::write(SXGA_75HZ + hSkew);
+                GBS::MD_SXGA_85HZ_CNTRL::write(SXGA_85HZ + hSkew);
+                GBS::MD_SVGA_60HZ_CNTRL::write(SVGA_60HZ + hSkew);
+                GBS::MD_SVGA_75HZ_CNTRL::write(SVGA_75HZ + hSkew);
+                GBS::MD_SVGA_85HZ_CNTRL::write(SVGA_85HZ + hSkew);
+                GBS::MD_VGA_75HZ_CNTRL::write(VGA_75HZ + hSkew);
+                GBS::MD_VGA_85HZ_CNTRL::write(VGA_85HZ + hSkew);
+            }
+        }
+    }
+
+    detectedMode = StatusSnapshot::get<GBS::STATUS_00>();
+    if ((detectedMode & 0x2F) == 0x07) { // 0_00 H+V stable, not NTSCI, not PALI
+        detectedMode = StatusSnapshot::get<GBS::STATUS_16>();
+        if ((detectedMode & 0x02) == 0x02) { // SP H active
+            // stability check below polls the chip directly, the snapshot would hide changes
+            uint16_t lineCount = StatusSnapshot::get<GBS::STATUS_SYNC_PROC_VTOTAL>();
+            for (uint8_t i = 0; i < 2; i++) {
+                delay(2);
+                if (GBS::STATUS_SYNC_PROC_VTOTAL::read() < (lineCount - 1) ||
+                    GBS::STATUS_SYNC_PROC_VTOTAL::read() > (lineCount + 1)) {
+                    lineCount = 0;
+                    rto->notRecognizedCounter = 0;
+                    break;
+                }
+                detectedMode = GBS::STATUS_00::read();
+                if ((detectedMode & 0x2F) != 0x07) {
+                    lineCount = 0;
+                    rto->notRecognizedCounter = 0;
+                    break;
+                }
+            }
+            if (lineCount != 0 && rto->notRecognizedCounter < 255) {
+                rto->notRecognizedCounter++;
+            }
+        } else {
+            rto->notRecognizedCounter = 0;
+        }
+    } else {
+        rto->notRecognizedCounter = 0;
+    }
+
+    if (rto->notRecognizedCounter == 255) {
+        return 9;
+    }
+
+    return 0; // unknown mode
+}
+
+#endif
@@ -0,0 +1,50 @@
+// Host build of the firmware core against the emulated TV5725 (native/hal).
+//
+//   gbs-native [-v] [MODE [PRESET]]
+//
+// Brings the chip up as setup() does, then, with MODE given, applies the presets for
+// that input (rto->videoStandardInput, 1 NTSC 60 .. 14 RGBHV) and PRESET
+// (uopt->presetPreference, 0 by default). Prints the registers of segments 1 to 5
+// and what it cost on the bus. -v shows the firmware's serial output.
+
+#include "sketch.h"
+
+static void printStats(const char *what, uint64_t elapsedNs)
+{
+    printf("%s: %u transfers, %u bytes, %u nacks, bus %.2f ms, %u delays %.2f ms, %.2f ms total\n", what,
+           Native::stats.transfers, Native::stats.bytes, Native::stats.nacks, Native::stats.busNs / 1e6,
+           Native::stats.delays, Native::stats.delayNs / 1e6, elapsedNs / 1e6);
+}
+
+int main(int argc, char **argv)
+{
+    int arg = 1;
+    if (arg < argc && strcmp(argv[arg], "-v") == 0) {
+        Native::logging = true;
+        arg++;
+    }
+    int mode = arg < argc ? atoi(argv[arg++]) : 0;
+    int preset = arg < argc ? atoi(argv[arg++]) : 0;
+
+    nativeSetup();
+    printStats("setup", Native::nowNs);
+    if (mode > 0) {
+        Native::resetStats();
+        uint64_t start = Native::nowNs;
+        rto->videoStandardInput = mode;
+        uopt->presetPreference = (PresetPreference)preset;
+        applyPresets(mode);
+        printStats("applyPresets", Native::nowNs - start);
+    }
+
+    for (uint8_t seg = 1; seg < NATIVE_TV5725_SEGMENTS; seg++) {
+        for (uint16_t reg = 0; reg < 256; reg += 16) {
+            printf("%u_%02x:", seg, reg);
+            for (uint8_t i = 0; i < 16; i++) {
+                printf(" %02x", Native::Tv5725::regs[seg][reg + i]);
+            }
+            printf("\n");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,341 @@
+#ifndef NATIVE_ARDUINO_H_
+#define NATIVE_ARDUINO_H_
+
+// Host stand-in for the parts of the ESP8266 Arduino core the portable firmware
+// core (core.h) uses. Time is virtual (native.h): delay() and bus transfers move it
+// forward, busy waits on millis()/micros()/Hal::cycles() cost a little each call
+// so they end. Serial goes to Native::logFile while Native::logging is on.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+typedef uint8_t uint8; // ESP8266 SDK c_types.h
+
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define ICACHE_FLASH_ATTR
+#define IRAM_ATTR
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p) (*(void *const *)(p))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define snprintf_P snprintf
+#define PSTR(s) (s)
+
+class __FlashStringHelper;
+#define F(s) ((const __FlashStringHelper *)(s))
+#define FPSTR(s) ((const __FlashStringHelper *)(s))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+
+// d1_mini pins
+#define D1 5
+#define D2 4
+#define D5 14
+#define D6 12
+#define D7 13
+#define SDA 4
+#define SCL 5
+#define LED_BUILTIN 2
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define lowByte(w) ((uint8_t)((w)&0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define sq(x) ((x) * (x))
+
+using std::abs;
+
+// mixed argument types as with the core's macros
+template <class A, class B>
+inline auto min(A a, B b) -> decltype(a < b ? a : b)
+{
+    return a < b ? a : b;
+}
+template <class A, class B>
+inline auto max(A a, B b) -> decltype(a > b ? a : b)
+{
+    return a > b ? a : b;
+}
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+long random(long high);
+long random(long low, long high);
+void randomSeed(unsigned long seed);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode);
+void detachInterrupt(uint8_t pin);
+#define digitalPinToInterrupt(pin) (pin)
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+class String
+{
+private:
+    std::string s;
+
+public:
+    String(const char *text = "") : s(text ? text : "") {}
+    String(const std::string &text) : s(text) {}
+    explicit String(char c) : s(1, c) {}
+    explicit String(int value, uint8_t base = DEC);
+    explicit String(unsigned int value, uint8_t base = DEC);
+    explicit String(long value, uint8_t base = DEC);
+    explicit String(unsigned long value, uint8_t base = DEC);
+    explicit String(float value, uint8_t decimals = 2);
+
+    const char *c_str() const
+    {
+        return s.c_str();
+    }
+    unsigned int length() const
+    {
+        return s.length();
+    }
+    char &operator[](unsigned int i)
+    {
+        return s[i];
+    }
+    char operator[](unsigned int i) const
+    {
+        return s[i];
+    }
+    String &operator+=(const String &other)
+    {
+        s += other.s;
+        return *this;
+    }
+    String &operator+=(const char *other)
+    {
+        s += other;
+        return *this;
+    }
+    String &operator+=(char c)
+    {
+        s += c;
+        return *this;
+    }
+    bool operator==(const String &other) const
+    {
+        return s == other.s;
+    }
+    bool operator==(const char *other) const
+    {
+        return s == other;
+    }
+    bool operator!=(const String &other) const
+    {
+        return s != other.s;
+    }
+    long toInt() const
+    {
+        return atol(s.c_str());
+    }
+    int indexOf(char c, unsigned int from = 0) const
+    {
+        size_t i = s.find(c, from);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+    String substring(unsigned int from, unsigned int to = ~0u) const
+    {
+        return from < s.size() ? String(s.substr(from, to - from)) : String();
+    }
+    friend String operator+(const String &a, const String &b)
+    {
+        return String(a.s + b.s);
+    }
+    friend String operator+(const char *a, const String &b)
+    {
+        return String(a + b.s);
+    }
+    friend String operator+(const String &a, const char *b)
+    {
+        return String(a.s + b);
+    }
+};
+
+class Print
+{
+private:
+    size_t printNumber(unsigned long long n, uint8_t base, bool negative);
+
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--) {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+    size_t write(const char *text)
+    {
+        return write((const uint8_t *)text, strlen(text));
+    }
+    size_t write(const char *buffer, size_t size)
+    {
+        return write((const uint8_t *)buffer, size);
+    }
+
+    size_t print(const __FlashStringHelper *text)
+    {
+        return write((const char *)text);
+    }
+    size_t print(const String &text)
+    {
+        return write(text.c_str());
+    }
+    size_t print(const char *text)
+    {
+        return write(text);
+    }
+    size_t print(char c)
+    {
+        return write((uint8_t)c);
+    }
+    size_t print(unsigned char n, int base = DEC)
+    {
+        return printNumber(n, base, false);
+    }
+    size_t print(int n, int base = DEC)
+    {
+        return print((long)n, base);
+    }
+    size_t print(unsigned int n, int base = DEC)
+    {
+        return printNumber(n, base, false);
+    }
+    size_t print(long n, int base = DEC)
+    {
+        return base == DEC && n < 0 ? printNumber(-(long long)n, base, true) : printNumber((unsigned long)n, base, false);
+    }
+    size_t print(unsigned long n, int base = DEC)
+    {
+        return printNumber(n, base, false);
+    }
+    size_t print(long long n, int base = DEC)
+    {
+        return base == DEC && n < 0 ? printNumber(-n, base, true) : printNumber((unsigned long long)n, base, false);
+    }
+    size_t print(unsigned long long n, int base = DEC)
+    {
+        return printNumber(n, base, false);
+    }
+    size_t print(double n, int digits = 2)
+    {
+        char text[48];
+        snprintf(text, sizeof(text), "%.*f", digits, n);
+        return write(text);
+    }
+
+    size_t println()
+    {
+        return write("\r\n");
+    }
+    template <class T>
+    size_t println(const T &value)
+    {
+        size_t n = print(value);
+        return n + println();
+    }
+    template <class T>
+    size_t println(const T &value, int format)
+    {
+        size_t n = print(value, format);
+        return n + println();
+    }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() {}
+    void setTimeout(unsigned long) {}
+    String readStringUntil(char terminator);
+};
+
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    int available() override
+    {
+        return 0;
+    }
+    int read() override
+    {
+        return -1;
+    }
+    int peek() override
+    {
+        return -1;
+    }
+};
+
+extern HardwareSerial Serial;
+
+class EspClass
+{
+public:
+    uint32_t getCycleCount();
+    uint8_t getCpuFreqMHz()
+    {
+        return 160;
+    }
+    uint32_t getFreeHeap()
+    {
+        return 40000;
+    }
+    void wdtDisable() {}
+    void wdtEnable(uint32_t = 0) {}
+    void wdtFeed() {}
+    void reset() {} // no restart on the host
+};
+
+extern EspClass ESP;
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef NATIVE_ESP8266WIFI_H_
+#define NATIVE_ESP8266WIFI_H_
+
+// framesync.h sets the sleep mode around its measurements, the OLED menu shows
+// the connection. There is no radio on the host: the state is only kept, host
+// programs set what the firmware should see.
+#include "Arduino.h"
+#include "FS.h" // the core's header brings it in (BearSSL cert store), OLEDMenuImplementation.cpp relies on that
+
+enum WiFiSleepType {
+    WIFI_NONE_SLEEP = 0,
+    WIFI_LIGHT_SLEEP = 1,
+    WIFI_MODEM_SLEEP = 2
+};
+
+typedef enum WiFiMode {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3
+} WiFiMode_t;
+
+class IPAddress
+{
+private:
+    uint8_t octets[4];
+
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : octets{a, b, c, d} {}
+    String toString() const
+    {
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+        return String(text);
+    }
+};
+
+class ESP8266WiFiClass
+{
+private:
+    WiFiSleepType sleepMode = WIFI_NONE_SLEEP;
+
+public:
+    WiFiMode_t mode = WIFI_OFF;
+    String ssid;
+    bool connected = false;
+    IPAddress ip;
+
+    bool setSleepMode(WiFiSleepType type)
+    {
+        sleepMode = type;
+        return true;
+    }
+    WiFiSleepType getSleepMode()
+    {
+        return sleepMode;
+    }
+    WiFiMode_t getMode()
+    {
+        return mode;
+    }
+    String SSID()
+    {
+        return ssid;
+    }
+    bool isConnected()
+    {
+        return connected;
+    }
+    IPAddress localIP()
+    {
+        return ip;
+    }
+    bool disconnect()
+    {
+        connected = false;
+        return true;
+    }
+};
+
+extern ESP8266WiFiClass WiFi;
+#endif
@@ -0,0 +1,100 @@
+#ifndef NATIVE_FS_H_
+#define NATIVE_FS_H_
+
+// Host stand-in for SPIFFS: files live in Native::spiffsDir.
+
+#include "Arduino.h"
+
+class File : public Stream
+{
+private:
+    FILE *file = nullptr;
+    std::string path;
+
+public:
+    File() {}
+    File(FILE *f, const char *name) : file(f), path(name) {}
+
+    explicit operator bool() const
+    {
+        return file != nullptr;
+    }
+    size_t write(uint8_t c) override
+    {
+        return file ? fwrite(&c, 1, 1, file) : 0;
+    }
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        return file ? fwrite(buffer, 1, size, file) : 0;
+    }
+    using Print::write;
+    int available() override
+    {
+        if (!file) {
+            return 0;
+        }
+        long at = ftell(file);
+        fseek(file, 0, SEEK_END);
+        long end = ftell(file);
+        fseek(file, at, SEEK_SET);
+        return end - at;
+    }
+    int read() override
+    {
+        return file ? fgetc(file) : -1;
+    }
+    size_t read(uint8_t *buffer, size_t size)
+    {
+        return file ? fread(buffer, 1, size, file) : 0;
+    }
+    int peek() override
+    {
+        int c = read();
+        if (c >= 0) {
+            ungetc(c, file);
+        }
+        return c;
+    }
+    size_t size()
+    {
+        return file ? ftell(file) + available() : 0;
+    }
+    const char *name() const
+    {
+        return path.c_str();
+    }
+    void close()
+    {
+        if (file) {
+            fclose(file);
+            file = nullptr;
+        }
+    }
+};
+
+class FS
+{
+public:
+    bool begin()
+    {
+        return true;
+    }
+    File open(const char *path, const char *mode);
+    File open(const String &path, const char *mode)
+    {
+        return open(path.c_str(), mode);
+    }
+    bool exists(const char *path);
+    bool exists(const String &path)
+    {
+        return exists(path.c_str());
+    }
+    bool remove(const char *path);
+    bool remove(const String &path)
+    {
+        return remove(path.c_str());
+    }
+};
+
+extern FS SPIFFS;
+#endif
@@ -0,0 +1,23 @@
+#ifndef NATIVE_SSD1306WIRE_H_
+#define NATIVE_SSD1306WIRE_H_
+
+// busarbiter.h derives BusSSD1306Wire from the OLED driver. The host has no OLED,
+// this is just enough of the class for it (tools/oledsim draws the menus).
+#include "Arduino.h"
+
+class SSD1306Wire
+{
+public:
+    SSD1306Wire(uint8_t, int, int) {}
+    virtual ~SSD1306Wire() {}
+    virtual void display(void) {}
+    uint16_t width()
+    {
+        return 128;
+    }
+    uint16_t height()
+    {
+        return 64;
+    }
+};
+#endif
@@ -0,0 +1,88 @@
+#ifndef NATIVE_WIRE_H_
+#define NATIVE_WIRE_H_
+
+// Host stand-in for the Wire library. Transfers go to the emulated devices of
+// native/hal/hal.cpp (the TV5725 at GBS_ADDR, nothing else answers) and take the
+// time they would at the set clock on the virtual clock.
+
+#include "Arduino.h"
+
+class TwoWire : public Stream
+{
+private:
+    uint8_t address = 0;
+    uint8_t txBuffer[256];
+    uint16_t txLength = 0;
+    uint8_t rxBuffer[256];
+    uint16_t rxLength = 0;
+    uint16_t rxPosition = 0;
+
+public:
+    void begin() {}
+    void begin(int, int) {}
+    void setClock(uint32_t hz);
+    void setClockStretchLimit(uint32_t) {}
+
+    void beginTransmission(uint8_t addr)
+    {
+        address = addr;
+        txLength = 0;
+    }
+    void beginTransmission(int addr)
+    {
+        beginTransmission((uint8_t)addr);
+    }
+    size_t write(uint8_t b) override
+    {
+        if (txLength < sizeof(txBuffer)) {
+            txBuffer[txLength++] = b;
+            return 1;
+        }
+        return 0;
+    }
+    size_t write(const uint8_t *data, size_t size) override
+    {
+        size_t n = 0;
+        while (n < size && write(data[n])) {
+            n++;
+        }
+        return n;
+    }
+    using Print::write;
+    size_t write(int b)
+    {
+        return write((uint8_t)b);
+    }
+
+    // 0 = acknowledged, 2 = no device at the address
+    uint8_t endTransmission(uint8_t sendStop = true);
+    uint8_t requestFrom(uint8_t addr, size_t size, bool sendStop = true);
+    uint8_t requestFrom(int addr, int size)
+    {
+        return requestFrom((uint8_t)addr, (size_t)size, true);
+    }
+    uint8_t requestFrom(uint8_t addr, uint8_t size)
+    {
+        return requestFrom(addr, (size_t)size, true);
+    }
+    uint8_t requestFrom(uint8_t addr, uint8_t size, uint8_t sendStop)
+    {
+        return requestFrom(addr, (size_t)size, (bool)sendStop);
+    }
+
+    int available() override
+    {
+        return rxLength - rxPosition;
+    }
+    int read() override
+    {
+        return rxPosition < rxLength ? rxBuffer[rxPosition++] : -1;
+    }
+    int peek() override
+    {
+        return rxPosition < rxLength ? rxBuffer[rxPosition] : -1;
+    }
+};
+
+extern TwoWire Wire;
+#endif
@@ -0,0 +1,283 @@
+// Host HAL: virtual clock, Serial, GPIO, SPIFFS and the bus with the emulated TV5725.
+// See native.h.
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "FS.h"
+#include "ESP8266WiFi.h"
+#include "native.h"
+#include "../../hal.h"
+
+#define NATIVE_GBS_ADDR 0x17 // tv5725.h GBS_ADDR
+#define NATIVE_SEGMENT_REGISTER 0xf0
+#define NATIVE_CPU_MHZ 160
+
+namespace Native
+{
+    uint64_t nowNs = 0;
+    Stats stats;
+    uint32_t pollNs = 100;
+    uint32_t busHz = 100000;
+    bool logging = false;
+    FILE *logFile = stdout;
+    std::string spiffsDir = "spiffs";
+
+    void resetStats()
+    {
+        stats = Stats();
+    }
+
+    static void busTime(uint16_t bytes)
+    {
+        uint64_t ns = (bytes * 9 + 2) * 1000000000ull / busHz;
+        stats.busNs += ns;
+        nowNs += ns;
+    }
+
+    namespace Tv5725
+    {
+        uint8_t regs[NATIVE_TV5725_SEGMENTS][256];
+        uint8_t segment = 0;
+
+        void reset()
+        {
+            memset(regs, 0, sizeof(regs));
+        }
+
+        void write(uint8_t reg, const uint8_t *data, uint16_t size)
+        {
+            for (uint16_t i = 0; i < size; i++, reg++) {
+                if (reg == NATIVE_SEGMENT_REGISTER) {
+                    segment = data[i] < NATIVE_TV5725_SEGMENTS ? data[i] : segment;
+                } else if (segment != 0 || reg >= NATIVE_TV5725_STATUS_END) {
+                    regs[segment][reg] = data[i];
+                }
+            }
+        }
+
+        void read(uint8_t reg, uint8_t *data, uint16_t size)
+        {
+            for (uint16_t i = 0; i < size; i++, reg++) {
+                data[i] = reg == NATIVE_SEGMENT_REGISTER ? segment : regs[segment][reg];
+            }
+        }
+    } // namespace Tv5725
+
+    GbsWrite gbsWrite = Tv5725::write;
+    GbsRead gbsRead = Tv5725::read;
+} // namespace Native
+
+uint32_t Hal::cycles()
+{
+    Native::nowNs += Native::pollNs;
+    return (uint32_t)(Native::nowNs * NATIVE_CPU_MHZ / 1000);
+}
+
+unsigned long millis()
+{
+    Native::nowNs += Native::pollNs;
+    return Native::nowNs / 1000000;
+}
+
+unsigned long micros()
+{
+    Native::nowNs += Native::pollNs;
+    return Native::nowNs / 1000;
+}
+
+void delay(unsigned long ms)
+{
+    Native::stats.delays++;
+    Native::stats.delayNs += ms * 1000000ull;
+    Native::nowNs += ms * 1000000ull;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    Native::stats.delays++;
+    Native::stats.delayNs += us * 1000ull;
+    Native::nowNs += us * 1000ull;
+}
+
+void yield() {}
+
+long random(long high)
+{
+    return high > 0 ? rand() % high : 0;
+}
+
+long random(long low, long high)
+{
+    return high > low ? low + rand() % (high - low) : low;
+}
+
+void randomSeed(unsigned long seed)
+{
+    srand(seed);
+}
+
+// no source on the debug pin: it stays low and never interrupts
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t)
+{
+    return LOW;
+}
+void attachInterrupt(uint8_t, void (*)(), int) {}
+void detachInterrupt(uint8_t) {}
+
+String::String(int value, uint8_t base) : String((long)value, base) {}
+String::String(unsigned int value, uint8_t base) : String((unsigned long)value, base) {}
+String::String(long value, uint8_t base)
+{
+    char text[36];
+    snprintf(text, sizeof(text), base == HEX ? "%lx" : "%ld", value);
+    s = text;
+}
+String::String(unsigned long value, uint8_t base)
+{
+    char text[36];
+    snprintf(text, sizeof(text), base == HEX ? "%lx" : "%lu", value);
+    s = text;
+}
+String::String(float value, uint8_t decimals)
+{
+    char text[48];
+    snprintf(text, sizeof(text), "%.*f", decimals, value);
+    s = text;
+}
+
+size_t Print::printNumber(unsigned long long n, uint8_t base, bool negative)
+{
+    char text[68];
+    char *p = text + sizeof(text) - 1;
+    *p = 0;
+    if (base < 2) {
+        base = DEC;
+    }
+    do {
+        uint8_t digit = n % base;
+        *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+        n /= base;
+    } while (n);
+    if (negative) {
+        *--p = '-';
+    }
+    return write(p);
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (n < 0) {
+        return 0;
+    }
+    return write((const uint8_t *)text, n < (int)sizeof(text) ? n : sizeof(text) - 1);
+}
+
+String Stream::readStringUntil(char terminator)
+{
+    std::string text;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) {
+        text += (char)c;
+    }
+    return String(text);
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    if (Native::logging) {
+        fputc(c, Native::logFile);
+    }
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    if (Native::logging) {
+        fwrite(buffer, 1, size, Native::logFile);
+    }
+    return size;
+}
+
+HardwareSerial Serial;
+
+uint32_t EspClass::getCycleCount()
+{
+    return Hal::cycles();
+}
+
+EspClass ESP;
+ESP8266WiFiClass WiFi;
+
+void TwoWire::setClock(uint32_t hz)
+{
+    Native::busHz = hz;
+}
+
+uint8_t TwoWire::endTransmission(uint8_t)
+{
+    Native::stats.transfers++;
+    Native::stats.bytes += txLength;
+    Native::busTime(1 + txLength);
+    if (address != NATIVE_GBS_ADDR) {
+        Native::stats.nacks++;
+        return 2;
+    }
+    if (txLength > 1) {
+        Native::gbsWrite(txBuffer[0], txBuffer + 1, txLength - 1);
+    }
+    // the first byte alone sets the register pointer for requestFrom()
+    return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t addr, size_t size, bool)
+{
+    Native::stats.transfers++;
+    rxLength = rxPosition = 0;
+    if (size > sizeof(rxBuffer)) {
+        size = sizeof(rxBuffer);
+    }
+    if (addr != NATIVE_GBS_ADDR) {
+        Native::busTime(1);
+        Native::stats.nacks++;
+        return 0;
+    }
+    Native::stats.bytes += size;
+    Native::busTime(1 + size);
+    Native::gbsRead(txLength > 0 ? txBuffer[0] : 0, rxBuffer, size);
+    rxLength = size;
+    return size;
+}
+
+TwoWire Wire;
+
+File FS::open(const char *path, const char *mode)
+{
+    std::string name = Native::spiffsDir + path;
+    FILE *f = fopen(name.c_str(), mode[0] == 'r' ? "rb" : mode[0] == 'a' ? "ab" : "wb");
+    return f ? File(f, path) : File();
+}
+
+bool FS::exists(const char *path)
+{
+    std::string name = Native::spiffsDir + path;
+    FILE *f = fopen(name.c_str(), "rb");
+    if (f) {
+        fclose(f);
+    }
+    return f != nullptr;
+}
+
+bool FS::remove(const char *path)
+{
+    std::string name = Native::spiffsDir + path;
+    return ::remove(name.c_str()) == 0;
+}
+
+FS SPIFFS;
@@ -0,0 +1,59 @@
+#ifndef NATIVE_NATIVE_H_
+#define NATIVE_NATIVE_H_
+
+// Control of the host HAL for host programs: the virtual clock, what the bus and
+// delay() cost, the emulated TV5725 and where SPIFFS files live.
+//
+// Clock: delay() and delayMicroseconds() advance it by the time asked for, each bus
+// transfer by its length at the bus clock (9 bits per byte, plus start and stop),
+// each read of millis(), micros() or Hal::cycles() by pollNs, so waits that spin on
+// the clock end. The firmware's own CPU time isn't modeled otherwise.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+#define NATIVE_TV5725_SEGMENTS 6
+#define NATIVE_TV5725_STATUS_END 0x30 // 0_00 .. 0_2F are read only status registers
+
+namespace Native
+{
+    struct Stats
+    {
+        uint32_t transfers;    // bus transfers (address phases), to any device
+        uint32_t bytes;        // data bytes on the bus, without the address bytes
+        uint32_t nacks;        // transfers nobody answered
+        uint64_t busNs;        // time on the bus
+        uint32_t delays;       // delay() / delayMicroseconds() calls
+        uint64_t delayNs;      // time asked for by them
+    };
+
+    extern uint64_t nowNs; // virtual clock
+    extern Stats stats;
+    extern uint32_t pollNs;
+    extern uint32_t busHz; // Wire.setClock(), 100kHz until then as in the Wire library
+    extern bool logging;   // Serial to logFile
+    extern FILE *logFile;  // stdout unless changed
+    extern std::string spiffsDir;
+
+    void resetStats();
+
+    // emulated TV5725, 0xf0 selects the segment in every segment
+    namespace Tv5725
+    {
+        extern uint8_t regs[NATIVE_TV5725_SEGMENTS][256];
+        extern uint8_t segment;
+        void reset(); // power on: all registers 0, the segment stays (tw.h caches it)
+        void write(uint8_t reg, const uint8_t *data, uint16_t size);
+        void read(uint8_t reg, uint8_t *data, uint16_t size);
+    } // namespace Tv5725
+
+    // what answers at GBS_ADDR, the emulated TV5725 unless a host program models the
+    // chip itself (tools/i2creplay answers from a captured trace). Called per transfer
+    // with the register pointer first, as on the bus.
+    typedef void (*GbsWrite)(uint8_t reg, const uint8_t *data, uint16_t size);
+    typedef void (*GbsRead)(uint8_t reg, uint8_t *data, uint16_t size);
+    extern GbsWrite gbsWrite;
+    extern GbsRead gbsRead;
+} // namespace Native
+#endif
@@ -0,0 +1,157 @@
+// Mode switch benchmark on the emulated TV5725 (native/hal).
+//
+//   modebench [-v] [MODE [PREFERENCE]]
+//
+// For every input mode (getVideoMode() results) and every PresetPreference, brings
+// the chip up as setup() does, makes the status registers show a stable source of
+// that mode, and switches to it as runSyncWatcher() does on the first detection:
+// applyPresets() -> writeProgramArrayNew() -> doPostPresetLoadSteps(), or
+// setOutModeHdBypass() for OutputBypass, from no source (rto->videoStandardInput 0).
+// One CSV line per transition on stdout:
+//
+//   mode, preference      input mode and uopt->presetPreference
+//   preset_id             rto->presetID afterwards (what actually got applied)
+//   transactions, bytes   bus transfers and data bytes, nacks to absent devices
+//   bus_ms                time on the bus at 400kHz
+//   delays, delay_ms      delay()/delayMicroseconds() calls and the time asked for
+//   apply_ms, write_ms,   the latency sections of applyPresets(),
+//   post_ms                 writeProgramArrayNew() and doPostPresetLoadSteps()
+//   wall_ms               virtual time of the whole switch, the blank screen time
+//
+// Time is the virtual clock: bus transfers and delays, plus MODEBENCH_POLL_NS per
+// clock read in the waits. The firmware's own CPU time isn't in it. MODE or
+// PREFERENCE limit the run, -v shows the firmware's serial output on stderr.
+
+#include "sketch.h"
+
+#define MODEBENCH_POLL_NS 2000 // a clock read in a wait loop, with the loop around it
+
+// a stable source as the status registers show it
+struct SourceImage
+{
+    uint8_t mode;       // what getVideoMode() makes of it
+    bool ypbpr;         // rto->inputIsYpBpR
+    uint8_t status00;   // 0_00 mode detect: H/V stable bits, SD flags
+    uint8_t status03;   // 0_03 720p and graphic mode flags
+    uint8_t status04;   // 0_04 HD flags
+    uint8_t status16;   // 0_16 sync processor: HS/VS active and polarity
+    uint16_t hperiod;   // HPERIOD_IF
+    uint16_t vperiod;   // VPERIOD_IF, lines per field
+    uint16_t spHtotal;  // STATUS_SYNC_PROC_HTOTAL
+    uint16_t spVtotal;  // STATUS_SYNC_PROC_VTOTAL
+};
+
+static const SourceImage sources[] = {
+    {1, true, 0x8f, 0x00, 0x00, 0x0a, 0x1ad, 263, 1716, 263},   // NTSC 480i
+    {2, true, 0xa7, 0x00, 0x00, 0x0a, 0x1b0, 312, 1728, 312},   // PAL 576i
+    {3, true, 0x97, 0x00, 0x00, 0x0a, 0x0d6, 525, 858, 525},    // 480p
+    {4, true, 0xc7, 0x00, 0x00, 0x0a, 0x0d8, 625, 864, 625},    // 576p
+    {5, true, 0x07, 0x10, 0x00, 0x0a, 0x0a0, 750, 1650, 750},   // 720p
+    {6, true, 0x07, 0x00, 0x61, 0x0a, 0x0c7, 562, 2200, 562},   // 1080i
+    {7, true, 0x07, 0x00, 0x30, 0x0a, 0x064, 1125, 2200, 1125}, // 1080p
+    {8, true, 0x07, 0x00, 0x34, 0x0a, 0x1ad, 263, 1716, 263},   // 24kHz
+    {13, true, 0x07, 0x02, 0x00, 0x0a, 0x0a0, 806, 1344, 806},  // YPbPr graphic mode
+    {14, false, 0x07, 0x02, 0x00, 0x0a, 0x0a0, 806, 1344, 806}, // RGBHV, scaled
+    {15, false, 0x07, 0x02, 0x00, 0x0a, 0x0a0, 806, 1344, 806}, // RGBHV, bypass
+};
+
+static const PresetPreference preferences[] = {
+    Output960P, Output480P, OutputCustomized, Output720P, Output1024P, Output1080P, OutputDownscale, OutputBypass,
+};
+
+// sets a read only status register on the emulated chip
+template <class Reg>
+static void setStatus(uint32_t value)
+{
+    tw::detail::regEncode<Reg::bitOffset, Reg::bitWidth>(value, &Native::Tv5725::regs[Reg::segment][Reg::byteOffset]);
+}
+
+static void showSource(const SourceImage &s)
+{
+    setStatus<GBS::STATUS_00>(s.status00);
+    setStatus<GBS::STATUS_03>(s.status03);
+    setStatus<GBS::STATUS_04>(s.status04);
+    setStatus<GBS::STATUS_05>(0); // H and V stable
+    setStatus<GBS::STATUS_16>(s.status16);
+    setStatus<GBS::HPERIOD_IF>(s.hperiod);
+    setStatus<GBS::VPERIOD_IF>(s.vperiod);
+    setStatus<GBS::STATUS_SYNC_PROC_HTOTAL>(s.spHtotal);
+    setStatus<GBS::STATUS_SYNC_PROC_VTOTAL>(s.spVtotal);
+    StatusSnapshot::invalidate();
+}
+
+static uint32_t sectionUs(const char *name)
+{
+    for (uint8_t i = 0; i < Latency::sectionCount; i++) {
+        if (strcmp(Latency::sections[i].name, name) == 0) {
+            return Latency::sections[i].sumUs;
+        }
+    }
+    return 0;
+}
+
+static void resetSections()
+{
+    for (uint8_t i = 0; i < Latency::sectionCount; i++) {
+        const char *name = Latency::sections[i].name;
+        memset(&Latency::sections[i], 0, sizeof(Latency::Histogram));
+        Latency::sections[i].name = name;
+    }
+}
+
+static void run(const SourceImage &s, PresetPreference preference)
+{
+    // from boot each time, so a combination gives the same numbers alone or in the sweep
+    Native::nowNs = 0;
+    randomSeed(1);
+    nativeSetup();
+    showSource(s);
+    rto->inputIsYpBpR = s.ypbpr;
+    rto->syncTypeCsync = false;
+    uopt->presetPreference = preference;
+    Native::resetStats();
+    resetSections();
+    Native::pollNs = MODEBENCH_POLL_NS;
+    uint64_t start = Native::nowNs;
+
+    if (preference != OutputBypass) {
+        applyPresets(s.mode);
+    } else {
+        rto->videoStandardInput = s.mode;
+        setOutModeHdBypass(false);
+    }
+
+    uint64_t wallNs = Native::nowNs - start;
+    Native::pollNs = 100;
+    const Native::Stats &st = Native::stats;
+    printf("%u,%u,%u,%u,%u,%u,%.3f,%u,%.3f,%.3f,%.3f,%.3f,%.3f\n", s.mode, preference, rto->presetID, st.transfers,
+           st.bytes, st.nacks, st.busNs / 1e6, st.delays, st.delayNs / 1e6, sectionUs("applyPresets") / 1e3,
+           sectionUs("writeProgramArrayNew") / 1e3, sectionUs("doPostPresetLoadSteps") / 1e3, wallNs / 1e6);
+    fflush(stdout);
+}
+
+int main(int argc, char **argv)
+{
+    int arg = 1;
+    if (arg < argc && strcmp(argv[arg], "-v") == 0) {
+        Native::logging = true;
+        Native::logFile = stderr;
+        arg++;
+    }
+    int onlyMode = arg < argc ? atoi(argv[arg++]) : -1;
+    int onlyPreference = arg < argc ? atoi(argv[arg++]) : -1;
+
+    printf("mode,preference,preset_id,transactions,bytes,nacks,bus_ms,delays,delay_ms,apply_ms,write_ms,post_ms,wall_ms\n");
+    for (const SourceImage &s : sources) {
+        if (onlyMode >= 0 && s.mode != onlyMode) {
+            continue;
+        }
+        for (PresetPreference p : preferences) {
+            if (onlyPreference >= 0 && p != onlyPreference) {
+                continue;
+            }
+            run(s, p);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+#ifndef NATIVE_SKETCH_H_
+#define NATIVE_SKETCH_H_
+
+// What gbs-control.ino sets up for the portable core (core.h), for host programs.
+// Include it once per program, it defines the globals. The Arduino API comes from
+// native/hal (native.h controls it), there is no WiFi, OLED or clock generator.
+
+#include <Arduino.h> // implicit in the sketch
+#include "options.h"
+#include "slot.h"
+#include "sourcecache.h"
+#include "commandqueue.h"
+#include "hal.h"
+#include "latency.h"
+#include "scheduler.h"
+#include "busarbiter.h"
+#include "i2ctrace.h"
+
+#include <Wire.h>
+#include "tv5725.h"
+#include "osd.h"
+#include "native.h"
+
+typedef TV5725<GBS_ADDR> GBS;
+
+#include "src/si5351mcu.h"
+Si5351mcu Si;
+
+#define DEBUG_IN_PIN D6
+#define LEDON                     \
+    pinMode(LED_BUILTIN, OUTPUT); \
+    digitalWrite(LED_BUILTIN, LOW)
+#define LEDOFF                       \
+    digitalWrite(LED_BUILTIN, HIGH); \
+    pinMode(LED_BUILTIN, INPUT)
+
+struct runTimeOptions rtos;
+struct runTimeOptions *rto = &rtos;
+struct userOptions uopts;
+struct userOptions *uopt = &uopts;
+struct adcOptions adcopts;
+struct adcOptions *adco = &adcopts;
+
+char serialCommand;
+char userCommand;
+static uint8_t lastSegment = 0xFF;
+
+#define SerialM Serial
+
+// OSDManager.h in the sketch
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define MIN(a, b) ((a) > (b) ? (b) : (a))
+
+void handleWiFi(boolean) {}
+
+#include "core.h"
+
+// as setup() leaves the chip and the options with a working board, before the
+// first source is detected
+void nativeSetup()
+{
+    Native::Tv5725::reset();
+    Wire.setClock(400000);
+    loadDefaultUserOptions();
+    loadDefaultRunTimeOptions();
+    rto->webServerEnabled = false;
+    rto->webServerStarted = false;
+    rto->allowUpdatesOTA = false;
+    uopt->enableCalibrationADC = 0; // needs a source
+    zeroAll();
+    setResetParameters();
+    prepareSyncProcessor();
+    setResetParameters();
+}
+#endif
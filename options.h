@@ -36,6 +36,7 @@ struct userOptions
     uint8_t wantFullHeight;
     uint8_t enableCalibrationADC;
     uint8_t scanlineStrength;
+    uint8_t enableAutoGeometry;
 };
 
 
@@ -44,6 +45,7 @@ struct runTimeOptions
 {
     uint32_t freqExtClockGen;
     uint16_t noSyncCounter; // is always at least 1 when checking value in syncwatcher
+    uint16_t plladLockChanges; // PLLAD lock lost or regained, as the sync watcher saw it
     uint8_t presetVlineShift;
     uint8_t videoStandardInput; // 0 - unknown, 1 - NTSC like, 2 - PAL like, 3 480p NTSC, 4 576p PAL
     uint8_t phaseSP;
@@ -64,6 +66,7 @@ struct runTimeOptions
     bool clampPositionIsSet;
     bool coastPositionIsSet;
     bool phaseIsSet;
+    bool autoGeometryIsSet;
     bool inputIsYpBpR;
     bool syncWatcherEnabled;
     bool outModeHdBypass;
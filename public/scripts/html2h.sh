@@ -2,6 +2,8 @@
 
 cd ../..
 gzip -c9 webui.html > webui_html && xxd -i webui_html > webui_html.h && rm webui_html && sed -i -e 's/unsigned char webui_html\[]/const uint8_t webui_html[] PROGMEM/' webui_html.h && sed -i -e 's/unsigned int webui_html_len/const unsigned int webui_html_len/' webui_html.h
+# content hash of the page for the ETag of "/", changes only when webui.html does
+echo "const char webui_html_etag[] = \"\\\"$(cksum < webui.html | cut -d' ' -f1)\\\"\";" >> webui_html.h
 rm -fv webui_html.h-e
 
-echo "webui_html.h GENERATED";
\ No newline at end of file
+echo "webui_html.h GENERATED";
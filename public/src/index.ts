@@ -120,6 +120,8 @@ const GBSControl = {
   scanSSIDDone: false,
   serverIP: "",
   structs: null,
+  status: [0, 0, 0, 0, 0],
+  statusSequence: -1,
   timeOutWs: 0,
   ui: {
     backupButton: null,
@@ -223,6 +225,7 @@ const createWebSocket = () => {
     GBSControl.wsTimeout = setTimeout(timeOutWs, 6000);
     GBSControl.isWsActive = true;
     GBSControl.wsNoSuccessConnectingCounter = 0;
+    GBSControl.statusSequence = -1;
   };
 
   GBSControl.ws.onclose = () => {
@@ -232,136 +235,178 @@ const createWebSocket = () => {
     GBSControl.isWsActive = false;
   };
 
+  GBSControl.ws.binaryType = "arraybuffer";
+
   GBSControl.ws.onmessage = (message: any) => {
     clearTimeout(GBSControl.wsTimeout);
-    GBSControl.wsTimeout = setTimeout(timeOutWs, 2700);
+    GBSControl.wsTimeout = setTimeout(timeOutWs, 4500);
     GBSControl.isWsActive = true;
 
-    const [
-      messageDataAt0,
-      messageDataAt1,
-      messageDataAt2,
-      messageDataAt3,
-      messageDataAt4,
-      messageDataAt5,
-    ] = message.data;
-
-    if (messageDataAt0 != "#") {
-      GBSControl.queuedText += message.data;
-      GBSControl.dataQueued += message.data.length;
-
-      if (GBSControl.dataQueued >= 70000) {
-        GBSControl.ui.terminal.value = "";
-        GBSControl.dataQueued = 0;
-      }
-    } else {
-      const presetId = GBSControl.buttonMapping[messageDataAt1];
-      const presetEl = document.querySelector(
-        `[gbs-element-ref="${presetId}"]`
-      );
-      const activePresetButton = presetEl
-        ? presetEl.getAttribute("gbs-element-ref")
-        : "none";
+    if (message.data instanceof ArrayBuffer) {
+      handleStatusFrame(new Uint8Array(message.data));
+      return;
+    }
 
-      GBSControl.ui.presetButtonList.forEach(
-        toggleButtonActive(activePresetButton)
-      );
+    GBSControl.queuedText += message.data;
+    GBSControl.dataQueued += message.data.length;
 
-      const slotId = "slot-" + messageDataAt2;
-      const activeSlotButton = document.querySelector(
-        `[gbs-element-ref="${slotId}"]`
-      );
+    if (GBSControl.dataQueued >= 70000) {
+      GBSControl.ui.terminal.value = "";
+      GBSControl.dataQueued = 0;
+    }
+  };
+};
 
-      if (activeSlotButton) {
-        GBSControl.ui.slotButtonList.forEach(toggleButtonActive(slotId));
-      }
+/**
+ * binary status frames, see updateWebSocketData() in gbs-control.ino
+ * [0] protocol version, [1] frame type, [2..3] sequence (LE), then (field, value) pairs
+ */
+const STATUS_PROTOCOL_VERSION = 1;
+const STATUS_FRAME_FULL = 0;
+const STATUS_FRAME_DELTA = 1;
 
-      if (messageDataAt3 && messageDataAt4 && messageDataAt5) {
-        const optionByte0 = messageDataAt3.charCodeAt(0);
-        const optionByte1 = messageDataAt4.charCodeAt(0);
-        const optionByte2 = messageDataAt5.charCodeAt(0);
-        const optionButtonList = [
-          ...nodelistToArray<HTMLButtonElement>(GBSControl.ui.toggleList),
-          ...nodelistToArray<HTMLButtonElement>(GBSControl.ui.toggleSwichList),
-        ];
-
-        const toggleMethod = (
-          button: HTMLTableCellElement | HTMLElement,
-          mode: boolean
-        ) => {
-          if (button.tagName === "TD") {
-            button.innerText = mode ? "toggle_on" : "toggle_off";
-          }
-          button = button.tagName !== "TD" ? button : button.parentElement;
-          if (mode) {
-            button.setAttribute("active", "");
-          } else {
-            button.removeAttribute("active");
-          }
-        };
+const handleStatusFrame = (frame: Uint8Array) => {
+  if (frame.length < 4 || frame[0] != STATUS_PROTOCOL_VERSION) {
+    return;
+  }
 
-        optionButtonList.forEach((button) => {
-          const toggleData =
-            button.getAttribute("gbs-toggle") ||
-            button.getAttribute("gbs-toggle-switch");
-
-          switch (toggleData) {
-            case "adcAutoGain":
-              toggleMethod(button, (optionByte0 & 0x01) == 0x01);
-              break;
-            case "scanlines":
-              toggleMethod(button, (optionByte0 & 0x02) == 0x02);
-              break;
-            case "vdsLineFilter":
-              toggleMethod(button, (optionByte0 & 0x04) == 0x04);
-              break;
-            case "peaking":
-              toggleMethod(button, (optionByte0 & 0x08) == 0x08);
-              break;
-            case "palForce60":
-              toggleMethod(button, (optionByte0 & 0x10) == 0x10);
-              break;
-            case "wantOutputComponent":
-              toggleMethod(button, (optionByte0 & 0x20) == 0x20);
-              break;
-            /** 1 */
-
-            case "matched":
-              toggleMethod(button, (optionByte1 & 0x01) == 0x01);
-              break;
-            case "frameTimeLock":
-              toggleMethod(button, (optionByte1 & 0x02) == 0x02);
-              break;
-            case "motionAdaptive":
-              toggleMethod(button, (optionByte1 & 0x04) == 0x04);
-              break;
-            case "bob":
-              toggleMethod(button, (optionByte1 & 0x04) != 0x04);
-              break;
-            // case "tap6":
-            //   toggleMethod(button, (optionByte1 & 0x08) != 0x04);
-            //   break;
-            case "step":
-              toggleMethod(button, (optionByte1 & 0x10) == 0x10);
-              break;
-            case "fullHeight":
-              toggleMethod(button, (optionByte1 & 0x20) == 0x20);
-              break;
-            /** 2 */
-            case "enableCalibrationADC":
-              toggleMethod(button, (optionByte2 & 0x01) == 0x01);
-              break;
-            case "preferScalingRgbhv":
-              toggleMethod(button, (optionByte2 & 0x02) == 0x02);
-              break;
-            case "disableExternalClockGenerator":
-              toggleMethod(button, (optionByte2 & 0x04) == 0x04);
-              break;
-          }
-        });
-      }
+  const frameType = frame[1];
+  const sequence = frame[2] | (frame[3] << 8);
+
+  if (frameType != STATUS_FRAME_FULL) {
+    if (GBSControl.statusSequence < 0) {
+      return; // waiting for a snapshot
+    }
+    const expected =
+      frameType == STATUS_FRAME_DELTA
+        ? (GBSControl.statusSequence + 1) & 0xffff
+        : GBSControl.statusSequence;
+    if (sequence != expected) {
+      requestStatusSnapshot();
+      return;
+    }
+  }
+
+  for (let i = 4; i + 1 < frame.length; i += 2) {
+    GBSControl.status[frame[i]] = frame[i + 1];
+  }
+  GBSControl.statusSequence = sequence;
+
+  if (frame.length > 4) {
+    applyStatus();
+  }
+};
+
+const requestStatusSnapshot = () => {
+  GBSControl.statusSequence = -1;
+  if (GBSControl.ws && GBSControl.ws.readyState == 1) {
+    GBSControl.ws.send("?");
+  }
+};
+
+const applyStatus = () => {
+  const [preset, slot, optionByte0, optionByte1, optionByte2] =
+    GBSControl.status;
+  const presetId = GBSControl.buttonMapping[preset];
+  const presetEl = document.querySelector(
+    `[gbs-element-ref="${presetId}"]`
+  );
+  const activePresetButton = presetEl
+    ? presetEl.getAttribute("gbs-element-ref")
+    : "none";
+
+  GBSControl.ui.presetButtonList.forEach(
+    toggleButtonActive(activePresetButton)
+  );
+
+  const slotId = "slot-" + String.fromCharCode(slot);
+  const activeSlotButton = document.querySelector(
+    `[gbs-element-ref="${slotId}"]`
+  );
+
+  if (activeSlotButton) {
+    GBSControl.ui.slotButtonList.forEach(toggleButtonActive(slotId));
+  }
+
+  const optionButtonList = [
+    ...nodelistToArray<HTMLButtonElement>(GBSControl.ui.toggleList),
+    ...nodelistToArray<HTMLButtonElement>(GBSControl.ui.toggleSwichList),
+  ];
+
+  const toggleMethod = (
+    button: HTMLTableCellElement | HTMLElement,
+    mode: boolean
+  ) => {
+    if (button.tagName === "TD") {
+      button.innerText = mode ? "toggle_on" : "toggle_off";
+    }
+    button = button.tagName !== "TD" ? button : button.parentElement;
+    if (mode) {
+      button.setAttribute("active", "");
+    } else {
+      button.removeAttribute("active");
     }
   };
+
+  optionButtonList.forEach((button) => {
+    const toggleData =
+      button.getAttribute("gbs-toggle") ||
+      button.getAttribute("gbs-toggle-switch");
+
+    switch (toggleData) {
+      case "adcAutoGain":
+        toggleMethod(button, (optionByte0 & 0x01) == 0x01);
+        break;
+      case "scanlines":
+        toggleMethod(button, (optionByte0 & 0x02) == 0x02);
+        break;
+      case "vdsLineFilter":
+        toggleMethod(button, (optionByte0 & 0x04) == 0x04);
+        break;
+      case "peaking":
+        toggleMethod(button, (optionByte0 & 0x08) == 0x08);
+        break;
+      case "palForce60":
+        toggleMethod(button, (optionByte0 & 0x10) == 0x10);
+        break;
+      case "wantOutputComponent":
+        toggleMethod(button, (optionByte0 & 0x20) == 0x20);
+        break;
+      /** 1 */
+
+      case "matched":
+        toggleMethod(button, (optionByte1 & 0x01) == 0x01);
+        break;
+      case "frameTimeLock":
+        toggleMethod(button, (optionByte1 & 0x02) == 0x02);
+        break;
+      case "motionAdaptive":
+        toggleMethod(button, (optionByte1 & 0x04) == 0x04);
+        break;
+      case "bob":
+        toggleMethod(button, (optionByte1 & 0x04) != 0x04);
+        break;
+      // case "tap6":
+      //   toggleMethod(button, (optionByte1 & 0x08) != 0x04);
+      //   break;
+      case "step":
+        toggleMethod(button, (optionByte1 & 0x10) == 0x10);
+        break;
+      case "fullHeight":
+        toggleMethod(button, (optionByte1 & 0x20) == 0x20);
+        break;
+      /** 2 */
+      case "enableCalibrationADC":
+        toggleMethod(button, (optionByte2 & 0x01) == 0x01);
+        break;
+      case "preferScalingRgbhv":
+        toggleMethod(button, (optionByte2 & 0x02) == 0x02);
+        break;
+      case "disableExternalClockGenerator":
+        toggleMethod(button, (optionByte2 & 0x04) == 0x04);
+        break;
+    }
+  });
 };
 
 const checkReadyState = () => {
@@ -0,0 +1,259 @@
+#ifndef REGINSPECT_H_
+#define REGINSPECT_H_
+
+#include "tv5725_names.h"
+
+// Live register inspector for WebSocket clients.
+//
+// A client subscribes to a register range with a binary message
+//   'S', segment, offset, length, interval (ms, LE uint16)   length 0 = drop the range
+//   'U'                                                      drop all of its ranges
+// Ranges are shared: every distinct range is burst-read once per (shortest
+// requested) interval, no matter how many clients watch it, and only the bytes
+// that changed are sent:
+//   'R', REGINSPECT_VERSION, segment, offset, then runs of (relative offset, count, bytes)
+// A new subscriber gets the whole range as one run. The names for the offsets
+// come from /regs/names (tv5725_names.h, generated from tv5725.h).
+//
+// webSocketEvent() runs in the network stack, so it only queues the requests;
+// run() applies them and does all I2C from loop().
+
+#define REGINSPECT_VERSION 1
+#define REGINSPECT_RANGES 6         // distinct ranges for all clients
+#define REGINSPECT_MAX_LEN 64       // bytes per range
+#define REGINSPECT_MIN_INTERVAL 50  // ms, protects the control loop
+#define REGINSPECT_REQUESTS 8       // pending requests, power of 2
+
+namespace RegInspector
+{
+    struct Range
+    {
+        uint8_t clients;     // bit per WebSocket client, 0 = slot free
+        uint8_t needFull;    // clients that have not seen the data yet
+        uint8_t segment;
+        uint8_t offset;
+        uint8_t length;
+        uint16_t interval[WEBSOCKETS_SERVER_CLIENT_MAX];
+        unsigned long lastRead;
+        uint8_t data[REGINSPECT_MAX_LEN];
+    };
+
+    struct Request
+    {
+        uint8_t client;
+        uint8_t segment;
+        uint8_t offset;
+        uint8_t length; // 0 = unsubscribe the range, 0xff with offset 0xff = unsubscribe all
+        uint16_t interval;
+    };
+
+    Range ranges[REGINSPECT_RANGES];
+    Request requests[REGINSPECT_REQUESTS];
+    volatile uint8_t requestHead = 0; // network stack side
+    volatile uint8_t requestTail = 0; // loop() side
+
+    static void queue(const Request &r)
+    {
+        uint8_t next = (requestHead + 1) & (REGINSPECT_REQUESTS - 1);
+        if (next == requestTail) {
+            return; // full, the client can ask again
+        }
+        requests[requestHead] = r;
+        __asm__ __volatile__("" ::: "memory");
+        requestHead = next;
+    }
+
+    // client disconnected or sent 'U'
+    void forgetClient(uint8_t num)
+    {
+        Request r;
+        r.client = num;
+        r.segment = 0;
+        r.offset = 0xff;
+        r.length = 0xff;
+        r.interval = 0;
+        queue(r);
+    }
+
+    // from webSocketEvent(), returns true if the message was for the inspector
+    bool handleMessage(uint8_t num, const uint8_t *payload, size_t length)
+    {
+        Request r;
+        r.client = num;
+        if (length >= 6 && payload[0] == 'S') {
+            r.segment = payload[1];
+            r.offset = payload[2];
+            r.length = payload[3];
+            r.interval = payload[4] | (payload[5] << 8);
+            if (r.segment > 5 || r.length > REGINSPECT_MAX_LEN || (r.offset + r.length) > 0x100) {
+                return true; // not a valid range, ignore
+            }
+            queue(r);
+            return true;
+        }
+        if (length >= 1 && payload[0] == 'U') {
+            forgetClient(num);
+            return true;
+        }
+        return false;
+    }
+
+    static uint16_t shortestInterval(const Range &range)
+    {
+        uint16_t shortest = 0xffff;
+        for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+            if ((range.clients & (1 << i)) && range.interval[i] < shortest) {
+                shortest = range.interval[i];
+            }
+        }
+        return shortest;
+    }
+
+    static void apply(const Request &r)
+    {
+        uint8_t bit = 1 << r.client;
+        if (r.length == 0xff && r.offset == 0xff) {
+            for (uint8_t i = 0; i < REGINSPECT_RANGES; i++) {
+                ranges[i].clients &= ~bit;
+                ranges[i].needFull &= ~bit;
+            }
+            return;
+        }
+
+        Range *match = nullptr;
+        Range *unused = nullptr;
+        for (uint8_t i = 0; i < REGINSPECT_RANGES; i++) {
+            Range &range = ranges[i];
+            if (range.clients == 0) {
+                if (unused == nullptr) {
+                    unused = &range;
+                }
+            } else if (range.segment == r.segment && range.offset == r.offset &&
+                       (range.length == r.length || r.length == 0)) {
+                match = &range;
+            }
+        }
+
+        if (r.length == 0) {
+            if (match) {
+                match->clients &= ~bit;
+                match->needFull &= ~bit;
+            }
+            return;
+        }
+        if (match == nullptr) {
+            if (unused == nullptr) {
+                return; // no room, the client sees no answer for this range
+            }
+            match = unused;
+            match->segment = r.segment;
+            match->offset = r.offset;
+            match->length = r.length;
+            match->lastRead = 0;
+            GBS::read(match->segment, match->offset, match->data, match->length);
+        }
+        match->clients |= bit;
+        match->needFull |= bit;
+        match->interval[r.client] = r.interval < REGINSPECT_MIN_INTERVAL ? REGINSPECT_MIN_INTERVAL : r.interval;
+    }
+
+    static void sendFull(Range &range)
+    {
+        uint8_t frame[6 + REGINSPECT_MAX_LEN];
+        frame[0] = 'R';
+        frame[1] = REGINSPECT_VERSION;
+        frame[2] = range.segment;
+        frame[3] = range.offset;
+        frame[4] = 0;
+        frame[5] = range.length;
+        memcpy(frame + 6, range.data, range.length);
+        for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+            if (range.needFull & (1 << i)) {
+                webSocket.sendBIN(i, frame, 6 + range.length);
+            }
+        }
+        range.needFull = 0;
+    }
+
+    static void update(Range &range)
+    {
+        uint8_t now[REGINSPECT_MAX_LEN];
+        // worst case every other byte changed: 3 bytes per changed byte
+        uint8_t frame[4 + 3 * REGINSPECT_MAX_LEN / 2 + 3];
+        uint8_t len = 4;
+        GBS::read(range.segment, range.offset, now, range.length);
+
+        uint8_t i = 0;
+        while (i < range.length) {
+            if (now[i] == range.data[i]) {
+                i++;
+                continue;
+            }
+            uint8_t start = i;
+            while (i < range.length && now[i] != range.data[i]) {
+                i++;
+            }
+            uint8_t count = i - start;
+            if ((size_t)(len + 2 + count) > sizeof(frame)) {
+                break;
+            }
+            frame[len++] = start;
+            frame[len++] = count;
+            memcpy(frame + len, now + start, count);
+            len += count;
+        }
+        memcpy(range.data, now, range.length);
+
+        if (len == 4) {
+            return; // nothing changed
+        }
+        frame[0] = 'R';
+        frame[1] = REGINSPECT_VERSION;
+        frame[2] = range.segment;
+        frame[3] = range.offset;
+        for (uint8_t c = 0; c < WEBSOCKETS_SERVER_CLIENT_MAX; c++) {
+            if (range.clients & (1 << c)) {
+                webSocket.sendBIN(c, frame, len);
+            }
+        }
+    }
+
+    // called once per loop() pass
+    void run()
+    {
+        while (requestTail != requestHead) {
+            Request r = requests[requestTail];
+            __asm__ __volatile__("" ::: "memory");
+            requestTail = (requestTail + 1) & (REGINSPECT_REQUESTS - 1);
+            apply(r);
+        }
+
+        for (uint8_t i = 0; i < REGINSPECT_RANGES; i++) {
+            Range &range = ranges[i];
+            if (range.clients == 0) {
+                continue;
+            }
+            if (range.needFull) {
+                sendFull(range);
+            }
+            if ((millis() - range.lastRead) >= shortestInterval(range)) {
+                range.lastRead = millis();
+                update(range);
+            }
+        }
+    }
+
+    // /regs/names element: [segment, byteOffset, bitOffset, bitWidth, "NAME"]
+    size_t nameJson(uint16_t index, char *buf, size_t maxLen)
+    {
+        RegisterName reg;
+        char name[32];
+        memcpy_P(&reg, &registerNames[index], sizeof(reg));
+        strncpy_P(name, reg.name, sizeof(name) - 1);
+        name[sizeof(name) - 1] = '\0';
+        int n = snprintf(buf, maxLen, "[%u,%u,%u,%u,\"%s\"]",
+                         reg.segment, reg.byteOffset, reg.bitOffset, reg.bitWidth, name);
+        return (n > 0 && (size_t)n < maxLen) ? n : 0;
+    }
+} // namespace RegInspector
+#endif
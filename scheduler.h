@@ -0,0 +1,155 @@
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+// Cooperative task scheduler for loop().
+//
+// Every task has a period, a deadline (how late it may start) and a priority.
+// run() is called from loop() and starts each due task once, highest priority
+// (lowest number) first. A task that starts later than its deadline counts a miss,
+// so slow neighbours show up in report() instead of as vague "sluggishness".
+//
+// Long operations (preset loads, phase search, ADC calibration, sync waits) call
+// yield() wherever they used to call handleWiFi(0). It runs only the tasks
+// registered as yield safe, the ones that don't touch the video path (network),
+// and it never re-enters a running task or itself.
+//
+// Every task also feeds a latency histogram of its name (latency.h).
+// Times are in microseconds, micros() wraps after ~71 minutes which the unsigned
+// differences handle.
+
+#define SCHEDULER_MAX_TASKS 10
+
+typedef void (*TaskFunction)();
+
+struct Task
+{
+    const char *name;
+    TaskFunction function;
+    uint32_t period;   // us, 0 = every pass
+    uint32_t deadline; // us, allowed start delay past the period
+    uint8_t priority;  // 0 runs first
+    bool yieldSafe;    // may run from inside a long operation
+    bool running;
+    uint8_t latency;  // Latency section of the same name
+    uint32_t lastStart;
+    uint32_t runs;
+    uint32_t misses;
+    uint32_t maxLate; // us past the due time
+    uint32_t maxRun;  // us
+};
+
+namespace Scheduler
+{
+    Task tasks[SCHEDULER_MAX_TASKS];
+    uint8_t taskCount = 0;
+    bool inYield = false;
+    uint32_t yields = 0;
+
+    // keeps the table sorted by priority, equal priorities in registration order
+    bool add(const char *name, TaskFunction function, uint32_t period, uint32_t deadline,
+             uint8_t priority, bool yieldSafe)
+    {
+        if (taskCount >= SCHEDULER_MAX_TASKS) {
+            return false;
+        }
+        uint8_t i = taskCount;
+        while (i > 0 && tasks[i - 1].priority > priority) {
+            tasks[i] = tasks[i - 1];
+            i--;
+        }
+        Task &t = tasks[i];
+        memset(&t, 0, sizeof(Task));
+        t.name = name;
+        t.function = function;
+        t.period = period;
+        t.deadline = deadline;
+        t.priority = priority;
+        t.yieldSafe = yieldSafe;
+        t.latency = Latency::define(name);
+        t.lastStart = micros() - period; // due right away
+        taskCount++;
+        return true;
+    }
+
+    static void runTask(Task &t)
+    {
+        uint32_t start = micros();
+        uint32_t sinceLast = start - t.lastStart;
+        if (sinceLast < t.period) {
+            return;
+        }
+        uint32_t late = sinceLast - t.period;
+        if (late > t.maxLate) {
+            t.maxLate = late;
+        }
+        if (t.runs > 0 && late > t.deadline) {
+            t.misses++;
+        }
+        t.lastStart = start;
+        t.running = true;
+        uint32_t startCycles = Latency::cycles();
+        t.function();
+        Latency::record(t.latency, Latency::cycles() - startCycles);
+        t.running = false;
+        t.runs++;
+
+        uint32_t took = micros() - start;
+        if (took > t.maxRun) {
+            t.maxRun = took;
+        }
+    }
+
+    // called from loop()
+    void run()
+    {
+        for (uint8_t i = 0; i < taskCount; i++) {
+            runTask(tasks[i]);
+        }
+    }
+
+    // called from long operations instead of handleWiFi(0)
+    void yield()
+    {
+        if (!inYield) {
+            inYield = true;
+            yields++;
+            for (uint8_t i = 0; i < taskCount; i++) {
+                if (tasks[i].yieldSafe && !tasks[i].running) {
+                    runTask(tasks[i]);
+                }
+            }
+            inYield = false;
+        }
+        ::yield();
+    }
+
+    // delay() that keeps the yield safe tasks going
+    void sleep(uint32_t ms)
+    {
+        uint32_t start = millis();
+        while (millis() - start < ms) {
+            yield();
+            delay(1);
+        }
+    }
+
+    void resetStats()
+    {
+        for (uint8_t i = 0; i < taskCount; i++) {
+            tasks[i].runs = tasks[i].misses = tasks[i].maxLate = tasks[i].maxRun = 0;
+        }
+        yields = 0;
+    }
+
+    void report(Print &out)
+    {
+        out.println(F("task       prio period(us) runs     misses  max late(us) max run(us)"));
+        for (uint8_t i = 0; i < taskCount; i++) {
+            const Task &t = tasks[i];
+            out.printf("%-10s %4u %10u %-8u %-7u %12u %11u\n", t.name, t.priority, t.period,
+                       t.runs, t.misses, t.maxLate, t.maxRun);
+        }
+        out.printf("yields from long operations: %u\n", yields);
+    }
+} // namespace Scheduler
+#endif
@@ -0,0 +1,158 @@
+#ifndef SOURCECACHE_H_
+#define SOURCECACHE_H_
+
+#include "FS.h"
+
+// Remembers the results of the slow per-source tuning steps (optimizeSogLevel(),
+// optimizePhaseSP(), runAutoBestHTotal(), auto gain, auto geometry) keyed by what the chip
+// reports about the source. When a known source comes back, the stored values are
+// validated and reapplied instead of searching again.
+
+#define SOURCECACHE_FILE "/sourcecache.bin" // the file where to store cached source settings
+#define SOURCECACHE_ENTRIES 16              // least recently used entry gets replaced
+#define SOURCECACHE_VERSION 2
+
+typedef struct
+{
+    uint16_t hperiod;   // HPERIOD_IF
+    uint16_t vperiod;   // VPERIOD_IF
+    uint16_t spHtotal;  // STATUS_SYNC_PROC_HTOTAL
+    uint16_t spVtotal;  // STATUS_SYNC_PROC_VTOTAL
+    uint8_t videoMode;  // rto->videoStandardInput
+    uint8_t presetID;   // output preset, best htotal depends on it
+    uint8_t syncTypeCsync;
+    uint8_t inputPort;  // ADC_INPUT_SEL: 1 = RGB, 0 = Component
+} SourceFingerprint;
+
+typedef struct
+{
+    uint16_t bestHtotal; // 0 = not measured
+    int16_t hscale;      // Geometry::Target, valid if geometrySet
+    int16_t vscale;
+    int16_t hCenter;
+    int16_t vStart;
+    int16_t srcStart;
+    uint8_t phaseSP;
+    uint8_t phaseADC;
+    uint8_t levelSOG;
+    uint8_t r_gain; // r/g/b gain 0 = auto gain was off
+    uint8_t g_gain;
+    uint8_t b_gain;
+    uint8_t geometrySet; // 0 = auto geometry was off
+} SourceSettings;
+
+typedef struct
+{
+    SourceFingerprint fp;
+    SourceSettings settings;
+    uint8_t inUse;
+    uint8_t lastUsed; // generation counter for LRU replacement
+} SourceCacheEntry;
+
+typedef struct
+{
+    uint8_t version;
+    uint8_t generation;
+    SourceCacheEntry entry[SOURCECACHE_ENTRIES];
+} SourceCacheArray;
+
+namespace SourceCache
+{
+    SourceCacheArray cache;
+
+    static inline bool near(uint16_t a, uint16_t b, uint16_t tolerance)
+    {
+        return (a > b ? a - b : b - a) <= tolerance;
+    }
+
+    // periods and line counts jitter by a count or two between detections
+    bool matches(const SourceFingerprint &a, const SourceFingerprint &b)
+    {
+        return a.videoMode == b.videoMode && a.presetID == b.presetID &&
+               a.syncTypeCsync == b.syncTypeCsync && a.inputPort == b.inputPort &&
+               near(a.hperiod, b.hperiod, 1) && near(a.vperiod, b.vperiod, 1) &&
+               near(a.spHtotal, b.spHtotal, 2) && near(a.spVtotal, b.spVtotal, 2);
+    }
+
+    void clear()
+    {
+        memset(&cache, 0, sizeof(cache));
+        cache.version = SOURCECACHE_VERSION;
+    }
+
+    void load()
+    {
+        clear();
+        File f = SPIFFS.open(SOURCECACHE_FILE, "r");
+        if (!f) {
+            return;
+        }
+        if (f.size() != sizeof(cache) ||
+            f.read((uint8_t *)&cache, sizeof(cache)) != sizeof(cache) ||
+            cache.version != SOURCECACHE_VERSION) {
+            clear(); // stale layout or short read
+        }
+        f.close();
+    }
+
+    void save()
+    {
+        File f = SPIFFS.open(SOURCECACHE_FILE, "w");
+        if (f) {
+            f.write((const uint8_t *)&cache, sizeof(cache));
+            f.close();
+        }
+    }
+
+    SourceCacheEntry *find(const SourceFingerprint &fp)
+    {
+        for (uint8_t i = 0; i < SOURCECACHE_ENTRIES; i++) {
+            if (cache.entry[i].inUse && matches(cache.entry[i].fp, fp)) {
+                cache.entry[i].lastUsed = ++cache.generation;
+                return &cache.entry[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // returns true if the stored copy changed (and was written to SPIFFS)
+    bool store(const SourceFingerprint &fp, const SourceSettings &settings)
+    {
+        SourceCacheEntry *e = find(fp);
+        if (e == nullptr) {
+            // pick a free slot, else the least recently used one
+            e = &cache.entry[0];
+            for (uint8_t i = 0; i < SOURCECACHE_ENTRIES; i++) {
+                if (!cache.entry[i].inUse) {
+                    e = &cache.entry[i];
+                    break;
+                }
+                if ((uint8_t)(cache.generation - cache.entry[i].lastUsed) >
+                    (uint8_t)(cache.generation - e->lastUsed)) {
+                    e = &cache.entry[i];
+                }
+            }
+        } else if (memcmp(&e->settings, &settings, sizeof(settings)) == 0) {
+            return false; // nothing new, spare the flash
+        }
+
+        e->fp = fp;
+        e->settings = settings;
+        e->inUse = 1;
+        e->lastUsed = ++cache.generation;
+        save();
+        return true;
+    }
+
+    void forget(const SourceFingerprint &fp)
+    {
+        for (uint8_t i = 0; i < SOURCECACHE_ENTRIES; i++) {
+            if (cache.entry[i].inUse && matches(cache.entry[i].fp, fp)) {
+                cache.entry[i].inUse = 0;
+                save();
+                return;
+            }
+        }
+    }
+} // namespace SourceCache
+#endif
@@ -280,9 +280,11 @@ typedef struct {
     uint32_t pongTimeout;              // interval in millis after which pong is considered to timeout
     uint8_t disconnectTimeoutCount;    // after how many subsequent pong timeouts discconnect will happen, 0 means "do not disconnect"
     uint8_t pongTimeoutCount;          // current pong timeout count
+    uint32_t broadcastSkipped;         // broadcast frames dropped because the client could not keep up
 
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
     String cHttpLine;    ///< HTTP header lines
+    AsyncClient * asyncClient;    ///< the connection under tcp, its send window shows a slow client
 #endif
 
 } WSclient_t;
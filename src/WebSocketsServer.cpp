@@ -35,7 +35,7 @@ WebSocketsServer::WebSocketsServer(uint16_t port, String origin, String protocol
 
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
     _server->onClient([](void * s, AsyncClient * c) {
-        ((WebSocketsServer *)s)->newClient(new AsyncTCPbuffer(c));
+        ((WebSocketsServer *)s)->newClient(new AsyncTCPbuffer(c), c);
     },
         this);
 #endif
@@ -211,24 +211,10 @@ bool WebSocketsServer::sendTXT(uint8_t num, String & payload) {
  * @return true if ok
  */
 bool WebSocketsServer::broadcastTXT(uint8_t * payload, size_t length, bool headerToPayload) {
-    WSclient_t * client;
-    bool ret = true;
     if(length == 0) {
         length = strlen((const char *)payload);
     }
-
-    for(uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
-        client = &_clients[i];
-        if(clientIsConnected(client)) {
-            if(!sendFrame(client, WSop_text, payload, length, true, headerToPayload)) {
-                ret = false;
-            }
-        }
-#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266)
-        delay(0);
-#endif
-    }
-    return ret;
+    return broadcastFrame(WSop_text, payload, length, headerToPayload);
 }
 
 bool WebSocketsServer::broadcastTXT(const uint8_t * payload, size_t length) {
@@ -278,20 +264,7 @@ bool WebSocketsServer::sendBIN(uint8_t num, const uint8_t * payload, size_t leng
  * @return true if ok
  */
 bool WebSocketsServer::broadcastBIN(uint8_t * payload, size_t length, bool headerToPayload) {
-    WSclient_t * client;
-    bool ret = true;
-    for(uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
-        client = &_clients[i];
-        if(clientIsConnected(client)) {
-            if(!sendFrame(client, WSop_binary, payload, length, true, headerToPayload)) {
-                ret = false;
-            }
-        }
-#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266)
-        delay(0);
-#endif
-    }
-    return ret;
+    return broadcastFrame(WSop_binary, payload, length, headerToPayload);
 }
 
 bool WebSocketsServer::broadcastBIN(const uint8_t * payload, size_t length) {
@@ -327,24 +300,125 @@ bool WebSocketsServer::sendPing(uint8_t num, String & payload) {
  * @return true if ping is send out
  */
 bool WebSocketsServer::broadcastPing(uint8_t * payload, size_t length) {
+    return broadcastFrame(WSop_ping, payload, length, false);
+}
+
+bool WebSocketsServer::broadcastPing(String & payload) {
+    return broadcastPing((uint8_t *)payload.c_str(), payload.length());
+}
+
+/**
+ * send one frame to all connected clients
+ * the header and payload are encoded once and the same bytes go to every client
+ * (server frames are not masked). Clients that can not take the frame without
+ * blocking are skipped and counted, see broadcastSkipped().
+ * @param opcode WSopcode_t
+ * @param payload uint8_t *
+ * @param length size_t
+ * @param headerToPayload bool  (see sendFrame for more details)
+ * @return true if all clients got the frame
+ */
+bool WebSocketsServer::broadcastFrame(WSopcode_t opcode, uint8_t * payload, size_t length, bool headerToPayload) {
     WSclient_t * client;
-    bool ret = true;
+    bool ret             = true;
+    uint8_t * frame      = payload;
+    bool useInternBuffer = false;
+
+    if(!headerToPayload) {
+        frame = (uint8_t *)malloc(length + WEBSOCKETS_MAX_HEADER_SIZE);
+        if(!frame) {
+            // no memory for the shared copy, fall back to one frame per client
+            for(uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+                client = &_clients[i];
+                if(clientIsConnected(client) && !sendFrame(client, opcode, payload, length)) {
+                    ret = false;
+                }
+            }
+            return ret;
+        }
+        if(payload && length > 0) {
+            memcpy(frame + WEBSOCKETS_MAX_HEADER_SIZE, payload, length);
+        }
+        useInternBuffer = true;
+    }
+
+    uint8_t maskKey[4] = { 0x00, 0x00, 0x00, 0x00 };
+    uint8_t headerSize;
+    if(length < 126) {
+        headerSize = 2;
+    } else if(length < 0xFFFF) {
+        headerSize = 4;
+    } else {
+        headerSize = 10;
+    }
+    uint8_t * headerPtr = frame + (WEBSOCKETS_MAX_HEADER_SIZE - headerSize);
+    createHeader(headerPtr, opcode, length, false, maskKey, true);
+    size_t frameSize = length + headerSize;
+
     for(uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
         client = &_clients[i];
-        if(clientIsConnected(client)) {
-            if(!sendFrame(client, WSop_ping, payload, length)) {
-                ret = false;
-            }
+        if(!clientIsConnected(client) || client->status != WSC_CONNECTED) {
+            continue;
+        }
+        if(!clientCanTakeBroadcast(client, frameSize)) {
+            client->broadcastSkipped++;
+            ret = false;
+            continue;
+        }
+        if(write(client, headerPtr, frameSize) != frameSize) {
+            ret = false;
         }
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266)
         delay(0);
 #endif
     }
+
+    if(useInternBuffer) {
+        free(frame);
+    }
     return ret;
 }
 
-bool WebSocketsServer::broadcastPing(String & payload) {
-    return broadcastPing((uint8_t *)payload.c_str(), payload.length());
+/**
+ * backpressure check for broadcasts, per client: the frame must fit in the
+ * client's own TCP send window. Sync clients would block in write() otherwise,
+ * async ones would queue it on the heap behind what is still unacknowledged.
+ * The heap floor only guards against all async clients together running it low.
+ * @param client WSclient_t *
+ * @param length size_t  frame size including the header
+ * @return true if the frame can be sent now
+ */
+bool WebSocketsServer::clientCanTakeBroadcast(WSclient_t * client, size_t length) {
+#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP32)
+    if((size_t)client->tcp->availableForWrite() < length) {
+        return false;
+    }
+#endif
+#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
+    if(!client->asyncClient || !client->asyncClient->canSend() || client->asyncClient->space() < length) {
+        return false;
+    }
+#endif
+#ifdef WEBSOCKETS_USE_BIG_MEM
+    if(GET_FREE_HEAP < (WEBSOCKETS_BROADCAST_MIN_HEAP + length)) {
+        return false;
+    }
+#endif
+    (void)client;
+    (void)length;
+    return true;
+}
+
+/**
+ * number of broadcast frames a client missed because it could not keep up
+ * a client whose count changed needs a full resync of any incremental state
+ * @param num uint8_t client id
+ */
+uint32_t WebSocketsServer::broadcastSkipped(uint8_t num) {
+    if(num >= WEBSOCKETS_SERVER_CLIENT_MAX) {
+        return 0;
+    }
+    return _clients[num].broadcastSkipped;
 }
 
 /**
@@ -441,8 +515,13 @@ IPAddress WebSocketsServer::remoteIP(uint8_t num) {
 /**
  * handle new client connection
  * @param client
+ * @param asyncClient  the connection TCPclient buffers (async only)
  */
+#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
+bool WebSocketsServer::newClient(WEBSOCKETS_NETWORK_CLASS * TCPclient, AsyncClient * asyncClient) {
+#else
 bool WebSocketsServer::newClient(WEBSOCKETS_NETWORK_CLASS * TCPclient) {
+#endif
     WSclient_t * client;
     // search free list entry for client
     for(uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
@@ -451,6 +530,10 @@ bool WebSocketsServer::newClient(WEBSOCKETS_NETWORK_CLASS * TCPclient) {
         // state is not connected or tcp connection is lost
         if(!clientIsConnected(client)) {
             client->tcp = TCPclient;
+            client->broadcastSkipped = 0;
+#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
+            client->asyncClient = asyncClient;
+#endif
 
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP32)
             client->isSSL = false;
@@ -475,8 +558,9 @@ bool WebSocketsServer::newClient(WEBSOCKETS_NETWORK_CLASS * TCPclient) {
 
                 AsyncTCPbuffer ** sl = &server->_clients[client->num].tcp;
                 if(*sl == obj) {
-                    client->status = WSC_NOT_CONNECTED;
-                    *sl            = NULL;
+                    client->status      = WSC_NOT_CONNECTED;
+                    *sl                 = NULL;
+                    client->asyncClient = NULL;
                 }
                 return true;
             },
@@ -551,7 +635,8 @@ void WebSocketsServer::clientDisconnect(WSclient_t * client) {
             client->tcp->stop();
         }
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
-        client->status = WSC_NOT_CONNECTED;
+        client->status      = WSC_NOT_CONNECTED;
+        client->asyncClient = NULL;
 #else
         delete client->tcp;
 #endif
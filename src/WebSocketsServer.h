@@ -31,6 +31,12 @@
 #define WEBSOCKETS_SERVER_CLIENT_MAX (2)
 #endif
 
+// safety net for async clients: broadcasts are skipped for all of them while the
+// free heap is below this, whatever their own send window
+#ifndef WEBSOCKETS_BROADCAST_MIN_HEAP
+#define WEBSOCKETS_BROADCAST_MIN_HEAP (12000)
+#endif
+
 class WebSocketsServer : protected WebSockets {
   public:
 #ifdef __AVR__
@@ -91,6 +97,7 @@ class WebSocketsServer : protected WebSockets {
     void setAuthorization(const char * auth);
 
     int connectedClients(bool ping = false);
+    uint32_t broadcastSkipped(uint8_t num);
 
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP32)
     IPAddress remoteIP(uint8_t num);
@@ -113,13 +120,20 @@ class WebSocketsServer : protected WebSockets {
 
     bool _runnning;
 
+#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
+    bool newClient(WEBSOCKETS_NETWORK_CLASS * TCPclient, AsyncClient * asyncClient);
+#else
     bool newClient(WEBSOCKETS_NETWORK_CLASS * TCPclient);
+#endif
 
     void messageReceived(WSclient_t * client, WSopcode_t opcode, uint8_t * payload, size_t length, bool fin);
 
     void clientDisconnect(WSclient_t * client);
     bool clientIsConnected(WSclient_t * client);
 
+    bool broadcastFrame(WSopcode_t opcode, uint8_t * payload, size_t length, bool headerToPayload);
+    bool clientCanTakeBroadcast(WSclient_t * client, size_t length);
+
 #if(WEBSOCKETS_NETWORK_TYPE != NETWORK_ESP8266_ASYNC)
     void handleNewClients(void);
     void handleClientData(void);
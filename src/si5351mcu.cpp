@@ -33,6 +33,8 @@
     #include "Wire.h"
 #endif
 
+void (*Si5351mcu::busHook)(bool begin, uint8_t bytes) = nullptr;
+
 /*****************************************************************************
  * This is the default init procedure, it set the Si5351 with this params:
  * XTAL 27.000 Mhz
@@ -357,6 +359,7 @@ uint8_t Si5351mcu::i2cWriteBurst( const uint8_t start_register,
     // This method saves the massive overhead of having to keep opening
     // and closing the I2C bus for consecutive register writes.  It
     // also saves numbytes - 1 writes for register address selection.
+    if (busHook) busHook(true, 0);
     Wire.beginTransmission(SIADDR);
 
     Wire.write(start_register);
@@ -364,7 +367,9 @@ uint8_t Si5351mcu::i2cWriteBurst( const uint8_t start_register,
     // All of the bytes queued up in the above write() calls are buffered
     // up and will be sent to the slave in one "burst", on the call to
     // endTransmission().  This also sends the I2C STOP to the Slave.
-    return Wire.endTransmission();
+    uint8_t result = Wire.endTransmission();
+    if (busHook) busHook(false, numbytes + 1);
+    return result;
     // returns non zero on error
 }
 
@@ -384,6 +389,7 @@ void Si5351mcu::i2cWrite( const uint8_t regist, const uint8_t value) {
 int16_t  Si5351mcu::i2cRead( const uint8_t regist ) {
     int value;
 
+    if (busHook) busHook(true, 0);
     Wire.beginTransmission(SIADDR);
     Wire.write(regist);
     Wire.endTransmission();
@@ -395,6 +401,7 @@ int16_t  Si5351mcu::i2cRead( const uint8_t regist ) {
     else {
       value = -1;   // "EOF" in C
     }
+    if (busHook) busHook(false, 2);
 
     return value;
 }
@@ -143,6 +143,8 @@ class Si5351mcu {
         static void     i2cWrite( uint8_t reg, uint8_t val );
         static uint8_t  i2cWriteBurst( uint8_t start_register, const uint8_t *data, uint8_t numbytes );
         static int16_t  i2cRead( uint8_t reg );
+        // optional bus accounting, called before (begin) and after every transaction
+        static void (*busHook)(bool begin, uint8_t bytes);
 
         inline bool isEnabled( const uint8_t channel ) {
           return channel < SICHANNELS && clkOn[ channel ] != 0;
@@ -0,0 +1,83 @@
+#ifndef STATUSSNAPSHOT_H_
+#define STATUSSNAPSHOT_H_
+
+// Burst-read cache of the segment 0 status block (0_00 .. 0_1C).
+//
+// getVideoMode(), getStatus16SpHsStable(), runSyncWatcher(), runAutoGain() and
+// printInfo() all look at the same handful of status registers, often several
+// times per loop() pass. Each single register read is a full I2C transaction
+// (segment check, address, register, restart, data), so the whole block is read
+// once in one transaction and the registers are decoded from the local copy.
+//
+// The copy is invalidated at the start of every loop() pass and expires after
+// maxAgeMs, so code that waits for a status change (delay() loops) still sees
+// fresh data. Code that needs a guaranteed fresh value right after poking the
+// chip (interrupt resets, SOG level changes) calls invalidate() first.
+
+template <class GBS, class Attrs>
+class StatusSnapshotManager
+{
+private:
+    static const uint8_t blockStart = 0x00;
+    static const uint8_t blockSize = Attrs::blockSize;
+
+    static uint8_t data[Attrs::blockSize];
+    static bool valid;
+    static unsigned long timestamp;
+    static uint16_t maxAgeMs;
+
+    static void fetch()
+    {
+        GBS::read(0, blockStart, data, blockSize);
+        timestamp = millis();
+        valid = true;
+    }
+
+public:
+    static void invalidate()
+    {
+        valid = false;
+    }
+
+    static void setMaxAge(uint16_t ms)
+    {
+        maxAgeMs = ms;
+    }
+
+    static uint16_t getMaxAge()
+    {
+        return maxAgeMs;
+    }
+
+    // re-read the status block if it is stale, else keep the cached copy
+    static void refresh()
+    {
+        if (!valid || (millis() - timestamp) > maxAgeMs) {
+            fetch();
+        }
+    }
+
+    // decode a segment 0 status register from the snapshot
+    template <class Reg>
+    static typename Reg::Value get()
+    {
+        static_assert(Reg::segment == 0, "Snapshot only covers segment 0");
+        static_assert(Reg::byteOffset + tw::detail::byteSize(Reg::bitOffset, Reg::bitWidth) <= blockStart + blockSize,
+                      "Register outside of the snapshot block");
+        refresh();
+        return tw::detail::regDecode<Reg::bitOffset, Reg::bitWidth>(data + Reg::byteOffset - blockStart);
+    }
+};
+
+template <class GBS, class Attrs>
+uint8_t StatusSnapshotManager<GBS, Attrs>::data[Attrs::blockSize];
+
+template <class GBS, class Attrs>
+bool StatusSnapshotManager<GBS, Attrs>::valid = false;
+
+template <class GBS, class Attrs>
+unsigned long StatusSnapshotManager<GBS, Attrs>::timestamp = 0;
+
+template <class GBS, class Attrs>
+uint16_t StatusSnapshotManager<GBS, Attrs>::maxAgeMs = Attrs::maxAgeMs;
+#endif
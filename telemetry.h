@@ -0,0 +1,217 @@
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <memory>
+
+// Sync / frame lock telemetry.
+//
+// Fixed size binary records are taken at a configurable rate from values loop()
+// already has: the StatusSnapshot burst read, rto counters and the last FrameSync
+// measurement. Nothing here starts an extra vsync measurement, so watching the
+// lock does not change its timing. Records go to a RAM ring (downloadable via
+// /telemetry/download) and, batched, to subscribed WebSocket clients as binary
+// frames that start with TELEMETRY_FRAME_MAGIC (status frames start with the
+// protocol version).
+//
+// Off until asked for: /telemetry/config?rate= starts recording, a client
+// subscribes with the binary message
+//   'T', rate (records per second)   rate 0 = unsubscribe, the recording goes on
+// Only subscribed clients get frames, nobody else sees any telemetry traffic.
+
+#define TELEMETRY_RECORDS 128        // ring size, 32s at 4 records per second
+#define TELEMETRY_DEFAULT_RATE 0     // records per second, 0 = off
+#define TELEMETRY_MAX_RATE 50
+#define TELEMETRY_SEND_INTERVAL 250  // ms between WebSocket frames
+#define TELEMETRY_FRAME_MAGIC 'T'
+#define TELEMETRY_VERSION 2
+
+#define TELEMETRY_FLAG_PLLAD_LOCK 0x01
+#define TELEMETRY_FLAG_SYNC_LOCK_READY 0x02
+#define TELEMETRY_FLAG_SOURCE_DISCONNECTED 0x04
+#define TELEMETRY_FLAG_FRAME_TIME_LOCK 0x08
+
+typedef struct __attribute__((packed))
+{
+    uint32_t ms;
+    uint32_t periodInput;  // vsync period in CPU cycles, last FrameSync measurement (0 = none yet)
+    uint32_t periodOutput;
+    int32_t phase;         // output vsync behind input, CPU cycles
+    uint16_t htotal;       // STATUS_SYNC_PROC_HTOTAL
+    uint16_t vtotal;       // STATUS_SYNC_PROC_VTOTAL
+    uint16_t noSyncCounter;
+    int16_t syncLastCorrection;
+    uint8_t levelSOG;
+    uint8_t stableCounter; // rto->continousStableCounter
+    uint8_t videoMode;     // rto->videoStandardInput
+    uint8_t flags;         // TELEMETRY_FLAG_*, PLLAD_LOCK is the state at the sample
+    uint16_t plladLockChanges; // rto->plladLockChanges: lost or regained since boot, wraps
+} TelemetryRecord;
+
+// download / WebSocket header, followed by count records
+typedef struct __attribute__((packed))
+{
+    uint8_t magic;      // TELEMETRY_FRAME_MAGIC
+    uint8_t version;    // TELEMETRY_VERSION
+    uint8_t recordSize; // sizeof(TelemetryRecord)
+    uint8_t cpuMHz;     // to turn cycle counts into time
+    uint16_t count;
+} TelemetryHeader;
+
+namespace Telemetry
+{
+    TelemetryRecord ring[TELEMETRY_RECORDS];
+    uint16_t head = 0;        // next record to write
+    uint16_t count = 0;       // valid records in the ring
+    uint16_t unsent = 0;      // records not yet sent to WebSocket clients
+    uint8_t rate = TELEMETRY_DEFAULT_RATE;
+    volatile uint8_t subscribers = 0; // bit per WebSocket client
+    unsigned long lastRecord = 0;
+    unsigned long lastSend = 0;
+
+    void setRate(uint8_t recordsPerSecond)
+    {
+        rate = recordsPerSecond > TELEMETRY_MAX_RATE ? TELEMETRY_MAX_RATE : recordsPerSecond;
+    }
+
+    // client connected (a new one in the slot) or disconnected
+    void forgetClient(uint8_t num)
+    {
+        subscribers &= ~(1 << num);
+    }
+
+    // from webSocketEvent(), returns true if the message was a subscription
+    bool handleMessage(uint8_t num, const uint8_t *payload, size_t length)
+    {
+        if (length < 2 || payload[0] != TELEMETRY_FRAME_MAGIC) {
+            return false;
+        }
+        if (payload[1] == 0) {
+            forgetClient(num);
+            return true;
+        }
+        setRate(payload[1]);
+        subscribers |= (1 << num);
+        return true;
+    }
+
+    void clear()
+    {
+        head = count = unsent = 0;
+    }
+
+    static void fillHeader(TelemetryHeader &h, uint16_t n)
+    {
+        h.magic = TELEMETRY_FRAME_MAGIC;
+        h.version = TELEMETRY_VERSION;
+        h.recordSize = sizeof(TelemetryRecord);
+        h.cpuMHz = ESP.getCpuFreqMHz();
+        h.count = n;
+    }
+
+    // copies the newest n records (oldest first) behind a header, returns the byte size
+    size_t copyNewest(uint8_t *out, uint16_t n)
+    {
+        if (n > count) {
+            n = count;
+        }
+        fillHeader(*(TelemetryHeader *)out, n);
+        uint8_t *p = out + sizeof(TelemetryHeader);
+        uint16_t index = (head + TELEMETRY_RECORDS - n) % TELEMETRY_RECORDS;
+        for (uint16_t i = 0; i < n; i++) {
+            memcpy(p, &ring[index], sizeof(TelemetryRecord));
+            p += sizeof(TelemetryRecord);
+            index = (index + 1) % TELEMETRY_RECORDS;
+        }
+        return p - out;
+    }
+
+    void record()
+    {
+        TelemetryRecord &r = ring[head];
+        r.ms = millis();
+        r.periodInput = FrameSync::getLastPeriodInput();
+        r.periodOutput = FrameSync::getLastPeriodOutput();
+        r.phase = FrameSync::getLastPhase();
+        r.htotal = StatusSnapshot::get<GBS::STATUS_SYNC_PROC_HTOTAL>();
+        r.vtotal = StatusSnapshot::get<GBS::STATUS_SYNC_PROC_VTOTAL>();
+        r.noSyncCounter = rto->noSyncCounter;
+        r.syncLastCorrection = FrameSync::getSyncLastCorrection();
+        r.levelSOG = rto->currentLevelSOG;
+        r.stableCounter = rto->continousStableCounter;
+        r.videoMode = rto->videoStandardInput;
+        r.plladLockChanges = rto->plladLockChanges;
+        r.flags = 0;
+        if (StatusSnapshot::get<GBS::STATUS_MISC_PLLAD_LOCK>()) {
+            r.flags |= TELEMETRY_FLAG_PLLAD_LOCK;
+        }
+        if (FrameSync::ready()) {
+            r.flags |= TELEMETRY_FLAG_SYNC_LOCK_READY;
+        }
+        if (rto->sourceDisconnected) {
+            r.flags |= TELEMETRY_FLAG_SOURCE_DISCONNECTED;
+        }
+        if (uopt->enableFrameTimeLock) {
+            r.flags |= TELEMETRY_FLAG_FRAME_TIME_LOCK;
+        }
+
+        head = (head + 1) % TELEMETRY_RECORDS;
+        if (count < TELEMETRY_RECORDS) {
+            count++;
+        }
+        if (unsent < TELEMETRY_RECORDS) {
+            unsent++;
+        }
+    }
+
+    // called once per loop() pass
+    void run()
+    {
+        if (rate == 0) {
+            return;
+        }
+        if ((millis() - lastRecord) >= (1000u / rate)) {
+            lastRecord = millis();
+            record();
+        }
+
+        if (unsent > 0 && (millis() - lastSend) >= TELEMETRY_SEND_INTERVAL) {
+            lastSend = millis();
+            uint8_t to = subscribers;
+            if (to) {
+                // TELEMETRY_MAX_RATE * TELEMETRY_SEND_INTERVAL / 1000 records fit
+                uint8_t frame[sizeof(TelemetryHeader) + 16 * sizeof(TelemetryRecord)];
+                uint16_t n = unsent > 16 ? 16 : unsent;
+                size_t size = copyNewest(frame, n);
+                for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+                    if (to & (1 << num)) {
+                        webSocket.sendBIN(num, frame, size);
+                    }
+                }
+            }
+            unsent = 0;
+        }
+    }
+
+    // whole ring, oldest record first
+    AsyncWebServerResponse *beginDownload(AsyncWebServerRequest *request)
+    {
+        size_t size = sizeof(TelemetryHeader) + count * sizeof(TelemetryRecord);
+        std::shared_ptr<uint8_t> copy((uint8_t *)malloc(size), free);
+        if (!copy) {
+            return request->beginResponse(503);
+        }
+        copyNewest(copy.get(), count);
+        AsyncWebServerResponse *response = request->beginResponse("application/octet-stream", size,
+            [copy, size](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                size_t n = size - index;
+                if (n > maxLen) {
+                    n = maxLen;
+                }
+                memcpy(buffer, copy.get() + index, n);
+                return n;
+            });
+        response->addHeader("Content-Disposition", "attachment; filename=\"telemetry.bin\"");
+        return response;
+    }
+} // namespace Telemetry
+#endif
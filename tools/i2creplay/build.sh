@@ -0,0 +1,7 @@
+#!/usr/bin/env bash
+# builds the host I2C trace replay tool (i2creplay.cpp) next to this script, on the
+# host HAL (native/hal)
+
+cd "$(dirname "$0")"
+${CXX:-g++} -std=c++17 -O2 -Wall -DGBS_NATIVE -I../../native/hal -I../.. \
+    i2creplay.cpp ../../native/hal/hal.cpp -o i2creplay && echo "i2creplay BUILT"
@@ -0,0 +1,336 @@
+// Host replay of GBS register traces captured with /trace (i2ctrace.h).
+//
+//   ./build.sh && ./i2creplay dump TRACE
+//                 ./i2creplay modes TRACE [-v]
+//
+// dump lists the records: time, direction, segment_register, register name and data.
+//
+// modes runs the firmware's mode detection (modedetect.h: getVideoMode(),
+// getStatus16SpHsStable()) against the captured chip. Each status block read in the
+// trace (what StatusSnapshot fetches once per loop() pass) starts one pass at the
+// time it was recorded. Reads the code makes are answered from the next matching
+// read in the trace, within REPLAY_MATCH_WINDOW_US; that also moves the trace
+// forward, so the code sees the status changes at the time they happened. Reads
+// without a match get the last value the trace showed for that register, writes
+// from the code change the replayed registers.
+//
+// The bus and the clock are the host HAL's (native/hal): the replayed chip answers at
+// GBS_ADDR in place of the emulated one (Native::gbsWrite/gbsRead), time is the
+// virtual clock. delay() and the transfers themselves (at 400kHz, as setup() sets
+// it) move it, after a delay() the trace catches up before the next transfer.
+//
+// Output is one line per change of the detected mode, sync stability or input, then a
+// summary: passes, mode changes, unstable time, how many reads the trace answered
+// and the host time per pass, for comparing detection changes on the same capture.
+// -v prints every pass.
+//
+// rto->videoStandardInput follows the detected mode after REPLAY_MODE_CONFIRM equal
+// passes, a simplified version of what runSyncWatcher() does with it.
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <Arduino.h>
+#include <Wire.h>
+#include <native.h>
+#include "i2ctrace.h"
+#include "tv5725.h"
+#include "options.h"
+#include "statussnapshot.h"
+
+#define REPLAY_MATCH_WINDOW_US 100000 // a read may be answered by one this far ahead
+#define REPLAY_MODE_CONFIRM 3
+#define REPLAY_SEGMENTS 8
+
+typedef TV5725<GBS_ADDR> GBS;
+
+// as in gbs-control.ino
+struct StatusSnapshotAttrs
+{
+    static const uint8_t blockSize = 0x1D;
+    static const uint16_t maxAgeMs = 5;
+};
+typedef StatusSnapshotManager<GBS, StatusSnapshotAttrs> StatusSnapshot;
+
+struct runTimeOptions rtos;
+struct runTimeOptions *rto = &rtos;
+
+#include "modedetect.h"
+#include "tv5725_names.h"
+
+struct Record
+{
+    uint64_t us;
+    bool write;
+    uint8_t segment;
+    uint8_t reg;
+    std::vector<uint8_t> data;
+};
+
+static std::vector<Record> trace;
+static size_t cursor = 0; // next record not yet applied
+static uint8_t regs[REPLAY_SEGMENTS][256];
+static uint8_t codeSegment = I2CTRACE_SEGMENT_UNKNOWN; // selected by the code under test
+static uint32_t readsServed = 0, readsUnmatched = 0, codeWrites = 0;
+
+static uint64_t nowUs()
+{
+    return Native::nowNs / 1000;
+}
+
+static void apply(const Record &r)
+{
+    if (r.segment < REPLAY_SEGMENTS && r.reg != I2CTRACE_SEGMENT_REGISTER) {
+        for (size_t i = 0; i < r.data.size(); i++) {
+            regs[r.segment][(uint8_t)(r.reg + i)] = r.data[i];
+        }
+    }
+}
+
+// applies records up to and including index
+static void advanceTo(size_t index)
+{
+    while (cursor <= index && cursor < trace.size()) {
+        apply(trace[cursor]);
+        if (trace[cursor].us > nowUs()) {
+            Native::nowNs = trace[cursor].us * 1000;
+        }
+        cursor++;
+    }
+}
+
+// after a delay(): applies what the chip did meanwhile. The transfers' own bus time
+// doesn't, their reads match the trace records at that time instead.
+static void catchUp()
+{
+    static uint64_t delayNs = 0; // Native::stats.delayNs at the last catch up
+    if (Native::stats.delayNs == delayNs) {
+        return;
+    }
+    delayNs = Native::stats.delayNs;
+    while (cursor < trace.size() && trace[cursor].us <= nowUs()) {
+        advanceTo(cursor);
+    }
+}
+
+static void replayWrite(uint8_t reg, const uint8_t *data, uint16_t size)
+{
+    catchUp();
+    if (reg == I2CTRACE_SEGMENT_REGISTER) {
+        codeSegment = data[0] < REPLAY_SEGMENTS ? data[0] : I2CTRACE_SEGMENT_UNKNOWN;
+        return;
+    }
+    codeWrites++;
+    if (codeSegment < REPLAY_SEGMENTS) {
+        for (uint16_t i = 0; i < size; i++) {
+            regs[codeSegment][(uint8_t)(reg + i)] = data[i];
+        }
+    }
+}
+
+static void replayRead(uint8_t reg, uint8_t *data, uint16_t size)
+{
+    catchUp();
+    if (reg == I2CTRACE_SEGMENT_REGISTER) {
+        memset(data, codeSegment, size);
+        return;
+    }
+    bool matched = false;
+    for (size_t i = cursor; i < trace.size() && trace[i].us <= nowUs() + REPLAY_MATCH_WINDOW_US; i++) {
+        const Record &r = trace[i];
+        if (!r.write && r.segment == codeSegment && r.reg == reg && r.data.size() == size) {
+            advanceTo(i);
+            matched = true;
+            break;
+        }
+    }
+    matched ? readsServed++ : readsUnmatched++;
+    for (uint16_t i = 0; i < size; i++) {
+        data[i] = codeSegment < REPLAY_SEGMENTS ? regs[codeSegment][(uint8_t)(reg + i)] : 0;
+    }
+}
+
+static bool load(const char *path, I2CTraceHeader &header)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    std::vector<uint8_t> bytes;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        bytes.insert(bytes.end(), buf, buf + n);
+    }
+    fclose(f);
+    if (bytes.size() < sizeof(header)) {
+        fprintf(stderr, "%s: too short\n", path);
+        return false;
+    }
+    memcpy(&header, bytes.data(), sizeof(header));
+    if (header.magic != I2CTRACE_MAGIC || header.version != I2CTRACE_VERSION ||
+        header.bytes > bytes.size() - sizeof(header)) {
+        fprintf(stderr, "%s: not an i2ctrace version %u file\n", path, I2CTRACE_VERSION);
+        return false;
+    }
+
+    const uint8_t *p = bytes.data() + sizeof(header);
+    const uint8_t *end = p + header.bytes;
+    uint64_t us = header.startUs;
+    while (end - p >= 4) {
+        Record r;
+        r.write = p[0] & I2CTRACE_WRITE;
+        r.segment = p[0] & I2CTRACE_SEGMENT_MASK;
+        r.reg = p[1];
+        uint8_t size = p[2];
+        p += 3;
+        uint64_t delta = 0;
+        for (uint8_t shift = 0; p < end; shift += 7) {
+            uint8_t b = *p++;
+            delta |= (uint64_t)(b & 0x7f) << shift;
+            if (!(b & 0x80)) {
+                break;
+            }
+        }
+        if (end - p < size) {
+            fprintf(stderr, "%s: truncated record\n", path);
+            break;
+        }
+        us += delta;
+        r.us = us;
+        r.data.assign(p, p + size);
+        p += size;
+        trace.push_back(r);
+    }
+    return true;
+}
+
+static const char *registerName(uint8_t segment, uint8_t offset)
+{
+    for (uint16_t i = 0; i < REGISTER_NAMES_COUNT; i++) {
+        if (registerNames[i].segment == segment && registerNames[i].byteOffset == offset) {
+            return registerNames[i].name;
+        }
+    }
+    return offset == I2CTRACE_SEGMENT_REGISTER ? "SEGMENT" : "";
+}
+
+static int dump()
+{
+    uint64_t start = trace.empty() ? 0 : trace[0].us;
+    for (const Record &r : trace) {
+        printf("%10.3f %c %u_%02x %-28s", (r.us - start) / 1000.0, r.write ? 'W' : 'R', r.segment, r.reg,
+               registerName(r.segment, r.reg));
+        for (uint8_t b : r.data) {
+            printf(" %02x", b);
+        }
+        printf("\n");
+    }
+    return 0;
+}
+
+static int modes(bool verbose)
+{
+    uint64_t start = trace.empty() ? 0 : trace[0].us;
+    uint32_t passes = 0, modeChanges = 0, unstablePasses = 0;
+    uint64_t unstableSince = 0, unstableUs = 0, longestUnstableUs = 0, hostNs = 0, maxHostNs = 0;
+    uint8_t lastMode = 0xff, lastInput = 0, candidate = 0, candidatePasses = 0;
+    bool lastStable = false, unstable = false;
+
+    printf("time(ms)   mode  stable  input\n");
+    for (size_t k = 0; k < trace.size(); k++) {
+        const Record &r = trace[k];
+        if (r.write || r.segment != 0 || r.reg != 0 || r.data.size() != StatusSnapshotAttrs::blockSize || k < cursor) {
+            continue;
+        }
+        // one loop() pass, starting when this status read happened
+        if (k > 0) {
+            advanceTo(k - 1);
+        }
+        Native::nowNs = r.us * 1000;
+        StatusSnapshot::invalidate();
+        auto t0 = std::chrono::steady_clock::now();
+        uint8_t mode = getVideoMode();
+        bool stable = getStatus16SpHsStable();
+        uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0).count();
+        hostNs += ns;
+        maxHostNs = ns > maxHostNs ? ns : maxHostNs;
+        passes++;
+
+        if (mode != 0 && mode != rto->videoStandardInput) {
+            candidatePasses = (mode == candidate) ? candidatePasses + 1 : 1;
+            candidate = mode;
+            if (candidatePasses >= REPLAY_MODE_CONFIRM) {
+                rto->videoStandardInput = mode;
+            }
+        } else {
+            candidatePasses = 0;
+        }
+
+        bool bad = mode == 0 || !stable;
+        if (bad) {
+            unstablePasses++;
+            if (!unstable) {
+                unstableSince = nowUs();
+            }
+        } else if (unstable) {
+            uint64_t took = nowUs() - unstableSince;
+            unstableUs += took;
+            longestUnstableUs = took > longestUnstableUs ? took : longestUnstableUs;
+        }
+        unstable = bad;
+
+        if (verbose || mode != lastMode || stable != lastStable || rto->videoStandardInput != lastInput) {
+            if (mode != lastMode && lastMode != 0xff) {
+                modeChanges++;
+            }
+            printf("%10.3f %-5u %-7s %u\n", (nowUs() - start) / 1000.0, mode, stable ? "yes" : "no", rto->videoStandardInput);
+            lastMode = mode;
+            lastStable = stable;
+            lastInput = rto->videoStandardInput;
+        }
+    }
+    if (unstable) {
+        uint64_t took = nowUs() - unstableSince;
+        unstableUs += took;
+        longestUnstableUs = took > longestUnstableUs ? took : longestUnstableUs;
+    }
+
+    printf("passes %u, mode changes %u, unstable passes %u (%.1f ms, longest %.1f ms)\n", passes, modeChanges,
+           unstablePasses, unstableUs / 1000.0, longestUnstableUs / 1000.0);
+    printf("reads answered by the trace %u, not in the trace %u, writes %u\n", readsServed, readsUnmatched, codeWrites);
+    printf("host time per pass %.2f us, max %.2f us\n", passes ? hostNs / 1000.0 / passes : 0.0, maxHostNs / 1000.0);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s dump|modes TRACE [-v]\n", argv[0]);
+        return 2;
+    }
+    std::string command = argv[1];
+    bool verbose = argc > 3 && std::string(argv[3]) == "-v";
+    I2CTraceHeader header;
+    if (!load(argv[2], header)) {
+        return 1;
+    }
+    fprintf(stderr, "%zu records, %u dropped before the first, filter %s\n", trace.size(), header.dropped,
+            header.filter == I2CTraceStatus ? "status" : "all");
+    memset(regs, 0, sizeof(regs));
+    rto->videoStandardInput = 0;
+    Native::gbsWrite = replayWrite;
+    Native::gbsRead = replayRead;
+    Native::pollNs = 0; // reading the clock takes no trace time
+    Wire.setClock(400000);
+
+    if (command == "dump") {
+        return dump();
+    }
+    if (command == "modes") {
+        return modes(verbose);
+    }
+    fprintf(stderr, "unknown command %s\n", command.c_str());
+    return 2;
+}
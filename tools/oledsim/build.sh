@@ -0,0 +1,8 @@
+#!/usr/bin/env bash
+# builds the host OLED menu simulator (oledsim.cpp) next to this script, with the
+# firmware's menu code on the host HAL (native/hal)
+
+cd "$(dirname "$0")"
+${CXX:-g++} -std=c++17 -O2 -Wall -DGBS_NATIVE -Istubs -I../../native/hal -I../.. -include stubs/websockets.h \
+    ../../OLEDMenuManager.cpp ../../OLEDMenuItem.cpp ../../OLEDMenuImplementation.cpp ../../OSDManager.cpp \
+    ../../native/hal/hal.cpp oledsim.cpp -o oledsim && echo "oledsim BUILT"
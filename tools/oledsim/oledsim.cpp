@@ -0,0 +1,368 @@
+// Host simulator for the OLED menu.
+//
+// Runs the real OLEDMenuManager / OLEDMenuItem code against a memory framebuffer
+// (stubs/SSD1306Wire.h), drives tick() with a scripted key sequence and reports
+// per frame what would go over I2C and how long the drawing took. With -o every
+// frame the panel changed on is written as a PNG, with -c the frames are compared
+// against an earlier -o run (exit code 1 on any difference), so rendering changes
+// can be checked and measured before flashing.
+//
+//   ./build.sh && ./oledsim [-s SCRIPT] [-t STEP_MS] [-x SCALE] [-o DIR] [-c DIR]
+//
+// SCRIPT is a list of keys, each optionally followed by a repeat count:
+//   u / d = rotary encoder up / down, e = enter, i = idle (no key)
+// One key is one tick, the simulated clock advances STEP_MS (default 10) per tick.
+//
+// The menu and its handlers are the firmware's own (OLEDMenuImplementation.cpp,
+// OSDManager.cpp), on the host HAL (native/hal): the clock is its virtual clock and
+// the TV5725 the emulated one. This file only stands in for what the handlers read
+// and call in gbs-control.ino: rto/uopt, applyPresets() and friends, the WiFi state
+// and a slots file with three presets.
+//
+// Bytes per frame are counted as BusSSD1306Wire (busarbiter.h) sends them: the
+// changed columns per page, each segment with its window command and one control
+// byte per 16 data bytes. "full" is what an unbuffered display() would send.
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include <FS.h>
+#include <ESP8266WiFi.h>
+#include <native.h>
+#include "OLEDMenuImplementation.h"
+#include "OSDManager.h"
+#include "options.h"
+#include "tv5725.h"
+#include "slot.h"
+namespace full
+{
+#include "fonts.h"
+}
+
+#define SIM_BURST_BYTES 16 // BUS_OLED_BURST_BYTES
+#define SIM_WINDOW_BYTES 7 // control byte + COLUMNADDR, PAGEADDR
+#define SIM_FULL_FRAME_BYTES (128 * 64 / 8)
+
+// stand-ins for the library fonts
+extern const uint8_t *const ArialMT_Plain_10 = full::DejaVu_Sans_Mono_10;
+extern const uint8_t *const ArialMT_Plain_16 = full::URW_Gothic_L_Book_14;
+
+struct FrameCost
+{
+    uint32_t pushes;   // display() calls
+    uint32_t segments; // changed page spans
+    uint32_t data;     // pixel bytes
+    uint32_t bus;      // data + window commands + control bytes
+};
+
+static uint8_t panel[SIM_FULL_FRAME_BYTES]; // what is on the screen
+static FrameCost frame;
+
+void simDisplay(OLEDDisplay *display)
+{
+    frame.pushes++;
+    for (uint8_t page = 0; page < 8; page++) {
+        const uint8_t *now = display->buffer + page * 128;
+        uint8_t *shown = panel + page * 128;
+        int16_t first = -1, last = -1;
+        for (uint8_t x = 0; x < 128; x++) {
+            if (now[x] != shown[x]) {
+                if (first < 0) {
+                    first = x;
+                }
+                last = x;
+            }
+        }
+        if (first < 0) {
+            continue;
+        }
+        uint16_t span = last - first + 1;
+        frame.segments++;
+        frame.data += span;
+        frame.bus += SIM_WINDOW_BYTES + span + (span + SIM_BURST_BYTES - 1) / SIM_BURST_BYTES;
+        memcpy(shown + first, now + first, span);
+    }
+}
+
+// ---- PNG, 8 bit grey, stored (uncompressed) deflate blocks ----
+
+static uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (uint8_t k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+static void put32(std::vector<uint8_t> &out, uint32_t v)
+{
+    out.push_back(v >> 24);
+    out.push_back(v >> 16);
+    out.push_back(v >> 8);
+    out.push_back(v);
+}
+
+static void chunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data)
+{
+    put32(out, data.size());
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    put32(out, crc32(out.data() + start, out.size() - start));
+}
+
+static std::vector<uint8_t> encodePng(uint8_t scale)
+{
+    const uint32_t w = 128 * scale, h = 64 * scale;
+    std::vector<uint8_t> raw;
+    for (uint32_t y = 0; y < h; y++) {
+        raw.push_back(0); // filter: none
+        for (uint32_t x = 0; x < w; x++) {
+            uint16_t px = x / scale, py = y / scale;
+            raw.push_back(panel[px + (py / 8) * 128] & (1 << (py & 7)) ? 0xff : 0x00);
+        }
+    }
+    std::vector<uint8_t> z = {0x78, 0x01};
+    uint32_t a = 1, b = 0;
+    for (size_t pos = 0; pos < raw.size();) {
+        uint16_t n = raw.size() - pos > 0xffff ? 0xffff : raw.size() - pos;
+        z.push_back(pos + n == raw.size());
+        z.push_back(n);
+        z.push_back(n >> 8);
+        z.push_back(~n);
+        z.push_back(~n >> 8);
+        for (uint16_t i = 0; i < n; i++) {
+            a = (a + raw[pos + i]) % 65521;
+            b = (b + a) % 65521;
+        }
+        z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + n);
+        pos += n;
+    }
+    put32(z, (b << 16) | a);
+
+    std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    std::vector<uint8_t> ihdr;
+    put32(ihdr, w);
+    put32(ihdr, h);
+    ihdr.insert(ihdr.end(), {8, 0, 0, 0, 0}); // 8 bit grey
+    chunk(png, "IHDR", ihdr);
+    chunk(png, "IDAT", z);
+    chunk(png, "IEND", {});
+    return png;
+}
+
+static bool writeFile(const std::string &path, const std::vector<uint8_t> &data)
+{
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (!fp) {
+        return false;
+    }
+    bool ok = fwrite(data.data(), 1, data.size(), fp) == data.size();
+    fclose(fp);
+    return ok;
+}
+
+static bool sameAsFile(const std::string &path, const std::vector<uint8_t> &data)
+{
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (!fp) {
+        return false;
+    }
+    std::vector<uint8_t> old(data.size() + 1);
+    size_t n = fread(old.data(), 1, old.size(), fp);
+    fclose(fp);
+    return n == data.size() && memcmp(old.data(), data.data(), n) == 0;
+}
+
+// ---- what the menu handlers (OLEDMenuImplementation.cpp) read and call ----
+
+SSD1306Wire display(0x3c, 0, 0);
+OLEDMenuManager oledMenu(&display);
+OSDManager osdManager;
+WebSocketsServer webSocket;
+static runTimeOptions rtos;
+static userOptions uopts;
+runTimeOptions *rto = &rtos;
+userOptions *uopt = &uopts;
+const char *ap_ssid = "gbscontrol";
+const char *ap_password = "qqqqqqqq";
+const char *device_hostname_full = "gbscontrol.local";
+
+// the preset ID the chip reports for a preference, as the presets set it (the
+// stored presets are all 1280x960 ones)
+void applyPresets(uint8_t)
+{
+    static const uint8_t ids[] = {0x01, 0x04, 0x01, 0x03, 0x02, 0x05, 0x06};
+    uint8_t preference = uopt->presetPreference;
+    GBS::GBS_PRESET_ID::write(preference < sizeof(ids) ? ids[preference] : 0x01);
+}
+void setOutModeHdBypass(bool) { GBS::GBS_PRESET_ID::write(0x21); }
+void saveUserPrefs() {}
+void loadDefaultUserOptions() {}
+float getOutputFrameRate() { return 59.94006f; }
+uint8_t getVideoMode() { return rto->videoStandardInput; }
+void shiftHorizontalRight() {}
+void shiftHorizontalLeft() {}
+void shiftVerticalDownIF() {}
+void shiftVerticalUpIF() {}
+void scaleVertical(uint16_t, bool) {}
+void scaleHorizontal(uint16_t, bool) {}
+
+// a connected NTSC source, the device on a home network, three stored presets
+static bool setUpDevice()
+{
+    rto->boardHasPower = true;
+    rto->sourceDisconnected = false;
+    rto->videoStandardInput = 1;
+    GBS::ADC_INPUT_SEL::write(1);
+    GBS::GBS_PRESET_ID::write(0x01);
+    // HS and VS active, a read only status register on the emulated chip
+    typedef GBS::STATUS_16 Status;
+    Native::Tv5725::regs[Status::segment][Status::byteOffset] = 0x0a;
+
+    WiFi.mode = WIFI_STA;
+    WiFi.ssid = "gbscontrol-test";
+    WiFi.connected = true;
+    WiFi.ip = IPAddress(192, 168, 1, 123);
+
+    char dir[] = "/tmp/oledsim-XXXXXX";
+    if (!mkdtemp(dir)) {
+        return false;
+    }
+    Native::spiffsDir = dir;
+    static const char *names[] = {"Arcade", "Saturn 240p", "A preset name to scroll"};
+    SlotMetaArray slots;
+    memset(&slots, 0, sizeof(slots));
+    for (uint8_t i = 0; i < SLOTS_TOTAL; i++) {
+        strcpy(slots.slot[i].name, i < 3 ? names[i] : EMPTY_SLOT_NAME);
+        slots.slot[i].slot = i;
+    }
+    File f = SPIFFS.open(SLOTS_FILE, "w");
+    if (!f) {
+        return false;
+    }
+    f.write((const uint8_t *)&slots, sizeof(slots));
+    f.close();
+    return true;
+}
+
+// walks every menu, lets the long items scroll, opens the handlers
+static const char *defaultScript =
+    "i10 "
+    "d e i5 d6 i5 e i110 d e i5 "   // resolutions: page down, load passthrough, back
+    "d e i5 d2 i200 e i210 d e i5 "  // presets: long name scrolls, load it, back
+    "d e i5 d3 i200 d2 e i5 "        // wifi info: scrolling URL, back
+    "d e i60 u i5 "                  // current settings, any key leaves
+    "d e i5 e i210 d e i5 "          // reset menu: reset GBS, back
+    "i30";
+
+int main(int argc, char **argv)
+{
+    const char *script = defaultScript;
+    unsigned long stepMs = 10;
+    uint8_t scale = 2;
+    std::string outDir, compareDir;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string opt = argv[i];
+        if (opt == "-s") {
+            script = argv[i + 1];
+        } else if (opt == "-t") {
+            stepMs = strtoul(argv[i + 1], nullptr, 0);
+        } else if (opt == "-x") {
+            scale = atoi(argv[i + 1]);
+        } else if (opt == "-o") {
+            outDir = argv[i + 1];
+        } else if (opt == "-c") {
+            compareDir = argv[i + 1];
+        } else {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    if (!setUpDevice()) {
+        fprintf(stderr, "can't write the slots file\n");
+        return 2;
+    }
+    Native::nowNs = 1000000000ull;
+    Native::pollNs = 0; // the clock only moves per tick, as in the firmware's loop
+    initOLEDMenu();
+    initOSD();
+    uint32_t step = 0, frames = 0, differences = 0;
+    uint64_t totalBus = 0, totalUs = 0;
+    uint32_t maxBus = 0, maxUs = 0;
+    printf("step   key  ms      pushes segments data  bus   full  draw(us)\n");
+    for (const char *p = script; *p;) {
+        char key = *p++;
+        if (key == ' ') {
+            continue;
+        }
+        uint32_t repeat = 1;
+        if (*p >= '0' && *p <= '9') {
+            repeat = strtoul(p, (char **)&p, 10);
+        }
+        OLEDMenuNav nav = OLEDMenuNav::IDLE;
+        switch (key) {
+            case 'u':
+                nav = OLEDMenuNav::UP;
+                break;
+            case 'd':
+                nav = OLEDMenuNav::DOWN;
+                break;
+            case 'e':
+                nav = OLEDMenuNav::ENTER;
+                break;
+            case 'i':
+                break;
+            default:
+                fprintf(stderr, "unknown key '%c'\n", key);
+                return 2;
+        }
+        for (uint32_t r = 0; r < repeat; r++, step++) {
+            Native::nowNs += stepMs * 1000000ull;
+            frame = FrameCost();
+            auto start = std::chrono::steady_clock::now();
+            oledMenu.tick(nav);
+            uint32_t us = std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+            if (frame.pushes == 0) {
+                continue;
+            }
+            frames++;
+            totalBus += frame.bus;
+            totalUs += us;
+            maxBus = frame.bus > maxBus ? frame.bus : maxBus;
+            maxUs = us > maxUs ? us : maxUs;
+            printf("%-6u %-4c %-7lu %-6u %-8u %-5u %-5u %-5u %u\n", step, key, millis(),
+                   frame.pushes, frame.segments, frame.data, frame.bus,
+                   frame.pushes * SIM_FULL_FRAME_BYTES, us);
+            if (frame.segments == 0 || (outDir.empty() && compareDir.empty())) {
+                continue;
+            }
+            char name[32];
+            snprintf(name, sizeof(name), "/frame_%05u.png", step);
+            std::vector<uint8_t> png = encodePng(scale);
+            if (outDir.size() && !writeFile(outDir + name, png)) {
+                fprintf(stderr, "can't write %s%s\n", outDir.c_str(), name);
+                return 2;
+            }
+            if (compareDir.size() && !sameAsFile(compareDir + name, png)) {
+                printf("  differs from %s%s\n", compareDir.c_str(), name);
+                differences++;
+            }
+        }
+    }
+    printf("%u frames, bus bytes avg %llu max %u, draw avg %lluus max %uus\n", frames,
+           frames ? (unsigned long long)(totalBus / frames) : 0ull, maxBus,
+           frames ? (unsigned long long)(totalUs / frames) : 0ull, maxUs);
+    if (compareDir.size()) {
+        printf("%u frames differ\n", differences);
+    }
+    return differences ? 1 : 0;
+}
@@ -0,0 +1,239 @@
+#ifndef OLEDSIM_SSD1306WIRE_H_
+#define OLEDSIM_SSD1306WIRE_H_
+
+// Host stand-in for the ThingPulse SSD1306 driver (4.4.0). Drawing follows the
+// library: page major framebuffer, the same font format and text alignment,
+// drawXbm() semantics and colors. display() doesn't talk to a panel, it hands the
+// frame to the simulator (oledsim.cpp). The Arduino API comes from native/hal.
+
+#include <Arduino.h>
+
+#define OLEDDISPLAY_DOUBLE_BUFFER // as the library's default
+
+enum OLEDDISPLAY_COLOR {
+    BLACK = 0,
+    WHITE = 1,
+    INVERSE = 2
+};
+
+enum OLEDDISPLAY_TEXT_ALIGNMENT {
+    TEXT_ALIGN_LEFT = 0,
+    TEXT_ALIGN_RIGHT = 1,
+    TEXT_ALIGN_CENTER = 2,
+    TEXT_ALIGN_CENTER_BOTH = 3
+};
+
+// the library's own fonts, oledsim.cpp maps them to fonts of this repo
+extern const uint8_t *const ArialMT_Plain_10;
+extern const uint8_t *const ArialMT_Plain_16;
+
+class OLEDDisplay;
+// called by display() with the framebuffer as it would go to the panel
+extern void simDisplay(OLEDDisplay *display);
+
+class OLEDDisplay
+{
+protected:
+    OLEDDISPLAY_COLOR color = WHITE;
+    OLEDDISPLAY_TEXT_ALIGNMENT textAlignment = TEXT_ALIGN_LEFT;
+    const uint8_t *fontData = nullptr;
+
+    void drawGlyph(int16_t xMove, int16_t yMove, int16_t height, const uint8_t *data, uint8_t size)
+    {
+        uint8_t rasterHeight = 1 + ((height - 1) >> 3);
+        for (uint16_t i = 0; i < size; i++) {
+            uint8_t bits = pgm_read_byte(data + i);
+            int16_t x = xMove + i / rasterHeight;
+            int16_t y = yMove + (i % rasterHeight) * 8;
+            for (uint8_t b = 0; b < 8; b++) {
+                if (bits & (1 << b)) {
+                    setPixel(x, y + b);
+                }
+            }
+        }
+    }
+
+    void drawLine(int16_t xMove, int16_t yMove, const char *text, uint16_t length)
+    {
+        uint8_t textHeight = pgm_read_byte(fontData + 1);
+        uint8_t firstChar = pgm_read_byte(fontData + 2);
+        uint16_t jumpTableSize = pgm_read_byte(fontData + 3) * 4;
+        uint16_t textWidth = getStringWidth(text, length);
+        switch (textAlignment) {
+            case TEXT_ALIGN_CENTER_BOTH:
+                yMove -= textHeight >> 1;
+                // fallthrough
+            case TEXT_ALIGN_CENTER:
+                xMove -= textWidth >> 1;
+                break;
+            case TEXT_ALIGN_RIGHT:
+                xMove -= textWidth;
+                break;
+            default:
+                break;
+        }
+        int16_t cursorX = 0;
+        for (uint16_t j = 0; j < length; j++) {
+            uint8_t code = text[j];
+            if (code < firstChar) {
+                continue;
+            }
+            const uint8_t *entry = fontData + 4 + (code - firstChar) * 4;
+            uint8_t msb = pgm_read_byte(entry), lsb = pgm_read_byte(entry + 1);
+            if (!(msb == 0xff && lsb == 0xff)) {
+                drawGlyph(xMove + cursorX, yMove, textHeight,
+                          fontData + 4 + jumpTableSize + ((msb << 8) | lsb), pgm_read_byte(entry + 2));
+            }
+            cursorX += pgm_read_byte(entry + 3);
+        }
+    }
+
+public:
+    uint8_t buffer[128 * 64 / 8];
+
+    OLEDDisplay()
+    {
+        clear();
+    }
+    virtual ~OLEDDisplay() {}
+
+    int16_t width() const
+    {
+        return 128;
+    }
+    int16_t height() const
+    {
+        return 64;
+    }
+
+    void clear()
+    {
+        memset(buffer, 0, sizeof(buffer));
+    }
+
+    void setColor(OLEDDISPLAY_COLOR c)
+    {
+        color = c;
+    }
+
+    void setPixel(int16_t x, int16_t y)
+    {
+        if (x < 0 || x >= width() || y < 0 || y >= height()) {
+            return;
+        }
+        uint8_t &b = buffer[x + (y / 8) * width()];
+        switch (color) {
+            case WHITE:
+                b |= 1 << (y & 7);
+                break;
+            case BLACK:
+                b &= ~(1 << (y & 7));
+                break;
+            case INVERSE:
+                b ^= 1 << (y & 7);
+                break;
+        }
+    }
+
+    bool getPixel(int16_t x, int16_t y) const
+    {
+        return buffer[x + (y / 8) * 128] & (1 << (y & 7));
+    }
+
+    void fillRect(int16_t xMove, int16_t yMove, int16_t w, int16_t h)
+    {
+        for (int16_t y = yMove; y < yMove + h; y++) {
+            for (int16_t x = xMove; x < xMove + w; x++) {
+                setPixel(x, y);
+            }
+        }
+    }
+
+    void drawXbm(int16_t xMove, int16_t yMove, int16_t w, int16_t h, const uint8_t *xbm)
+    {
+        int16_t rowBytes = (w + 7) / 8;
+        uint8_t data = 0;
+        for (int16_t y = 0; y < h; y++) {
+            for (int16_t x = 0; x < w; x++) {
+                if (x & 7) {
+                    data >>= 1;
+                } else {
+                    data = pgm_read_byte(xbm + (x / 8) + y * rowBytes);
+                }
+                if (data & 0x01) {
+                    setPixel(xMove + x, yMove + y);
+                }
+            }
+        }
+    }
+
+    void setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT alignment)
+    {
+        textAlignment = alignment;
+    }
+
+    void setFont(const uint8_t *font)
+    {
+        fontData = font;
+    }
+
+    uint16_t getStringWidth(const char *text, uint16_t length)
+    {
+        uint8_t firstChar = pgm_read_byte(fontData + 2);
+        uint16_t w = 0;
+        for (uint16_t j = 0; j < length; j++) {
+            uint8_t code = text[j];
+            if (code >= firstChar) {
+                w += pgm_read_byte(fontData + 4 + (code - firstChar) * 4 + 3);
+            }
+        }
+        return w;
+    }
+
+    // the library takes a String, a null item->str (image items) becomes ""
+    void drawString(int16_t x, int16_t y, const char *text)
+    {
+        if (!text) {
+            return;
+        }
+        uint8_t lineHeight = pgm_read_byte(fontData + 1);
+        uint16_t line = 0;
+        const char *start = text;
+        for (const char *p = text;; p++) {
+            if (*p == '\n' || *p == '\0') {
+                drawLine(x, y + line * lineHeight, start, p - start);
+                if (*p == '\0') {
+                    break;
+                }
+                start = p + 1;
+                line++;
+            }
+        }
+    }
+
+    void drawString(int16_t x, int16_t y, const String &text)
+    {
+        drawString(x, y, text.c_str());
+    }
+
+    void drawStringf(int16_t x, int16_t y, char *out, const char *format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        vsprintf(out, format, args);
+        va_end(args);
+        drawString(x, y, out);
+    }
+
+    virtual void display()
+    {
+        simDisplay(this);
+    }
+};
+
+class SSD1306Wire : public OLEDDisplay
+{
+public:
+    SSD1306Wire(uint8_t, int, int) {}
+};
+#endif
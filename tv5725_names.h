@@ -0,0 +1,1373 @@
+#ifndef TV5725_NAMES_H_
+#define TV5725_NAMES_H_
+
+// generated by generate_register_names.py from tv5725.h, do not edit
+
+typedef struct
+{
+    uint8_t segment;
+    uint8_t byteOffset;
+    uint8_t bitOffset;
+    uint8_t bitWidth;
+    const char *name; // PROGMEM
+} RegisterName;
+
+static const char RN_0[] PROGMEM = "STATUS_00";
+static const char RN_1[] PROGMEM = "STATUS_IF_VT_OK";
+static const char RN_2[] PROGMEM = "STATUS_IF_HT_OK";
+static const char RN_3[] PROGMEM = "STATUS_IF_HVT_OK";
+static const char RN_4[] PROGMEM = "STATUS_IF_INP_NTSC_INT";
+static const char RN_5[] PROGMEM = "STATUS_IF_INP_NTSC_PRG";
+static const char RN_6[] PROGMEM = "STATUS_IF_INP_PAL_INT";
+static const char RN_7[] PROGMEM = "STATUS_IF_INP_PAL_PRG";
+static const char RN_8[] PROGMEM = "STATUS_IF_INP_SD";
+static const char RN_9[] PROGMEM = "STATUS_IF_INP_VGA60";
+static const char RN_10[] PROGMEM = "STATUS_IF_INP_VGA75";
+static const char RN_11[] PROGMEM = "STATUS_IF_INP_VGA86";
+static const char RN_12[] PROGMEM = "STATUS_IF_INP_VGA";
+static const char RN_13[] PROGMEM = "STATUS_IF_INP_SVGA60";
+static const char RN_14[] PROGMEM = "STATUS_IF_INP_SVGA75";
+static const char RN_15[] PROGMEM = "STATUS_IF_INP_SVGA85";
+static const char RN_16[] PROGMEM = "STATUS_IF_INP_SVGA";
+static const char RN_17[] PROGMEM = "STATUS_IF_INP_XGA60";
+static const char RN_18[] PROGMEM = "STATUS_IF_INP_XGA70";
+static const char RN_19[] PROGMEM = "STATUS_IF_INP_XGA75";
+static const char RN_20[] PROGMEM = "STATUS_IF_INP_XGA85";
+static const char RN_21[] PROGMEM = "STATUS_IF_INP_XGA";
+static const char RN_22[] PROGMEM = "STATUS_IF_INP_SXGA60";
+static const char RN_23[] PROGMEM = "STATUS_IF_INP_SXGA75";
+static const char RN_24[] PROGMEM = "STATUS_IF_INP_SXGA85";
+static const char RN_25[] PROGMEM = "STATUS_03";
+static const char RN_26[] PROGMEM = "STATUS_IF_INP_SXGA";
+static const char RN_27[] PROGMEM = "STATUS_IF_INP_PC";
+static const char RN_28[] PROGMEM = "STATUS_IF_INP_720P50";
+static const char RN_29[] PROGMEM = "STATUS_IF_INP_720P60";
+static const char RN_30[] PROGMEM = "STATUS_IF_INP_720";
+static const char RN_31[] PROGMEM = "STATUS_IF_INP_2200_1125I";
+static const char RN_32[] PROGMEM = "STATUS_IF_INP_2376_1250I";
+static const char RN_33[] PROGMEM = "STATUS_IF_INP_2640_1125I";
+static const char RN_34[] PROGMEM = "STATUS_04";
+static const char RN_35[] PROGMEM = "STATUS_IF_INP_1080I";
+static const char RN_36[] PROGMEM = "STATUS_IF_INP_2200_1125P";
+static const char RN_37[] PROGMEM = "STATUS_IF_INP_2376_1250P";
+static const char RN_38[] PROGMEM = "STATUS_IF_INP_2640_1125P";
+static const char RN_39[] PROGMEM = "STATUS_IF_INP_1808P";
+static const char RN_40[] PROGMEM = "STATUS_IF_INP_HD";
+static const char RN_41[] PROGMEM = "STATUS_IF_INP_INT";
+static const char RN_42[] PROGMEM = "STATUS_IF_INP_PRG";
+static const char RN_43[] PROGMEM = "STATUS_05";
+static const char RN_44[] PROGMEM = "STATUS_IF_INP_USER";
+static const char RN_45[] PROGMEM = "STATUS_IF_NO_SYNC";
+static const char RN_46[] PROGMEM = "STATUS_IF_HT_BAD";
+static const char RN_47[] PROGMEM = "STATUS_IF_VT_BAD";
+static const char RN_48[] PROGMEM = "STATUS_IF_INP_SW";
+static const char RN_49[] PROGMEM = "HPERIOD_IF";
+static const char RN_50[] PROGMEM = "VPERIOD_IF";
+static const char RN_51[] PROGMEM = "STATUS_MISC_PLL648_LOCK";
+static const char RN_52[] PROGMEM = "STATUS_MISC_PLLAD_LOCK";
+static const char RN_53[] PROGMEM = "STATUS_MISC_PIP_EN_V";
+static const char RN_54[] PROGMEM = "STATUS_MISC_PIP_EN_H";
+static const char RN_55[] PROGMEM = "STATUS_MISC_VBLK";
+static const char RN_56[] PROGMEM = "STATUS_MISC_HBLK";
+static const char RN_57[] PROGMEM = "STATUS_MISC_VSYNC";
+static const char RN_58[] PROGMEM = "STATUS_MISC_HSYNC";
+static const char RN_59[] PROGMEM = "CHIP_ID_FOUNDRY";
+static const char RN_60[] PROGMEM = "CHIP_ID_PRODUCT";
+static const char RN_61[] PROGMEM = "CHIP_ID_REVISION";
+static const char RN_62[] PROGMEM = "STATUS_GPIO_GPIO";
+static const char RN_63[] PROGMEM = "STATUS_GPIO_HALF";
+static const char RN_64[] PROGMEM = "STATUS_GPIO_SCLSA";
+static const char RN_65[] PROGMEM = "STATUS_GPIO_MBA";
+static const char RN_66[] PROGMEM = "STATUS_GPIO_MCS1";
+static const char RN_67[] PROGMEM = "STATUS_GPIO_HBOUT";
+static const char RN_68[] PROGMEM = "STATUS_GPIO_VBOUT";
+static const char RN_69[] PROGMEM = "STATUS_GPIO_CLKOUT";
+static const char RN_70[] PROGMEM = "STATUS_0F";
+static const char RN_71[] PROGMEM = "STATUS_INT_SOG_BAD";
+static const char RN_72[] PROGMEM = "STATUS_INT_SOG_SW";
+static const char RN_73[] PROGMEM = "STATUS_INT_SOG_OK";
+static const char RN_74[] PROGMEM = "STATUS_INT_INP_SW";
+static const char RN_75[] PROGMEM = "STATUS_INT_INP_NO_SYNC";
+static const char RN_76[] PROGMEM = "STATUS_INT_INP_HSYNC";
+static const char RN_77[] PROGMEM = "STATUS_INT_INP_VSYNC";
+static const char RN_78[] PROGMEM = "STATUS_INT_INP_CSYNC";
+static const char RN_79[] PROGMEM = "STATUS_VDS_FR_NUM";
+static const char RN_80[] PROGMEM = "STATUS_VDS_OUT_VSYNC";
+static const char RN_81[] PROGMEM = "STATUS_VDS_OUT_HSYNC";
+static const char RN_82[] PROGMEM = "STATUS_VDS_FIELD";
+static const char RN_83[] PROGMEM = "STATUS_VDS_OUT_BLANK";
+static const char RN_84[] PROGMEM = "STATUS_VDS_VERT_COUNT";
+static const char RN_85[] PROGMEM = "STATUS_MEM_FF_WFF_FIFO_FULL";
+static const char RN_86[] PROGMEM = "STATUS_MEM_FF_WFF_FIFO_EMPTY";
+static const char RN_87[] PROGMEM = "STATUS_MEM_FF_RFF_FIFO_FULL";
+static const char RN_88[] PROGMEM = "STATUS_MEM_FF_RFF_FIFO_EMPTY";
+static const char RN_89[] PROGMEM = "STATUS_MEM_FF_CAP_FIFO_FULL";
+static const char RN_90[] PROGMEM = "STATUS_MEM_FF_CAP_FIFO_EMPTY";
+static const char RN_91[] PROGMEM = "STATUS_MEM_FF_PLY_FIFO_FULL";
+static const char RN_92[] PROGMEM = "STATUS_MEM_FF_PLY_FIFO_EMPTY";
+static const char RN_93[] PROGMEM = "STATUS_MEM_FF_EXT_FIN";
+static const char RN_94[] PROGMEM = "STATUS_DEINT_PULLDN";
+static const char RN_95[] PROGMEM = "STATUS_16";
+static const char RN_96[] PROGMEM = "STATUS_SYNC_PROC_HSPOL";
+static const char RN_97[] PROGMEM = "STATUS_SYNC_PROC_HSACT";
+static const char RN_98[] PROGMEM = "STATUS_SYNC_PROC_VSPOL";
+static const char RN_99[] PROGMEM = "STATUS_SYNC_PROC_VSACT";
+static const char RN_100[] PROGMEM = "STATUS_SYNC_PROC_HTOTAL";
+static const char RN_101[] PROGMEM = "STATUS_SYNC_PROC_HLOW_LEN";
+static const char RN_102[] PROGMEM = "STATUS_SYNC_PROC_VTOTAL";
+static const char RN_103[] PROGMEM = "TEST_BUS_1F";
+static const char RN_104[] PROGMEM = "TEST_FF_STATUS";
+static const char RN_105[] PROGMEM = "TEST_BUS_23";
+static const char RN_106[] PROGMEM = "TEST_BUS";
+static const char RN_107[] PROGMEM = "TEST_BUS_2E";
+static const char RN_108[] PROGMEM = "TEST_BUS_2F";
+static const char RN_109[] PROGMEM = "PLL_CKIS";
+static const char RN_110[] PROGMEM = "PLL_DIVBY2Z";
+static const char RN_111[] PROGMEM = "PLL_IS";
+static const char RN_112[] PROGMEM = "PLL_ADS";
+static const char RN_113[] PROGMEM = "PLL_MS";
+static const char RN_114[] PROGMEM = "PLL648_CONTROL_01";
+static const char RN_115[] PROGMEM = "PLL648_CONTROL_03";
+static const char RN_116[] PROGMEM = "PLL_R";
+static const char RN_117[] PROGMEM = "PLL_S";
+static const char RN_118[] PROGMEM = "PLL_LEN";
+static const char RN_119[] PROGMEM = "PLL_VCORST";
+static const char RN_120[] PROGMEM = "DAC_RGBS_PWDNZ";
+static const char RN_121[] PROGMEM = "DAC_RGBS_R0ENZ";
+static const char RN_122[] PROGMEM = "DAC_RGBS_G0ENZ";
+static const char RN_123[] PROGMEM = "DAC_RGBS_B0ENZ";
+static const char RN_124[] PROGMEM = "DAC_RGBS_SPD";
+static const char RN_125[] PROGMEM = "DAC_RGBS_S0ENZ";
+static const char RN_126[] PROGMEM = "DAC_RGBS_S1EN";
+static const char RN_127[] PROGMEM = "RESET_CONTROL_0x46";
+static const char RN_128[] PROGMEM = "SFTRST_IF_RSTZ";
+static const char RN_129[] PROGMEM = "SFTRST_DEINT_RSTZ";
+static const char RN_130[] PROGMEM = "SFTRST_MEM_FF_RSTZ";
+static const char RN_131[] PROGMEM = "SFTRST_FIFO_RSTZ";
+static const char RN_132[] PROGMEM = "SFTRST_VDS_RSTZ";
+static const char RN_133[] PROGMEM = "RESET_CONTROL_0x47";
+static const char RN_134[] PROGMEM = "SFTRST_DEC_RSTZ";
+static const char RN_135[] PROGMEM = "SFTRST_MODE_RSTZ";
+static const char RN_136[] PROGMEM = "SFTRST_SYNC_RSTZ";
+static const char RN_137[] PROGMEM = "SFTRST_HDBYPS_RSTZ";
+static const char RN_138[] PROGMEM = "SFTRST_INT_RSTZ";
+static const char RN_139[] PROGMEM = "PAD_CONTROL_00_0x48";
+static const char RN_140[] PROGMEM = "PAD_BOUT_EN";
+static const char RN_141[] PROGMEM = "PAD_SYNC1_IN_ENZ";
+static const char RN_142[] PROGMEM = "PAD_SYNC2_IN_ENZ";
+static const char RN_143[] PROGMEM = "PAD_CONTROL_01_0x49";
+static const char RN_144[] PROGMEM = "PAD_CKIN_ENZ";
+static const char RN_145[] PROGMEM = "PAD_CKOUT_ENZ";
+static const char RN_146[] PROGMEM = "PAD_SYNC_OUT_ENZ";
+static const char RN_147[] PROGMEM = "PAD_TRI_ENZ";
+static const char RN_148[] PROGMEM = "PAD_OSC_CNTRL";
+static const char RN_149[] PROGMEM = "DAC_RGBS_BYPS2DAC";
+static const char RN_150[] PROGMEM = "DAC_RGBS_ADC2DAC";
+static const char RN_151[] PROGMEM = "TEST_BUS_SEL";
+static const char RN_152[] PROGMEM = "TEST_BUS_EN";
+static const char RN_153[] PROGMEM = "OUT_SYNC_CNTRL";
+static const char RN_154[] PROGMEM = "OUT_SYNC_SEL";
+static const char RN_155[] PROGMEM = "GPIO_CONTROL_00";
+static const char RN_156[] PROGMEM = "GPIO_CONTROL_01";
+static const char RN_157[] PROGMEM = "INTERRUPT_CONTROL_00";
+static const char RN_158[] PROGMEM = "INT_CONTROL_RST_SOGBAD";
+static const char RN_159[] PROGMEM = "INT_CONTROL_RST_SOGSWITCH";
+static const char RN_160[] PROGMEM = "INT_CONTROL_RST_NOHSYNC";
+static const char RN_161[] PROGMEM = "INTERRUPT_CONTROL_01";
+static const char RN_162[] PROGMEM = "OSD_SW_RESET";
+static const char RN_163[] PROGMEM = "OSD_HORIZONTAL_ZOOM";
+static const char RN_164[] PROGMEM = "OSD_VERTICAL_ZOOM";
+static const char RN_165[] PROGMEM = "OSD_DISP_EN";
+static const char RN_166[] PROGMEM = "OSD_MENU_EN";
+static const char RN_167[] PROGMEM = "OSD_MENU_ICON_SEL";
+static const char RN_168[] PROGMEM = "OSD_MENU_MOD_SEL";
+static const char RN_169[] PROGMEM = "OSD_MENU_BAR_FONT_FORCOR";
+static const char RN_170[] PROGMEM = "OSD_MENU_BAR_FONT_BGCOR";
+static const char RN_171[] PROGMEM = "OSD_MENU_BAR_BORD_COR";
+static const char RN_172[] PROGMEM = "OSD_MENU_SEL_FORCOR";
+static const char RN_173[] PROGMEM = "OSD_MENU_SEL_BGCOR";
+static const char RN_174[] PROGMEM = "OSD_COMMAND_FINISH";
+static const char RN_175[] PROGMEM = "OSD_MENU_DISP_STYLE";
+static const char RN_176[] PROGMEM = "OSD_YCBCR_RGB_FORMAT";
+static const char RN_177[] PROGMEM = "OSD_INT_NG_LAT";
+static const char RN_178[] PROGMEM = "OSD_TEST_SEL";
+static const char RN_179[] PROGMEM = "OSD_MENU_HORI_START";
+static const char RN_180[] PROGMEM = "OSD_MENU_VER_START";
+static const char RN_181[] PROGMEM = "OSD_BAR_LENGTH";
+static const char RN_182[] PROGMEM = "OSD_BAR_FOREGROUND_VALUE";
+static const char RN_183[] PROGMEM = "IF_IN_DREG_BYPS";
+static const char RN_184[] PROGMEM = "IF_MATRIX_BYPS";
+static const char RN_185[] PROGMEM = "IF_UV_REVERT";
+static const char RN_186[] PROGMEM = "IF_SEL_656";
+static const char RN_187[] PROGMEM = "IF_SEL16BIT";
+static const char RN_188[] PROGMEM = "IF_VS_SEL";
+static const char RN_189[] PROGMEM = "IF_PRGRSV_CNTRL";
+static const char RN_190[] PROGMEM = "IF_HS_FLIP";
+static const char RN_191[] PROGMEM = "IF_VS_FLIP";
+static const char RN_192[] PROGMEM = "IF_SEL24BIT";
+static const char RN_193[] PROGMEM = "INPUT_FORMATTER_02";
+static const char RN_194[] PROGMEM = "IF_SEL_WEN";
+static const char RN_195[] PROGMEM = "IF_HS_SEL_LPF";
+static const char RN_196[] PROGMEM = "IF_HS_INT_LPF_BYPS";
+static const char RN_197[] PROGMEM = "IF_HS_PSHIFT_BYPS";
+static const char RN_198[] PROGMEM = "IF_HS_TAP11_BYPS";
+static const char RN_199[] PROGMEM = "IF_HS_Y_PDELAY";
+static const char RN_200[] PROGMEM = "IF_HS_DEC_FACTOR";
+static const char RN_201[] PROGMEM = "IF_SEL_HSCALE";
+static const char RN_202[] PROGMEM = "IF_LD_SEL_PROV";
+static const char RN_203[] PROGMEM = "IF_LD_RAM_BYPS";
+static const char RN_204[] PROGMEM = "IF_LD_ST";
+static const char RN_205[] PROGMEM = "IF_INI_ST";
+static const char RN_206[] PROGMEM = "IF_HSYNC_RST";
+static const char RN_207[] PROGMEM = "IF_HB_ST";
+static const char RN_208[] PROGMEM = "IF_HB_SP";
+static const char RN_209[] PROGMEM = "IF_HB_SP1";
+static const char RN_210[] PROGMEM = "IF_HB_ST2";
+static const char RN_211[] PROGMEM = "IF_HB_SP2";
+static const char RN_212[] PROGMEM = "IF_VB_ST";
+static const char RN_213[] PROGMEM = "IF_VB_SP";
+static const char RN_214[] PROGMEM = "IF_LINE_ST";
+static const char RN_215[] PROGMEM = "IF_LINE_SP";
+static const char RN_216[] PROGMEM = "IF_HBIN_ST";
+static const char RN_217[] PROGMEM = "IF_HBIN_SP";
+static const char RN_218[] PROGMEM = "IF_LD_WRST_SEL";
+static const char RN_219[] PROGMEM = "IF_SEL_ADC_SYNC";
+static const char RN_220[] PROGMEM = "IF_TEST_EN";
+static const char RN_221[] PROGMEM = "IF_TEST_SEL";
+static const char RN_222[] PROGMEM = "IF_AUTO_OFST_EN";
+static const char RN_223[] PROGMEM = "IF_AUTO_OFST_PRD";
+static const char RN_224[] PROGMEM = "IF_AUTO_OFST_U_RANGE";
+static const char RN_225[] PROGMEM = "IF_AUTO_OFST_V_RANGE";
+static const char RN_226[] PROGMEM = "GBS_PRESET_ID";
+static const char RN_227[] PROGMEM = "GBS_PRESET_CUSTOM";
+static const char RN_228[] PROGMEM = "GBS_OPTION_SCANLINES_ENABLED";
+static const char RN_229[] PROGMEM = "GBS_OPTION_SCALING_RGBHV";
+static const char RN_230[] PROGMEM = "GBS_OPTION_PALFORCED60_ENABLED";
+static const char RN_231[] PROGMEM = "GBS_RUNTIME_UNUSED_BIT";
+static const char RN_232[] PROGMEM = "GBS_RUNTIME_FTL_ADJUSTED";
+static const char RN_233[] PROGMEM = "GBS_PRESET_DISPLAY_CLOCK";
+static const char RN_234[] PROGMEM = "HD_MATRIX_BYPS";
+static const char RN_235[] PROGMEM = "HD_DYN_BYPS";
+static const char RN_236[] PROGMEM = "HD_SEL_BLK_IN";
+static const char RN_237[] PROGMEM = "HD_Y_OFFSET";
+static const char RN_238[] PROGMEM = "HD_U_OFFSET";
+static const char RN_239[] PROGMEM = "HD_V_OFFSET";
+static const char RN_240[] PROGMEM = "HD_HSYNC_RST";
+static const char RN_241[] PROGMEM = "HD_INI_ST";
+static const char RN_242[] PROGMEM = "HD_HB_ST";
+static const char RN_243[] PROGMEM = "HD_HB_SP";
+static const char RN_244[] PROGMEM = "HD_HS_ST";
+static const char RN_245[] PROGMEM = "HD_HS_SP";
+static const char RN_246[] PROGMEM = "HD_VB_ST";
+static const char RN_247[] PROGMEM = "HD_VB_SP";
+static const char RN_248[] PROGMEM = "HD_VS_ST";
+static const char RN_249[] PROGMEM = "HD_VS_SP";
+static const char RN_250[] PROGMEM = "HD_BLK_GY_DATA";
+static const char RN_251[] PROGMEM = "HD_BLK_BU_DATA";
+static const char RN_252[] PROGMEM = "HD_BLK_RV_DATA";
+static const char RN_253[] PROGMEM = "MD_HPERIOD_LOCK_VALUE";
+static const char RN_254[] PROGMEM = "MD_HPERIOD_UNLOCK_VALUE";
+static const char RN_255[] PROGMEM = "MD_VPERIOD_LOCK_VALUE";
+static const char RN_256[] PROGMEM = "MD_VPERIOD_UNLOCK_VALUE";
+static const char RN_257[] PROGMEM = "MD_HS_FLIP";
+static const char RN_258[] PROGMEM = "MD_VS_FLIP";
+static const char RN_259[] PROGMEM = "MD_VGA_CNTRL";
+static const char RN_260[] PROGMEM = "MD_SEL_VGA60";
+static const char RN_261[] PROGMEM = "MD_VGA_75HZ_CNTRL";
+static const char RN_262[] PROGMEM = "MD_VGA_85HZ_CNTRL";
+static const char RN_263[] PROGMEM = "MD_SVGA_60HZ_CNTRL";
+static const char RN_264[] PROGMEM = "MD_SVGA_75HZ_CNTRL";
+static const char RN_265[] PROGMEM = "MD_SVGA_85HZ_CNTRL";
+static const char RN_266[] PROGMEM = "MD_XGA_60HZ_CNTRL";
+static const char RN_267[] PROGMEM = "MD_XGA_70HZ_CNTRL";
+static const char RN_268[] PROGMEM = "MD_XGA_75HZ_CNTRL";
+static const char RN_269[] PROGMEM = "MD_XGA_85HZ_CNTRL";
+static const char RN_270[] PROGMEM = "MD_SXGA_60HZ_CNTRL";
+static const char RN_271[] PROGMEM = "MD_SXGA_75HZ_CNTRL";
+static const char RN_272[] PROGMEM = "MD_SXGA_85HZ_CNTRL";
+static const char RN_273[] PROGMEM = "MD_HD1250P_CNTRL";
+static const char RN_274[] PROGMEM = "DEINT_00";
+static const char RN_275[] PROGMEM = "DIAG_BOB_PLDY_RAM_BYPS";
+static const char RN_276[] PROGMEM = "MADPT_Y_VSCALE_BYPS";
+static const char RN_277[] PROGMEM = "MADPT_UV_VSCALE_BYPS";
+static const char RN_278[] PROGMEM = "MADPT_STILL_NOISE_EST_EN";
+static const char RN_279[] PROGMEM = "MADPT_Y_MI_DET_BYPS";
+static const char RN_280[] PROGMEM = "MADPT_Y_MI_OFFSET";
+static const char RN_281[] PROGMEM = "MADPT_MI_1BIT_BYPS";
+static const char RN_282[] PROGMEM = "MADPT_MI_1BIT_FRAME2_EN";
+static const char RN_283[] PROGMEM = "MADPT_MO_ADP_UV_EN";
+static const char RN_284[] PROGMEM = "MADPT_VT_FILTER_CNTRL";
+static const char RN_285[] PROGMEM = "MAPDT_VT_SEL_PRGV";
+static const char RN_286[] PROGMEM = "MADPT_Y_DELAY_UV_DELAY";
+static const char RN_287[] PROGMEM = "MADPT_Y_DELAY";
+static const char RN_288[] PROGMEM = "MADPT_UV_DELAY";
+static const char RN_289[] PROGMEM = "MADPT_HTAP_BYPS";
+static const char RN_290[] PROGMEM = "MADPT_BIT_STILL_EN";
+static const char RN_291[] PROGMEM = "MADPT_VTAP2_BYPS";
+static const char RN_292[] PROGMEM = "MADPT_VTAP2_ROUND_SEL";
+static const char RN_293[] PROGMEM = "MADPT_VTAP2_COEFF";
+static const char RN_294[] PROGMEM = "MADPT_EN_NOUT_FOR_STILL";
+static const char RN_295[] PROGMEM = "MADPT_EN_NOUT_FOR_LESS_STILL";
+static const char RN_296[] PROGMEM = "MADPT_PD_RAM_BYPS";
+static const char RN_297[] PROGMEM = "MADPT_VIIR_BYPS";
+static const char RN_298[] PROGMEM = "MADPT_VIIR_COEF";
+static const char RN_299[] PROGMEM = "MADPT_VSCALE_DEC_FACTOR";
+static const char RN_300[] PROGMEM = "MADPT_SEL_PHASE_INI";
+static const char RN_301[] PROGMEM = "MADPT_DD0_SEL";
+static const char RN_302[] PROGMEM = "MADPT_NRD_VIIR_PD_BYPS";
+static const char RN_303[] PROGMEM = "MADPT_UVDLY_PD_BYPS";
+static const char RN_304[] PROGMEM = "MADPT_CMP_EN";
+static const char RN_305[] PROGMEM = "MADPT_UVDLY_PD_SP";
+static const char RN_306[] PROGMEM = "MADPT_UVDLY_PD_ST";
+static const char RN_307[] PROGMEM = "MADPT_EN_UV_DEINT";
+static const char RN_308[] PROGMEM = "MADPT_EN_STILL_FOR_NRD";
+static const char RN_309[] PROGMEM = "MADPT_MI_1BIT_DLY";
+static const char RN_310[] PROGMEM = "MADPT_UV_MI_DET_BYPS";
+static const char RN_311[] PROGMEM = "MADPT_UV_MI_OFFSET";
+static const char RN_312[] PROGMEM = "VDS_SYNC_EN";
+static const char RN_313[] PROGMEM = "VDS_FIELDAB_EN";
+static const char RN_314[] PROGMEM = "VDS_DFIELD_EN";
+static const char RN_315[] PROGMEM = "VDS_FIELD_FLIP";
+static const char RN_316[] PROGMEM = "VDS_HSCALE_BYPS";
+static const char RN_317[] PROGMEM = "VDS_VSCALE_BYPS";
+static const char RN_318[] PROGMEM = "VDS_HALF_EN";
+static const char RN_319[] PROGMEM = "VDS_SRESET";
+static const char RN_320[] PROGMEM = "VDS_HSYNC_RST";
+static const char RN_321[] PROGMEM = "VDS_VSYNC_RST";
+static const char RN_322[] PROGMEM = "VDS_HB_ST";
+static const char RN_323[] PROGMEM = "VDS_HB_SP";
+static const char RN_324[] PROGMEM = "VDS_VB_ST";
+static const char RN_325[] PROGMEM = "VDS_VB_SP";
+static const char RN_326[] PROGMEM = "VDS_HS_ST";
+static const char RN_327[] PROGMEM = "VDS_HS_SP";
+static const char RN_328[] PROGMEM = "VDS_VS_ST";
+static const char RN_329[] PROGMEM = "VDS_VS_SP";
+static const char RN_330[] PROGMEM = "VDS_DIS_HB_ST";
+static const char RN_331[] PROGMEM = "VDS_DIS_HB_SP";
+static const char RN_332[] PROGMEM = "VDS_DIS_VB_ST";
+static const char RN_333[] PROGMEM = "VDS_DIS_VB_SP";
+static const char RN_334[] PROGMEM = "VDS_HSCALE";
+static const char RN_335[] PROGMEM = "VDS_VSCALE";
+static const char RN_336[] PROGMEM = "VDS_FRAME_RST";
+static const char RN_337[] PROGMEM = "VDS_FLOCK_EN";
+static const char RN_338[] PROGMEM = "VDS_FREERUN_FID";
+static const char RN_339[] PROGMEM = "VDS_FID_AA_DLY";
+static const char RN_340[] PROGMEM = "VDS_FID_RST";
+static const char RN_341[] PROGMEM = "VDS_FR_SELECT";
+static const char RN_342[] PROGMEM = "VDS_FRAME_NO";
+static const char RN_343[] PROGMEM = "VDS_DIF_FR_SEL_EN";
+static const char RN_344[] PROGMEM = "VDS_EN_FR_NUM_RST";
+static const char RN_345[] PROGMEM = "VDS_VSYN_SIZE1";
+static const char RN_346[] PROGMEM = "VDS_VSYN_SIZE2";
+static const char RN_347[] PROGMEM = "VDS_3_24";
+static const char RN_348[] PROGMEM = "VDS_UV_FLIP";
+static const char RN_349[] PROGMEM = "VDS_U_DELAY";
+static const char RN_350[] PROGMEM = "VDS_V_DELAY";
+static const char RN_351[] PROGMEM = "VDS_TAP6_BYPS";
+static const char RN_352[] PROGMEM = "VDS_Y_DELAY";
+static const char RN_353[] PROGMEM = "VDS_WEN_DELAY";
+static const char RN_354[] PROGMEM = "VDS_D_SP";
+static const char RN_355[] PROGMEM = "VDS_D_RAM_BYPS";
+static const char RN_356[] PROGMEM = "VDS_BLEV_AUTO_EN";
+static const char RN_357[] PROGMEM = "VDS_USER_MIN";
+static const char RN_358[] PROGMEM = "VDS_USER_MAX";
+static const char RN_359[] PROGMEM = "VDS_BLEV_LEVEL";
+static const char RN_360[] PROGMEM = "VDS_BLEV_GAIN";
+static const char RN_361[] PROGMEM = "VDS_BLEV_BYPS";
+static const char RN_362[] PROGMEM = "VDS_STEP_DLY_CNTRL";
+static const char RN_363[] PROGMEM = "VDS_0X2A_RESERVED_2BITS";
+static const char RN_364[] PROGMEM = "VDS_STEP_GAIN";
+static const char RN_365[] PROGMEM = "VDS_STEP_CLIP";
+static const char RN_366[] PROGMEM = "VDS_UV_STEP_BYPS";
+static const char RN_367[] PROGMEM = "VDS_SK_U_CENTER";
+static const char RN_368[] PROGMEM = "VDS_SK_V_CENTER";
+static const char RN_369[] PROGMEM = "VDS_SK_Y_LOW_TH";
+static const char RN_370[] PROGMEM = "VDS_SK_Y_HIGH_TH";
+static const char RN_371[] PROGMEM = "VDS_SK_RANGE";
+static const char RN_372[] PROGMEM = "VDS_SK_GAIN";
+static const char RN_373[] PROGMEM = "VDS_SK_Y_EN";
+static const char RN_374[] PROGMEM = "VDS_SK_BYPS";
+static const char RN_375[] PROGMEM = "VDS_SVM_BPF_CNTRL";
+static const char RN_376[] PROGMEM = "VDS_SVM_POL_FLIP";
+static const char RN_377[] PROGMEM = "VDS_SVM_2ND_BYPS";
+static const char RN_378[] PROGMEM = "VDS_SVM_VCLK_DELAY";
+static const char RN_379[] PROGMEM = "VDS_SVM_SIGMOID_BYPS";
+static const char RN_380[] PROGMEM = "VDS_SVM_GAIN";
+static const char RN_381[] PROGMEM = "VDS_SVM_OFFSET";
+static const char RN_382[] PROGMEM = "VDS_Y_GAIN";
+static const char RN_383[] PROGMEM = "VDS_UCOS_GAIN";
+static const char RN_384[] PROGMEM = "VDS_VCOS_GAIN";
+static const char RN_385[] PROGMEM = "VDS_USIN_GAIN";
+static const char RN_386[] PROGMEM = "VDS_VSIN_GAIN";
+static const char RN_387[] PROGMEM = "VDS_Y_OFST";
+static const char RN_388[] PROGMEM = "VDS_U_OFST";
+static const char RN_389[] PROGMEM = "VDS_V_OFST";
+static const char RN_390[] PROGMEM = "VDS_SYNC_LEV";
+static const char RN_391[] PROGMEM = "VDS_CONVT_BYPS";
+static const char RN_392[] PROGMEM = "VDS_DYN_BYPS";
+static const char RN_393[] PROGMEM = "VDS_BLK_BF_EN";
+static const char RN_394[] PROGMEM = "VDS_UV_BLK_VAL";
+static const char RN_395[] PROGMEM = "VDS_1ST_INT_BYPS";
+static const char RN_396[] PROGMEM = "VDS_2ND_INT_BYPS";
+static const char RN_397[] PROGMEM = "VDS_IN_DREG_BYPS";
+static const char RN_398[] PROGMEM = "VDS_SVM_V4CLK_DELAY";
+static const char RN_399[] PROGMEM = "VDS_PK_LINE_BUF_SP";
+static const char RN_400[] PROGMEM = "VDS_PK_RAM_BYPS";
+static const char RN_401[] PROGMEM = "VDS_PK_VL_HL_SEL";
+static const char RN_402[] PROGMEM = "VDS_PK_VL_HH_SEL";
+static const char RN_403[] PROGMEM = "VDS_PK_VH_HL_SEL";
+static const char RN_404[] PROGMEM = "VDS_PK_VH_HH_SEL";
+static const char RN_405[] PROGMEM = "VDS_PK_LB_CORE";
+static const char RN_406[] PROGMEM = "VDS_PK_LB_CMP";
+static const char RN_407[] PROGMEM = "VDS_PK_LB_GAIN";
+static const char RN_408[] PROGMEM = "VDS_PK_LH_CORE";
+static const char RN_409[] PROGMEM = "VDS_PK_LH_CMP";
+static const char RN_410[] PROGMEM = "VDS_PK_LH_GAIN";
+static const char RN_411[] PROGMEM = "VDS_PK_HL_CORE";
+static const char RN_412[] PROGMEM = "VDS_PK_HL_CMP";
+static const char RN_413[] PROGMEM = "VDS_PK_HL_GAIN";
+static const char RN_414[] PROGMEM = "VDS_PK_HB_CORE";
+static const char RN_415[] PROGMEM = "VDS_PK_HB_CMP";
+static const char RN_416[] PROGMEM = "VDS_PK_HB_GAIN";
+static const char RN_417[] PROGMEM = "VDS_PK_HH_CORE";
+static const char RN_418[] PROGMEM = "VDS_PK_HH_CMP";
+static const char RN_419[] PROGMEM = "VDS_PK_HH_GAIN";
+static const char RN_420[] PROGMEM = "VDS_PK_Y_H_BYPS";
+static const char RN_421[] PROGMEM = "VDS_PK_Y_V_BYPS";
+static const char RN_422[] PROGMEM = "VDS_C_VPK_BYPS";
+static const char RN_423[] PROGMEM = "VDS_C_VPK_CORE";
+static const char RN_424[] PROGMEM = "VDS_C_VPK_GAIN";
+static const char RN_425[] PROGMEM = "VDS_TEST_BUS_SEL";
+static const char RN_426[] PROGMEM = "VDS_TEST_EN";
+static const char RN_427[] PROGMEM = "VDS_DO_UV_DEV_BYPS";
+static const char RN_428[] PROGMEM = "VDS_DO_UVSEL_FLIP";
+static const char RN_429[] PROGMEM = "VDS_DO_16B_EN";
+static const char RN_430[] PROGMEM = "VDS_GLB_NOISE";
+static const char RN_431[] PROGMEM = "VDS_NR_Y_BYPS";
+static const char RN_432[] PROGMEM = "VDS_NR_C_BYPS";
+static const char RN_433[] PROGMEM = "VDS_NR_DIF_LPF5_BYPS";
+static const char RN_434[] PROGMEM = "VDS_NR_MI_TH_EN";
+static const char RN_435[] PROGMEM = "VDS_NR_MI_OFFSET";
+static const char RN_436[] PROGMEM = "VDS_NR_MIG_USER_EN";
+static const char RN_437[] PROGMEM = "VDS_NR_MI_GAIN";
+static const char RN_438[] PROGMEM = "VDS_NR_STILL_GAIN";
+static const char RN_439[] PROGMEM = "VDS_NR_MI_THRES";
+static const char RN_440[] PROGMEM = "VDS_NR_EN_H_NOISY";
+static const char RN_441[] PROGMEM = "VDS_NR_EN_GLB_STILL";
+static const char RN_442[] PROGMEM = "VDS_NR_GLB_STILL_MENU";
+static const char RN_443[] PROGMEM = "VDS_NR_NOISY_OFFSET";
+static const char RN_444[] PROGMEM = "VDS_W_LEV_BYPS";
+static const char RN_445[] PROGMEM = "VDS_W_LEV";
+static const char RN_446[] PROGMEM = "VDS_WLEV_GAIN";
+static const char RN_447[] PROGMEM = "VDS_NS_U_CENTER";
+static const char RN_448[] PROGMEM = "VDS_NS_V_CENTER";
+static const char RN_449[] PROGMEM = "VDS_NS_U_GAIN";
+static const char RN_450[] PROGMEM = "VDS_NS_SQUARE_RAD";
+static const char RN_451[] PROGMEM = "VDS_NS_Y_HIGH_TH";
+static const char RN_452[] PROGMEM = "VDS_NS_V_GAIN";
+static const char RN_453[] PROGMEM = "VDS_NS_Y_LOW_TH";
+static const char RN_454[] PROGMEM = "VDS_NS_BYPS";
+static const char RN_455[] PROGMEM = "VDS_NS_Y_ACTIVE_EN";
+static const char RN_456[] PROGMEM = "VDS_C1_TAG_LOW_SLOPE";
+static const char RN_457[] PROGMEM = "VDS_C1_TAG_HIGH_SLOPE";
+static const char RN_458[] PROGMEM = "VDS_C1_GAIN";
+static const char RN_459[] PROGMEM = "VDS_C1_U_LOW";
+static const char RN_460[] PROGMEM = "VDS_C1_U_HIGH";
+static const char RN_461[] PROGMEM = "VDS_C1_BYPS";
+static const char RN_462[] PROGMEM = "VDS_C1_Y_THRESH";
+static const char RN_463[] PROGMEM = "VDS_C2_TAG_LOW_SLOPE";
+static const char RN_464[] PROGMEM = "VDS_C2_TAG_HIGH_SLOPE";
+static const char RN_465[] PROGMEM = "VDS_C2_GAIN";
+static const char RN_466[] PROGMEM = "VDS_C2_U_LOW";
+static const char RN_467[] PROGMEM = "VDS_C2_U_HIGH";
+static const char RN_468[] PROGMEM = "VDS_C2_BYPS";
+static const char RN_469[] PROGMEM = "VDS_C2_Y_THRESH";
+static const char RN_470[] PROGMEM = "VDS_EXT_HB_ST";
+static const char RN_471[] PROGMEM = "VDS_EXT_HB_SP";
+static const char RN_472[] PROGMEM = "VDS_EXT_VB_ST";
+static const char RN_473[] PROGMEM = "VDS_EXT_VB_SP";
+static const char RN_474[] PROGMEM = "VDS_SYNC_IN_SEL";
+static const char RN_475[] PROGMEM = "VDS_BLUE_RANGE";
+static const char RN_476[] PROGMEM = "VDS_BLUE_BYPS";
+static const char RN_477[] PROGMEM = "VDS_BLUE_UGAIN";
+static const char RN_478[] PROGMEM = "VDS_BLUE_VGAIN";
+static const char RN_479[] PROGMEM = "VDS_BLUE_Y_LEV";
+static const char RN_480[] PROGMEM = "PIP_UV_FLIP";
+static const char RN_481[] PROGMEM = "PIP_U_DELAY";
+static const char RN_482[] PROGMEM = "PIP_V_DELAY";
+static const char RN_483[] PROGMEM = "PIP_TAP3_BYPS";
+static const char RN_484[] PROGMEM = "PIP_Y_DELAY";
+static const char RN_485[] PROGMEM = "PIP_SUB_16B_SEL";
+static const char RN_486[] PROGMEM = "PIP_DYN_BYPS";
+static const char RN_487[] PROGMEM = "PIP_CONVT_BYPS";
+static const char RN_488[] PROGMEM = "PIP_DREG_BYPS";
+static const char RN_489[] PROGMEM = "PIP_EN";
+static const char RN_490[] PROGMEM = "PIP_Y_GAIN";
+static const char RN_491[] PROGMEM = "PIP_U_GAIN";
+static const char RN_492[] PROGMEM = "PIP_V_GAIN";
+static const char RN_493[] PROGMEM = "PIP_Y_OFST";
+static const char RN_494[] PROGMEM = "PIP_U_OFST";
+static const char RN_495[] PROGMEM = "PIP_V_OFST";
+static const char RN_496[] PROGMEM = "PIP_H_ST";
+static const char RN_497[] PROGMEM = "PIP_H_SP";
+static const char RN_498[] PROGMEM = "PIP_V_ST";
+static const char RN_499[] PROGMEM = "PIP_V_SP";
+static const char RN_500[] PROGMEM = "SDRAM_RESET_CONTROL";
+static const char RN_501[] PROGMEM = "SDRAM_RESET_SIGNAL";
+static const char RN_502[] PROGMEM = "SDRAM_START_INITIAL_CYCLE";
+static const char RN_503[] PROGMEM = "MEM_INTER_DLYCELL_SEL";
+static const char RN_504[] PROGMEM = "MEM_CLK_DLYCELL_SEL";
+static const char RN_505[] PROGMEM = "MEM_FBK_CLK_DLYCELL_SEL";
+static const char RN_506[] PROGMEM = "MEM_PAD_CLK_INVERT";
+static const char RN_507[] PROGMEM = "MEM_RD_DATA_CLK_INVERT";
+static const char RN_508[] PROGMEM = "MEM_FBK_CLK_INVERT";
+static const char RN_509[] PROGMEM = "MEM_REQ_PBH_RFFH";
+static const char RN_510[] PROGMEM = "MEM_ADR_DLY_REG";
+static const char RN_511[] PROGMEM = "MEM_CLK_DLY_REG";
+static const char RN_512[] PROGMEM = "CAPTURE_ENABLE";
+static const char RN_513[] PROGMEM = "CAP_FF_HALF_REQ";
+static const char RN_514[] PROGMEM = "CAP_SAFE_GUARD_EN";
+static const char RN_515[] PROGMEM = "CAP_REQ_OVER";
+static const char RN_516[] PROGMEM = "CAP_STATUS_SEL";
+static const char RN_517[] PROGMEM = "CAP_REQ_FREEZ";
+static const char RN_518[] PROGMEM = "CAP_SAFE_GUARD_A";
+static const char RN_519[] PROGMEM = "CAP_SAFE_GUARD_B";
+static const char RN_520[] PROGMEM = "PB_CUT_REFRESH";
+static const char RN_521[] PROGMEM = "PB_REQ_SEL";
+static const char RN_522[] PROGMEM = "PB_BYPASS";
+static const char RN_523[] PROGMEM = "PB_DB_BUFFER_EN";
+static const char RN_524[] PROGMEM = "PB_ENABLE";
+static const char RN_525[] PROGMEM = "PB_MAST_FLAG_REG";
+static const char RN_526[] PROGMEM = "PB_GENERAL_FLAG_REG";
+static const char RN_527[] PROGMEM = "PB_CAP_OFFSET";
+static const char RN_528[] PROGMEM = "PB_FETCH_NUM";
+static const char RN_529[] PROGMEM = "WFF_ENABLE";
+static const char RN_530[] PROGMEM = "WFF_FF_STA_INV";
+static const char RN_531[] PROGMEM = "WFF_SAFE_GUARD";
+static const char RN_532[] PROGMEM = "WFF_ADR_ADD_2";
+static const char RN_533[] PROGMEM = "WFF_FF_STATUS_SEL";
+static const char RN_534[] PROGMEM = "WFF_SAFE_GUARD_A";
+static const char RN_535[] PROGMEM = "WFF_SAFE_GUARD_B";
+static const char RN_536[] PROGMEM = "WFF_YUV_DEINTERLACE";
+static const char RN_537[] PROGMEM = "WFF_LINE_FLIP";
+static const char RN_538[] PROGMEM = "WFF_HB_DELAY";
+static const char RN_539[] PROGMEM = "WFF_VB_DELAY";
+static const char RN_540[] PROGMEM = "RFF_ADR_ADD_2";
+static const char RN_541[] PROGMEM = "RFF_REQ_SEL";
+static const char RN_542[] PROGMEM = "RFF_ENABLE";
+static const char RN_543[] PROGMEM = "RFF_MASTER_FLAG";
+static const char RN_544[] PROGMEM = "RFF_LINE_FLIP";
+static const char RN_545[] PROGMEM = "RFF_YUV_DEINTERLACE";
+static const char RN_546[] PROGMEM = "RFF_LREQ_CUT";
+static const char RN_547[] PROGMEM = "RFF_WFF_STA_ADDR_A";
+static const char RN_548[] PROGMEM = "RFF_WFF_STA_ADDR_B";
+static const char RN_549[] PROGMEM = "RFF_WFF_OFFSET";
+static const char RN_550[] PROGMEM = "RFF_FETCH_NUM";
+static const char RN_551[] PROGMEM = "MEM_FF_TOP_FF_SEL";
+static const char RN_552[] PROGMEM = "ADC_5_00";
+static const char RN_553[] PROGMEM = "ADC_CLK_PA";
+static const char RN_554[] PROGMEM = "ADC_CLK_ICLK2X";
+static const char RN_555[] PROGMEM = "ADC_CLK_ICLK1X";
+static const char RN_556[] PROGMEM = "ADC_SOGEN";
+static const char RN_557[] PROGMEM = "ADC_SOGCTRL";
+static const char RN_558[] PROGMEM = "ADC_INPUT_SEL";
+static const char RN_559[] PROGMEM = "ADC_5_03";
+static const char RN_560[] PROGMEM = "ADC_POWDZ";
+static const char RN_561[] PROGMEM = "ADC_RYSEL_R";
+static const char RN_562[] PROGMEM = "ADC_RYSEL_G";
+static const char RN_563[] PROGMEM = "ADC_RYSEL_B";
+static const char RN_564[] PROGMEM = "ADC_FLTR";
+static const char RN_565[] PROGMEM = "ADC_TEST_04";
+static const char RN_566[] PROGMEM = "ADC_TR_RSEL";
+static const char RN_567[] PROGMEM = "ADC_TR_RSEL_04_BIT1";
+static const char RN_568[] PROGMEM = "ADC_TR_ISEL";
+static const char RN_569[] PROGMEM = "ADC_TA_05_CTRL";
+static const char RN_570[] PROGMEM = "ADC_TA_05_EN";
+static const char RN_571[] PROGMEM = "ADC_ROFCTRL";
+static const char RN_572[] PROGMEM = "ADC_GOFCTRL";
+static const char RN_573[] PROGMEM = "ADC_BOFCTRL";
+static const char RN_574[] PROGMEM = "ADC_RGCTRL";
+static const char RN_575[] PROGMEM = "ADC_GGCTRL";
+static const char RN_576[] PROGMEM = "ADC_BGCTRL";
+static const char RN_577[] PROGMEM = "ADC_TEST_0C";
+static const char RN_578[] PROGMEM = "ADC_TEST_0C_BIT1";
+static const char RN_579[] PROGMEM = "ADC_TEST_0C_BIT3";
+static const char RN_580[] PROGMEM = "ADC_TEST_0C_BIT4";
+static const char RN_581[] PROGMEM = "ADC_AUTO_OFST_EN";
+static const char RN_582[] PROGMEM = "ADC_AUTO_OFST_PRD";
+static const char RN_583[] PROGMEM = "ADC_AUTO_OFST_DELAY";
+static const char RN_584[] PROGMEM = "ADC_AUTO_OFST_STEP";
+static const char RN_585[] PROGMEM = "ADC_AUTO_OFST_TEST";
+static const char RN_586[] PROGMEM = "ADC_AUTO_OFST_RANGE_REG";
+static const char RN_587[] PROGMEM = "PLLAD_CONTROL_00_5x11";
+static const char RN_588[] PROGMEM = "PLLAD_VCORST";
+static const char RN_589[] PROGMEM = "PLLAD_LEN";
+static const char RN_590[] PROGMEM = "PLLAD_TEST";
+static const char RN_591[] PROGMEM = "PLLAD_TS";
+static const char RN_592[] PROGMEM = "PLLAD_PDZ";
+static const char RN_593[] PROGMEM = "PLLAD_FS";
+static const char RN_594[] PROGMEM = "PLLAD_BPS";
+static const char RN_595[] PROGMEM = "PLLAD_LAT";
+static const char RN_596[] PROGMEM = "PLLAD_MD";
+static const char RN_597[] PROGMEM = "PLLAD_5_16";
+static const char RN_598[] PROGMEM = "PLLAD_R";
+static const char RN_599[] PROGMEM = "PLLAD_S";
+static const char RN_600[] PROGMEM = "PLLAD_KS";
+static const char RN_601[] PROGMEM = "PLLAD_CKOS";
+static const char RN_602[] PROGMEM = "PLLAD_ICP";
+static const char RN_603[] PROGMEM = "PA_ADC_BYPSZ";
+static const char RN_604[] PROGMEM = "PA_ADC_S";
+static const char RN_605[] PROGMEM = "PA_ADC_LOCKOFF";
+static const char RN_606[] PROGMEM = "PA_ADC_LAT";
+static const char RN_607[] PROGMEM = "PA_SP_BYPSZ";
+static const char RN_608[] PROGMEM = "PA_SP_S";
+static const char RN_609[] PROGMEM = "PA_SP_LOCKOFF";
+static const char RN_610[] PROGMEM = "PA_SP_LAT";
+static const char RN_611[] PROGMEM = "DEC_WEN_MODE";
+static const char RN_612[] PROGMEM = "DEC_5_1F";
+static const char RN_613[] PROGMEM = "DEC1_BYPS";
+static const char RN_614[] PROGMEM = "DEC2_BYPS";
+static const char RN_615[] PROGMEM = "DEC_MATRIX_BYPS";
+static const char RN_616[] PROGMEM = "DEC_TEST_ENABLE";
+static const char RN_617[] PROGMEM = "DEC_TEST_SEL";
+static const char RN_618[] PROGMEM = "DEC_IDREG_EN";
+static const char RN_619[] PROGMEM = "SP_SOG_SRC_SEL";
+static const char RN_620[] PROGMEM = "SP_SOG_P_ATO";
+static const char RN_621[] PROGMEM = "SP_SOG_P_INV";
+static const char RN_622[] PROGMEM = "SP_EXT_SYNC_SEL";
+static const char RN_623[] PROGMEM = "SP_JITTER_SYNC";
+static const char RN_624[] PROGMEM = "SP_SYNC_PD_THD";
+static const char RN_625[] PROGMEM = "SP_H_TIMER_VAL";
+static const char RN_626[] PROGMEM = "SP_DLT_REG";
+static const char RN_627[] PROGMEM = "SP_H_PULSE_IGNOR";
+static const char RN_628[] PROGMEM = "SP_PRE_COAST";
+static const char RN_629[] PROGMEM = "SP_POST_COAST";
+static const char RN_630[] PROGMEM = "SP_H_TOTAL_EQ_THD";
+static const char RN_631[] PROGMEM = "SP_SDCS_VSST_REG_H";
+static const char RN_632[] PROGMEM = "SP_SDCS_VSSP_REG_H";
+static const char RN_633[] PROGMEM = "SP_CS_0x3E";
+static const char RN_634[] PROGMEM = "SP_CS_P_SWAP";
+static const char RN_635[] PROGMEM = "SP_HD_MODE";
+static const char RN_636[] PROGMEM = "SP_H_COAST";
+static const char RN_637[] PROGMEM = "SP_H_PROTECT";
+static const char RN_638[] PROGMEM = "SP_DIS_SUB_COAST";
+static const char RN_639[] PROGMEM = "SP_SDCS_VSST_REG_L";
+static const char RN_640[] PROGMEM = "SP_SDCS_VSSP_REG_L";
+static const char RN_641[] PROGMEM = "SP_CS_CLP_ST";
+static const char RN_642[] PROGMEM = "SP_CS_CLP_SP";
+static const char RN_643[] PROGMEM = "SP_CS_HS_ST";
+static const char RN_644[] PROGMEM = "SP_CS_HS_SP";
+static const char RN_645[] PROGMEM = "SP_RT_HS_ST";
+static const char RN_646[] PROGMEM = "SP_RT_HS_SP";
+static const char RN_647[] PROGMEM = "SP_H_CST_ST";
+static const char RN_648[] PROGMEM = "SP_H_CST_SP";
+static const char RN_649[] PROGMEM = "SP_HS_POL_ATO";
+static const char RN_650[] PROGMEM = "SP_VS_POL_ATO";
+static const char RN_651[] PROGMEM = "SP_HCST_AUTO_EN";
+static const char RN_652[] PROGMEM = "SP_5_56";
+static const char RN_653[] PROGMEM = "SP_SOG_MODE";
+static const char RN_654[] PROGMEM = "SP_HS2PLL_INV_REG";
+static const char RN_655[] PROGMEM = "SP_CLAMP_MANUAL";
+static const char RN_656[] PROGMEM = "SP_CLP_SRC_SEL";
+static const char RN_657[] PROGMEM = "SP_SYNC_BYPS";
+static const char RN_658[] PROGMEM = "SP_HS_PROC_INV_REG";
+static const char RN_659[] PROGMEM = "SP_VS_PROC_INV_REG";
+static const char RN_660[] PROGMEM = "SP_CLAMP_INV_REG";
+static const char RN_661[] PROGMEM = "SP_5_57";
+static const char RN_662[] PROGMEM = "SP_NO_CLAMP_REG";
+static const char RN_663[] PROGMEM = "SP_COAST_INV_REG";
+static const char RN_664[] PROGMEM = "SP_NO_COAST_REG";
+static const char RN_665[] PROGMEM = "SP_HS_LOOP_SEL";
+static const char RN_666[] PROGMEM = "SP_HS_REG";
+static const char RN_667[] PROGMEM = "ADC_UNUSED_60";
+static const char RN_668[] PROGMEM = "ADC_UNUSED_61";
+static const char RN_669[] PROGMEM = "ADC_UNUSED_62";
+static const char RN_670[] PROGMEM = "TEST_BUS_SP_SEL";
+static const char RN_671[] PROGMEM = "ADC_UNUSED_64";
+static const char RN_672[] PROGMEM = "ADC_UNUSED_65";
+static const char RN_673[] PROGMEM = "ADC_UNUSED_66";
+static const char RN_674[] PROGMEM = "ADC_UNUSED_67";
+static const char RN_675[] PROGMEM = "ADC_UNUSED_69";
+static const char RN_676[] PROGMEM = "VERYWIDEDUMMYREG";
+
+const RegisterName registerNames[] PROGMEM = {
+    {0, 0x00, 0, 8, RN_0},
+    {0, 0x00, 0, 1, RN_1},
+    {0, 0x00, 1, 1, RN_2},
+    {0, 0x00, 2, 1, RN_3},
+    {0, 0x00, 3, 1, RN_4},
+    {0, 0x00, 4, 1, RN_5},
+    {0, 0x00, 5, 1, RN_6},
+    {0, 0x00, 6, 1, RN_7},
+    {0, 0x00, 7, 1, RN_8},
+    {0, 0x01, 0, 1, RN_9},
+    {0, 0x01, 1, 1, RN_10},
+    {0, 0x01, 2, 1, RN_11},
+    {0, 0x01, 3, 1, RN_12},
+    {0, 0x01, 4, 1, RN_13},
+    {0, 0x01, 5, 1, RN_14},
+    {0, 0x01, 6, 1, RN_15},
+    {0, 0x01, 7, 1, RN_16},
+    {0, 0x02, 0, 1, RN_17},
+    {0, 0x02, 1, 1, RN_18},
+    {0, 0x02, 2, 1, RN_19},
+    {0, 0x02, 3, 1, RN_20},
+    {0, 0x02, 4, 1, RN_21},
+    {0, 0x02, 5, 1, RN_22},
+    {0, 0x02, 6, 1, RN_23},
+    {0, 0x02, 7, 1, RN_24},
+    {0, 0x03, 0, 8, RN_25},
+    {0, 0x03, 0, 1, RN_26},
+    {0, 0x03, 1, 1, RN_27},
+    {0, 0x03, 2, 1, RN_28},
+    {0, 0x03, 3, 1, RN_29},
+    {0, 0x03, 4, 1, RN_30},
+    {0, 0x03, 5, 1, RN_31},
+    {0, 0x03, 6, 1, RN_32},
+    {0, 0x03, 7, 1, RN_33},
+    {0, 0x04, 0, 8, RN_34},
+    {0, 0x04, 0, 1, RN_35},
+    {0, 0x04, 1, 1, RN_36},
+    {0, 0x04, 2, 1, RN_37},
+    {0, 0x04, 3, 1, RN_38},
+    {0, 0x04, 4, 1, RN_39},
+    {0, 0x04, 5, 1, RN_40},
+    {0, 0x04, 6, 1, RN_41},
+    {0, 0x04, 7, 1, RN_42},
+    {0, 0x05, 0, 8, RN_43},
+    {0, 0x05, 0, 1, RN_44},
+    {0, 0x05, 1, 1, RN_45},
+    {0, 0x05, 2, 1, RN_46},
+    {0, 0x05, 3, 1, RN_47},
+    {0, 0x05, 4, 1, RN_48},
+    {0, 0x06, 0, 9, RN_49},
+    {0, 0x07, 1, 11, RN_50},
+    {0, 0x09, 6, 1, RN_51},
+    {0, 0x09, 7, 1, RN_52},
+    {0, 0x0a, 0, 1, RN_53},
+    {0, 0x0a, 1, 1, RN_54},
+    {0, 0x0a, 4, 1, RN_55},
+    {0, 0x0a, 5, 1, RN_56},
+    {0, 0x0a, 6, 1, RN_57},
+    {0, 0x0a, 7, 1, RN_58},
+    {0, 0x0b, 0, 8, RN_59},
+    {0, 0x0c, 0, 8, RN_60},
+    {0, 0x0d, 0, 8, RN_61},
+    {0, 0x0e, 0, 1, RN_62},
+    {0, 0x0e, 1, 1, RN_63},
+    {0, 0x0e, 2, 1, RN_64},
+    {0, 0x0e, 3, 1, RN_65},
+    {0, 0x0e, 4, 1, RN_66},
+    {0, 0x0e, 5, 1, RN_67},
+    {0, 0x0e, 6, 1, RN_68},
+    {0, 0x0e, 7, 1, RN_69},
+    {0, 0x0f, 0, 8, RN_70},
+    {0, 0x0f, 0, 1, RN_71},
+    {0, 0x0f, 1, 1, RN_72},
+    {0, 0x0f, 2, 1, RN_73},
+    {0, 0x0f, 3, 1, RN_74},
+    {0, 0x0f, 4, 1, RN_75},
+    {0, 0x0f, 5, 1, RN_76},
+    {0, 0x0f, 6, 1, RN_77},
+    {0, 0x0f, 7, 1, RN_78},
+    {0, 0x10, 0, 4, RN_79},
+    {0, 0x10, 4, 1, RN_80},
+    {0, 0x10, 5, 1, RN_81},
+    {0, 0x11, 0, 1, RN_82},
+    {0, 0x11, 1, 1, RN_83},
+    {0, 0x11, 4, 11, RN_84},
+    {0, 0x13, 0, 1, RN_85},
+    {0, 0x13, 1, 1, RN_86},
+    {0, 0x13, 2, 1, RN_87},
+    {0, 0x13, 3, 1, RN_88},
+    {0, 0x13, 4, 1, RN_89},
+    {0, 0x13, 5, 1, RN_90},
+    {0, 0x13, 6, 1, RN_91},
+    {0, 0x13, 7, 1, RN_92},
+    {0, 0x14, 0, 1, RN_93},
+    {0, 0x15, 7, 1, RN_94},
+    {0, 0x16, 0, 8, RN_95},
+    {0, 0x16, 0, 1, RN_96},
+    {0, 0x16, 1, 1, RN_97},
+    {0, 0x16, 2, 1, RN_98},
+    {0, 0x16, 3, 1, RN_99},
+    {0, 0x17, 0, 12, RN_100},
+    {0, 0x19, 0, 12, RN_101},
+    {0, 0x1b, 0, 11, RN_102},
+    {0, 0x1f, 0, 8, RN_103},
+    {0, 0x20, 0, 16, RN_104},
+    {0, 0x23, 0, 8, RN_105},
+    {0, 0x2e, 0, 16, RN_106},
+    {0, 0x2e, 0, 8, RN_107},
+    {0, 0x2f, 0, 8, RN_108},
+    {0, 0x40, 0, 1, RN_109},
+    {0, 0x40, 1, 1, RN_110},
+    {0, 0x40, 2, 1, RN_111},
+    {0, 0x40, 3, 1, RN_112},
+    {0, 0x40, 4, 3, RN_113},
+    {0, 0x41, 0, 8, RN_114},
+    {0, 0x43, 0, 8, RN_115},
+    {0, 0x43, 0, 2, RN_116},
+    {0, 0x43, 2, 2, RN_117},
+    {0, 0x43, 4, 1, RN_118},
+    {0, 0x43, 5, 1, RN_119},
+    {0, 0x44, 0, 1, RN_120},
+    {0, 0x44, 2, 1, RN_121},
+    {0, 0x44, 5, 1, RN_122},
+    {0, 0x45, 0, 1, RN_123},
+    {0, 0x45, 2, 1, RN_124},
+    {0, 0x45, 3, 1, RN_125},
+    {0, 0x45, 4, 1, RN_126},
+    {0, 0x46, 0, 8, RN_127},
+    {0, 0x46, 0, 1, RN_128},
+    {0, 0x46, 1, 1, RN_129},
+    {0, 0x46, 2, 1, RN_130},
+    {0, 0x46, 4, 1, RN_131},
+    {0, 0x46, 6, 1, RN_132},
+    {0, 0x47, 0, 8, RN_133},
+    {0, 0x47, 0, 1, RN_134},
+    {0, 0x47, 1, 1, RN_135},
+    {0, 0x47, 2, 1, RN_136},
+    {0, 0x47, 3, 1, RN_137},
+    {0, 0x47, 4, 1, RN_138},
+    {0, 0x48, 0, 8, RN_139},
+    {0, 0x48, 0, 1, RN_140},
+    {0, 0x48, 6, 1, RN_141},
+    {0, 0x48, 7, 1, RN_142},
+    {0, 0x49, 0, 8, RN_143},
+    {0, 0x49, 0, 1, RN_144},
+    {0, 0x49, 1, 1, RN_145},
+    {0, 0x49, 2, 1, RN_146},
+    {0, 0x49, 4, 1, RN_147},
+    {0, 0x4a, 0, 3, RN_148},
+    {0, 0x4b, 1, 1, RN_149},
+    {0, 0x4b, 2, 1, RN_150},
+    {0, 0x4d, 0, 5, RN_151},
+    {0, 0x4d, 5, 1, RN_152},
+    {0, 0x4f, 5, 1, RN_153},
+    {0, 0x4f, 6, 2, RN_154},
+    {0, 0x52, 0, 8, RN_155},
+    {0, 0x53, 0, 8, RN_156},
+    {0, 0x58, 0, 8, RN_157},
+    {0, 0x58, 0, 1, RN_158},
+    {0, 0x58, 1, 1, RN_159},
+    {0, 0x58, 4, 1, RN_160},
+    {0, 0x59, 0, 8, RN_161},
+    {0, 0x90, 0, 1, RN_162},
+    {0, 0x90, 1, 3, RN_163},
+    {0, 0x90, 4, 2, RN_164},
+    {0, 0x90, 6, 1, RN_165},
+    {0, 0x90, 7, 1, RN_166},
+    {0, 0x91, 0, 4, RN_167},
+    {0, 0x91, 4, 4, RN_168},
+    {0, 0x92, 0, 3, RN_169},
+    {0, 0x92, 3, 3, RN_170},
+    {0, 0x92, 6, 3, RN_171},
+    {0, 0x93, 1, 3, RN_172},
+    {0, 0x93, 4, 3, RN_173},
+    {0, 0x93, 7, 1, RN_174},
+    {0, 0x94, 0, 1, RN_175},
+    {0, 0x94, 2, 1, RN_176},
+    {0, 0x94, 3, 1, RN_177},
+    {0, 0x94, 4, 4, RN_178},
+    {0, 0x95, 0, 8, RN_179},
+    {0, 0x96, 0, 8, RN_180},
+    {0, 0x97, 0, 8, RN_181},
+    {0, 0x98, 0, 8, RN_182},
+    {1, 0x00, 0, 1, RN_183},
+    {1, 0x00, 1, 1, RN_184},
+    {1, 0x00, 2, 1, RN_185},
+    {1, 0x00, 3, 1, RN_186},
+    {1, 0x00, 4, 1, RN_187},
+    {1, 0x00, 5, 1, RN_188},
+    {1, 0x00, 6, 1, RN_189},
+    {1, 0x00, 7, 1, RN_190},
+    {1, 0x01, 0, 1, RN_191},
+    {1, 0x01, 7, 1, RN_192},
+    {1, 0x02, 0, 8, RN_193},
+    {1, 0x02, 0, 1, RN_194},
+    {1, 0x02, 1, 1, RN_195},
+    {1, 0x02, 2, 1, RN_196},
+    {1, 0x02, 3, 1, RN_197},
+    {1, 0x02, 4, 1, RN_198},
+    {1, 0x02, 5, 2, RN_199},
+    {1, 0x0b, 4, 2, RN_200},
+    {1, 0x0b, 6, 1, RN_201},
+    {1, 0x0b, 7, 1, RN_202},
+    {1, 0x0c, 0, 1, RN_203},
+    {1, 0x0c, 1, 4, RN_204},
+    {1, 0x0c, 5, 11, RN_205},
+    {1, 0x0e, 0, 11, RN_206},
+    {1, 0x10, 0, 11, RN_207},
+    {1, 0x12, 0, 11, RN_208},
+    {1, 0x16, 0, 11, RN_209},
+    {1, 0x18, 0, 11, RN_210},
+    {1, 0x1a, 0, 11, RN_211},
+    {1, 0x1c, 0, 11, RN_212},
+    {1, 0x1e, 0, 11, RN_213},
+    {1, 0x20, 0, 12, RN_214},
+    {1, 0x22, 0, 12, RN_215},
+    {1, 0x24, 0, 12, RN_216},
+    {1, 0x26, 0, 12, RN_217},
+    {1, 0x28, 1, 1, RN_218},
+    {1, 0x28, 2, 1, RN_219},
+    {1, 0x28, 3, 1, RN_220},
+    {1, 0x28, 4, 4, RN_221},
+    {1, 0x29, 0, 1, RN_222},
+    {1, 0x29, 1, 1, RN_223},
+    {1, 0x2a, 0, 4, RN_224},
+    {1, 0x2a, 4, 4, RN_225},
+    {1, 0x2b, 0, 7, RN_226},
+    {1, 0x2b, 7, 1, RN_227},
+    {1, 0x2c, 0, 1, RN_228},
+    {1, 0x2c, 1, 1, RN_229},
+    {1, 0x2c, 2, 1, RN_230},
+    {1, 0x2c, 3, 1, RN_231},
+    {1, 0x2c, 4, 1, RN_232},
+    {1, 0x2d, 0, 8, RN_233},
+    {1, 0x30, 1, 1, RN_234},
+    {1, 0x30, 2, 1, RN_235},
+    {1, 0x30, 3, 1, RN_236},
+    {1, 0x32, 0, 8, RN_237},
+    {1, 0x34, 0, 8, RN_238},
+    {1, 0x36, 0, 8, RN_239},
+    {1, 0x37, 0, 11, RN_240},
+    {1, 0x39, 0, 11, RN_241},
+    {1, 0x3b, 0, 12, RN_242},
+    {1, 0x3d, 0, 12, RN_243},
+    {1, 0x3f, 0, 12, RN_244},
+    {1, 0x41, 0, 12, RN_245},
+    {1, 0x43, 0, 12, RN_246},
+    {1, 0x45, 0, 12, RN_247},
+    {1, 0x47, 0, 12, RN_248},
+    {1, 0x49, 0, 12, RN_249},
+    {1, 0x53, 0, 8, RN_250},
+    {1, 0x54, 0, 8, RN_251},
+    {1, 0x55, 0, 8, RN_252},
+    {1, 0x60, 0, 5, RN_253},
+    {1, 0x60, 5, 3, RN_254},
+    {1, 0x61, 0, 5, RN_255},
+    {1, 0x61, 5, 3, RN_256},
+    {1, 0x63, 6, 1, RN_257},
+    {1, 0x63, 7, 1, RN_258},
+    {1, 0x65, 0, 7, RN_259},
+    {1, 0x65, 7, 1, RN_260},
+    {1, 0x66, 0, 8, RN_261},
+    {1, 0x67, 0, 8, RN_262},
+    {1, 0x6a, 0, 8, RN_263},
+    {1, 0x6b, 0, 8, RN_264},
+    {1, 0x6c, 0, 8, RN_265},
+    {1, 0x6e, 0, 8, RN_266},
+    {1, 0x6f, 0, 7, RN_267},
+    {1, 0x70, 0, 7, RN_268},
+    {1, 0x71, 0, 7, RN_269},
+    {1, 0x73, 0, 7, RN_270},
+    {1, 0x74, 0, 7, RN_271},
+    {1, 0x75, 0, 7, RN_272},
+    {1, 0x7f, 0, 7, RN_273},
+    {2, 0x00, 0, 8, RN_274},
+    {2, 0x00, 7, 1, RN_275},
+    {2, 0x02, 6, 1, RN_276},
+    {2, 0x02, 7, 1, RN_277},
+    {2, 0x0a, 5, 1, RN_278},
+    {2, 0x0a, 7, 1, RN_279},
+    {2, 0x0b, 0, 7, RN_280},
+    {2, 0x0c, 4, 1, RN_281},
+    {2, 0x0c, 5, 1, RN_282},
+    {2, 0x16, 5, 1, RN_283},
+    {2, 0x16, 6, 1, RN_284},
+    {2, 0x16, 7, 1, RN_285},
+    {2, 0x17, 0, 8, RN_286},
+    {2, 0x17, 0, 4, RN_287},
+    {2, 0x17, 4, 4, RN_288},
+    {2, 0x18, 3, 1, RN_289},
+    {2, 0x19, 0, 1, RN_290},
+    {2, 0x19, 2, 1, RN_291},
+    {2, 0x19, 3, 1, RN_292},
+    {2, 0x19, 4, 4, RN_293},
+    {2, 0x21, 4, 1, RN_294},
+    {2, 0x21, 5, 1, RN_295},
+    {2, 0x24, 2, 1, RN_296},
+    {2, 0x26, 6, 1, RN_297},
+    {2, 0x27, 0, 7, RN_298},
+    {2, 0x31, 0, 2, RN_299},
+    {2, 0x31, 2, 1, RN_300},
+    {2, 0x35, 3, 1, RN_301},
+    {2, 0x35, 4, 1, RN_302},
+    {2, 0x35, 5, 1, RN_303},
+    {2, 0x35, 6, 1, RN_304},
+    {2, 0x39, 0, 4, RN_305},
+    {2, 0x39, 4, 4, RN_306},
+    {2, 0x3a, 0, 1, RN_307},
+    {2, 0x3a, 3, 1, RN_308},
+    {2, 0x3a, 5, 2, RN_309},
+    {2, 0x3a, 7, 1, RN_310},
+    {2, 0x3b, 0, 7, RN_311},
+    {3, 0x00, 0, 1, RN_312},
+    {3, 0x00, 1, 1, RN_313},
+    {3, 0x00, 2, 1, RN_314},
+    {3, 0x00, 3, 1, RN_315},
+    {3, 0x00, 4, 1, RN_316},
+    {3, 0x00, 5, 1, RN_317},
+    {3, 0x00, 6, 1, RN_318},
+    {3, 0x00, 7, 1, RN_319},
+    {3, 0x01, 0, 12, RN_320},
+    {3, 0x02, 4, 11, RN_321},
+    {3, 0x04, 0, 12, RN_322},
+    {3, 0x05, 4, 12, RN_323},
+    {3, 0x07, 0, 11, RN_324},
+    {3, 0x08, 4, 11, RN_325},
+    {3, 0x0a, 0, 12, RN_326},
+    {3, 0x0b, 4, 12, RN_327},
+    {3, 0x0d, 0, 11, RN_328},
+    {3, 0x0e, 4, 11, RN_329},
+    {3, 0x10, 0, 12, RN_330},
+    {3, 0x11, 4, 12, RN_331},
+    {3, 0x13, 0, 11, RN_332},
+    {3, 0x14, 4, 11, RN_333},
+    {3, 0x16, 0, 10, RN_334},
+    {3, 0x17, 4, 10, RN_335},
+    {3, 0x19, 0, 10, RN_336},
+    {3, 0x1a, 4, 1, RN_337},
+    {3, 0x1a, 5, 1, RN_338},
+    {3, 0x1a, 6, 1, RN_339},
+    {3, 0x1a, 7, 1, RN_340},
+    {3, 0x1b, 0, 32, RN_341},
+    {3, 0x1f, 0, 4, RN_342},
+    {3, 0x1f, 4, 1, RN_343},
+    {3, 0x1f, 5, 1, RN_344},
+    {3, 0x20, 0, 11, RN_345},
+    {3, 0x22, 0, 11, RN_346},
+    {3, 0x24, 0, 8, RN_347},
+    {3, 0x24, 0, 1, RN_348},
+    {3, 0x24, 1, 1, RN_349},
+    {3, 0x24, 2, 1, RN_350},
+    {3, 0x24, 3, 1, RN_351},
+    {3, 0x24, 4, 2, RN_352},
+    {3, 0x24, 6, 2, RN_353},
+    {3, 0x25, 0, 10, RN_354},
+    {3, 0x26, 6, 1, RN_355},
+    {3, 0x26, 7, 1, RN_356},
+    {3, 0x27, 0, 4, RN_357},
+    {3, 0x27, 4, 4, RN_358},
+    {3, 0x28, 0, 8, RN_359},
+    {3, 0x29, 0, 8, RN_360},
+    {3, 0x2a, 0, 1, RN_361},
+    {3, 0x2a, 4, 2, RN_362},
+    {3, 0x2a, 6, 2, RN_363},
+    {3, 0x2b, 0, 4, RN_364},
+    {3, 0x2b, 4, 3, RN_365},
+    {3, 0x2b, 7, 1, RN_366},
+    {3, 0x2c, 0, 8, RN_367},
+    {3, 0x2d, 0, 8, RN_368},
+    {3, 0x2e, 0, 8, RN_369},
+    {3, 0x2f, 0, 8, RN_370},
+    {3, 0x30, 0, 8, RN_371},
+    {3, 0x31, 0, 4, RN_372},
+    {3, 0x31, 4, 1, RN_373},
+    {3, 0x31, 5, 1, RN_374},
+    {3, 0x32, 0, 2, RN_375},
+    {3, 0x32, 2, 1, RN_376},
+    {3, 0x32, 3, 1, RN_377},
+    {3, 0x32, 4, 3, RN_378},
+    {3, 0x32, 7, 1, RN_379},
+    {3, 0x33, 0, 8, RN_380},
+    {3, 0x34, 0, 8, RN_381},
+    {3, 0x35, 0, 8, RN_382},
+    {3, 0x36, 0, 8, RN_383},
+    {3, 0x37, 0, 8, RN_384},
+    {3, 0x38, 0, 8, RN_385},
+    {3, 0x39, 0, 8, RN_386},
+    {3, 0x3a, 0, 8, RN_387},
+    {3, 0x3b, 0, 8, RN_388},
+    {3, 0x3c, 0, 8, RN_389},
+    {3, 0x3d, 0, 9, RN_390},
+    {3, 0x3e, 3, 1, RN_391},
+    {3, 0x3e, 4, 1, RN_392},
+    {3, 0x3e, 7, 1, RN_393},
+    {3, 0x3f, 0, 8, RN_394},
+    {3, 0x40, 0, 1, RN_395},
+    {3, 0x40, 1, 1, RN_396},
+    {3, 0x40, 2, 1, RN_397},
+    {3, 0x40, 4, 2, RN_398},
+    {3, 0x41, 0, 10, RN_399},
+    {3, 0x42, 6, 1, RN_400},
+    {3, 0x43, 0, 1, RN_401},
+    {3, 0x43, 1, 1, RN_402},
+    {3, 0x43, 2, 1, RN_403},
+    {3, 0x43, 3, 1, RN_404},
+    {3, 0x44, 0, 3, RN_405},
+    {3, 0x44, 3, 5, RN_406},
+    {3, 0x45, 0, 6, RN_407},
+    {3, 0x46, 0, 3, RN_408},
+    {3, 0x46, 3, 5, RN_409},
+    {3, 0x47, 0, 6, RN_410},
+    {3, 0x48, 0, 3, RN_411},
+    {3, 0x48, 3, 5, RN_412},
+    {3, 0x49, 0, 6, RN_413},
+    {3, 0x4a, 0, 3, RN_414},
+    {3, 0x4a, 3, 5, RN_415},
+    {3, 0x4b, 0, 6, RN_416},
+    {3, 0x4c, 0, 3, RN_417},
+    {3, 0x4c, 3, 5, RN_418},
+    {3, 0x4d, 0, 6, RN_419},
+    {3, 0x4e, 0, 1, RN_420},
+    {3, 0x4e, 1, 1, RN_421},
+    {3, 0x4e, 3, 1, RN_422},
+    {3, 0x4e, 4, 3, RN_423},
+    {3, 0x4f, 0, 6, RN_424},
+    {3, 0x50, 0, 4, RN_425},
+    {3, 0x50, 4, 1, RN_426},
+    {3, 0x50, 5, 1, RN_427},
+    {3, 0x50, 6, 1, RN_428},
+    {3, 0x50, 7, 1, RN_429},
+    {3, 0x51, 7, 11, RN_430},
+    {3, 0x52, 4, 1, RN_431},
+    {3, 0x52, 5, 1, RN_432},
+    {3, 0x52, 6, 1, RN_433},
+    {3, 0x52, 7, 1, RN_434},
+    {3, 0x53, 0, 7, RN_435},
+    {3, 0x53, 7, 1, RN_436},
+    {3, 0x54, 0, 4, RN_437},
+    {3, 0x54, 4, 4, RN_438},
+    {3, 0x55, 0, 4, RN_439},
+    {3, 0x55, 4, 1, RN_440},
+    {3, 0x55, 6, 1, RN_441},
+    {3, 0x55, 7, 1, RN_442},
+    {3, 0x56, 0, 7, RN_443},
+    {3, 0x56, 7, 1, RN_444},
+    {3, 0x57, 0, 8, RN_445},
+    {3, 0x58, 0, 8, RN_446},
+    {3, 0x59, 0, 8, RN_447},
+    {3, 0x5a, 0, 8, RN_448},
+    {3, 0x5b, 0, 7, RN_449},
+    {3, 0x5b, 7, 15, RN_450},
+    {3, 0x5d, 6, 8, RN_451},
+    {3, 0x5e, 6, 7, RN_452},
+    {3, 0x5f, 5, 5, RN_453},
+    {3, 0x60, 2, 1, RN_454},
+    {3, 0x60, 3, 1, RN_455},
+    {3, 0x60, 4, 10, RN_456},
+    {3, 0x61, 6, 10, RN_457},
+    {3, 0x63, 0, 4, RN_458},
+    {3, 0x63, 4, 8, RN_459},
+    {3, 0x64, 4, 8, RN_460},
+    {3, 0x65, 4, 1, RN_461},
+    {3, 0x65, 5, 8, RN_462},
+    {3, 0x66, 5, 10, RN_463},
+    {3, 0x67, 7, 10, RN_464},
+    {3, 0x69, 1, 4, RN_465},
+    {3, 0x69, 5, 8, RN_466},
+    {3, 0x6a, 5, 8, RN_467},
+    {3, 0x6b, 5, 1, RN_468},
+    {3, 0x6b, 6, 8, RN_469},
+    {3, 0x6d, 0, 12, RN_470},
+    {3, 0x6e, 4, 12, RN_471},
+    {3, 0x70, 0, 11, RN_472},
+    {3, 0x71, 4, 11, RN_473},
+    {3, 0x72, 7, 1, RN_474},
+    {3, 0x73, 0, 3, RN_475},
+    {3, 0x73, 3, 1, RN_476},
+    {3, 0x73, 4, 4, RN_477},
+    {3, 0x74, 0, 4, RN_478},
+    {3, 0x74, 4, 4, RN_479},
+    {3, 0x80, 0, 1, RN_480},
+    {3, 0x80, 1, 1, RN_481},
+    {3, 0x80, 2, 1, RN_482},
+    {3, 0x80, 3, 1, RN_483},
+    {3, 0x80, 4, 2, RN_484},
+    {3, 0x80, 6, 1, RN_485},
+    {3, 0x80, 7, 1, RN_486},
+    {3, 0x81, 0, 1, RN_487},
+    {3, 0x81, 3, 1, RN_488},
+    {3, 0x81, 7, 1, RN_489},
+    {3, 0x82, 0, 8, RN_490},
+    {3, 0x83, 0, 8, RN_491},
+    {3, 0x84, 0, 8, RN_492},
+    {3, 0x85, 0, 8, RN_493},
+    {3, 0x86, 0, 8, RN_494},
+    {3, 0x87, 0, 8, RN_495},
+    {3, 0x88, 0, 12, RN_496},
+    {3, 0x8a, 0, 12, RN_497},
+    {3, 0x8c, 0, 11, RN_498},
+    {3, 0x8e, 0, 11, RN_499},
+    {4, 0x00, 0, 8, RN_500},
+    {4, 0x00, 4, 1, RN_501},
+    {4, 0x00, 7, 1, RN_502},
+    {4, 0x12, 0, 1, RN_503},
+    {4, 0x12, 1, 1, RN_504},
+    {4, 0x12, 2, 1, RN_505},
+    {4, 0x13, 0, 1, RN_506},
+    {4, 0x13, 1, 1, RN_507},
+    {4, 0x13, 2, 1, RN_508},
+    {4, 0x15, 0, 1, RN_509},
+    {4, 0x1b, 0, 3, RN_510},
+    {4, 0x1b, 4, 3, RN_511},
+    {4, 0x21, 0, 1, RN_512},
+    {4, 0x21, 1, 1, RN_513},
+    {4, 0x21, 5, 1, RN_514},
+    {4, 0x22, 0, 1, RN_515},
+    {4, 0x22, 1, 1, RN_516},
+    {4, 0x22, 3, 1, RN_517},
+    {4, 0x24, 0, 21, RN_518},
+    {4, 0x27, 0, 21, RN_519},
+    {4, 0x2b, 0, 1, RN_520},
+    {4, 0x2b, 1, 2, RN_521},
+    {4, 0x2b, 3, 1, RN_522},
+    {4, 0x2b, 5, 1, RN_523},
+    {4, 0x2b, 7, 1, RN_524},
+    {4, 0x2c, 0, 8, RN_525},
+    {4, 0x2d, 0, 8, RN_526},
+    {4, 0x37, 0, 10, RN_527},
+    {4, 0x39, 0, 10, RN_528},
+    {4, 0x42, 0, 1, RN_529},
+    {4, 0x42, 2, 1, RN_530},
+    {4, 0x42, 3, 1, RN_531},
+    {4, 0x42, 5, 1, RN_532},
+    {4, 0x42, 7, 1, RN_533},
+    {4, 0x44, 0, 21, RN_534},
+    {4, 0x47, 0, 21, RN_535},
+    {4, 0x4a, 0, 1, RN_536},
+    {4, 0x4a, 4, 1, RN_537},
+    {4, 0x4b, 0, 3, RN_538},
+    {4, 0x4b, 4, 3, RN_539},
+    {4, 0x4d, 4, 1, RN_540},
+    {4, 0x4d, 5, 2, RN_541},
+    {4, 0x4d, 7, 1, RN_542},
+    {4, 0x4e, 0, 8, RN_543},
+    {4, 0x50, 5, 1, RN_544},
+    {4, 0x50, 6, 1, RN_545},
+    {4, 0x50, 7, 1, RN_546},
+    {4, 0x51, 0, 21, RN_547},
+    {4, 0x54, 0, 21, RN_548},
+    {4, 0x57, 0, 10, RN_549},
+    {4, 0x59, 0, 10, RN_550},
+    {4, 0x5b, 7, 1, RN_551},
+    {5, 0x00, 0, 8, RN_552},
+    {5, 0x00, 0, 2, RN_553},
+    {5, 0x00, 3, 1, RN_554},
+    {5, 0x00, 4, 1, RN_555},
+    {5, 0x02, 0, 1, RN_556},
+    {5, 0x02, 1, 5, RN_557},
+    {5, 0x02, 6, 2, RN_558},
+    {5, 0x03, 0, 8, RN_559},
+    {5, 0x03, 0, 1, RN_560},
+    {5, 0x03, 1, 1, RN_561},
+    {5, 0x03, 2, 1, RN_562},
+    {5, 0x03, 3, 1, RN_563},
+    {5, 0x03, 4, 2, RN_564},
+    {5, 0x04, 0, 8, RN_565},
+    {5, 0x04, 0, 2, RN_566},
+    {5, 0x04, 1, 1, RN_567},
+    {5, 0x04, 2, 3, RN_568},
+    {5, 0x05, 0, 8, RN_569},
+    {5, 0x05, 0, 1, RN_570},
+    {5, 0x06, 0, 8, RN_571},
+    {5, 0x07, 0, 8, RN_572},
+    {5, 0x08, 0, 8, RN_573},
+    {5, 0x09, 0, 8, RN_574},
+    {5, 0x0a, 0, 8, RN_575},
+    {5, 0x0b, 0, 8, RN_576},
+    {5, 0x0c, 0, 8, RN_577},
+    {5, 0x0c, 1, 1, RN_578},
+    {5, 0x0c, 3, 1, RN_579},
+    {5, 0x0c, 4, 1, RN_580},
+    {5, 0x0e, 0, 1, RN_581},
+    {5, 0x0e, 1, 1, RN_582},
+    {5, 0x0e, 2, 2, RN_583},
+    {5, 0x0e, 4, 2, RN_584},
+    {5, 0x0e, 7, 1, RN_585},
+    {5, 0x0f, 0, 8, RN_586},
+    {5, 0x11, 0, 8, RN_587},
+    {5, 0x11, 0, 1, RN_588},
+    {5, 0x11, 1, 1, RN_589},
+    {5, 0x11, 2, 1, RN_590},
+    {5, 0x11, 3, 1, RN_591},
+    {5, 0x11, 4, 1, RN_592},
+    {5, 0x11, 5, 1, RN_593},
+    {5, 0x11, 6, 1, RN_594},
+    {5, 0x11, 7, 1, RN_595},
+    {5, 0x12, 0, 12, RN_596},
+    {5, 0x16, 0, 8, RN_597},
+    {5, 0x16, 0, 2, RN_598},
+    {5, 0x16, 2, 2, RN_599},
+    {5, 0x16, 4, 2, RN_600},
+    {5, 0x16, 6, 2, RN_601},
+    {5, 0x17, 0, 3, RN_602},
+    {5, 0x18, 0, 1, RN_603},
+    {5, 0x18, 1, 5, RN_604},
+    {5, 0x18, 6, 1, RN_605},
+    {5, 0x18, 7, 1, RN_606},
+    {5, 0x19, 0, 1, RN_607},
+    {5, 0x19, 1, 5, RN_608},
+    {5, 0x19, 6, 1, RN_609},
+    {5, 0x19, 7, 1, RN_610},
+    {5, 0x1e, 7, 1, RN_611},
+    {5, 0x1f, 0, 8, RN_612},
+    {5, 0x1f, 0, 1, RN_613},
+    {5, 0x1f, 1, 1, RN_614},
+    {5, 0x1f, 2, 1, RN_615},
+    {5, 0x1f, 3, 1, RN_616},
+    {5, 0x1f, 4, 3, RN_617},
+    {5, 0x1f, 7, 1, RN_618},
+    {5, 0x20, 0, 1, RN_619},
+    {5, 0x20, 1, 1, RN_620},
+    {5, 0x20, 2, 1, RN_621},
+    {5, 0x20, 3, 1, RN_622},
+    {5, 0x20, 4, 1, RN_623},
+    {5, 0x26, 0, 12, RN_624},
+    {5, 0x33, 0, 8, RN_625},
+    {5, 0x35, 0, 12, RN_626},
+    {5, 0x37, 0, 8, RN_627},
+    {5, 0x38, 0, 8, RN_628},
+    {5, 0x39, 0, 8, RN_629},
+    {5, 0x3a, 0, 8, RN_630},
+    {5, 0x3b, 0, 3, RN_631},
+    {5, 0x3b, 4, 3, RN_632},
+    {5, 0x3e, 0, 8, RN_633},
+    {5, 0x3e, 0, 1, RN_634},
+    {5, 0x3e, 1, 1, RN_635},
+    {5, 0x3e, 2, 1, RN_636},
+    {5, 0x3e, 4, 1, RN_637},
+    {5, 0x3e, 5, 1, RN_638},
+    {5, 0x3f, 0, 8, RN_639},
+    {5, 0x40, 0, 8, RN_640},
+    {5, 0x41, 0, 12, RN_641},
+    {5, 0x43, 0, 12, RN_642},
+    {5, 0x45, 0, 12, RN_643},
+    {5, 0x47, 0, 12, RN_644},
+    {5, 0x49, 0, 12, RN_645},
+    {5, 0x4b, 0, 12, RN_646},
+    {5, 0x4d, 0, 12, RN_647},
+    {5, 0x4f, 0, 12, RN_648},
+    {5, 0x55, 4, 1, RN_649},
+    {5, 0x55, 6, 1, RN_650},
+    {5, 0x55, 7, 1, RN_651},
+    {5, 0x56, 0, 8, RN_652},
+    {5, 0x56, 0, 1, RN_653},
+    {5, 0x56, 1, 1, RN_654},
+    {5, 0x56, 2, 1, RN_655},
+    {5, 0x56, 3, 1, RN_656},
+    {5, 0x56, 4, 1, RN_657},
+    {5, 0x56, 5, 1, RN_658},
+    {5, 0x56, 6, 1, RN_659},
+    {5, 0x56, 7, 1, RN_660},
+    {5, 0x57, 0, 8, RN_661},
+    {5, 0x57, 0, 1, RN_662},
+    {5, 0x57, 1, 1, RN_663},
+    {5, 0x57, 2, 1, RN_664},
+    {5, 0x57, 6, 1, RN_665},
+    {5, 0x57, 7, 1, RN_666},
+    {5, 0x60, 0, 8, RN_667},
+    {5, 0x61, 0, 8, RN_668},
+    {5, 0x62, 0, 8, RN_669},
+    {5, 0x63, 0, 8, RN_670},
+    {5, 0x64, 0, 8, RN_671},
+    {5, 0x65, 0, 8, RN_672},
+    {5, 0x66, 0, 8, RN_673},
+    {5, 0x67, 0, 16, RN_674},
+    {5, 0x69, 0, 8, RN_675},
+    {5, 0xd0, 0, 32, RN_676},
+};
+#define REGISTER_NAMES_COUNT 677
+#endif
@@ -3,6 +3,18 @@
 
 #include <Wire.h>
 
+// bus accounting hooks around every transaction, busarbiter.h defines them
+#ifndef TW_BUS_BEGIN
+#define TW_BUS_BEGIN()
+#define TW_BUS_END(bytes)
+#endif
+
+// trace hooks with the data of every transaction, i2ctrace.h defines them
+#ifndef TW_TRACE_READ
+#define TW_TRACE_READ(addr, reg, data, size)
+#define TW_TRACE_WRITE(addr, reg, data, size)
+#endif
+
 namespace tw
 {
 
@@ -65,6 +77,7 @@ namespace tw
 
         inline void rawRead(uint8_t addr, uint8_t reg, uint8_t *output, uint8_t size)
         {
+            TW_BUS_BEGIN();
             Wire.beginTransmission(addr);
             Wire.write(reg);
             Wire.endTransmission();
@@ -73,6 +86,8 @@ namespace tw
             while (Wire.available()) {
                 output[rcvBytes++] = Wire.read();
             }
+            TW_BUS_END(size + 1);
+            TW_TRACE_READ(addr, reg, output, rcvBytes);
 
 #if 0
   Serial.print("READ "); Serial.print(addr, HEX); Serial.print("@"); Serial.print(reg, HEX); Serial.print(": ");
@@ -92,10 +107,13 @@ namespace tw
   }
   Serial.println();
 #endif
+            TW_BUS_BEGIN();
             Wire.beginTransmission(addr);
             Wire.write(reg);
             Wire.write(input, size);
             Wire.endTransmission();
+            TW_BUS_END(size + 1);
+            TW_TRACE_WRITE(addr, reg, input, size);
         }
 
         // Number of bytes covered by a register with a particular offset and
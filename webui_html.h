@@ -1,5 +1,5 @@
 const uint8_t webui_html[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x08, 0xe5, 0xc0, 0xf4, 0x64, 0x02, 0x03, 0x77, 0x65,
+  0x1f, 0x8b, 0x08, 0x08, 0x56, 0x10, 0xd6, 0x6a, 0x02, 0x03, 0x77, 0x65,
   0x62, 0x75, 0x69, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x00, 0xbc, 0xfd, 0x6d,
   0xb3, 0xab, 0xba, 0x96, 0x2e, 0x08, 0x7e, 0xcf, 0x5f, 0xb1, 0xfb, 0x54,
   0x74, 0x44, 0xc7, 0x5d, 0x79, 0x62, 0xf2, 0x62, 0x3c, 0xa7, 0xf3, 0xe5,
@@ -13314,886 +13314,916 @@ const uint8_t webui_html[] PROGMEM = {
   0x7c, 0xbf, 0xbc, 0x4b, 0xf7, 0x2d, 0xe7, 0xbf, 0x8d, 0xd5, 0x3e, 0xa5,
   0x00, 0xcd, 0xb4, 0xea, 0x38, 0xac, 0x41, 0x28, 0x0e, 0xda, 0x9e, 0x06,
   0xb5, 0x82, 0x78, 0x78, 0x1e, 0x53, 0x7b, 0xb1, 0xc4, 0xaf, 0xf1, 0x9d,
-  0xff, 0xaf, 0xbd, 0xaf, 0x6d, 0x6b, 0x1b, 0x59, 0x16, 0xfc, 0x9e, 0x5f,
-  0xa1, 0xd1, 0xcd, 0x93, 0xd8, 0x83, 0x31, 0x98, 0xbc, 0x1e, 0x18, 0x92,
-  0x87, 0x40, 0x32, 0xe1, 0x4e, 0x12, 0xb8, 0x31, 0x99, 0xec, 0x5d, 0x0e,
-  0x0f, 0xc8, 0xb6, 0x00, 0x4d, 0x8c, 0xe5, 0x23, 0xc9, 0x21, 0x0c, 0xc7,
-  0xfb, 0xdb, 0xb7, 0xaa, 0xba, 0x5b, 0xea, 0x57, 0x49, 0xc6, 0x26, 0x21,
-  0x7b, 0x37, 0x1f, 0x14, 0x2c, 0x75, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-  0x57, 0x57, 0x55, 0x27, 0xb4, 0xe5, 0x64, 0xb7, 0x70, 0x92, 0xf2, 0x3e,
-  0x1e, 0xe3, 0x4b, 0xdc, 0x90, 0x03, 0x90, 0xb0, 0x6a, 0x2b, 0x70, 0x70,
-  0x09, 0x7a, 0x53, 0x98, 0x9d, 0xc7, 0x03, 0x76, 0x03, 0x5a, 0xf0, 0x35,
-  0x88, 0x86, 0x38, 0xee, 0x6d, 0xef, 0x00, 0x26, 0x07, 0xe3, 0x05, 0xda,
-  0xea, 0xf3, 0x42, 0x11, 0x57, 0xd6, 0xb8, 0x2a, 0xe6, 0x9d, 0xc5, 0xcc,
-  0x60, 0x37, 0xfa, 0xe2, 0x89, 0x09, 0x96, 0xe6, 0xf6, 0xbe, 0xe1, 0x22,
-  0x36, 0x07, 0xb3, 0xb1, 0x87, 0xc4, 0x12, 0xc1, 0x60, 0x00, 0x98, 0x1f,
-  0x53, 0xb8, 0x27, 0x85, 0xc7, 0xa8, 0xc3, 0x3e, 0xcb, 0x94, 0xad, 0x39,
-  0x83, 0xca, 0x23, 0xc4, 0x6f, 0x2d, 0xea, 0xa0, 0xb0, 0xb7, 0x89, 0x0e,
-  0x62, 0xff, 0xee, 0xc0, 0x5c, 0x2d, 0x1b, 0x8c, 0x2e, 0xe1, 0x4c, 0x23,
-  0xe1, 0xbd, 0x27, 0xe6, 0xba, 0xcd, 0x01, 0x89, 0xbe, 0xc3, 0x80, 0xa4,
-  0xd9, 0x15, 0x7a, 0x5b, 0xf7, 0x27, 0x49, 0x1a, 0x27, 0xeb, 0xde, 0x38,
-  0xa6, 0x70, 0x83, 0x7a, 0xc3, 0x40, 0x77, 0x37, 0xd3, 0xcc, 0xbe, 0x6b,
-  0x22, 0x73, 0x27, 0x8f, 0x9a, 0x08, 0xf9, 0x38, 0xfd, 0x20, 0x8d, 0x80,
-  0xdd, 0xb2, 0x08, 0x12, 0x48, 0xa0, 0x33, 0x20, 0x87, 0x6b, 0xd8, 0x6a,
-  0x93, 0xe4, 0xc4, 0xfb, 0xd3, 0x60, 0x07, 0xc8, 0xc4, 0x0e, 0x67, 0xeb,
-  0xb4, 0x56, 0xcc, 0x47, 0xae, 0x86, 0xc7, 0x3d, 0xde, 0xc3, 0x75, 0x0f,
-  0xb8, 0x02, 0xcf, 0x2e, 0x08, 0x16, 0x6c, 0x2d, 0x15, 0x30, 0xb4, 0xd9,
-  0x04, 0x7e, 0x06, 0x04, 0x86, 0xc1, 0x19, 0x59, 0x37, 0x4f, 0x91, 0x37,
-  0xc2, 0x04, 0x54, 0x0a, 0x6e, 0x6b, 0xed, 0xc7, 0x17, 0x3d, 0x90, 0xcb,
-  0x03, 0xa6, 0x55, 0x4b, 0x51, 0x63, 0x65, 0x08, 0xbc, 0x8f, 0x69, 0x5d,
-  0xd8, 0x1a, 0x04, 0x63, 0x5c, 0xa6, 0xd6, 0x3d, 0xe6, 0xe3, 0x91, 0x0a,
-  0xf0, 0xd4, 0xcf, 0xf4, 0x3c, 0xbe, 0x4c, 0x99, 0xc1, 0x15, 0x74, 0xa0,
-  0x90, 0x05, 0xa1, 0x44, 0x23, 0x0f, 0x4a, 0xa2, 0x9c, 0x06, 0x2a, 0x81,
-  0x04, 0xaf, 0x68, 0x08, 0x76, 0xdc, 0xe3, 0x38, 0x4d, 0xd1, 0x0a, 0xdb,
-  0x42, 0x22, 0x9e, 0x46, 0x67, 0x98, 0xd7, 0x8f, 0x0e, 0x42, 0x68, 0xaf,
-  0x4d, 0xb6, 0x26, 0xd0, 0x93, 0xce, 0x60, 0x1f, 0x9d, 0xe2, 0x8a, 0xc9,
-  0xd6, 0xa5, 0xb6, 0xb7, 0x87, 0xfb, 0x83, 0xcb, 0x28, 0x85, 0x7a, 0xec,
-  0x94, 0x47, 0xc3, 0xb9, 0x9e, 0x4b, 0xfb, 0x8f, 0x11, 0xff, 0x1a, 0xaa,
-  0x37, 0x56, 0xd9, 0x92, 0x3b, 0xab, 0xb2, 0xf5, 0xe2, 0xde, 0x1d, 0x97,
-  0xfa, 0x30, 0xc7, 0x6e, 0x4c, 0xf7, 0x7f, 0xdd, 0x59, 0xba, 0x5f, 0x10,
-  0x67, 0x09, 0xc6, 0xfa, 0x9e, 0x43, 0x40, 0xd8, 0x0c, 0xc2, 0xaf, 0x1c,
-  0x95, 0xfa, 0xe6, 0x8f, 0xf0, 0x6b, 0x38, 0x8c, 0xc7, 0x20, 0x53, 0xde,
-  0xc7, 0x83, 0xf0, 0x7b, 0x4a, 0xf4, 0xd7, 0x23, 0x66, 0xb5, 0xce, 0xc8,
-  0xf0, 0x2d, 0xb0, 0x00, 0x71, 0x31, 0xc1, 0xcb, 0x71, 0x41, 0x23, 0x40,
-  0xa1, 0x1e, 0x44, 0x23, 0xd0, 0x22, 0x83, 0x24, 0x8a, 0x27, 0x28, 0xc3,
-  0x7b, 0x93, 0xb3, 0x33, 0x52, 0x7f, 0xe3, 0xd8, 0x2d, 0xda, 0x66, 0xdc,
-  0x98, 0x59, 0xbc, 0x4f, 0xf2, 0x11, 0x99, 0x75, 0x00, 0xe8, 0xaa, 0xf9,
-  0x3e, 0xdd, 0xd2, 0xbe, 0xcc, 0xc3, 0x5f, 0x6a, 0x8f, 0x44, 0x17, 0x4d,
-  0x30, 0x2c, 0xda, 0x10, 0xbb, 0xb8, 0x0f, 0xc4, 0xe8, 0x02, 0xb8, 0xef,
-  0x39, 0x24, 0x9f, 0xd1, 0x98, 0x94, 0x9f, 0x9f, 0xe3, 0x25, 0xe4, 0xb0,
-  0xcc, 0x00, 0x0e, 0x4c, 0x94, 0x7f, 0x65, 0x36, 0xd5, 0x28, 0xf1, 0xc8,
-  0xde, 0xca, 0xe2, 0x22, 0x25, 0xe5, 0xa1, 0xea, 0xa0, 0x9e, 0xee, 0x4f,
-  0xe6, 0x69, 0x0c, 0x54, 0xe8, 0x17, 0x30, 0xcc, 0x38, 0xd4, 0xe2, 0xb0,
-  0x4d, 0x00, 0x17, 0x0e, 0x63, 0xed, 0x3b, 0x33, 0xd4, 0xf0, 0x06, 0xf1,
-  0x5f, 0xc0, 0xd5, 0xe1, 0x39, 0xcb, 0x7f, 0x07, 0x87, 0x2c, 0xbf, 0xae,
-  0x3b, 0xa3, 0x2b, 0x28, 0x98, 0xfb, 0xe2, 0x71, 0x8c, 0xe7, 0x0a, 0x95,
-  0x9a, 0xfb, 0x02, 0x09, 0x9f, 0x20, 0x30, 0x3d, 0x84, 0xcb, 0xdf, 0xda,
-  0x39, 0x98, 0x40, 0xc4, 0x95, 0x79, 0x1b, 0x1e, 0x10, 0x34, 0x4c, 0x6b,
-  0x9c, 0xc6, 0x33, 0x25, 0x33, 0xbc, 0x9d, 0xab, 0x98, 0xca, 0x1d, 0x41,
-  0x97, 0x6f, 0xf9, 0xba, 0xe4, 0x72, 0x57, 0xd0, 0xb9, 0x6f, 0x3c, 0xb6,
-  0xa4, 0x62, 0x2a, 0x1b, 0x9a, 0xf7, 0xaf, 0xdf, 0x7b, 0xef, 0x5c, 0x65,
-  0xe6, 0x72, 0xa8, 0x5d, 0xfa, 0x7f, 0x8a, 0x8e, 0x14, 0x21, 0x56, 0x45,
-  0xc8, 0x8f, 0xce, 0x42, 0x73, 0x51, 0xb2, 0xf3, 0x3f, 0x8a, 0x23, 0xdf,
-  0x76, 0x6f, 0x89, 0x21, 0x57, 0xff, 0x67, 0x31, 0x24, 0xd0, 0x71, 0x56,
-  0x7e, 0xbc, 0xd5, 0x68, 0x84, 0x70, 0x21, 0x0e, 0xf6, 0xb5, 0x89, 0x7f,
-  0x53, 0x32, 0x0f, 0xa3, 0xb4, 0x94, 0xac, 0xef, 0xe0, 0xbb, 0xb7, 0xc7,
-  0xce, 0xef, 0x16, 0xcf, 0xa3, 0xd1, 0xf7, 0xe6, 0xd1, 0x9b, 0x92, 0xc9,
-  0x19, 0xa2, 0x91, 0x07, 0xc3, 0x80, 0xea, 0xe9, 0xdd, 0x4e, 0xa8, 0x46,
-  0xeb, 0x67, 0x21, 0x52, 0x30, 0x0c, 0x92, 0x8b, 0x32, 0x2a, 0xfd, 0x0e,
-  0x9a, 0xe8, 0x9f, 0xd1, 0x20, 0x8c, 0xbd, 0x03, 0x76, 0x20, 0x31, 0xfb,
-  0x64, 0xbd, 0xa5, 0xd9, 0xfa, 0xe6, 0xfb, 0xce, 0x56, 0x97, 0x06, 0x37,
-  0x47, 0x10, 0x67, 0x70, 0x3c, 0x3e, 0x8f, 0xb3, 0x52, 0x26, 0x7d, 0x93,
-  0x84, 0xe1, 0xdf, 0xa0, 0x97, 0x06, 0x63, 0xbc, 0x76, 0xe3, 0xe7, 0xa2,
-  0xfd, 0x5d, 0xe0, 0xef, 0xd2, 0x74, 0x10, 0x9c, 0xc6, 0x78, 0xb0, 0xfc,
-  0xc6, 0x9d, 0xed, 0x68, 0x2e, 0x41, 0x30, 0xfc, 0x39, 0x96, 0x94, 0x8b,
-  0xf0, 0x22, 0x4e, 0x4a, 0x89, 0xb4, 0x7d, 0xd5, 0x87, 0xfd, 0x51, 0x77,
-  0xe7, 0xe3, 0xd6, 0xfb, 0xbb, 0xb2, 0x5c, 0xef, 0xfc, 0x2c, 0x4c, 0xd8,
-  0x9b, 0x9c, 0x1d, 0x27, 0x21, 0x3a, 0xb3, 0x95, 0x07, 0xbc, 0x41, 0x39,
-  0x90, 0xb5, 0xe1, 0xe5, 0x5d, 0x21, 0x70, 0xf0, 0xd3, 0xac, 0x62, 0x33,
-  0x85, 0x13, 0xbf, 0x3d, 0x88, 0xb3, 0x60, 0xb8, 0xb4, 0xb4, 0xf8, 0xd9,
-  0xbe, 0xf5, 0xb3, 0x10, 0x6c, 0xe6, 0xc8, 0x61, 0x46, 0xb3, 0xe5, 0xe5,
-  0xc5, 0xd3, 0xac, 0xfd, 0x73, 0xef, 0x79, 0xd2, 0xab, 0x51, 0xff, 0x98,
-  0xbb, 0x13, 0x95, 0x11, 0xf0, 0x63, 0x88, 0x25, 0x3d, 0x46, 0xc7, 0xbb,
-  0x32, 0xc1, 0x47, 0x3f, 0x0b, 0xbf, 0xf6, 0x83, 0x61, 0x7f, 0x32, 0x0c,
-  0xb2, 0xf2, 0xe8, 0xf6, 0x77, 0xef, 0x3c, 0xf8, 0x1f, 0x94, 0xd5, 0xe4,
-  0x36, 0x26, 0xf7, 0xf3, 0x9f, 0x67, 0xe3, 0x83, 0xce, 0x37, 0xc7, 0xe4,
-  0xef, 0x96, 0x96, 0x11, 0x6c, 0x97, 0x0a, 0x7a, 0x5d, 0x60, 0xcc, 0xbb,
-  0xc2, 0x91, 0x17, 0x3f, 0x0b, 0x91, 0x07, 0xe1, 0xd7, 0x08, 0xdd, 0x26,
-  0xc8, 0x5b, 0xb6, 0x8c, 0xc8, 0x48, 0xdd, 0xcf, 0x14, 0x3c, 0x5a, 0xa5,
-  0x5e, 0xde, 0x9a, 0x7e, 0x79, 0x87, 0xa5, 0xe7, 0xec, 0x79, 0x01, 0x90,
-  0x9e, 0xfb, 0x49, 0x0c, 0xb4, 0x4f, 0xe3, 0xe4, 0xae, 0xb0, 0x6d, 0xfc,
-  0xf3, 0xc8, 0x86, 0x14, 0x2d, 0x6e, 0xa5, 0x62, 0x61, 0x0f, 0xa4, 0x42,
-  0x1a, 0x5c, 0x8c, 0x87, 0xae, 0x0c, 0x98, 0xb7, 0x9f, 0x71, 0xe5, 0x2e,
-  0x90, 0x2a, 0xe7, 0x4d, 0x3a, 0x1c, 0x3b, 0x3e, 0x1f, 0x5c, 0x44, 0x65,
-  0x54, 0x7b, 0xba, 0xba, 0x42, 0xbe, 0xf1, 0x18, 0x87, 0x75, 0x0b, 0x13,
-  0xfd, 0xf5, 0xcf, 0xb1, 0x91, 0xac, 0xb7, 0xd5, 0xd9, 0x7d, 0xe3, 0x6d,
-  0x4d, 0xb2, 0xd8, 0xdb, 0x23, 0x77, 0xee, 0xbb, 0x32, 0x89, 0xff, 0xfe,
-  0x39, 0x48, 0xcc, 0xc2, 0x9d, 0x8e, 0xc9, 0x2f, 0xf8, 0xf8, 0xaf, 0x49,
-  0x9a, 0x45, 0xa7, 0xa5, 0x3b, 0xf7, 0xee, 0xde, 0xef, 0xde, 0x3b, 0x3c,
-  0xc0, 0xad, 0xd4, 0xde, 0x6f, 0x42, 0xb4, 0x7f, 0xfd, 0xdc, 0x0b, 0x10,
-  0x46, 0x3c, 0x0e, 0x8f, 0x33, 0x4c, 0x47, 0x5b, 0x92, 0xef, 0x97, 0x2b,
-  0xf0, 0x61, 0xe6, 0x6d, 0x9f, 0x47, 0xe3, 0x79, 0xf8, 0xf5, 0x86, 0x2e,
-  0x03, 0xe9, 0x55, 0x9a, 0x85, 0x17, 0x77, 0xc7, 0x5f, 0xc0, 0x99, 0xd5,
-  0x9d, 0x2f, 0xd1, 0x88, 0xed, 0x0f, 0x48, 0xab, 0xda, 0xff, 0xa1, 0xcc,
-  0x38, 0x6f, 0x8e, 0x24, 0xa2, 0xda, 0xf1, 0x64, 0x3c, 0x80, 0x7d, 0x0e,
-  0x4c, 0xef, 0x52, 0x09, 0xca, 0x5c, 0xa8, 0xbc, 0xbd, 0x83, 0xad, 0xc5,
-  0xaf, 0xd0, 0xc1, 0x0f, 0x30, 0xac, 0xff, 0xb8, 0x3c, 0x53, 0x30, 0xaf,
-  0x31, 0x92, 0xe8, 0x07, 0x9d, 0x89, 0xdf, 0x2e, 0x19, 0xbf, 0x8b, 0xb2,
-  0x8e, 0x41, 0x59, 0x68, 0x3e, 0x3a, 0x2e, 0xb9, 0xea, 0x41, 0x92, 0xa0,
-  0x3c, 0xaf, 0x57, 0xba, 0x68, 0x29, 0xfa, 0x5d, 0x73, 0x59, 0xd5, 0x14,
-  0x93, 0xe9, 0xe0, 0xb8, 0x1f, 0x24, 0x03, 0xb7, 0xa4, 0x7c, 0x45, 0x94,
-  0xf4, 0x0e, 0xe9, 0x0e, 0x0c, 0xf4, 0x26, 0x47, 0xa7, 0xeb, 0x14, 0x03,
-  0x8d, 0xd9, 0xfe, 0xf2, 0xa8, 0xbe, 0x10, 0xad, 0xe3, 0x19, 0x58, 0x2b,
-  0x1d, 0x1a, 0xba, 0xc1, 0x33, 0xb4, 0x56, 0x30, 0x31, 0x09, 0x1f, 0xe2,
-  0xdc, 0x47, 0x9c, 0xe2, 0xc0, 0xd0, 0x4d, 0xcf, 0xee, 0xca, 0x2e, 0x55,
-  0x8f, 0xd0, 0x7f, 0x73, 0x18, 0xb1, 0x4e, 0x09, 0xff, 0x3e, 0xd6, 0x2f,
-  0x4a, 0x98, 0x63, 0xad, 0x8e, 0xdd, 0xb0, 0xc1, 0xe8, 0x85, 0xd9, 0x25,
-  0xa6, 0xe7, 0xe1, 0xfb, 0x6e, 0xe6, 0x54, 0x4f, 0xde, 0xea, 0x48, 0xad,
-  0x73, 0xa0, 0xf2, 0x25, 0x06, 0x2f, 0x25, 0xf0, 0x39, 0xa5, 0x9c, 0xde,
-  0x00, 0xc3, 0xec, 0xbf, 0xe1, 0x34, 0x38, 0xd7, 0xda, 0x33, 0xc7, 0x1c,
-  0x64, 0x6f, 0xa9, 0x8f, 0xf3, 0x9a, 0xc6, 0x86, 0xf1, 0x64, 0x40, 0x77,
-  0x4f, 0x0d, 0xe3, 0x60, 0x50, 0x32, 0xff, 0x3c, 0x16, 0xf1, 0xc1, 0x1c,
-  0xfa, 0x95, 0x1f, 0x1c, 0x11, 0x4e, 0xf3, 0x85, 0x48, 0xc2, 0x1f, 0x20,
-  0x9e, 0x18, 0x21, 0x26, 0xe3, 0x32, 0x32, 0xb0, 0x28, 0x3b, 0x26, 0x7a,
-  0x91, 0x85, 0x95, 0x68, 0x18, 0x3e, 0x1c, 0x54, 0x06, 0xef, 0x78, 0xec,
-  0x87, 0xe3, 0x6c, 0xd3, 0x6f, 0xf7, 0xa2, 0x91, 0xbf, 0x32, 0x33, 0x49,
-  0xb9, 0x70, 0x7c, 0xf1, 0xb1, 0x64, 0x05, 0xba, 0x4b, 0xd2, 0xae, 0x6e,
-  0x7a, 0xfd, 0xe8, 0x34, 0x72, 0x8b, 0xb3, 0xcf, 0xd1, 0xf2, 0x9b, 0xa8,
-  0x54, 0x64, 0xdd, 0xbe, 0x93, 0xa8, 0x55, 0x9d, 0xa0, 0x97, 0x88, 0xfb,
-  0x72, 0x30, 0xae, 0xed, 0x66, 0x13, 0xf7, 0x49, 0xd6, 0xb9, 0xae, 0xff,
-  0x12, 0xa7, 0xc7, 0x7d, 0x34, 0x45, 0x79, 0xfb, 0x18, 0xea, 0x75, 0x93,
-  0xa9, 0x33, 0x73, 0x0f, 0x40, 0x5d, 0x51, 0x33, 0x3e, 0x56, 0x1c, 0xf5,
-  0x04, 0x83, 0x28, 0xae, 0x12, 0x0b, 0x32, 0xe0, 0xe5, 0x34, 0x8d, 0x06,
-  0x2f, 0xba, 0xec, 0xc7, 0x9c, 0x7b, 0xf3, 0x52, 0x1e, 0x2d, 0x5a, 0x46,
-  0x8f, 0x26, 0xcb, 0xde, 0xe6, 0xa6, 0xac, 0xeb, 0x24, 0x45, 0x3c, 0xc9,
-  0x2a, 0x8c, 0xb5, 0x94, 0xef, 0xc6, 0xeb, 0x76, 0x77, 0x77, 0x1c, 0x3d,
-  0xb7, 0xad, 0xbd, 0xb6, 0x34, 0x93, 0xd8, 0x2f, 0x40, 0x10, 0x3a, 0xe6,
-  0xbf, 0xb0, 0xb8, 0x8e, 0xbb, 0x66, 0x75, 0xd5, 0xcd, 0x1a, 0x67, 0x69,
-  0x8f, 0x83, 0x86, 0x1e, 0x8d, 0x00, 0x57, 0xff, 0x3b, 0xd0, 0x6d, 0x18,
-  0x9f, 0x45, 0xa3, 0x8a, 0xe4, 0xee, 0x88, 0x0b, 0xe6, 0x85, 0x98, 0x9d,
-  0x74, 0x35, 0x6f, 0x39, 0x22, 0xb1, 0x5c, 0xfb, 0x06, 0x1b, 0x46, 0x23,
-  0x26, 0xca, 0x2d, 0x95, 0xc6, 0x18, 0x3c, 0x78, 0x1e, 0x0f, 0x07, 0x61,
-  0xb2, 0xe9, 0x23, 0xca, 0xb6, 0x42, 0x6c, 0x99, 0xc8, 0xc2, 0x6f, 0x56,
-  0x10, 0x49, 0x18, 0x0c, 0x50, 0x8b, 0x71, 0x84, 0x07, 0x51, 0xd3, 0xb0,
-  0x71, 0x87, 0xb9, 0x64, 0xd6, 0x5e, 0xa9, 0x77, 0x61, 0xcd, 0x0f, 0xa7,
-  0x0c, 0xe6, 0x89, 0xbb, 0x8c, 0x93, 0x81, 0x9b, 0x3a, 0x65, 0x25, 0x24,
-  0x32, 0xb8, 0x8b, 0x2d, 0x96, 0x14, 0xa5, 0xd7, 0x2f, 0x91, 0xa8, 0xe1,
-  0xd3, 0x66, 0xd9, 0x59, 0xf2, 0x07, 0xdd, 0x88, 0x34, 0x02, 0xfd, 0x36,
-  0x4e, 0xbe, 0x1c, 0xf7, 0xcf, 0x43, 0x8c, 0x4b, 0x2f, 0xbb, 0x19, 0x89,
-  0xcf, 0xb6, 0xf9, 0xef, 0x44, 0x72, 0x28, 0x16, 0x37, 0xcc, 0x33, 0x1c,
-  0x5f, 0x8c, 0xb3, 0xbb, 0x63, 0xa1, 0x12, 0xbe, 0xc8, 0x6e, 0x76, 0xe2,
-  0xea, 0x1a, 0x60, 0xbd, 0xcc, 0x83, 0x88, 0x5f, 0xec, 0xd3, 0xcf, 0xef,
-  0x13, 0xe4, 0x62, 0x9f, 0xb5, 0x95, 0x56, 0xe2, 0x72, 0xb1, 0x24, 0x4f,
-  0x39, 0xd6, 0x35, 0xc7, 0x44, 0xbf, 0x08, 0xbe, 0x0d, 0xc3, 0xd1, 0x59,
-  0x76, 0xbe, 0xe9, 0xaf, 0x19, 0x99, 0x0a, 0x56, 0x16, 0x6a, 0x74, 0x57,
-  0x08, 0x1d, 0x8c, 0xfa, 0xe1, 0xb0, 0xa6, 0xca, 0x33, 0x83, 0xe2, 0x9f,
-  0x96, 0xdf, 0x3d, 0xb2, 0xf5, 0x61, 0xfb, 0xf5, 0xbb, 0x85, 0x59, 0x78,
-  0x78, 0x5f, 0xe2, 0x2f, 0x77, 0x61, 0xd7, 0x03, 0x6b, 0x50, 0x69, 0xdf,
-  0xf7, 0xfe, 0xb8, 0x45, 0x73, 0xb5, 0x43, 0x16, 0x04, 0xc3, 0x30, 0xb9,
-  0x43, 0xa2, 0xe0, 0x32, 0x48, 0x9c, 0xc6, 0x7d, 0xa6, 0xc2, 0xbf, 0x7b,
-  0xfd, 0xf1, 0x60, 0xa6, 0x59, 0x7f, 0xcf, 0x39, 0xee, 0xb9, 0x0c, 0xc8,
-  0x03, 0x9f, 0xcf, 0xe3, 0x04, 0x04, 0x00, 0x93, 0x0b, 0xf1, 0x20, 0x18,
-  0x1e, 0x1f, 0x73, 0x13, 0xa0, 0x3e, 0xe4, 0x58, 0x82, 0x48, 0x27, 0xe4,
-  0x91, 0xf2, 0xfd, 0xc5, 0xbc, 0xd3, 0xb0, 0xe6, 0x3e, 0x23, 0xbf, 0x6e,
-  0xfa, 0x26, 0x53, 0x83, 0xa1, 0xff, 0xff, 0x67, 0xc6, 0x3d, 0x17, 0x6a,
-  0x2c, 0x78, 0xd1, 0xaf, 0x7f, 0x95, 0x9e, 0xfc, 0xc3, 0x56, 0x7b, 0x91,
-  0x13, 0xc5, 0x19, 0x24, 0xc9, 0xe8, 0x45, 0x8d, 0xdf, 0xca, 0xe2, 0x28,
-  0xc7, 0x75, 0xf6, 0x87, 0x61, 0x90, 0xcc, 0xc6, 0xc3, 0xc2, 0x23, 0x67,
-  0x18, 0x66, 0x92, 0x33, 0xe3, 0x42, 0xcf, 0x8f, 0x71, 0xb9, 0x0d, 0x40,
-  0xe5, 0x37, 0x58, 0x29, 0x1a, 0x6c, 0xfa, 0x0c, 0xf3, 0x03, 0x28, 0xb2,
-  0x05, 0x45, 0x4a, 0x6d, 0xf5, 0xac, 0xe8, 0xf1, 0xb1, 0x80, 0x67, 0x30,
-  0x37, 0xec, 0x15, 0xf9, 0xa7, 0x1b, 0x31, 0xa0, 0x54, 0x48, 0xfd, 0xa1,
-  0xf5, 0x12, 0x8d, 0x64, 0x61, 0x02, 0x5b, 0xd3, 0xe8, 0xe2, 0x0c, 0xd6,
-  0x7b, 0xa9, 0xac, 0xfc, 0xa7, 0x56, 0x89, 0x14, 0x68, 0x2e, 0x4d, 0x7d,
-  0xea, 0xf9, 0x65, 0xd8, 0x4b, 0xe3, 0xfe, 0x97, 0x30, 0xfb, 0xcc, 0xdf,
-  0xba, 0xda, 0xc3, 0x21, 0xf2, 0x30, 0xc7, 0xda, 0x17, 0x90, 0x7e, 0xfe,
-  0x8b, 0x34, 0x3a, 0x1b, 0x81, 0x24, 0xa4, 0xbd, 0x08, 0x45, 0x60, 0x5b,
-  0x9b, 0x4f, 0xfb, 0x49, 0x34, 0xce, 0xbb, 0x07, 0x10, 0x52, 0xd8, 0x9a,
-  0x67, 0xc9, 0x04, 0xd3, 0x9d, 0x6c, 0x7a, 0xd7, 0xf4, 0x9e, 0xc2, 0xc8,
-  0xd7, 0xbd, 0xc3, 0x9c, 0x06, 0xd7, 0xb4, 0x08, 0xad, 0x7b, 0x3e, 0xfe,
-  0xe7, 0xb7, 0x48, 0x5d, 0x82, 0x5f, 0x69, 0x86, 0xb1, 0xf5, 0xf0, 0x3b,
-  0x8d, 0xfe, 0x86, 0xdf, 0x6b, 0x4f, 0xbc, 0x69, 0xcb, 0xac, 0xc3, 0x92,
-  0x86, 0xc2, 0x76, 0x30, 0xaf, 0xd7, 0xbb, 0xca, 0xc2, 0xbc, 0x56, 0xc7,
-  0x5a, 0xa9, 0xb8, 0xca, 0xfc, 0x46, 0xb5, 0xa0, 0x47, 0xa4, 0x89, 0xcd,
-  0x56, 0x1b, 0xba, 0x3d, 0x53, 0x05, 0x4c, 0x4f, 0xfb, 0xa7, 0x72, 0x31,
-  0xf5, 0xac, 0xb5, 0xf1, 0x02, 0x52, 0x71, 0xff, 0xe8, 0xcc, 0x95, 0xf9,
-  0x4d, 0xa9, 0x55, 0xf5, 0x8e, 0x5a, 0xf7, 0xa6, 0x1b, 0xf7, 0xe4, 0x91,
-  0xde, 0x0f, 0x92, 0x34, 0x4c, 0xf2, 0xe1, 0x1e, 0xc7, 0x30, 0xd8, 0xab,
-  0xac, 0xf0, 0x18, 0x3f, 0xb1, 0x52, 0x5b, 0x49, 0x12, 0x5c, 0x35, 0x7a,
-  0x93, 0xd3, 0x53, 0x00, 0xc9, 0x38, 0x64, 0x27, 0x64, 0xec, 0x13, 0x63,
-  0x4a, 0x1e, 0xf6, 0xae, 0xc9, 0x81, 0x14, 0xdc, 0xc4, 0x4f, 0x25, 0x18,
-  0x10, 0x68, 0xc4, 0xac, 0x7b, 0xc8, 0x5e, 0x1d, 0x6d, 0xe4, 0x35, 0x31,
-  0x47, 0x60, 0x1b, 0xf0, 0x80, 0xe2, 0xab, 0xc5, 0x5b, 0x6c, 0x1b, 0xde,
-  0x8c, 0xc2, 0x4b, 0xef, 0x53, 0x34, 0xca, 0x9e, 0x17, 0x18, 0x35, 0x8b,
-  0x42, 0xd1, 0xa9, 0xd7, 0x50, 0x9a, 0x94, 0x31, 0x2a, 0xb0, 0x62, 0x4d,
-  0x76, 0x81, 0x34, 0x00, 0x51, 0x26, 0x43, 0xfb, 0x2c, 0xa4, 0xd7, 0x8d,
-  0x92, 0x3e, 0x6e, 0xdc, 0x53, 0xad, 0x14, 0xd9, 0x24, 0x19, 0x79, 0x87,
-  0xed, 0x76, 0xbb, 0xc0, 0xa8, 0x8d, 0xc4, 0x7f, 0x47, 0x4c, 0x87, 0xa9,
-  0xda, 0xf3, 0xd6, 0x9a, 0x47, 0xed, 0x8b, 0x60, 0xdc, 0x68, 0x34, 0xbd,
-  0xcd, 0x17, 0x1a, 0x62, 0x12, 0x2c, 0xa5, 0x03, 0xed, 0x24, 0x1c, 0x4c,
-  0xfa, 0x61, 0xa3, 0x11, 0xf4, 0xfb, 0x02, 0x85, 0xdd, 0x2c, 0xbc, 0x70,
-  0x80, 0xc0, 0x7f, 0x50, 0xf2, 0xb0, 0x28, 0xd8, 0x46, 0x26, 0x39, 0x82,
-  0x7e, 0x12, 0x59, 0xa1, 0x7f, 0x7f, 0x06, 0xc3, 0x49, 0xa8, 0x0c, 0x25,
-  0xc1, 0xdb, 0xb0, 0xc2, 0xe2, 0x28, 0x01, 0x48, 0xf3, 0xfb, 0xb4, 0xe5,
-  0x5d, 0x4f, 0xb5, 0x7a, 0xf2, 0xef, 0xe9, 0x3d, 0x0d, 0xca, 0x68, 0x32,
-  0x1c, 0xb2, 0xcf, 0x9c, 0x1b, 0xdd, 0xd8, 0x48, 0x5d, 0x63, 0x59, 0x57,
-  0xbc, 0x86, 0xd4, 0x25, 0x64, 0x71, 0x63, 0x64, 0x31, 0x0b, 0x25, 0xe3,
-  0xfa, 0x75, 0x17, 0x65, 0xb1, 0x99, 0x43, 0xc1, 0x5e, 0x4b, 0x4b, 0x47,
-  0x1b, 0x16, 0x08, 0x5c, 0x8e, 0x99, 0x30, 0x14, 0x86, 0xde, 0x27, 0xf6,
-  0x14, 0xa0, 0x4c, 0xda, 0xe4, 0x3c, 0xbc, 0xb4, 0x29, 0x75, 0xab, 0x8d,
-  0xb3, 0x71, 0xc3, 0x85, 0x5d, 0xc1, 0x43, 0x5a, 0x8d, 0xe6, 0x91, 0x75,
-  0x6c, 0x24, 0x5e, 0xf2, 0x3d, 0xbf, 0x59, 0x52, 0xe6, 0xb8, 0x7f, 0x1e,
-  0x24, 0x2d, 0x2f, 0x1a, 0x0d, 0xc2, 0x6f, 0x25, 0x8c, 0x83, 0xb3, 0x87,
-  0x48, 0x24, 0x75, 0x72, 0x89, 0xd5, 0x3a, 0xf2, 0x5e, 0x78, 0x8f, 0x3a,
-  0x4d, 0x47, 0x45, 0xa9, 0x13, 0x5d, 0x22, 0x5f, 0xfb, 0x14, 0xb6, 0x70,
-  0xdb, 0xd0, 0xe8, 0x36, 0x68, 0x3c, 0x4e, 0x98, 0x0e, 0x9e, 0x9b, 0x96,
-  0x71, 0xa2, 0xef, 0x5b, 0x18, 0xd1, 0xd1, 0xf7, 0xbf, 0xe2, 0x68, 0xd4,
-  0xf0, 0x5d, 0x94, 0x01, 0x44, 0x2f, 0x1a, 0x06, 0xbb, 0x16, 0x9c, 0x59,
-  0x25, 0x07, 0x16, 0x22, 0xeb, 0xaa, 0xa7, 0x3c, 0x6c, 0x86, 0xc7, 0x96,
-  0x31, 0x83, 0x6f, 0xc8, 0x5b, 0xf8, 0xd5, 0xc2, 0x55, 0xb6, 0x69, 0x0b,
-  0xd3, 0x75, 0xb5, 0x99, 0x4f, 0x3f, 0x58, 0x05, 0x56, 0x7e, 0xf5, 0x7e,
-  0x7f, 0xd5, 0xdd, 0xe6, 0x5b, 0x83, 0xdf, 0x87, 0x71, 0x2f, 0x18, 0x7a,
-  0x7b, 0xbd, 0xbf, 0x40, 0xc5, 0xfe, 0x75, 0x85, 0xaf, 0x11, 0x52, 0x01,
-  0xb1, 0x42, 0x30, 0xb5, 0xef, 0x7d, 0x30, 0x1e, 0xc3, 0x40, 0xaf, 0x4b,
-  0x68, 0x75, 0x70, 0xd5, 0xa1, 0x8f, 0xe2, 0x9a, 0x24, 0xbf, 0x58, 0xac,
-  0xd6, 0xd4, 0x8f, 0x78, 0x55, 0x92, 0xf4, 0xf5, 0x91, 0xfa, 0xf5, 0xd9,
-  0x9a, 0x5c, 0xf5, 0x71, 0xfe, 0x11, 0xde, 0xe3, 0x6d, 0x10, 0xd2, 0xb7,
-  0x27, 0x45, 0xc5, 0x7f, 0xac, 0x21, 0x58, 0xe5, 0xeb, 0xd3, 0xe2, 0xeb,
-  0x93, 0x2f, 0x6f, 0xff, 0xc6, 0xab, 0x12, 0xc2, 0x9d, 0xf8, 0x72, 0x24,
-  0x15, 0x79, 0x9e, 0x17, 0xe9, 0x52, 0x56, 0x36, 0xbc, 0x13, 0xe4, 0x80,
-  0x5d, 0x09, 0x22, 0x95, 0xfa, 0x47, 0x5e, 0xea, 0x1d, 0xe8, 0x75, 0xdb,
-  0x94, 0x85, 0x88, 0xdd, 0x4b, 0xc5, 0x0b, 0x71, 0xb6, 0xe1, 0xfb, 0xac,
-  0x3f, 0xc2, 0xab, 0xf4, 0x7d, 0xdc, 0x8b, 0x86, 0x21, 0x66, 0x7e, 0x82,
-  0xba, 0x18, 0x0c, 0xe4, 0x3b, 0x8a, 0xc8, 0x24, 0xc4, 0x72, 0xeb, 0xda,
-  0x48, 0xf3, 0xf5, 0x1c, 0x15, 0xca, 0x9d, 0xb8, 0x2f, 0x21, 0x85, 0xff,
-  0x30, 0x93, 0x02, 0x7c, 0x7c, 0xa6, 0xbd, 0x9e, 0x8c, 0xe1, 0xe5, 0xaf,
-  0xda, 0x4b, 0x4a, 0x17, 0x00, 0xef, 0x9f, 0x6a, 0xef, 0xf1, 0x68, 0x1b,
-  0x5e, 0xaf, 0x48, 0xaf, 0x25, 0x2d, 0x83, 0xae, 0x2b, 0xb9, 0x09, 0x4e,
-  0xe7, 0x36, 0x9c, 0x1e, 0x3b, 0x70, 0xfa, 0xdb, 0x8e, 0xd3, 0x13, 0x3b,
-  0x4e, 0xec, 0x16, 0x94, 0xb4, 0x04, 0xab, 0x4f, 0xe8, 0xf6, 0x63, 0x45,
-  0xeb, 0x95, 0x0d, 0xad, 0x6d, 0x07, 0x5a, 0x5b, 0x76, 0xb4, 0x76, 0x4c,
-  0xb4, 0xf8, 0x7f, 0x83, 0x20, 0x0b, 0xfe, 0x6b, 0x12, 0x4e, 0xc2, 0x41,
-  0xae, 0x45, 0x45, 0xe9, 0xe7, 0x94, 0xe5, 0xc4, 0x5d, 0xf7, 0x4e, 0x83,
-  0x61, 0x1a, 0xb2, 0xd7, 0x17, 0xc1, 0xb7, 0x2e, 0x53, 0xad, 0x9f, 0xad,
-  0xb1, 0x37, 0xff, 0xa2, 0x7a, 0xb8, 0xcb, 0x81, 0x26, 0x78, 0x0b, 0xa8,
-  0xc4, 0xe2, 0xf1, 0xc9, 0x0e, 0xec, 0xb5, 0x95, 0xea, 0xd0, 0xbf, 0xaf,
-  0x61, 0xb2, 0xbb, 0x2f, 0x15, 0x65, 0xe2, 0x66, 0x9d, 0x96, 0x59, 0xf6,
-  0x0a, 0xb3, 0xd3, 0xc2, 0xae, 0xf2, 0x73, 0xa1, 0xd2, 0x4d, 0x22, 0x99,
-  0x68, 0xec, 0x40, 0xfe, 0x15, 0x31, 0xb6, 0x5c, 0xaf, 0xf8, 0xb6, 0xcb,
-  0x6e, 0xca, 0x51, 0x3f, 0xb1, 0x2c, 0x5c, 0x88, 0x3d, 0xd3, 0x74, 0x53,
-  0xbd, 0x40, 0x9e, 0x80, 0x89, 0x25, 0x20, 0xd5, 0x3f, 0xb3, 0xbd, 0x91,
-  0xfe, 0x96, 0xed, 0xdc, 0xb6, 0x71, 0x77, 0xaa, 0x7f, 0x62, 0xbb, 0x06,
-  0x86, 0x27, 0x26, 0x5f, 0x30, 0xbf, 0x33, 0xa7, 0x00, 0xe6, 0x5f, 0xe1,
-  0xfa, 0xca, 0x3d, 0x05, 0xf4, 0xcf, 0xa8, 0xe9, 0xbb, 0x41, 0xe3, 0xd7,
-  0x6d, 0x96, 0x2d, 0xcd, 0x44, 0x19, 0xfa, 0x7e, 0x11, 0xc1, 0x3e, 0xcb,
-  0x78, 0x4f, 0xc9, 0x8e, 0x6c, 0xe0, 0xd8, 0x17, 0x20, 0x4b, 0xff, 0xdc,
-  0xf6, 0x19, 0xb6, 0x7b, 0x5d, 0xda, 0xee, 0xf1, 0x23, 0x88, 0x28, 0x1e,
-  0xf1, 0x8d, 0x9f, 0x51, 0x12, 0x76, 0x76, 0xbc, 0x50, 0xc9, 0x27, 0xfb,
-  0xd0, 0x62, 0x01, 0x6b, 0xeb, 0xfc, 0xfd, 0x01, 0xda, 0xa7, 0x6c, 0x1f,
-  0xf7, 0xf9, 0x29, 0x93, 0x95, 0x2b, 0xb0, 0x40, 0xb7, 0xbb, 0xe3, 0xfc,
-  0xb6, 0x35, 0x76, 0x63, 0xd3, 0xcd, 0x82, 0xd2, 0x8f, 0x38, 0x05, 0xf4,
-  0x4f, 0x64, 0x0a, 0xb3, 0xbe, 0xdc, 0xfb, 0x62, 0x7d, 0xbd, 0xcd, 0x8c,
-  0x7e, 0x16, 0xf6, 0xb8, 0x18, 0x3b, 0xde, 0x9a, 0x90, 0xd8, 0xfb, 0x6d,
-  0x32, 0xb3, 0x3b, 0xbe, 0x95, 0x35, 0x63, 0x50, 0x87, 0xcb, 0x0d, 0xe6,
-  0x94, 0x7a, 0xc0, 0xf9, 0x09, 0xd3, 0x0b, 0x27, 0xf9, 0x9c, 0xcd, 0x99,
-  0xa2, 0x4b, 0x73, 0xfe, 0x53, 0x32, 0x2c, 0x26, 0x3d, 0xd2, 0x47, 0x5d,
-  0x40, 0x68, 0xbd, 0x09, 0xc6, 0x92, 0x84, 0xc2, 0x23, 0xd2, 0xa2, 0x06,
-  0x6f, 0xf0, 0x52, 0x99, 0xb4, 0x97, 0xe9, 0x36, 0x1e, 0x8b, 0x69, 0xed,
-  0xa6, 0x9c, 0x8b, 0xb6, 0xe3, 0x09, 0x66, 0x66, 0x95, 0x3e, 0x7c, 0x88,
-  0xbb, 0x13, 0x72, 0xcb, 0x10, 0x7c, 0x3a, 0x3a, 0x33, 0x0b, 0x21, 0xb4,
-  0x18, 0x7b, 0xbb, 0xca, 0xd5, 0x8d, 0x5f, 0xbd, 0xdc, 0x9c, 0x41, 0xf2,
-  0x8b, 0xfc, 0xcc, 0x72, 0x55, 0x83, 0x0e, 0xe6, 0x3e, 0xab, 0x7d, 0x05,
-  0xa5, 0x43, 0xde, 0x2c, 0xa1, 0x82, 0xfa, 0x4b, 0xa1, 0x92, 0xb4, 0x0b,
-  0xd1, 0x2a, 0x6b, 0x63, 0x58, 0x4a, 0x2a, 0x74, 0x99, 0xea, 0x6a, 0xeb,
-  0xca, 0xaf, 0x4e, 0x2d, 0x96, 0xfd, 0x5b, 0xa5, 0xe7, 0xf6, 0xde, 0x87,
-  0x0f, 0xaf, 0xb7, 0x0f, 0x76, 0x3f, 0xfc, 0x5e, 0x51, 0xbc, 0x43, 0xcf,
-  0xbd, 0xfd, 0xd7, 0x1f, 0x2a, 0x0a, 0xae, 0x31, 0xb8, 0xef, 0xf6, 0xba,
-  0xd5, 0x40, 0x1f, 0xe5, 0x65, 0x5f, 0xef, 0x54, 0x14, 0x05, 0x12, 0xca,
-  0x3f, 0xc5, 0x86, 0x49, 0xa1, 0x41, 0x1b, 0x8f, 0xd3, 0xaf, 0xd0, 0xe9,
-  0x24, 0xb4, 0x69, 0xf1, 0xb4, 0xf7, 0xe9, 0xac, 0xdb, 0xdf, 0xaf, 0xad,
-  0x5b, 0x11, 0x50, 0xe1, 0xd3, 0x21, 0x51, 0xc3, 0xa1, 0xd2, 0xf7, 0xa0,
-  0xf5, 0x2f, 0x1b, 0x76, 0xe8, 0x8f, 0x6a, 0x40, 0xc7, 0x8d, 0x7f, 0xbe,
-  0x79, 0xac, 0x01, 0x7c, 0x6a, 0xd9, 0x84, 0xea, 0xcc, 0x63, 0xf2, 0x45,
-  0x1f, 0x00, 0x65, 0x61, 0xce, 0x82, 0x96, 0xcd, 0x41, 0x61, 0x3c, 0xc9,
-  0x97, 0x56, 0x8d, 0x45, 0xfb, 0x2c, 0xc1, 0x5d, 0x7b, 0x18, 0x9f, 0x35,
-  0xfc, 0xbc, 0x90, 0xcf, 0x41, 0x95, 0xb2, 0x66, 0x09, 0x3d, 0x59, 0xf3,
-  0x56, 0xce, 0x87, 0xf6, 0x49, 0x2d, 0x60, 0x05, 0x79, 0xca, 0xf8, 0xcf,
-  0x20, 0x16, 0xf8, 0xc2, 0xd1, 0x00, 0xb5, 0x20, 0x04, 0x30, 0x39, 0xe6,
-  0x5a, 0x2f, 0x2d, 0x53, 0x4c, 0x25, 0xfd, 0x83, 0x07, 0x6c, 0x6a, 0x7e,
-  0xcc, 0x19, 0xa8, 0xd1, 0x94, 0xd1, 0x66, 0x7b, 0x0d, 0x07, 0x9e, 0x65,
-  0xa2, 0xa2, 0xb0, 0xef, 0x18, 0x63, 0x1d, 0x5e, 0x7a, 0xc5, 0x30, 0xc8,
-  0x5f, 0x0d, 0x51, 0xd8, 0xf2, 0x0e, 0xfd, 0x20, 0x19, 0x4c, 0xa2, 0x51,
-  0xec, 0x8b, 0x0d, 0xa5, 0x4a, 0xc8, 0x78, 0x04, 0x9a, 0xc8, 0x48, 0xeb,
-  0xa6, 0x31, 0x54, 0x97, 0x78, 0xe7, 0x05, 0x16, 0xf4, 0xa5, 0x51, 0xb7,
-  0x50, 0x93, 0x68, 0x2d, 0x15, 0x51, 0xda, 0x52, 0xe5, 0xe5, 0xd2, 0x52,
-  0x51, 0x8c, 0x8c, 0xee, 0x5c, 0x20, 0xaa, 0xf4, 0xe5, 0x2f, 0x5d, 0x20,
-  0xf9, 0x67, 0xdc, 0x4e, 0x86, 0x99, 0x00, 0x90, 0xf3, 0x55, 0xcb, 0x7b,
-  0xba, 0xba, 0xba, 0x6a, 0xaf, 0xab, 0xb0, 0x08, 0x32, 0x81, 0xa3, 0x85,
-  0x3a, 0x03, 0x34, 0xb5, 0x13, 0x96, 0x78, 0xb4, 0x9a, 0xb2, 0xa2, 0xa4,
-  0x4c, 0xda, 0x1b, 0x12, 0xc4, 0xc5, 0xf7, 0x0e, 0x04, 0xf9, 0x41, 0x20,
-  0xa2, 0xc8, 0xff, 0xd4, 0x31, 0xbd, 0xad, 0x71, 0x59, 0x7b, 0x76, 0x83,
-  0x71, 0x61, 0x13, 0xf4, 0x90, 0xa3, 0xba, 0x03, 0x7b, 0x89, 0xad, 0x6c,
-  0xb5, 0xe5, 0x29, 0xbf, 0x3b, 0xda, 0xef, 0x35, 0xed, 0xf7, 0x23, 0xed,
-  0xf7, 0x63, 0xed, 0xf7, 0x93, 0x16, 0x1a, 0x03, 0xf9, 0xab, 0x36, 0xee,
-  0x57, 0x54, 0xf3, 0xa9, 0xda, 0xb8, 0xf7, 0xcb, 0xa6, 0xe7, 0xff, 0x87,
-  0xaf, 0x4b, 0x4a, 0xa9, 0x3b, 0xc5, 0xae, 0x05, 0xed, 0x11, 0x76, 0xb8,
-  0x5a, 0x95, 0x62, 0x93, 0xa4, 0x57, 0x69, 0x33, 0x9f, 0x09, 0xb5, 0xa6,
-  0x26, 0x92, 0xa4, 0xda, 0x2f, 0x36, 0x3d, 0x20, 0x33, 0x10, 0xda, 0xb2,
-  0xa2, 0x49, 0x35, 0x26, 0x51, 0x5b, 0x68, 0xea, 0xed, 0xaf, 0x68, 0x6f,
-  0x04, 0x02, 0xd8, 0xec, 0x48, 0xf6, 0x46, 0x14, 0x2b, 0xb4, 0x6b, 0x71,
-  0x09, 0x81, 0x13, 0xad, 0xa6, 0x66, 0x7e, 0xe0, 0x81, 0x60, 0x24, 0xf0,
-  0x8a, 0x0d, 0x45, 0x1d, 0xef, 0x8e, 0x6e, 0x95, 0x94, 0xc0, 0xbc, 0x46,
-  0x2b, 0xcc, 0x20, 0xee, 0x4f, 0xf0, 0x52, 0x41, 0xa4, 0x7c, 0x72, 0xc5,
-  0x1c, 0x2a, 0xe3, 0xa4, 0x71, 0x72, 0x88, 0xc7, 0x40, 0xf0, 0x0b, 0xbf,
-  0x2d, 0x27, 0xe1, 0xe9, 0xa6, 0x7f, 0xff, 0x5a, 0xb4, 0x3e, 0xf5, 0x8f,
-  0x4e, 0x9a, 0x36, 0xb8, 0xec, 0x4a, 0xcd, 0x7d, 0x69, 0x7f, 0xe5, 0x6d,
-  0xe6, 0x8d, 0x19, 0x04, 0x7a, 0x99, 0x7f, 0x42, 0x43, 0xf2, 0x56, 0x96,
-  0x25, 0x11, 0xf4, 0x24, 0x6c, 0xf8, 0x5a, 0xd3, 0x16, 0x93, 0x1b, 0x9e,
-  0x17, 0xc1, 0x1e, 0xd6, 0x77, 0x32, 0x05, 0x0c, 0x92, 0xbe, 0xcd, 0x6b,
-  0x9f, 0xc6, 0xc9, 0xeb, 0xa0, 0x7f, 0xde, 0x60, 0xbb, 0x26, 0xf6, 0x81,
-  0x4d, 0x9d, 0x86, 0x89, 0x78, 0xd3, 0xda, 0x41, 0xdc, 0xbf, 0x11, 0xf5,
-  0xe9, 0x44, 0x67, 0xd9, 0xf7, 0x96, 0xb4, 0xe9, 0xe3, 0xa6, 0x4a, 0x37,
-  0xdf, 0x18, 0xce, 0x48, 0x75, 0xd6, 0xa6, 0x85, 0xe6, 0xc8, 0xc9, 0x3a,
-  0xec, 0x6a, 0xde, 0x55, 0x37, 0xa8, 0x65, 0x44, 0x61, 0x0d, 0xeb, 0x84,
-  0x98, 0x1a, 0x38, 0xa8, 0x02, 0x03, 0x57, 0x78, 0x55, 0x64, 0x18, 0x6f,
-  0x9e, 0x58, 0x75, 0x46, 0xa2, 0x15, 0xbb, 0x68, 0xe7, 0xd5, 0x55, 0x16,
-  0xae, 0x16, 0x72, 0x85, 0x43, 0x6e, 0xf7, 0xb9, 0x09, 0x78, 0x2b, 0x6b,
-  0xac, 0x5a, 0x54, 0x43, 0x1d, 0x42, 0x47, 0x87, 0xf0, 0x78, 0x56, 0x08,
-  0x6b, 0x3a, 0x84, 0x27, 0x33, 0x41, 0xc8, 0xa9, 0x0c, 0x60, 0x0e, 0xed,
-  0x66, 0xe3, 0x76, 0x7b, 0x84, 0x21, 0xad, 0xb8, 0x4d, 0x8e, 0x99, 0xb5,
-  0x5e, 0x93, 0x34, 0xf9, 0xde, 0xbf, 0xd9, 0x9a, 0x07, 0x42, 0x6e, 0x23,
-  0xb0, 0x80, 0x39, 0x72, 0x75, 0x83, 0x55, 0x65, 0x17, 0x6c, 0xe0, 0xa2,
-  0xc7, 0xe4, 0x4c, 0x8b, 0xb6, 0x85, 0x95, 0x86, 0x7f, 0x2c, 0xda, 0xce,
-  0x82, 0xb3, 0x0f, 0x18, 0xf0, 0xb3, 0xb9, 0x09, 0x53, 0xe6, 0x60, 0xc7,
-  0x2f, 0x33, 0xf9, 0xf3, 0x2a, 0x11, 0xa8, 0x0d, 0x09, 0x2d, 0x00, 0x9b,
-  0xec, 0x82, 0xd3, 0x97, 0x9e, 0x2f, 0x92, 0x7f, 0x8f, 0x7c, 0x9c, 0xf9,
-  0x45, 0x2a, 0x70, 0x7f, 0x16, 0x93, 0x7f, 0x4f, 0x4c, 0x3e, 0x0d, 0xb7,
-  0x5f, 0x38, 0x6e, 0xd0, 0x10, 0x2f, 0xb2, 0x2e, 0x8a, 0x8c, 0x03, 0xb4,
-  0xa3, 0xbf, 0x66, 0xf3, 0x71, 0xc3, 0xd9, 0x59, 0x46, 0x8f, 0xca, 0x9e,
-  0xa5, 0x8a, 0x90, 0x63, 0x33, 0xd7, 0x6f, 0xc1, 0xda, 0x31, 0xd3, 0xc9,
-  0x85, 0x65, 0x6d, 0xb0, 0xb4, 0xc5, 0x32, 0x46, 0x99, 0xcd, 0xd5, 0x6e,
-  0x6a, 0x6a, 0x16, 0xd4, 0xb9, 0x3a, 0x97, 0x1d, 0x7c, 0xb4, 0x4b, 0x58,
-  0x42, 0xe6, 0x27, 0x9c, 0x49, 0xc5, 0x28, 0x98, 0x92, 0x9f, 0x95, 0x02,
-  0x56, 0xf9, 0xf7, 0xbf, 0xab, 0x7a, 0xe9, 0xaa, 0xcc, 0xef, 0x56, 0x70,
-  0xf5, 0x56, 0x6c, 0x69, 0x0b, 0x7c, 0xca, 0x46, 0x8f, 0x1d, 0xe4, 0x05,
-  0x83, 0x3e, 0xe6, 0x40, 0xf8, 0x3d, 0x88, 0x46, 0xfe, 0x7a, 0xe9, 0x0e,
-  0x5a, 0x9e, 0x35, 0xf9, 0x94, 0x69, 0xc8, 0x82, 0xed, 0x81, 0xb7, 0xfa,
-  0x6d, 0xb5, 0x03, 0xe4, 0xda, 0x64, 0x7f, 0x6c, 0x94, 0xc2, 0x73, 0xec,
-  0x76, 0xb5, 0x73, 0xc6, 0xdc, 0xa9, 0x61, 0x21, 0xc8, 0xad, 0x09, 0xe4,
-  0xd6, 0x16, 0x81, 0xdc, 0x57, 0xc5, 0x91, 0x61, 0x21, 0x08, 0x3e, 0x16,
-  0x08, 0x3e, 0x5e, 0x04, 0x82, 0x63, 0xee, 0xee, 0xb0, 0x10, 0xd4, 0x9e,
-  0x0b, 0xd4, 0x9e, 0x2f, 0x04, 0xb5, 0xe2, 0x52, 0xd6, 0x45, 0x60, 0xd7,
-  0x59, 0xe5, 0xd8, 0x75, 0x56, 0x17, 0x81, 0x9d, 0xed, 0x16, 0xe5, 0x45,
-  0xa0, 0xb9, 0x26, 0xd0, 0x5c, 0x9b, 0x13, 0x4d, 0x34, 0x13, 0x76, 0x74,
-  0x93, 0x96, 0xd9, 0x8f, 0x0b, 0xca, 0xf8, 0x34, 0x98, 0x13, 0xf7, 0xce,
-  0x6d, 0xcc, 0x6c, 0xf5, 0x86, 0xb8, 0x85, 0x20, 0xb8, 0xd8, 0xd9, 0xad,
-  0x5d, 0xa5, 0xb3, 0x10, 0x0c, 0x17, 0x3b, 0xbd, 0xf1, 0x92, 0xa5, 0x45,
-  0xa1, 0xf5, 0xcb, 0x22, 0xd0, 0x5a, 0x59, 0xe1, 0x98, 0x65, 0xc1, 0xf8,
-  0x69, 0x09, 0x6a, 0x50, 0xae, 0x36, 0x6e, 0xcf, 0xeb, 0xe0, 0x46, 0x00,
-  0xeb, 0x2d, 0x28, 0x59, 0x38, 0x5e, 0x08, 0xd1, 0x16, 0x2c, 0x71, 0x4e,
-  0x27, 0xc3, 0xe1, 0xdb, 0x10, 0x0f, 0x54, 0x17, 0x82, 0xdd, 0x42, 0x05,
-  0xcd, 0x5a, 0xb5, 0xa0, 0xb1, 0x5e, 0xd1, 0x3a, 0x5f, 0x47, 0xd6, 0x6e,
-  0x43, 0xea, 0xb0, 0xdb, 0x82, 0xd0, 0xc5, 0x01, 0xd6, 0xc5, 0x8f, 0x67,
-  0xbd, 0xf3, 0xaf, 0x8b, 0xc1, 0x72, 0xb1, 0xa2, 0xa7, 0xfc, 0xaa, 0xe6,
-  0x85, 0x20, 0xbc, 0x08, 0x49, 0x64, 0xd1, 0xae, 0x9b, 0xe5, 0x46, 0xa0,
-  0xa9, 0x6c, 0x61, 0x57, 0xcd, 0xe5, 0x55, 0x16, 0x76, 0xe9, 0x68, 0x06,
-  0x31, 0x5f, 0x73, 0x9e, 0x09, 0xb8, 0x2d, 0xb5, 0xb2, 0xa9, 0xd9, 0x80,
-  0x5f, 0x62, 0xe0, 0x45, 0x03, 0x9a, 0xcd, 0x45, 0x52, 0x36, 0x8b, 0xa7,
-  0x59, 0x34, 0xa4, 0x7b, 0xd2, 0x53, 0xba, 0x97, 0xf1, 0x94, 0x6e, 0x2a,
-  0x37, 0xec, 0xb9, 0xf5, 0x8e, 0x6c, 0x66, 0x36, 0x3c, 0x17, 0x93, 0x15,
-  0xad, 0xbd, 0x43, 0x2f, 0x63, 0xae, 0x39, 0xfa, 0xb4, 0x2d, 0x39, 0xb9,
-  0x91, 0xdc, 0xa1, 0x24, 0x7b, 0x71, 0xa5, 0xf5, 0x8e, 0x57, 0x51, 0xed,
-  0xb3, 0x53, 0xe9, 0x90, 0x83, 0xea, 0x54, 0x8d, 0xe5, 0xea, 0xf7, 0x1d,
-  0xcb, 0xce, 0xe3, 0x9a, 0x83, 0x99, 0x57, 0x6e, 0x61, 0x47, 0x93, 0xab,
-  0xd2, 0x91, 0xb4, 0x1f, 0xed, 0xdd, 0x68, 0x28, 0x0d, 0x97, 0xd0, 0x82,
-  0xbe, 0x12, 0x55, 0xaf, 0xcb, 0x4a, 0x69, 0xe7, 0x58, 0xbb, 0xd8, 0xc8,
-  0x57, 0x90, 0x24, 0x38, 0xe7, 0xf4, 0xc3, 0x38, 0xf5, 0x70, 0x26, 0x3f,
-  0xe1, 0x66, 0x46, 0x7b, 0x51, 0xb3, 0x61, 0x3b, 0x78, 0x6e, 0x79, 0x4f,
-  0x72, 0xfb, 0xbd, 0x6c, 0x9d, 0x31, 0x8f, 0xe9, 0x35, 0x60, 0x6a, 0x09,
-  0x04, 0xc3, 0xce, 0xde, 0x80, 0x81, 0xb7, 0xf6, 0x77, 0x2d, 0xc7, 0xde,
-  0xdc, 0x87, 0x0a, 0x31, 0x47, 0xef, 0x7d, 0x09, 0x7b, 0xc1, 0xb5, 0x21,
-  0x68, 0xba, 0x8d, 0x93, 0xf3, 0x2c, 0x1b, 0xaf, 0xaf, 0xac, 0xdc, 0xbf,
-  0x96, 0xd0, 0x11, 0x4e, 0x40, 0xd3, 0x95, 0xb4, 0xff, 0xf2, 0xfe, 0x35,
-  0xd6, 0x9f, 0x3e, 0x18, 0xc5, 0x7d, 0xd8, 0xe2, 0x87, 0x9b, 0xf7, 0xaf,
-  0xf1, 0x18, 0x6d, 0x87, 0xce, 0xeb, 0x70, 0xdf, 0x8d, 0xd8, 0x36, 0x9a,
-  0xd3, 0x13, 0xf9, 0x2c, 0x50, 0xb8, 0x4a, 0x59, 0x5a, 0x47, 0xd6, 0xc3,
-  0x57, 0xc8, 0xc6, 0x7e, 0xe0, 0xc3, 0xde, 0xde, 0xcb, 0x7f, 0x76, 0x7c,
-  0x07, 0x5f, 0xbb, 0x8e, 0x67, 0x2a, 0x0d, 0xf2, 0x4b, 0x00, 0xf5, 0x9f,
-  0x23, 0x9e, 0x2a, 0xea, 0x9f, 0x23, 0xbf, 0xb2, 0x5a, 0xda, 0x87, 0x37,
-  0xc3, 0x83, 0x78, 0xac, 0x1a, 0xd6, 0xcd, 0x22, 0x4c, 0xf5, 0x90, 0x79,
-  0x6c, 0x16, 0xba, 0x4e, 0x66, 0xa5, 0x2b, 0x6a, 0x15, 0xdd, 0x77, 0x7b,
-  0x07, 0xde, 0x45, 0x30, 0x0a, 0xce, 0xc8, 0x0c, 0x55, 0x8c, 0x35, 0x5e,
-  0xcc, 0xc7, 0x4c, 0xd6, 0x96, 0x53, 0xe3, 0xc2, 0x81, 0x74, 0x18, 0x67,
-  0x6e, 0x8b, 0xf3, 0x43, 0xb2, 0x38, 0x03, 0x96, 0x98, 0xb5, 0x0e, 0x83,
-  0x14, 0x8e, 0x0e, 0x99, 0xa5, 0xe8, 0xe8, 0xa1, 0x74, 0xc8, 0xfc, 0x8b,
-  0x04, 0xab, 0xfc, 0xb0, 0x96, 0x35, 0xfd, 0x25, 0xbc, 0x82, 0x26, 0xa5,
-  0x4a, 0x55, 0x06, 0xfe, 0x0d, 0x13, 0xef, 0x5d, 0x74, 0xea, 0xad, 0x84,
-  0x42, 0x66, 0xf8, 0x68, 0x20, 0x20, 0xc0, 0x2b, 0x16, 0x14, 0xdc, 0xf0,
-  0xb7, 0x52, 0x8c, 0x5a, 0xf1, 0x02, 0xb2, 0xd9, 0x7b, 0x3c, 0xba, 0x44,
-  0x1e, 0x15, 0xe6, 0xe0, 0x46, 0xf6, 0xf0, 0xf4, 0x50, 0x6e, 0xf4, 0x88,
-  0x9c, 0xdc, 0x91, 0x45, 0xa1, 0x1f, 0xc5, 0xd9, 0x43, 0x3b, 0x3b, 0x0f,
-  0x47, 0x0d, 0x11, 0x10, 0x80, 0xa6, 0x43, 0xcd, 0xe0, 0x25, 0x85, 0x0b,
-  0x90, 0x61, 0x11, 0x8f, 0xba, 0x8b, 0x9f, 0xdc, 0x43, 0x98, 0x99, 0x1b,
-  0x5f, 0x03, 0x8a, 0x57, 0x86, 0x35, 0x54, 0xee, 0x6a, 0x6a, 0x74, 0x95,
-  0x77, 0x41, 0x6e, 0x5f, 0x95, 0xa1, 0x9c, 0x05, 0x57, 0xb0, 0x47, 0x2b,
-  0xc8, 0x1c, 0x2f, 0xc9, 0x31, 0x1a, 0x58, 0x4c, 0xee, 0x1d, 0xb0, 0x1e,
-  0x46, 0x7d, 0xe6, 0x2f, 0x09, 0xb7, 0x74, 0xd2, 0x63, 0x9e, 0xea, 0x8d,
-  0xd5, 0x96, 0xb7, 0xf6, 0xb8, 0x39, 0x7d, 0x70, 0xff, 0x7a, 0xa9, 0x60,
-  0x4c, 0x60, 0x47, 0xde, 0x7b, 0x87, 0x8d, 0x4f, 0xcc, 0xfc, 0x86, 0xff,
-  0xd8, 0xaf, 0x28, 0xca, 0xdc, 0x0d, 0xf3, 0x43, 0xce, 0xb2, 0x62, 0x79,
-  0xa7, 0x90, 0x22, 0x88, 0x67, 0xda, 0x10, 0xc0, 0x53, 0xb6, 0x40, 0x54,
-  0x54, 0x16, 0xa3, 0x92, 0x97, 0xbe, 0xae, 0xf0, 0x7d, 0x11, 0xae, 0x53,
-  0x52, 0x83, 0xe5, 0x5a, 0xdf, 0xd4, 0xf9, 0x75, 0xea, 0x32, 0xb5, 0xca,
-  0x8b, 0x41, 0xa9, 0x4e, 0x68, 0x3a, 0x8c, 0x48, 0xcc, 0xd8, 0x47, 0x8b,
-  0x85, 0xa0, 0x1e, 0x95, 0x55, 0xc4, 0xb0, 0x55, 0x2e, 0x14, 0xa3, 0xf4,
-  0xc8, 0x35, 0x4a, 0x5c, 0x45, 0xe8, 0x82, 0x6c, 0xc0, 0x53, 0x54, 0xd4,
-  0x3f, 0x1a, 0xbe, 0xe1, 0xa1, 0xe9, 0x37, 0xc9, 0xa2, 0x4f, 0xbe, 0x20,
-  0x1a, 0x4d, 0x6b, 0x0c, 0xad, 0xe0, 0x53, 0x60, 0xea, 0x15, 0x9e, 0x77,
-  0x49, 0xdc, 0xc1, 0xfa, 0x52, 0x67, 0x3b, 0x8d, 0x24, 0xc0, 0x9c, 0x4f,
-  0x56, 0x2d, 0x74, 0x91, 0x7a, 0xcf, 0x2c, 0xdf, 0xd6, 0xfe, 0x2b, 0x13,
-  0x84, 0x95, 0x7b, 0xb9, 0x5a, 0x2d, 0x89, 0xed, 0x94, 0xaa, 0xe8, 0xe8,
-  0x2c, 0xae, 0x00, 0x7c, 0x67, 0x7e, 0x03, 0x4f, 0x0d, 0xa8, 0x76, 0xb0,
-  0xb7, 0xb3, 0xb7, 0xee, 0x61, 0xc6, 0x7d, 0xf2, 0x22, 0x8a, 0xb5, 0x2c,
-  0x05, 0xb6, 0x3e, 0x77, 0x6e, 0xda, 0xe7, 0x19, 0xe7, 0xef, 0x5c, 0x73,
-  0x77, 0x86, 0x79, 0x3b, 0xc3, 0x9c, 0xb5, 0xcf, 0x57, 0xdb, 0x5c, 0xb5,
-  0xce, 0x53, 0x65, 0x4e, 0x02, 0x33, 0xe6, 0x05, 0x14, 0x16, 0xc4, 0x70,
-  0x0f, 0x5c, 0x55, 0xde, 0x1e, 0xbc, 0x7f, 0xa7, 0xb1, 0x20, 0x0c, 0xb3,
-  0x96, 0xf5, 0x4f, 0x56, 0x22, 0x8a, 0x43, 0xc2, 0x87, 0x5b, 0x0f, 0x5b,
-  0xde, 0xc3, 0x57, 0xf8, 0xd8, 0xc6, 0xc7, 0x0e, 0x3e, 0x5e, 0xe3, 0xe3,
-  0x0d, 0x3e, 0x7e, 0xc7, 0xc7, 0x5b, 0x7c, 0xec, 0xe2, 0xe3, 0x3f, 0xf1,
-  0xf1, 0x07, 0x3e, 0xde, 0xe1, 0xe3, 0x3d, 0x3e, 0x3e, 0xe0, 0x63, 0x0f,
-  0x1f, 0xfb, 0xf8, 0xf8, 0x2f, 0x7c, 0x7c, 0xc4, 0x47, 0x17, 0x1f, 0x07,
-  0xf8, 0xf8, 0x84, 0x8f, 0x3f, 0xf1, 0xf1, 0x19, 0x1f, 0xff, 0x0b, 0x1f,
-  0xff, 0x8d, 0x8f, 0xff, 0xfd, 0xb0, 0x38, 0x25, 0x7c, 0x18, 0xe0, 0x9b,
-  0x1e, 0x3e, 0xfa, 0xf8, 0x18, 0xe0, 0x23, 0xc4, 0xc7, 0x29, 0x3e, 0xce,
-  0xf0, 0x71, 0x8e, 0x8f, 0x08, 0x1f, 0x7f, 0xe1, 0xe3, 0x0b, 0x3e, 0x86,
-  0xf8, 0xb8, 0xc0, 0xc7, 0x08, 0x1f, 0x31, 0x3e, 0xc6, 0xf8, 0xf8, 0x17,
-  0x3e, 0x12, 0x7c, 0xa4, 0xf8, 0xc8, 0xf0, 0x31, 0xc1, 0xc7, 0x57, 0x7c,
-  0x5c, 0xe2, 0xe3, 0x1b, 0x3e, 0xae, 0xf0, 0xf1, 0xb7, 0x8c, 0xc9, 0x2a,
-  0xbe, 0xe9, 0xe0, 0x63, 0x0d, 0x1f, 0x8f, 0xf0, 0xf1, 0x18, 0x1f, 0x4f,
-  0xf0, 0xf1, 0x14, 0x1f, 0xcf, 0xf0, 0xf1, 0x1c, 0x1f, 0xff, 0xc0, 0xc7,
-  0x32, 0x3e, 0xda, 0xf8, 0x38, 0xc6, 0xc7, 0xff, 0xc1, 0x47, 0x03, 0x1f,
-  0x4d, 0x7c, 0xfc, 0x82, 0x8f, 0x5f, 0xf1, 0xb1, 0x8e, 0x8f, 0xd6, 0x43,
-  0x16, 0xd4, 0xc8, 0xa2, 0x9c, 0xfa, 0xe7, 0x18, 0xe3, 0x34, 0xd0, 0x23,
-  0x9c, 0xf8, 0x48, 0x9d, 0xc8, 0x61, 0xf5, 0x15, 0x49, 0x8f, 0x51, 0xad,
-  0x12, 0xda, 0x89, 0x50, 0x58, 0xf0, 0x60, 0x1f, 0x80, 0x4f, 0x8b, 0x0f,
-  0x79, 0x22, 0x52, 0x58, 0x99, 0xcf, 0x13, 0xf3, 0x03, 0xcf, 0x40, 0x9a,
-  0x32, 0xde, 0x2a, 0x3e, 0x5b, 0x12, 0x8f, 0x1a, 0x4e, 0x04, 0xd4, 0xa8,
-  0x09, 0x37, 0x0b, 0x36, 0x7d, 0x0c, 0x9d, 0x79, 0xf0, 0x1f, 0xdf, 0x82,
-  0x8d, 0x6f, 0xcf, 0x9e, 0x3e, 0x2f, 0x3e, 0x4a, 0x1a, 0x61, 0xfe, 0x8e,
-  0xe7, 0x36, 0x66, 0xb0, 0x04, 0xf2, 0x45, 0xde, 0x81, 0x13, 0x31, 0x13,
-  0x58, 0xa4, 0xd4, 0xc3, 0x87, 0xf2, 0x94, 0xe0, 0x68, 0xe3, 0x6c, 0x48,
-  0x49, 0x89, 0xb4, 0x0b, 0x65, 0x28, 0xf6, 0x12, 0xff, 0xd8, 0x64, 0x6e,
-  0x0f, 0xa6, 0x1a, 0x22, 0x81, 0xd4, 0x66, 0xbd, 0x2e, 0xeb, 0xe3, 0x04,
-  0x76, 0x1c, 0xb0, 0x04, 0x44, 0xb4, 0x67, 0x84, 0xff, 0x7e, 0x93, 0x05,
-  0xac, 0x88, 0x97, 0x80, 0x0f, 0x4b, 0x4b, 0x66, 0xf0, 0x55, 0x58, 0xe9,
-  0x1a, 0x23, 0x8f, 0xa3, 0xe6, 0x9b, 0x11, 0x0e, 0xdd, 0xda, 0x9b, 0x53,
-  0x01, 0x8d, 0x98, 0xd6, 0x59, 0x05, 0x06, 0x07, 0x0d, 0xc0, 0x70, 0x09,
-  0xc3, 0x56, 0x39, 0xec, 0x7e, 0x83, 0xa2, 0x6b, 0x61, 0xdf, 0xd8, 0x28,
-  0x6b, 0x41, 0xc4, 0x4b, 0xb7, 0xbc, 0xce, 0x6a, 0xb3, 0xd9, 0x34, 0x36,
-  0xc1, 0xaa, 0xc0, 0xd6, 0x28, 0xaa, 0x6e, 0x74, 0x56, 0x7a, 0xd1, 0x88,
-  0xc6, 0x2c, 0xc5, 0x8c, 0x8b, 0xc6, 0xba, 0xad, 0x6b, 0xcd, 0x09, 0x8f,
-  0x44, 0x26, 0x78, 0xe2, 0x47, 0x3b, 0x40, 0x7f, 0x85, 0x57, 0x93, 0xd3,
-  0x53, 0xd0, 0x49, 0x9a, 0x46, 0x1d, 0xe9, 0xab, 0x45, 0x4b, 0x91, 0xbe,
-  0xca, 0x01, 0xb2, 0xa0, 0x97, 0x28, 0x12, 0xdb, 0x1a, 0x8f, 0xcb, 0xa3,
-  0xd2, 0x5b, 0xcc, 0x8d, 0x07, 0xd5, 0x99, 0x5f, 0x6d, 0xcc, 0x51, 0xe2,
-  0xa7, 0x96, 0x6a, 0x71, 0xed, 0xca, 0xea, 0xc8, 0x02, 0x71, 0x94, 0x96,
-  0x8d, 0xe0, 0x67, 0x09, 0xfd, 0x96, 0x67, 0xe0, 0xa3, 0x3a, 0x69, 0x4c,
-  0x37, 0xea, 0x1a, 0x93, 0xec, 0xe6, 0x29, 0xdb, 0xe2, 0x54, 0xb0, 0x0e,
-  0x0e, 0xb3, 0x60, 0x0c, 0x89, 0xce, 0xe2, 0x90, 0xbc, 0xf8, 0x24, 0x4d,
-  0x12, 0xb4, 0xbe, 0xa2, 0xa9, 0x79, 0xdd, 0x7c, 0xa5, 0xb9, 0x7d, 0x8b,
-  0x40, 0xcb, 0x3c, 0x88, 0x6f, 0xc3, 0xa8, 0xb2, 0x66, 0x81, 0xb2, 0x56,
-  0x02, 0x85, 0xa2, 0xfd, 0x4c, 0x30, 0x8f, 0x2c, 0x60, 0x1e, 0x95, 0x80,
-  0xc1, 0xb0, 0x40, 0x13, 0xca, 0x13, 0x0b, 0x94, 0x27, 0x0e, 0x28, 0x79,
-  0x8c, 0xa0, 0x09, 0xe6, 0xa9, 0x05, 0xcc, 0x53, 0x3b, 0x98, 0x9d, 0xbd,
-  0xcf, 0x1f, 0xba, 0xdb, 0x5b, 0xef, 0x5e, 0x5b, 0xc0, 0x3c, 0xb6, 0x57,
-  0x11, 0x91, 0x8b, 0x46, 0x85, 0x8e, 0xab, 0xc2, 0xd3, 0xe7, 0xdf, 0x9e,
-  0x3c, 0x7b, 0x6a, 0x56, 0x58, 0xeb, 0xac, 0xa3, 0x4e, 0xd2, 0xbb, 0xc2,
-  0x94, 0x6f, 0x5e, 0xc7, 0xf8, 0xbc, 0x26, 0x7f, 0x5e, 0xb3, 0xc2, 0x7e,
-  0xf5, 0xdf, 0xfb, 0x5b, 0xdd, 0xae, 0x04, 0x7a, 0xc0, 0x52, 0x46, 0xdb,
-  0x31, 0xd9, 0xfe, 0xd4, 0x3d, 0xd8, 0x7b, 0xef, 0x57, 0x88, 0x9e, 0xd7,
-  0x49, 0x12, 0x27, 0x1f, 0xd1, 0x96, 0xa8, 0x09, 0x21, 0x49, 0xf3, 0x54,
-  0x6b, 0x6c, 0x8d, 0x06, 0xbb, 0xa3, 0x28, 0x43, 0xc9, 0xb6, 0xba, 0x2a,
-  0xf3, 0xbb, 0xb5, 0x98, 0x6d, 0x63, 0x20, 0xe9, 0x8f, 0xba, 0x24, 0xb2,
-  0x6b, 0xac, 0x64, 0x19, 0x71, 0xa8, 0xa8, 0xae, 0xee, 0xd8, 0x6d, 0xc9,
-  0xb6, 0x69, 0x1c, 0x01, 0x9a, 0x9f, 0x76, 0xb9, 0xef, 0x91, 0xa2, 0xd3,
-  0x62, 0x94, 0xce, 0xef, 0x30, 0x8b, 0xb3, 0x20, 0x9b, 0x14, 0x5a, 0xb5,
-  0x45, 0x9d, 0x66, 0x20, 0xf4, 0x26, 0x2b, 0xb4, 0xe5, 0x0a, 0xe3, 0xb7,
-  0xcd, 0x4e, 0xaa, 0x97, 0x91, 0x06, 0xe9, 0x3c, 0x1a, 0x84, 0x18, 0xe4,
-  0x4a, 0xc6, 0xe1, 0x8e, 0xea, 0x5d, 0x3e, 0xcd, 0xe3, 0x87, 0x9d, 0xe4,
-  0x32, 0x36, 0xbc, 0xce, 0x82, 0xb9, 0xb9, 0x0c, 0xed, 0x3f, 0x51, 0x2a,
-  0xdb, 0x44, 0x41, 0xfe, 0x46, 0x01, 0x2e, 0xe8, 0x8d, 0xd3, 0xc9, 0xa8,
-  0xcf, 0x46, 0x91, 0xfe, 0xca, 0x43, 0xa3, 0xc7, 0xac, 0x4e, 0x8b, 0x5e,
-  0xd3, 0x77, 0xfe, 0xa6, 0x58, 0xbd, 0x80, 0xa1, 0xf3, 0x8a, 0x82, 0xe6,
-  0x24, 0xc9, 0x61, 0x51, 0x8d, 0xb3, 0x18, 0x95, 0xb3, 0x36, 0x34, 0x07,
-  0x58, 0xe2, 0x7a, 0x38, 0x10, 0x55, 0x9a, 0xcd, 0x96, 0xc0, 0x08, 0x5a,
-  0x4b, 0xe3, 0xe1, 0xd7, 0xb0, 0x71, 0x78, 0x84, 0x4b, 0x2f, 0xe2, 0x8a,
-  0x19, 0xbd, 0x61, 0xd7, 0x5b, 0xa0, 0xca, 0x0e, 0xa5, 0xde, 0xc2, 0x6b,
-  0x7d, 0xeb, 0x0e, 0x9a, 0xcc, 0x39, 0x7b, 0x6d, 0x6c, 0xcf, 0x29, 0x2f,
-  0x38, 0xba, 0x4b, 0xc9, 0x32, 0x5f, 0x2a, 0x75, 0x99, 0x44, 0xa8, 0x3e,
-  0x50, 0xb1, 0x96, 0xf7, 0x0b, 0xfe, 0xcf, 0x29, 0xcf, 0x58, 0x01, 0x9b,
-  0x6b, 0x88, 0xd7, 0x45, 0x48, 0x0a, 0x73, 0x8e, 0x12, 0xb1, 0x97, 0x18,
-  0x7a, 0x6c, 0x35, 0x33, 0x0e, 0xb4, 0x12, 0x06, 0x7a, 0x4a, 0x81, 0x1a,
-  0x78, 0xaa, 0xe5, 0x01, 0x61, 0xe5, 0x85, 0x82, 0xb9, 0x82, 0x5d, 0xc3,
-  0x28, 0xa8, 0xf5, 0x65, 0x5b, 0x37, 0x63, 0x38, 0xcc, 0xa6, 0x66, 0xa9,
-  0x3a, 0x16, 0x11, 0x57, 0x77, 0xcc, 0xa2, 0xd0, 0x25, 0xe3, 0xa5, 0xd2,
-  0x2d, 0x03, 0xd1, 0x86, 0xb5, 0x82, 0xa6, 0x09, 0x0b, 0xae, 0xa1, 0x81,
-  0x54, 0x2d, 0xef, 0xec, 0x55, 0x21, 0x1c, 0x72, 0xcd, 0xb6, 0x17, 0x0f,
-  0xae, 0xda, 0xb4, 0x7d, 0x21, 0x87, 0x3e, 0x66, 0x1f, 0x68, 0xe4, 0xd9,
-  0xe6, 0x97, 0x71, 0xfa, 0xfa, 0xcd, 0x92, 0x23, 0x15, 0x17, 0xa4, 0x60,
-  0x30, 0x70, 0x82, 0xd1, 0xf0, 0x36, 0x58, 0x4c, 0x1d, 0x46, 0x7d, 0x7c,
-  0xca, 0x54, 0x73, 0x66, 0xcd, 0xe6, 0x59, 0xbd, 0x36, 0x0b, 0x4e, 0xf2,
-  0x15, 0x6b, 0xb6, 0x06, 0xff, 0x5a, 0xd6, 0xb8, 0x0d, 0xbf, 0x49, 0x96,
-  0x15, 0xcf, 0x6f, 0xba, 0x8e, 0x10, 0xb4, 0xe0, 0xe4, 0x5a, 0x4e, 0x9e,
-  0x75, 0xc8, 0xcf, 0xd3, 0x6b, 0x55, 0x0e, 0x80, 0xb1, 0x4b, 0xe0, 0x08,
-  0x6b, 0x4d, 0x96, 0x23, 0x5d, 0xc3, 0x5b, 0xb4, 0x72, 0xa0, 0x9d, 0x08,
-  0x97, 0x37, 0xad, 0x0e, 0xa0, 0xdf, 0xce, 0x13, 0x84, 0x35, 0x15, 0x4f,
-  0x60, 0x55, 0xca, 0x94, 0xbb, 0x04, 0x6b, 0xfc, 0x65, 0x9d, 0xf6, 0x6c,
-  0x3e, 0xcd, 0x36, 0xc3, 0x25, 0x9b, 0xa7, 0x32, 0xbb, 0x14, 0x58, 0x8e,
-  0xa3, 0x2c, 0xe8, 0xb9, 0x01, 0xb1, 0x92, 0x57, 0xac, 0x03, 0x5e, 0x05,
-  0xb4, 0x62, 0x2c, 0x6d, 0x63, 0x62, 0x02, 0xa9, 0x39, 0x2a, 0x2a, 0x15,
-  0x6b, 0x8e, 0x4a, 0x41, 0xea, 0x7c, 0xf7, 0x34, 0x4c, 0x59, 0xa2, 0x90,
-  0x75, 0xef, 0x5a, 0x04, 0x14, 0x93, 0xf0, 0xfc, 0x12, 0x5e, 0xb5, 0x3c,
-  0x3a, 0xd2, 0xd3, 0xc8, 0x2a, 0xc6, 0x4a, 0x54, 0x54, 0x47, 0x30, 0x7f,
-  0x0b, 0x4b, 0xcd, 0xf5, 0x74, 0xa3, 0xac, 0xe2, 0x21, 0x34, 0x81, 0x11,
-  0x4c, 0xd4, 0xc8, 0x86, 0x94, 0x53, 0xa0, 0x1f, 0x0c, 0x45, 0x59, 0xdc,
-  0xfe, 0x64, 0xe1, 0x45, 0xc3, 0x2f, 0xa8, 0x96, 0x6b, 0x20, 0x30, 0x5c,
-  0xff, 0xd9, 0xdd, 0xfb, 0xd0, 0x66, 0xa7, 0x27, 0xd1, 0xe9, 0x55, 0xc3,
-  0xd2, 0x48, 0xb3, 0xa9, 0xe4, 0x29, 0x22, 0x06, 0xc3, 0xa3, 0xa5, 0xca,
-  0x3e, 0x11, 0x68, 0xda, 0x3a, 0x36, 0x14, 0x8c, 0xce, 0xca, 0x30, 0xa2,
-  0x15, 0xd6, 0xbf, 0x9e, 0xca, 0xb3, 0x97, 0x6b, 0xdf, 0x2e, 0x02, 0xc8,
-  0x79, 0x5c, 0xd8, 0x20, 0x69, 0x31, 0x05, 0x38, 0x65, 0xc4, 0x2b, 0xd3,
-  0x24, 0xa0, 0xeb, 0x41, 0xe9, 0x30, 0xea, 0x83, 0x36, 0x14, 0x0c, 0x87,
-  0x45, 0x25, 0x63, 0x35, 0x96, 0x43, 0x4d, 0x10, 0x7c, 0x34, 0x20, 0xc0,
-  0xb9, 0x2b, 0xce, 0x31, 0x1d, 0x5e, 0xc1, 0xff, 0xb4, 0x53, 0x96, 0x1a,
-  0xad, 0xe7, 0xe1, 0x2e, 0x05, 0x21, 0x54, 0x9c, 0x3d, 0xd2, 0xb4, 0xc6,
-  0xd6, 0xa5, 0x4c, 0x16, 0xf5, 0x1c, 0xf6, 0xa5, 0xa5, 0xcc, 0x8c, 0xed,
-  0xa4, 0x28, 0x41, 0x75, 0x01, 0x53, 0x67, 0x9d, 0x3b, 0x3b, 0x03, 0x70,
-  0xd3, 0xd5, 0x30, 0x6c, 0x73, 0x98, 0x3c, 0x0e, 0xe2, 0x5e, 0x11, 0x36,
-  0xe5, 0xf7, 0xd0, 0xd1, 0xa9, 0xc8, 0x45, 0x58, 0x44, 0x43, 0x69, 0xa2,
-  0x4f, 0x38, 0x0e, 0x94, 0xfb, 0x0c, 0x15, 0x31, 0x77, 0x3c, 0x60, 0xce,
-  0x7b, 0xa1, 0xba, 0x9a, 0x24, 0x21, 0x14, 0x49, 0xb3, 0xad, 0x51, 0x74,
-  0x41, 0x3e, 0x6b, 0x6f, 0xd0, 0x25, 0xd5, 0xba, 0xe3, 0xa8, 0x3a, 0x95,
-  0xb7, 0xb6, 0xba, 0x51, 0x07, 0xc4, 0x8d, 0x4e, 0xe8, 0xcb, 0x03, 0x0c,
-  0xd5, 0xb0, 0xbd, 0xa9, 0x4b, 0x3f, 0xc1, 0x2b, 0xde, 0xf7, 0xe3, 0x44,
-  0xdf, 0x33, 0xe6, 0x0b, 0xa2, 0xf8, 0x83, 0x6f, 0xd5, 0xf8, 0xe0, 0x01,
-  0xef, 0x80, 0xde, 0x0f, 0x0b, 0x56, 0x76, 0xd5, 0xf0, 0x97, 0x97, 0xbf,
-  0x02, 0x10, 0xbc, 0x66, 0x11, 0xf4, 0x21, 0xf2, 0x5d, 0x6c, 0xc1, 0x2e,
-  0x6e, 0x34, 0x88, 0x2f, 0x99, 0x38, 0x65, 0x38, 0x7b, 0x4b, 0x9e, 0x3f,
-  0xfe, 0xe6, 0xcb, 0x53, 0x45, 0xda, 0x3e, 0xb9, 0x9d, 0x51, 0x80, 0x06,
-  0x2c, 0x07, 0x8a, 0xc6, 0xb0, 0x84, 0x08, 0xf2, 0x2b, 0x67, 0xa4, 0x75,
-  0x62, 0x92, 0xa6, 0xee, 0x5a, 0xf6, 0x06, 0xb7, 0x54, 0x22, 0x53, 0x20,
-  0xdb, 0x54, 0x62, 0x5b, 0x8a, 0xc5, 0x4e, 0x4a, 0x98, 0x90, 0x1b, 0xef,
-  0xe2, 0x2f, 0x32, 0x8f, 0xa0, 0x2b, 0xd5, 0x25, 0x85, 0x5a, 0xd3, 0xa6,
-  0xac, 0x71, 0xf2, 0xf6, 0xe0, 0x60, 0xdf, 0xbb, 0x7f, 0x9d, 0x17, 0x4f,
-  0x09, 0xf2, 0xd4, 0x5b, 0x36, 0x5f, 0xe2, 0x68, 0xe4, 0x67, 0x7d, 0x8a,
-  0x57, 0x85, 0x28, 0xa8, 0x9c, 0xef, 0x05, 0x83, 0x77, 0x28, 0x0c, 0x61,
-  0xd9, 0x21, 0xc1, 0x81, 0x17, 0xc3, 0x18, 0x5a, 0x22, 0x96, 0x22, 0x47,
-  0x14, 0xc4, 0x08, 0x4b, 0x7e, 0xa4, 0x17, 0x62, 0xa7, 0xca, 0x3e, 0xa3,
-  0xf2, 0xf2, 0xfa, 0x2b, 0x8c, 0x19, 0x6a, 0x32, 0xe8, 0x36, 0xd8, 0xa0,
-  0x6c, 0x3f, 0x40, 0xb2, 0x46, 0x88, 0xaf, 0x35, 0x06, 0x1f, 0xc4, 0x3c,
-  0xe7, 0x4b, 0x83, 0x57, 0xe7, 0x7b, 0xbc, 0xc2, 0xc8, 0x26, 0x81, 0xc6,
-  0xff, 0xb6, 0xd2, 0x2d, 0xc9, 0xc0, 0x49, 0x78, 0xe6, 0xdb, 0xd4, 0x9e,
-  0xb8, 0xb3, 0x49, 0x5c, 0xcb, 0x95, 0xef, 0x01, 0x07, 0x31, 0xbf, 0x4c,
-  0xc9, 0xdc, 0x01, 0xb2, 0x4a, 0xd8, 0x1d, 0x9e, 0x24, 0x0e, 0x5f, 0x62,
-  0xe2, 0xdc, 0xc2, 0x2f, 0x0a, 0xdf, 0x64, 0x78, 0x69, 0x79, 0xf1, 0x8a,
-  0x59, 0x6c, 0xfd, 0x95, 0x74, 0x1c, 0x9d, 0x9e, 0xa6, 0x2b, 0x83, 0x28,
-  0xf1, 0x4d, 0xfb, 0x2c, 0x33, 0xcc, 0xb6, 0xff, 0x4a, 0xe3, 0x91, 0xc5,
-  0x14, 0x4b, 0xf7, 0x47, 0x69, 0xe4, 0x90, 0x90, 0x41, 0xf7, 0x9c, 0x02,
-  0x29, 0xe6, 0x5d, 0xc9, 0x50, 0xa0, 0xd7, 0x46, 0x1c, 0x2e, 0xb7, 0xcc,
-  0xe0, 0x1e, 0x3c, 0x2f, 0x43, 0x87, 0x2e, 0xe3, 0x20, 0x3b, 0x67, 0xcb,
-  0x80, 0x45, 0xb8, 0x68, 0x06, 0x68, 0xd1, 0x1d, 0x7e, 0x95, 0xd2, 0x4b,
-  0x04, 0xb3, 0x79, 0xff, 0x1a, 0x41, 0x38, 0xdd, 0x17, 0x2c, 0x4c, 0x5d,
-  0x16, 0x40, 0x2a, 0xe7, 0x01, 0xb2, 0x18, 0xe3, 0x45, 0x01, 0x60, 0x98,
-  0x93, 0xfb, 0xd7, 0x38, 0x0e, 0xd3, 0x95, 0xfb, 0xd7, 0xd4, 0x75, 0xe3,
-  0xe8, 0x9a, 0x31, 0xd0, 0x28, 0x94, 0xfd, 0xf1, 0xb4, 0x8e, 0xb9, 0x66,
-  0xa3, 0x84, 0xf5, 0x83, 0x07, 0x0e, 0xe3, 0x79, 0xc9, 0x31, 0xa5, 0xa9,
-  0x06, 0x30, 0x83, 0x08, 0xb7, 0x86, 0x6c, 0x18, 0xae, 0x05, 0xee, 0x21,
-  0xe7, 0x42, 0x89, 0x38, 0xbc, 0x48, 0x44, 0x97, 0x0f, 0xa1, 0x92, 0x69,
-  0xee, 0xd4, 0x9d, 0x21, 0x10, 0x53, 0x4a, 0x4a, 0xdc, 0x73, 0xc8, 0xf2,
-  0xf7, 0xa1, 0x1a, 0x26, 0xe7, 0xba, 0xac, 0x95, 0x83, 0x4e, 0x49, 0x19,
-  0xc9, 0xd0, 0x93, 0x20, 0xa3, 0xfe, 0x24, 0xd4, 0xa8, 0x42, 0x43, 0xd3,
-  0xf1, 0xaf, 0x82, 0xc0, 0x33, 0x7b, 0x6a, 0x6f, 0x1d, 0x4c, 0x7d, 0x11,
-  0x44, 0xa3, 0xb7, 0x42, 0xf8, 0xa8, 0x41, 0x9f, 0x0d, 0x1b, 0xdc, 0x17,
-  0x2f, 0xd0, 0xdf, 0xc6, 0x7b, 0xe0, 0xad, 0x3d, 0x79, 0xd2, 0xaa, 0x55,
-  0xbc, 0xf3, 0x74, 0xa6, 0xe2, 0xcf, 0x67, 0x2a, 0xbd, 0x6a, 0x94, 0x3e,
-  0xd2, 0x7b, 0xc8, 0x36, 0x7a, 0x42, 0x2d, 0x54, 0xbb, 0xd8, 0x6e, 0xb7,
-  0x0b, 0x02, 0xb4, 0xf4, 0x4f, 0x3a, 0x05, 0x61, 0x55, 0x8a, 0x32, 0x4c,
-  0xa9, 0xc8, 0x4f, 0x5c, 0x89, 0x55, 0xfa, 0x6a, 0x88, 0x6d, 0xd3, 0x80,
-  0x32, 0x1b, 0xaf, 0x71, 0x7e, 0x03, 0x4c, 0xe1, 0xc9, 0x2d, 0x74, 0xdc,
-  0x70, 0x87, 0x59, 0x25, 0x1b, 0x5a, 0x06, 0xd8, 0xd3, 0x66, 0xb3, 0xe9,
-  0x9c, 0xa0, 0x46, 0xde, 0x52, 0x60, 0xc0, 0xc3, 0xa3, 0xa6, 0x95, 0x56,
-  0x42, 0x2c, 0xbd, 0x1a, 0xc6, 0x3d, 0x6a, 0x84, 0xfe, 0x38, 0xd4, 0x9a,
-  0x93, 0x68, 0xd9, 0x04, 0x40, 0xde, 0x09, 0x9d, 0xe8, 0x8a, 0xb0, 0x7e,
-  0x76, 0xc1, 0x99, 0x2a, 0xca, 0xd0, 0xba, 0x78, 0xe2, 0xdc, 0xd8, 0xcf,
-  0x24, 0xb2, 0x4e, 0x6c, 0xbe, 0x0b, 0xf9, 0x22, 0xe7, 0x5c, 0x5a, 0xaf,
-  0xe5, 0x64, 0x6e, 0xde, 0x54, 0xd7, 0xc7, 0x64, 0x57, 0x3e, 0xac, 0xcf,
-  0x24, 0x94, 0x99, 0x6b, 0x97, 0x2f, 0x87, 0xba, 0x58, 0x21, 0x8b, 0x32,
-  0x97, 0x28, 0xfc, 0x74, 0x8f, 0xb6, 0x13, 0x8d, 0xc7, 0x2d, 0xef, 0xa9,
-  0xa4, 0xdb, 0x4b, 0xa5, 0x0f, 0x57, 0x8f, 0xc8, 0xab, 0x6e, 0xf5, 0xdb,
-  0xb3, 0x1e, 0xee, 0x7d, 0xe4, 0x4f, 0x1d, 0xf1, 0x69, 0x4d, 0x71, 0x84,
-  0x97, 0x7a, 0xa0, 0x11, 0x49, 0xe4, 0xd3, 0xd7, 0x0d, 0x28, 0x40, 0xbc,
-  0x2d, 0x4c, 0xfb, 0xd5, 0xf0, 0x77, 0x47, 0xec, 0x8a, 0x43, 0xbe, 0x4a,
-  0x23, 0x3b, 0x6b, 0x19, 0x0a, 0xdc, 0x16, 0x79, 0xb9, 0x5d, 0x63, 0x03,
-  0x93, 0x37, 0xad, 0x3a, 0x99, 0x2c, 0x06, 0x8e, 0x86, 0xa1, 0xe2, 0x3e,
-  0x36, 0x2f, 0xe8, 0x8d, 0x4a, 0x87, 0xd0, 0xde, 0xaa, 0x32, 0xa4, 0x30,
-  0x62, 0x2d, 0xaf, 0xd7, 0x51, 0xdf, 0x75, 0xf0, 0xdd, 0x9a, 0xfa, 0x6e,
-  0x0d, 0xdf, 0x3d, 0x52, 0xdf, 0x3d, 0x3a, 0x32, 0xb9, 0x86, 0x8b, 0xe8,
-  0x06, 0xb4, 0xf3, 0xdb, 0x6f, 0x24, 0x50, 0x97, 0xe0, 0x47, 0x07, 0x7f,
-  0xa0, 0xb8, 0xc4, 0x1f, 0x6b, 0xf8, 0xe3, 0x39, 0xfe, 0xdd, 0x7b, 0x64,
-  0x01, 0x40, 0xab, 0x03, 0x80, 0x90, 0x44, 0x83, 0x8d, 0x05, 0xa5, 0xe6,
-  0x96, 0xbc, 0xc7, 0xb2, 0xa2, 0x24, 0x89, 0x30, 0x5b, 0xd6, 0xda, 0xbe,
-  0x5c, 0x56, 0xa4, 0x92, 0x35, 0xf1, 0xb0, 0x6d, 0xfd, 0x65, 0x0c, 0x9b,
-  0xfa, 0xf4, 0x42, 0x05, 0x8a, 0x55, 0x6a, 0xc3, 0x4e, 0x3e, 0x6d, 0xc8,
-  0x60, 0x9a, 0x85, 0x4a, 0xc8, 0x12, 0x60, 0xab, 0xd8, 0x9b, 0x0a, 0xa3,
-  0xa9, 0xad, 0x99, 0x0a, 0xa6, 0x53, 0x77, 0xc3, 0x3f, 0x73, 0xaf, 0xd8,
-  0x86, 0x55, 0x73, 0xc0, 0x22, 0x3c, 0xa1, 0x5d, 0x6a, 0x9b, 0xe3, 0x80,
-  0x65, 0x8b, 0x50, 0x5d, 0x52, 0xc8, 0x71, 0x28, 0x40, 0x1f, 0x19, 0x4b,
-  0x35, 0xde, 0xae, 0xce, 0x03, 0xca, 0x49, 0xd3, 0xe7, 0x3f, 0x65, 0x85,
-  0x48, 0x14, 0x69, 0x07, 0xe3, 0x71, 0x38, 0x1a, 0x34, 0xd8, 0x4d, 0x92,
-  0x2d, 0xaf, 0x10, 0xca, 0x32, 0x5a, 0xc0, 0x70, 0xd7, 0x22, 0xf5, 0x27,
-  0x54, 0x00, 0xb4, 0x68, 0xcb, 0xbb, 0x12, 0xf7, 0xb3, 0x30, 0x5b, 0x06,
-  0x25, 0x22, 0x0c, 0x2e, 0x7c, 0xe0, 0xf9, 0x96, 0x27, 0x90, 0xe2, 0xce,
-  0xb3, 0x8d, 0x4e, 0xd3, 0xd4, 0xb4, 0x34, 0xd5, 0x9b, 0xdd, 0x76, 0x09,
-  0x6d, 0xab, 0x53, 0xee, 0x82, 0x82, 0x90, 0xa0, 0xc1, 0xfd, 0xbd, 0xee,
-  0x81, 0x96, 0x23, 0x14, 0xcd, 0xad, 0xeb, 0x79, 0x1f, 0xa4, 0x44, 0xa1,
-  0x35, 0x54, 0x5a, 0xfb, 0xda, 0xc0, 0xe5, 0xfb, 0x9c, 0xfa, 0xac, 0x4d,
-  0x97, 0xe5, 0x19, 0xaa, 0xed, 0x43, 0x67, 0x55, 0xe7, 0x8a, 0xfd, 0x9d,
-  0xb1, 0x0d, 0xe7, 0xff, 0x2b, 0xba, 0xaa, 0x5d, 0xb0, 0xce, 0xd3, 0x4d,
-  0xb9, 0x5b, 0x85, 0x7b, 0x6c, 0x50, 0xe6, 0xc4, 0x5c, 0xac, 0x04, 0x3c,
-  0xc0, 0x00, 0x05, 0x87, 0x84, 0xc3, 0x3f, 0x47, 0xfb, 0xc3, 0x10, 0x8f,
-  0xcf, 0x2f, 0x83, 0x28, 0xf3, 0x26, 0xa3, 0x2c, 0x1a, 0xd2, 0x91, 0x2d,
-  0x74, 0x96, 0x47, 0xca, 0xa4, 0x78, 0x13, 0x2e, 0xde, 0x8e, 0x11, 0xc1,
-  0x52, 0xb7, 0xf7, 0x87, 0x25, 0xbf, 0x4d, 0xb9, 0xfb, 0x25, 0x37, 0x1d,
-  0x88, 0x1b, 0x2f, 0x41, 0x4c, 0x23, 0xea, 0xe6, 0x26, 0xc0, 0x04, 0x6b,
-  0x7a, 0x0d, 0xdb, 0xe8, 0x2e, 0x29, 0x03, 0x85, 0x12, 0x43, 0xe2, 0x15,
-  0xfe, 0x6f, 0x91, 0x2f, 0x3d, 0x1a, 0x4f, 0x70, 0x68, 0xdb, 0xd9, 0xb7,
-  0xcc, 0x57, 0xfd, 0x1b, 0x81, 0x0e, 0x5f, 0x81, 0x3c, 0xde, 0x55, 0x3c,
-  0x49, 0x3c, 0xac, 0x01, 0xba, 0x59, 0x16, 0x7b, 0x01, 0x4d, 0x36, 0xef,
-  0xd3, 0xc7, 0x77, 0x5e, 0x23, 0xf0, 0xd2, 0x71, 0xd8, 0xc7, 0x43, 0xd9,
-  0x49, 0x82, 0x51, 0x58, 0x01, 0x0a, 0xa8, 0x08, 0x85, 0x02, 0x16, 0x1c,
-  0x79, 0x31, 0x93, 0x82, 0xd1, 0x88, 0xae, 0x0c, 0xee, 0x25, 0xf1, 0x25,
-  0x0c, 0xcb, 0xc3, 0x14, 0x26, 0xca, 0x45, 0x2c, 0x0e, 0x85, 0xf9, 0xc2,
-  0x02, 0x30, 0x3f, 0x25, 0x28, 0xbb, 0x00, 0x70, 0x9b, 0x1d, 0x4e, 0x33,
-  0xce, 0x83, 0xdf, 0x84, 0x2f, 0xef, 0x17, 0x22, 0x46, 0x5f, 0x01, 0x11,
-  0x8a, 0x3c, 0xe1, 0x36, 0x40, 0x09, 0x16, 0x0b, 0x48, 0x29, 0x0c, 0x3b,
-  0x0c, 0x1a, 0x37, 0xeb, 0x10, 0x53, 0xe4, 0xa0, 0xba, 0x21, 0x2b, 0x0e,
-  0x38, 0x9d, 0x27, 0xe1, 0x29, 0xa2, 0x4d, 0x1d, 0xc0, 0x3f, 0x10, 0x65,
-  0xd1, 0x55, 0x26, 0x43, 0xa1, 0x60, 0x9b, 0x8a, 0x6d, 0x0a, 0x7c, 0x37,
-  0x8a, 0x0f, 0x82, 0xc6, 0x28, 0xc1, 0x80, 0xb0, 0x79, 0x13, 0x5b, 0x24,
-  0xad, 0x18, 0x52, 0x1c, 0x2a, 0xca, 0x82, 0x7b, 0xe6, 0x61, 0x0c, 0x93,
-  0x6b, 0xdb, 0xe7, 0xd1, 0x70, 0xc0, 0xc2, 0x6e, 0x72, 0x18, 0x3b, 0x51,
-  0x3a, 0xc6, 0x11, 0xe7, 0xac, 0x46, 0x46, 0x0d, 0x2f, 0x66, 0x54, 0xc5,
-  0x92, 0xa2, 0xdc, 0xc1, 0x79, 0x94, 0xe2, 0xdd, 0xcd, 0xc0, 0x9c, 0xe8,
-  0x6c, 0x98, 0x5c, 0x79, 0x41, 0xca, 0xb0, 0xa3, 0x8a, 0xc0, 0x2f, 0x83,
-  0x18, 0x56, 0x9a, 0x51, 0x9c, 0x79, 0x78, 0xeb, 0x5d, 0x0e, 0x02, 0xc8,
-  0x43, 0x52, 0x1d, 0xfa, 0x16, 0x7f, 0x93, 0xba, 0xc4, 0x9b, 0x25, 0xdb,
-  0x0a, 0x29, 0xbf, 0xef, 0xe3, 0x49, 0x1a, 0xb2, 0x9f, 0x3e, 0x81, 0x54,
-  0x64, 0x60, 0x6f, 0xd2, 0x03, 0xa5, 0x22, 0x5d, 0xa7, 0xc3, 0x15, 0x29,
-  0x31, 0x30, 0xa5, 0x45, 0x65, 0xd9, 0x63, 0xd5, 0x2f, 0x68, 0x4d, 0x5b,
-  0xe7, 0xd3, 0x80, 0xe7, 0x21, 0x6d, 0x16, 0xbd, 0xfe, 0x48, 0x5a, 0x0b,
-  0xa3, 0x1c, 0xae, 0xc1, 0x2e, 0xba, 0x31, 0xed, 0x46, 0xa1, 0x1b, 0x37,
-  0xce, 0x7c, 0xde, 0x7d, 0xb3, 0x6b, 0x0d, 0xb9, 0x51, 0x5c, 0x2f, 0xca,
-  0xfd, 0xe3, 0xb0, 0xe8, 0x0a, 0xb3, 0x6f, 0x55, 0x7b, 0xc7, 0x95, 0x5b,
-  0x5f, 0x78, 0xda, 0x5a, 0x80, 0xe4, 0x96, 0x7c, 0x24, 0x61, 0x36, 0xbd,
-  0xa2, 0xa8, 0x3b, 0xec, 0x0f, 0x8a, 0xb4, 0x29, 0xb3, 0x0e, 0x65, 0xe5,
-  0x09, 0xc6, 0x65, 0xf9, 0xd8, 0xd0, 0x4e, 0x2d, 0x65, 0xdb, 0xad, 0x9d,
-  0xc3, 0xa6, 0x04, 0x84, 0xe5, 0xec, 0xd0, 0xbc, 0x44, 0xaa, 0x12, 0x5c,
-  0x9e, 0xe3, 0xd7, 0x79, 0x10, 0x50, 0x0b, 0xab, 0x02, 0x8c, 0xfd, 0x18,
-  0xf6, 0x66, 0x98, 0x61, 0x82, 0x61, 0x6e, 0xd9, 0x65, 0x2e, 0xe0, 0x7e,
-  0xf7, 0x60, 0xcb, 0xfb, 0xb7, 0xd7, 0x05, 0x96, 0xf6, 0x3e, 0xb0, 0xab,
-  0x23, 0xfd, 0x9a, 0xa1, 0xa3, 0x25, 0x94, 0x9c, 0xab, 0xe7, 0x96, 0xf1,
-  0x98, 0xbf, 0xe3, 0x73, 0x73, 0x89, 0x6d, 0x3c, 0xe6, 0x64, 0x13, 0x63,
-  0x30, 0x4e, 0x94, 0xe8, 0x3c, 0x9a, 0x0e, 0x98, 0xd4, 0x78, 0x7a, 0x52,
-  0x1a, 0x57, 0x22, 0xe5, 0xc1, 0xb6, 0xfa, 0x8d, 0x20, 0x08, 0xe3, 0x6c,
-  0x42, 0xce, 0x62, 0xdd, 0x96, 0xce, 0x18, 0x79, 0x1a, 0x3e, 0x9e, 0x00,
-  0xdb, 0x5a, 0x4d, 0xc9, 0x8e, 0x2d, 0xd7, 0x25, 0x2b, 0xbc, 0xa8, 0xca,
-  0x95, 0x75, 0xf7, 0xa9, 0xb3, 0x09, 0xca, 0x42, 0x58, 0xe9, 0x92, 0xd9,
-  0xe5, 0xe5, 0x10, 0xed, 0xf7, 0x7e, 0x8d, 0x4d, 0x5d, 0x85, 0xee, 0x6d,
-  0xe8, 0xdd, 0xe8, 0x94, 0x80, 0x54, 0x72, 0x7d, 0x47, 0xef, 0x24, 0xd1,
-  0xaf, 0xa6, 0x6a, 0xba, 0x26, 0x61, 0x2a, 0xae, 0x50, 0x96, 0x97, 0x0e,
-  0x97, 0xea, 0x6c, 0x53, 0x9b, 0xa7, 0x0e, 0xa5, 0x2e, 0x57, 0xe8, 0x4e,
-  0xa4, 0xfb, 0x29, 0x2e, 0x31, 0xb2, 0x39, 0x61, 0x0a, 0x1e, 0xa8, 0x24,
-  0x03, 0xf6, 0xa2, 0x5f, 0xdc, 0x9c, 0x7c, 0xff, 0x9a, 0x98, 0xa6, 0xed,
-  0xc9, 0xda, 0x5e, 0x1a, 0x83, 0x6a, 0xc4, 0xd8, 0x93, 0x2b, 0x79, 0x63,
-  0xba, 0x6b, 0x7e, 0xef, 0x8f, 0x93, 0xba, 0x26, 0x02, 0x5d, 0xb9, 0xe3,
-  0x8a, 0x83, 0xcf, 0x23, 0x4b, 0x01, 0x59, 0x61, 0x1f, 0xa2, 0x23, 0xe1,
-  0x15, 0xbf, 0xe6, 0x26, 0xdf, 0xae, 0xe1, 0x11, 0x83, 0xf2, 0x5b, 0x01,
-  0x4a, 0x4f, 0x98, 0xca, 0x26, 0xb8, 0xcd, 0x66, 0x62, 0xd6, 0xce, 0x73,
-  0xc1, 0xab, 0x92, 0xd1, 0xdf, 0xb0, 0x26, 0xe3, 0x96, 0xaf, 0x2a, 0x90,
-  0xb9, 0x5b, 0x59, 0x5e, 0xf1, 0x64, 0xf9, 0x65, 0xfd, 0x48, 0x45, 0x07,
-  0x78, 0x23, 0x71, 0xaa, 0xe6, 0xc3, 0x28, 0xd3, 0xa8, 0xe5, 0x3d, 0xb2,
-  0x3b, 0x31, 0xda, 0x27, 0x4a, 0x35, 0xb6, 0xfa, 0x5a, 0xcf, 0xf6, 0x71,
-  0xa0, 0x57, 0x87, 0xdf, 0x32, 0x8b, 0x2a, 0x20, 0x79, 0x22, 0x5a, 0x67,
-  0xbc, 0xd6, 0x2f, 0x2d, 0x68, 0xba, 0xd8, 0x75, 0x01, 0x10, 0x2e, 0x3a,
-  0x94, 0x5e, 0xbf, 0xe4, 0xdf, 0xcc, 0x9d, 0x03, 0xb7, 0xd5, 0xfe, 0x73,
-  0x64, 0xdb, 0xad, 0xd0, 0xfe, 0x1f, 0xd3, 0x8f, 0x11, 0x62, 0xf8, 0x87,
-  0x28, 0xdf, 0xf2, 0x9b, 0xae, 0xf2, 0x78, 0x7d, 0x0d, 0x61, 0xd0, 0xf2,
-  0xc2, 0x11, 0x99, 0xe2, 0xc3, 0x01, 0x13, 0x10, 0x47, 0xe5, 0x37, 0x5a,
-  0x5d, 0x7b, 0xce, 0x9a, 0xba, 0xab, 0xbc, 0x36, 0x23, 0xd6, 0xbd, 0xc3,
-  0x23, 0xd7, 0x79, 0x07, 0x56, 0x4f, 0xed, 0xc1, 0x3e, 0xf4, 0x49, 0xbb,
-  0x3a, 0x2b, 0xe5, 0xfe, 0x0a, 0xd6, 0x23, 0x2a, 0x58, 0x61, 0xa0, 0xd4,
-  0xf4, 0xb7, 0x2c, 0x61, 0x31, 0x3f, 0x29, 0x0b, 0x14, 0xc1, 0xff, 0xd9,
-  0x52, 0x23, 0xdd, 0x58, 0xf8, 0x5b, 0x36, 0x30, 0xae, 0x76, 0xf4, 0xe8,
-  0xe8, 0x76, 0xd3, 0x8f, 0xc7, 0x41, 0x3f, 0xca, 0xae, 0xd6, 0xf1, 0x54,
-  0x8b, 0x87, 0x77, 0x30, 0x18, 0x79, 0xff, 0x31, 0xbb, 0xce, 0x0a, 0x3a,
-  0xd6, 0x02, 0x48, 0x64, 0xb2, 0xdf, 0x56, 0xb2, 0x81, 0x02, 0xfb, 0x85,
-  0xdc, 0xac, 0xf1, 0xd5, 0xbc, 0x54, 0x92, 0x17, 0xcf, 0xe9, 0x8a, 0xee,
-  0x06, 0xe4, 0x6d, 0xe0, 0xad, 0xb3, 0x3f, 0x8e, 0x29, 0xad, 0xb5, 0x02,
-  0x0a, 0xfe, 0x4e, 0x5e, 0x9c, 0x28, 0x46, 0xcb, 0xc2, 0x47, 0xc2, 0x20,
-  0xf4, 0x79, 0x76, 0x31, 0x2c, 0xdd, 0xc1, 0x57, 0xa8, 0x77, 0x36, 0x1b,
-  0x24, 0x59, 0x84, 0x01, 0xae, 0x65, 0x39, 0x9c, 0x45, 0x18, 0x21, 0x88,
-  0x8d, 0x1a, 0x35, 0xeb, 0xb8, 0x09, 0xda, 0x6b, 0x73, 0x0d, 0xa2, 0x96,
-  0xcf, 0x9e, 0x43, 0x09, 0x61, 0x6e, 0x59, 0x42, 0x60, 0xeb, 0x07, 0xd5,
-  0x4a, 0x93, 0x05, 0xe9, 0x4d, 0x45, 0x04, 0x2a, 0x53, 0xdd, 0x36, 0xac,
-  0x70, 0x67, 0x61, 0xa6, 0xe6, 0xba, 0xb4, 0x45, 0xda, 0xa7, 0x45, 0x98,
-  0x7d, 0x7d, 0x15, 0x43, 0x56, 0x29, 0xdd, 0x5a, 0x86, 0x83, 0xca, 0x55,
-  0x44, 0x72, 0x93, 0xb7, 0x64, 0x7c, 0x34, 0x5a, 0x66, 0x5b, 0xfb, 0x16,
-  0xd7, 0xe6, 0x99, 0xb6, 0x4c, 0x8b, 0xd4, 0x8f, 0xfc, 0xc1, 0xe4, 0xe2,
-  0x22, 0xd7, 0x6b, 0xbf, 0xaf, 0xfa, 0xe3, 0x33, 0x97, 0x4c, 0x34, 0x67,
-  0x81, 0x7e, 0xb3, 0xb5, 0x4f, 0x6e, 0x47, 0xb9, 0x7e, 0x23, 0xa9, 0x3e,
-  0x85, 0x0e, 0xe2, 0x11, 0x1b, 0xa2, 0x7a, 0x54, 0x66, 0xd1, 0xba, 0xb1,
-  0xb2, 0xd3, 0xf9, 0xc7, 0x5a, 0xbb, 0xf3, 0xf4, 0x79, 0xfb, 0x71, 0xbb,
-  0x73, 0x53, 0x35, 0x87, 0x7c, 0x2d, 0xc4, 0x6d, 0xb4, 0x88, 0x9d, 0x6d,
-  0x5b, 0xcf, 0x7b, 0xb3, 0x4d, 0x05, 0xd0, 0x3b, 0x94, 0xfd, 0x36, 0x2c,
-  0xd9, 0x4a, 0xe9, 0x3f, 0x58, 0x92, 0x0b, 0xce, 0x22, 0xe6, 0x84, 0xe1,
-  0x5f, 0x96, 0xbf, 0x84, 0x57, 0xaa, 0xa5, 0x9f, 0x4d, 0x38, 0x55, 0xe9,
-  0x37, 0xee, 0xf1, 0x3a, 0x2c, 0xfb, 0x88, 0x1c, 0xcb, 0x17, 0xb2, 0x3c,
-  0x97, 0x29, 0x9b, 0xc5, 0xfa, 0x5d, 0x86, 0x2c, 0x4f, 0x96, 0xb8, 0x59,
-  0x4b, 0x0d, 0xc9, 0xe1, 0x6f, 0x79, 0xd5, 0xc3, 0xa2, 0x15, 0xfd, 0x2a,
-  0x3d, 0x2d, 0xb5, 0x55, 0x01, 0x93, 0xee, 0xc5, 0x32, 0x81, 0x92, 0x11,
-  0x75, 0x16, 0xa8, 0x72, 0x1e, 0x1e, 0x56, 0x9e, 0x0c, 0x46, 0x78, 0xb9,
-  0x5a, 0xe9, 0x70, 0x60, 0x8c, 0x7d, 0x91, 0x78, 0x87, 0x95, 0x3a, 0xf4,
-  0x51, 0xc6, 0xb0, 0x77, 0xf9, 0x1d, 0x0e, 0x1c, 0x36, 0x1f, 0x5f, 0x79,
-  0xb8, 0x73, 0xe0, 0xbc, 0x20, 0xb3, 0x77, 0x6d, 0xc8, 0x97, 0xab, 0xa9,
-  0x10, 0xf5, 0x74, 0x3f, 0x58, 0x81, 0xb4, 0x42, 0xc5, 0xb1, 0x4a, 0xea,
-  0xc5, 0xa7, 0xf1, 0xfc, 0x7d, 0xe0, 0x8c, 0x8c, 0x01, 0x3d, 0x52, 0xb4,
-  0x08, 0xfe, 0x7c, 0x1f, 0x8e, 0x26, 0x6c, 0xa5, 0xb4, 0x87, 0x33, 0x5c,
-  0x28, 0xdf, 0xf5, 0x54, 0xd1, 0x0e, 0x3f, 0x7a, 0xe6, 0xf0, 0x8b, 0x55,
-  0xfd, 0xa6, 0xfa, 0x69, 0x6b, 0x38, 0x6c, 0xf0, 0xbb, 0xeb, 0xfc, 0xa6,
-  0x42, 0x5c, 0xee, 0x75, 0x5f, 0xbf, 0x15, 0x02, 0xc5, 0x6b, 0xe9, 0xb0,
-  0xc8, 0x93, 0xcf, 0xed, 0xe7, 0xcf, 0xf0, 0x63, 0xa5, 0xc4, 0xdc, 0x92,
-  0x3a, 0x6a, 0x4d, 0x4c, 0xcc, 0x7d, 0x3a, 0x4d, 0x97, 0x2f, 0x61, 0x8f,
-  0xb4, 0x1f, 0x59, 0x71, 0x04, 0xcb, 0x12, 0x16, 0xe7, 0x7d, 0xd8, 0x90,
-  0x92, 0x43, 0x30, 0x62, 0x14, 0x98, 0xf0, 0x37, 0xd4, 0x06, 0xff, 0xbb,
-  0x64, 0x7d, 0xb3, 0x38, 0xde, 0xab, 0x32, 0x4f, 0x0b, 0x49, 0xe6, 0x10,
-  0x0f, 0x59, 0x88, 0x36, 0xe8, 0x70, 0xec, 0x37, 0x05, 0x26, 0xab, 0x15,
-  0x6b, 0x68, 0x2e, 0x76, 0x4a, 0x66, 0x9c, 0x8c, 0x59, 0x89, 0xeb, 0x6d,
-  0x73, 0x63, 0x56, 0x17, 0x5a, 0x22, 0x16, 0x8d, 0x63, 0xee, 0xe1, 0x89,
-  0x29, 0x68, 0x3a, 0xb9, 0x10, 0x97, 0x67, 0x15, 0xf2, 0x3b, 0x88, 0xc5,
-  0x32, 0x76, 0x0f, 0x72, 0x26, 0x2c, 0x06, 0x12, 0xe6, 0x60, 0xb2, 0x9e,
-  0x0b, 0x26, 0xe9, 0x1a, 0x2f, 0x2a, 0xbb, 0x2e, 0xe4, 0x60, 0x4b, 0x4e,
-  0xed, 0x81, 0xee, 0xd4, 0x2d, 0xf9, 0x2e, 0x10, 0x7e, 0xdc, 0x30, 0xe3,
-  0x4c, 0x22, 0x1e, 0x3f, 0xcc, 0xc3, 0xf4, 0x8f, 0x72, 0x12, 0xf5, 0x4a,
-  0x38, 0xd5, 0xb8, 0x09, 0x14, 0xab, 0x72, 0x25, 0xc5, 0xc9, 0x84, 0x8c,
-  0x8b, 0x8d, 0xf3, 0xd1, 0xe2, 0xca, 0x12, 0x67, 0x4d, 0x5e, 0xc4, 0x59,
-  0xf7, 0x00, 0x96, 0x94, 0x1a, 0xf5, 0x29, 0x3f, 0x81, 0x09, 0x24, 0x10,
-  0xd3, 0x87, 0x8f, 0xcc, 0xa1, 0x04, 0xf5, 0x48, 0xbb, 0x6a, 0xb9, 0xe8,
-  0x27, 0x6a, 0x59, 0x3c, 0xa3, 0x81, 0xae, 0xcb, 0xcf, 0x3c, 0x8f, 0xd5,
-  0xe1, 0xce, 0x6f, 0x6e, 0xa9, 0x73, 0xd3, 0xb0, 0x05, 0xab, 0x24, 0x1c,
-  0x87, 0x41, 0xe6, 0xdb, 0x6f, 0x82, 0x46, 0x97, 0x77, 0xf4, 0x9f, 0xb0,
-  0x5c, 0x62, 0x53, 0x0f, 0x8b, 0x8d, 0x5a, 0x5d, 0xfd, 0xa5, 0xe1, 0xc3,
-  0x3a, 0x11, 0x4f, 0xfa, 0xe7, 0x64, 0x9e, 0xf2, 0xf1, 0xa0, 0x8c, 0x69,
-  0x52, 0x4d, 0xdc, 0xae, 0x5d, 0xe0, 0xaa, 0x83, 0xc7, 0x4a, 0x3c, 0x08,
-  0x23, 0x2f, 0xe7, 0xa6, 0x8d, 0x40, 0xdc, 0x96, 0x3a, 0x45, 0x5d, 0xa1,
-  0x18, 0x4e, 0xd6, 0x45, 0xd6, 0x44, 0xbd, 0x7c, 0xe5, 0xe4, 0x6d, 0x8a,
-  0xc5, 0xb3, 0x2c, 0x21, 0xcb, 0x3c, 0x94, 0x98, 0x8c, 0x0b, 0x3a, 0x80,
-  0x9e, 0x5d, 0x46, 0x85, 0x59, 0x7b, 0x3a, 0x2d, 0xdf, 0xad, 0xa1, 0xbc,
-  0xa2, 0x1b, 0x28, 0xf3, 0x7b, 0x3f, 0xdc, 0xf6, 0x35, 0xe9, 0xbe, 0xca,
-  0x19, 0x78, 0xbb, 0xe6, 0xb5, 0x34, 0x26, 0x56, 0x42, 0x3f, 0x41, 0x6d,
-  0x12, 0xf5, 0x4a, 0x7b, 0x28, 0x24, 0x2b, 0x95, 0x3a, 0x17, 0x62, 0x49,
-  0xbc, 0x71, 0x65, 0x97, 0x69, 0x7d, 0x47, 0x5a, 0x46, 0x37, 0x0e, 0x87,
-  0x37, 0x54, 0x17, 0x16, 0x46, 0xa6, 0xf8, 0xaa, 0x2a, 0x26, 0x09, 0x4c,
-  0x59, 0xa1, 0x52, 0x24, 0x26, 0x51, 0x63, 0x36, 0xf1, 0x50, 0xa5, 0x6b,
-  0xd7, 0xd2, 0xf3, 0x59, 0xd7, 0x7d, 0xf3, 0xde, 0x18, 0x1d, 0xf1, 0x24,
-  0x1b, 0xba, 0x18, 0x10, 0x3e, 0xd5, 0xbd, 0xba, 0x61, 0x6a, 0x6f, 0xa8,
-  0xd6, 0x8a, 0xab, 0x3b, 0x59, 0xc8, 0x03, 0x74, 0x63, 0x0a, 0xdf, 0x5c,
-  0x2a, 0xe9, 0x3a, 0x7f, 0xde, 0xb2, 0xba, 0x9a, 0xdc, 0xbc, 0x59, 0x53,
-  0x04, 0xa8, 0x0a, 0xba, 0xde, 0xa0, 0x31, 0x5f, 0xde, 0x85, 0x67, 0x50,
-  0xef, 0x2d, 0x0f, 0xd7, 0x56, 0xe7, 0xca, 0x0c, 0x9a, 0x00, 0xa9, 0xad,
-  0xa7, 0x51, 0x38, 0x1c, 0xc0, 0x28, 0x1d, 0x1f, 0x0f, 0x09, 0xea, 0xf2,
-  0x32, 0x0b, 0xe0, 0x6e, 0x16, 0x94, 0xd7, 0x9d, 0x79, 0xc2, 0x12, 0x7e,
-  0x2e, 0x42, 0xc6, 0x5d, 0xc8, 0x7f, 0x22, 0xff, 0x02, 0x51, 0x53, 0xc3,
-  0x9e, 0xef, 0xc0, 0x4d, 0xf8, 0x93, 0x91, 0x88, 0x85, 0xb0, 0x5d, 0x72,
-  0x96, 0x4b, 0x49, 0x47, 0x52, 0xd4, 0xe6, 0x46, 0xfd, 0x0b, 0x34, 0x2b,
-  0xd3, 0xde, 0xa2, 0x53, 0x67, 0x59, 0x81, 0x4e, 0xc5, 0xad, 0x47, 0xae,
-  0xa4, 0xb3, 0xd3, 0x2a, 0xe1, 0x5d, 0xdc, 0xab, 0x94, 0x96, 0x0a, 0x6f,
-  0xe5, 0x5a, 0x5f, 0xc5, 0xa2, 0x28, 0xa7, 0x02, 0x6b, 0x58, 0xcd, 0x56,
-  0xea, 0x7d, 0x4c, 0x33, 0x69, 0x96, 0x66, 0xf2, 0xce, 0x87, 0x86, 0xbe,
-  0x5c, 0xa4, 0x90, 0x28, 0xeb, 0x81, 0xa2, 0x2f, 0x17, 0xf7, 0x10, 0xe7,
-  0x4d, 0x9f, 0x85, 0xc2, 0x32, 0xf8, 0xea, 0x6a, 0x77, 0x00, 0x33, 0x8e,
-  0x56, 0x2b, 0x8c, 0xdb, 0xd9, 0x82, 0xa1, 0x90, 0xf3, 0xd5, 0x94, 0xdd,
-  0x39, 0xec, 0x04, 0x97, 0x5f, 0xe4, 0xca, 0x8b, 0xca, 0x00, 0x2d, 0xb7,
-  0x35, 0xcf, 0xa8, 0x7a, 0x13, 0x81, 0x1e, 0x32, 0x38, 0x0f, 0x51, 0x05,
-  0x2f, 0xb9, 0xad, 0x79, 0x3e, 0xda, 0xdb, 0xef, 0x6c, 0xae, 0xc2, 0x8f,
-  0x95, 0x3d, 0xf2, 0x9b, 0x25, 0x17, 0x3b, 0xd7, 0x83, 0xc1, 0xef, 0xbd,
-  0x51, 0x40, 0x15, 0xd7, 0x33, 0xbb, 0x36, 0xd3, 0x87, 0xc2, 0x38, 0xbb,
-  0x8c, 0x5d, 0xb7, 0x56, 0xe6, 0x77, 0x38, 0x97, 0x6e, 0xc7, 0x99, 0x79,
-  0x17, 0x41, 0xe8, 0x10, 0xf2, 0x9b, 0xa5, 0xdd, 0xf5, 0xd3, 0x1e, 0xaf,
-  0x2f, 0xac, 0x9c, 0xcd, 0xd2, 0x1b, 0xa8, 0xab, 0xbb, 0xc2, 0xe1, 0x70,
-  0x9f, 0x01, 0xa3, 0x53, 0xc5, 0xd5, 0xd2, 0xa5, 0xa9, 0x04, 0xc8, 0x58,
-  0x0d, 0x03, 0x8c, 0xb6, 0x6f, 0x18, 0xe0, 0xd2, 0xfb, 0xab, 0xeb, 0x00,
-  0x12, 0xc7, 0xdb, 0x26, 0xb0, 0xe2, 0x3e, 0xeb, 0xea, 0xbe, 0x05, 0x63,
-  0xb3, 0x3f, 0xc5, 0x95, 0xd7, 0xd5, 0xf5, 0xd1, 0x2b, 0x29, 0xb2, 0x11,
-  0x45, 0x5c, 0x8d, 0x5d, 0x1b, 0x04, 0x9d, 0x0a, 0x28, 0x70, 0xc4, 0x6d,
-  0xec, 0xa5, 0xac, 0xc2, 0x0a, 0xa9, 0xb3, 0x5c, 0xbd, 0x73, 0xbd, 0x14,
-  0x03, 0x51, 0x78, 0x99, 0xf9, 0xaa, 0x1f, 0xd9, 0x00, 0xe5, 0xd7, 0xb3,
-  0xd7, 0x83, 0xc4, 0xa3, 0xf0, 0x14, 0x50, 0xca, 0x15, 0xf2, 0xa5, 0x60,
-  0x78, 0xee, 0x03, 0x5a, 0x19, 0x15, 0x10, 0xda, 0x7d, 0xef, 0xa5, 0x40,
-  0x28, 0xa3, 0x1c, 0x9e, 0x40, 0x29, 0x10, 0x58, 0x17, 0xab, 0xc6, 0x96,
-  0xa8, 0xca, 0xe3, 0x45, 0x84, 0x75, 0xae, 0x65, 0x8b, 0x76, 0xa8, 0x07,
-  0x82, 0xb8, 0x55, 0x86, 0xa0, 0x65, 0x6d, 0xa8, 0xe8, 0x09, 0x94, 0xb6,
-  0x49, 0x22, 0x23, 0xcd, 0x40, 0x1d, 0x82, 0xb0, 0x4a, 0x22, 0x3f, 0xac,
-  0x02, 0x8f, 0x5f, 0xd9, 0xee, 0x9a, 0x77, 0xaa, 0x4d, 0x8c, 0x0a, 0xab,
-  0xd3, 0x2e, 0xbf, 0xdd, 0xbd, 0x14, 0x0b, 0x2a, 0xb5, 0x1c, 0x7f, 0x31,
-  0x9b, 0xce, 0xaf, 0x66, 0xaf, 0x51, 0xbf, 0xcf, 0xca, 0xea, 0xac, 0x4a,
-  0x57, 0xc5, 0xd7, 0xeb, 0x00, 0x2b, 0xad, 0xf6, 0xa0, 0xb8, 0x56, 0xbe,
-  0x8a, 0xcb, 0xa1, 0x98, 0xde, 0x07, 0xf5, 0xee, 0xf9, 0x3a, 0x00, 0x98,
-  0x43, 0xa6, 0x0d, 0x48, 0x2d, 0x4a, 0x08, 0x28, 0x4e, 0x52, 0xcc, 0x22,
-  0x48, 0x19, 0x2c, 0xc6, 0xa8, 0x39, 0x4d, 0xa6, 0xba, 0xb1, 0x90, 0xee,
-  0x02, 0x19, 0x0a, 0xa5, 0x36, 0xad, 0xab, 0xfb, 0x82, 0x34, 0x88, 0xfe,
-  0x0e, 0x2d, 0xba, 0xaf, 0x1a, 0x11, 0xde, 0xd0, 0xb6, 0x51, 0xaa, 0x62,
-  0x27, 0x07, 0xd2, 0x58, 0xd4, 0xf7, 0xf3, 0x60, 0x74, 0x16, 0xba, 0x42,
-  0x8d, 0x8b, 0x70, 0x09, 0xae, 0x14, 0xca, 0x47, 0xb5, 0x87, 0xe4, 0x79,
-  0x9d, 0xfa, 0x47, 0xb2, 0x63, 0x87, 0x14, 0x14, 0xdd, 0x10, 0xf5, 0x0e,
-  0x57, 0x8f, 0x9c, 0x91, 0x62, 0x32, 0x76, 0x36, 0x73, 0x81, 0xab, 0xc6,
-  0xab, 0x2a, 0xf3, 0x9b, 0x08, 0x5f, 0xae, 0xe1, 0x07, 0xe4, 0x06, 0xa2,
-  0x9e, 0x73, 0x57, 0x1d, 0xf7, 0x56, 0xe2, 0x24, 0x95, 0x75, 0xc2, 0xda,
-  0x1a, 0xd7, 0x02, 0x93, 0x9f, 0x18, 0x3b, 0x01, 0x15, 0xae, 0x0b, 0x15,
-  0x90, 0xb8, 0xab, 0x8e, 0x15, 0x90, 0x9e, 0x26, 0xa7, 0x6a, 0xff, 0xb7,
-  0x63, 0xc9, 0x91, 0x55, 0x95, 0xe4, 0xa5, 0x0a, 0xe6, 0xb6, 0x23, 0x49,
-  0x95, 0x0a, 0x97, 0x4b, 0xd1, 0x1b, 0x1b, 0xad, 0xa8, 0x7e, 0x2d, 0x7f,
-  0x08, 0x71, 0x50, 0xad, 0xe7, 0x53, 0x2b, 0x9d, 0x85, 0x42, 0x44, 0xde,
-  0x18, 0x3f, 0x06, 0xa0, 0x16, 0x82, 0x6c, 0xd6, 0x8a, 0xd9, 0x64, 0x03,
-  0x63, 0x38, 0x73, 0x8a, 0xfd, 0x2f, 0xab, 0x84, 0xa1, 0x8a, 0x93, 0xd1,
-  0x20, 0x3c, 0x05, 0x75, 0x61, 0x80, 0xbb, 0x5e, 0x7a, 0xed, 0xc8, 0xca,
-  0xa1, 0xdc, 0x77, 0xa0, 0xd3, 0xa4, 0xa2, 0xf1, 0x66, 0x4d, 0xe7, 0x63,
-  0x0b, 0x7c, 0x8c, 0xad, 0x68, 0x58, 0xed, 0x9e, 0x2e, 0xda, 0xb1, 0x25,
-  0xe6, 0x7b, 0x0c, 0x40, 0x05, 0xba, 0x65, 0x48, 0xba, 0xe4, 0xf4, 0x97,
-  0xf0, 0x8a, 0x8c, 0x56, 0x0e, 0x41, 0x8d, 0x63, 0xc7, 0x64, 0x33, 0x14,
-  0xdc, 0x16, 0xa7, 0x04, 0x9d, 0x47, 0xcd, 0xaa, 0x50, 0xac, 0xba, 0x5d,
-  0x9a, 0x83, 0xaf, 0xe6, 0xe4, 0xad, 0x05, 0xf1, 0x97, 0x99, 0x75, 0xdd,
-  0x71, 0x83, 0x6d, 0x0d, 0x5e, 0xb3, 0x19, 0x6d, 0xdc, 0xa3, 0xb0, 0xf6,
-  0xac, 0x39, 0x0f, 0x3b, 0x2b, 0x9a, 0x44, 0xad, 0x3c, 0x88, 0x35, 0x33,
-  0x20, 0x2a, 0x99, 0xe8, 0xf2, 0x93, 0xa5, 0x7c, 0x6c, 0x1c, 0x69, 0xa1,
-  0x1c, 0xd9, 0x11, 0xc9, 0xc3, 0x53, 0xc2, 0xdf, 0x96, 0x18, 0x51, 0x2e,
-  0x63, 0xcd, 0x29, 0x66, 0xab, 0xc4, 0x71, 0x33, 0xb3, 0xe2, 0x20, 0x39,
-  0x6e, 0x94, 0xa1, 0x72, 0x43, 0xc9, 0x47, 0xe8, 0xee, 0x34, 0x87, 0x62,
-  0x5e, 0xf8, 0x63, 0x4f, 0x68, 0x29, 0xe5, 0xb3, 0x9c, 0xea, 0x59, 0x2d,
-  0xf5, 0xa4, 0x96, 0xda, 0x12, 0x92, 0x9b, 0xbd, 0x38, 0x5b, 0xaf, 0xd3,
-  0x25, 0x63, 0x22, 0x4b, 0x17, 0xcb, 0x48, 0xc6, 0xde, 0xe4, 0x10, 0x68,
-  0xb9, 0xfa, 0x23, 0xbc, 0x92, 0xcd, 0xa9, 0xba, 0x60, 0xa8, 0x23, 0x14,
-  0xaa, 0x16, 0xb3, 0x7b, 0x75, 0xf9, 0xda, 0x04, 0xa4, 0x88, 0x3c, 0xb3,
-  0xef, 0x88, 0x31, 0x7a, 0x17, 0x3b, 0xad, 0x99, 0xf2, 0xe6, 0x86, 0xfc,
-  0x90, 0xf9, 0xdf, 0xe8, 0x27, 0x9d, 0xa7, 0x6b, 0xb2, 0x2d, 0xe2, 0x15,
-  0xbe, 0x05, 0xb9, 0x5e, 0x6f, 0x95, 0xb2, 0x13, 0x1c, 0x4b, 0x9d, 0xba,
-  0x79, 0x4e, 0x1d, 0x72, 0xab, 0x45, 0x2f, 0x3a, 0xde, 0x4d, 0xf2, 0x84,
-  0x46, 0x82, 0xb5, 0xf8, 0x40, 0x39, 0x9c, 0xda, 0x34, 0xf2, 0xd2, 0x68,
-  0x59, 0x0e, 0x5f, 0x72, 0xd4, 0x58, 0x17, 0x66, 0xc3, 0x6e, 0x5e, 0xbd,
-  0x46, 0xf5, 0xcc, 0x26, 0x2e, 0x50, 0x16, 0xe8, 0x8d, 0x8a, 0xb1, 0x76,
-  0x9c, 0x36, 0xdf, 0x9d, 0x3e, 0x19, 0x32, 0xd6, 0x96, 0x96, 0x5c, 0x13,
-  0xcd, 0x37, 0x98, 0x9a, 0x39, 0x08, 0xc1, 0xe1, 0x2d, 0x91, 0x8a, 0xfa,
-  0xcf, 0x7c, 0x83, 0xe3, 0x64, 0x7a, 0x65, 0x23, 0x5b, 0x93, 0xeb, 0xf9,
-  0x32, 0x5e, 0xc1, 0xf6, 0x15, 0x4b, 0x25, 0x25, 0xb7, 0x2c, 0xb0, 0x9c,
-  0x83, 0xe1, 0xad, 0x2b, 0x35, 0x80, 0xe7, 0x7f, 0x55, 0xaa, 0x49, 0x54,
-  0x14, 0xff, 0xd8, 0x28, 0xd5, 0xc4, 0x18, 0xee, 0xa7, 0xc0, 0x5d, 0x69,
-  0xc3, 0x79, 0xe4, 0xb4, 0xab, 0x31, 0xa5, 0x2b, 0xb1, 0xad, 0x58, 0x14,
-  0x2c, 0x9b, 0xf5, 0x86, 0x92, 0x13, 0x57, 0xdf, 0x73, 0x6b, 0xc7, 0x33,
-  0xf2, 0x6b, 0xe5, 0xb0, 0x4e, 0xfe, 0x20, 0xf9, 0xca, 0x29, 0x0d, 0xe7,
-  0x2e, 0x45, 0xf2, 0x5b, 0xe9, 0xe0, 0x5e, 0x79, 0xad, 0x9f, 0x9c, 0xcb,
-  0x1f, 0xd5, 0x93, 0x36, 0xf9, 0x8b, 0xba, 0xb6, 0x4a, 0x1f, 0x68, 0x99,
-  0x92, 0xc9, 0x87, 0xf9, 0x73, 0xac, 0x0a, 0x46, 0x84, 0x8b, 0x62, 0xe1,
-  0x29, 0x1b, 0xa7, 0x59, 0x11, 0x2f, 0x6c, 0xb9, 0x6d, 0x0e, 0x0a, 0x47,
-  0x63, 0xe3, 0xeb, 0xa5, 0x7a, 0x31, 0x21, 0x0b, 0x9d, 0x3e, 0xb9, 0x4c,
-  0xe9, 0xce, 0xba, 0x68, 0x3c, 0x5d, 0x7f, 0xde, 0x59, 0x39, 0x51, 0xc5,
-  0xf5, 0x3d, 0x87, 0xd3, 0x99, 0x6c, 0xca, 0xf5, 0xa2, 0x8b, 0x33, 0x39,
-  0xa9, 0x98, 0x96, 0x88, 0x2e, 0xe9, 0x93, 0x61, 0x80, 0xcb, 0x23, 0xcc,
-  0x0f, 0xe0, 0x02, 0xfa, 0xf0, 0x30, 0x09, 0x87, 0x9b, 0x94, 0x79, 0x21,
-  0x5c, 0xa6, 0xf3, 0x5a, 0x16, 0x97, 0x70, 0xf4, 0x50, 0x82, 0xae, 0x9e,
-  0xc1, 0x9f, 0x53, 0x16, 0x47, 0xd9, 0x63, 0x5a, 0xcf, 0xf6, 0xce, 0xe9,
-  0x8b, 0x94, 0xc5, 0x3f, 0xef, 0xb1, 0x98, 0x05, 0x96, 0xfe, 0x09, 0x63,
-  0x18, 0x7e, 0x5b, 0x41, 0x7f, 0xe9, 0x17, 0xf7, 0x7e, 0x5b, 0x41, 0xf3,
-  0xeb, 0x8b, 0x7b, 0xff, 0x17, 0xef, 0x2d, 0xeb, 0x23, 0x14, 0xe3, 0x04,
-  0x00
+  0xff, 0xaf, 0xbd, 0x6f, 0xed, 0x6a, 0x1b, 0x59, 0x16, 0xfd, 0x9e, 0x5f,
+  0xa1, 0xd1, 0xcd, 0x4a, 0xec, 0xc1, 0x18, 0x4c, 0x9e, 0x1b, 0x42, 0xb2,
+  0x08, 0x90, 0x09, 0x7b, 0x48, 0xe0, 0xc4, 0x64, 0x72, 0xcf, 0x65, 0x7b,
+  0x81, 0x6c, 0x0b, 0xd0, 0xc4, 0x58, 0xde, 0x92, 0x1c, 0xc2, 0x30, 0x9c,
+  0xdf, 0x7e, 0xab, 0xaa, 0xbb, 0xa5, 0x7e, 0x4a, 0xb2, 0x21, 0x09, 0x39,
+  0xe7, 0xcc, 0x9a, 0xa5, 0x60, 0xa9, 0xbb, 0xba, 0xba, 0xbb, 0xba, 0xba,
+  0xba, 0xba, 0x1e, 0x09, 0x1d, 0x39, 0x59, 0x16, 0x4e, 0x12, 0xde, 0x27,
+  0x13, 0x7c, 0x89, 0x07, 0x72, 0x00, 0x12, 0x56, 0x1d, 0x05, 0x0e, 0x2e,
+  0x40, 0x6e, 0x0a, 0xb3, 0xb3, 0x78, 0xc8, 0x32, 0xa0, 0x05, 0x5f, 0x82,
+  0x68, 0x84, 0xf3, 0xde, 0xf6, 0x0e, 0x60, 0x71, 0x30, 0x5a, 0xa0, 0xa3,
+  0x3e, 0x2f, 0x14, 0x71, 0x61, 0x8d, 0x8b, 0x62, 0xde, 0x69, 0xcc, 0x14,
+  0x76, 0xe3, 0xcf, 0x9e, 0x58, 0x60, 0x69, 0xae, 0xef, 0x1b, 0xdd, 0xc6,
+  0xe1, 0x60, 0x36, 0xf2, 0x90, 0x48, 0x22, 0x18, 0x0e, 0x01, 0xf3, 0x23,
+  0x72, 0xf7, 0x24, 0xf7, 0x18, 0x75, 0xda, 0x67, 0x59, 0xb2, 0x35, 0x57,
+  0x50, 0xb9, 0x87, 0xf8, 0x37, 0xf3, 0x3a, 0x28, 0xf4, 0x6d, 0xa2, 0x83,
+  0xd8, 0xbf, 0x3b, 0xb0, 0x56, 0xcb, 0x26, 0xa3, 0x4b, 0x38, 0xd3, 0x4c,
+  0x78, 0xef, 0x88, 0xb8, 0xbe, 0xe5, 0x84, 0x44, 0xdf, 0x61, 0x42, 0xd2,
+  0xec, 0x12, 0xad, 0xad, 0x07, 0xd3, 0x24, 0x8d, 0x93, 0x55, 0x6f, 0x12,
+  0x93, 0xbb, 0x41, 0xbd, 0x69, 0xa0, 0xdc, 0xcd, 0xb4, 0xb2, 0xef, 0x1a,
+  0xcb, 0xdc, 0xca, 0xbd, 0x26, 0x42, 0x3e, 0x4f, 0x3f, 0x48, 0x22, 0x60,
+  0x59, 0x16, 0x81, 0x03, 0x09, 0x74, 0x86, 0x64, 0x70, 0x0d, 0x47, 0x6d,
+  0xe2, 0x9c, 0x98, 0x3f, 0x0d, 0x4e, 0x80, 0x8c, 0xed, 0x70, 0xb2, 0x4e,
+  0x6b, 0xf9, 0x7c, 0xe4, 0x62, 0x78, 0xdc, 0xe7, 0x3d, 0x5c, 0xf5, 0x80,
+  0x2a, 0xf0, 0xee, 0x82, 0x60, 0xc1, 0xd1, 0x52, 0x01, 0x43, 0x87, 0x4d,
+  0xa0, 0x67, 0x40, 0x60, 0x14, 0x9c, 0x92, 0x76, 0xf3, 0x04, 0x69, 0x23,
+  0x4c, 0x40, 0xa4, 0xe0, 0xba, 0xd6, 0x41, 0x7c, 0xde, 0x07, 0xbe, 0x3c,
+  0x64, 0x52, 0xb5, 0xe4, 0x35, 0x56, 0x86, 0xc0, 0xbb, 0x98, 0xf6, 0x85,
+  0x8d, 0x61, 0x30, 0xc1, 0x6d, 0x6a, 0xd5, 0x63, 0x36, 0x1e, 0xa9, 0x00,
+  0x4f, 0xfd, 0x4c, 0xcf, 0xe2, 0x8b, 0x94, 0x29, 0x5c, 0x41, 0x06, 0x0a,
+  0x99, 0x13, 0x4a, 0x34, 0xf6, 0xa0, 0x24, 0xf2, 0x69, 0x18, 0x25, 0xe0,
+  0xe0, 0x15, 0x0d, 0xc1, 0x89, 0x7b, 0x12, 0xa7, 0x29, 0x6a, 0x61, 0x5b,
+  0x38, 0x88, 0x27, 0xd1, 0x29, 0xc6, 0xf5, 0xa3, 0x8b, 0x10, 0x3a, 0x6b,
+  0x93, 0xae, 0x09, 0xe4, 0xa4, 0x53, 0x38, 0x47, 0xa7, 0xb8, 0x63, 0xb2,
+  0x7d, 0xa9, 0xed, 0xed, 0xe1, 0xf9, 0xe0, 0x22, 0x4a, 0xa1, 0x1e, 0xbb,
+  0xe5, 0xd1, 0x70, 0xae, 0x67, 0xd2, 0xfe, 0x63, 0xd8, 0xbf, 0x86, 0xea,
+  0xdc, 0x22, 0x5b, 0x72, 0x67, 0x45, 0xb6, 0x7e, 0xdc, 0xbf, 0xe3, 0x5c,
+  0x1f, 0xd6, 0xd8, 0xdc, 0xe3, 0xfe, 0xef, 0x3b, 0x3b, 0xee, 0xe7, 0x44,
+  0x59, 0x82, 0xb0, 0xbe, 0xe7, 0x14, 0x10, 0x36, 0xc3, 0xf0, 0x0b, 0x47,
+  0xa5, 0xbe, 0xfa, 0x23, 0xfc, 0x12, 0x8e, 0xe2, 0x09, 0xf0, 0x94, 0x77,
+  0xf1, 0x30, 0xfc, 0x9e, 0x1c, 0x7d, 0x7b, 0xcc, 0xb4, 0xd6, 0x19, 0x29,
+  0xbe, 0x05, 0x16, 0xc0, 0x2e, 0xa6, 0x98, 0x1c, 0x17, 0x24, 0x02, 0x64,
+  0xea, 0x41, 0x34, 0x06, 0x29, 0x32, 0x48, 0xa2, 0x78, 0x8a, 0x3c, 0xbc,
+  0x3f, 0x3d, 0x3d, 0x25, 0xf1, 0x37, 0x8e, 0xdd, 0xac, 0x6d, 0xc6, 0x83,
+  0x99, 0xc5, 0xfa, 0x24, 0x9f, 0x91, 0x59, 0x27, 0x80, 0x52, 0xcd, 0x0f,
+  0x28, 0x4b, 0xfb, 0x22, 0x77, 0x7f, 0xa9, 0x3d, 0x13, 0x5d, 0x54, 0xc1,
+  0x30, 0x6f, 0x43, 0xec, 0xe2, 0x3e, 0x0c, 0x46, 0x17, 0xc0, 0x7d, 0xcf,
+  0x29, 0xf9, 0x84, 0xca, 0xa4, 0xfc, 0xfe, 0x1c, 0x93, 0x90, 0xc3, 0x36,
+  0x03, 0x38, 0x30, 0x56, 0xfe, 0x85, 0xe9, 0x54, 0xa3, 0xc4, 0x23, 0x7d,
+  0x2b, 0xf3, 0x8b, 0x94, 0x84, 0x87, 0xaa, 0x8b, 0x7a, 0xca, 0x9f, 0xcc,
+  0xc3, 0x18, 0xa8, 0xd0, 0xcf, 0x61, 0x9a, 0x71, 0xaa, 0xc5, 0x65, 0x9b,
+  0x00, 0x2e, 0x0c, 0xc6, 0xda, 0x77, 0x66, 0xaa, 0xe1, 0x0d, 0xe2, 0x7f,
+  0x0b, 0xa9, 0xc3, 0x73, 0x92, 0xff, 0x0e, 0x06, 0x59, 0x7e, 0x5d, 0x73,
+  0x46, 0x97, 0x53, 0x30, 0xb7, 0xc5, 0xe3, 0x18, 0xdf, 0xc8, 0x55, 0xea,
+  0xc6, 0x09, 0x24, 0x7c, 0x82, 0xc0, 0xe4, 0x10, 0xce, 0x7f, 0x6b, 0xc7,
+  0x60, 0x02, 0x16, 0x57, 0x66, 0x6d, 0x78, 0x40, 0xd0, 0x30, 0xac, 0x71,
+  0x1a, 0xcf, 0x14, 0xcc, 0xf0, 0xdb, 0xa4, 0x62, 0x2a, 0x37, 0x04, 0x5d,
+  0xfc, 0xc6, 0xe9, 0x92, 0xcb, 0x4d, 0x41, 0x6f, 0x9c, 0xf1, 0xd8, 0x12,
+  0x8a, 0xa9, 0x6c, 0x6a, 0xde, 0x6d, 0xbf, 0xf3, 0x76, 0x5d, 0x65, 0x6e,
+  0x64, 0x50, 0xbb, 0xf0, 0xdf, 0x6a, 0x1c, 0xc9, 0x43, 0xac, 0x6a, 0x20,
+  0x3f, 0x38, 0x0b, 0xdd, 0x68, 0x24, 0x3b, 0xff, 0xa3, 0x28, 0xf2, 0x6d,
+  0xf7, 0x1b, 0x11, 0xe4, 0xf2, 0xff, 0x2c, 0x82, 0x84, 0x71, 0x9c, 0x95,
+  0x1e, 0xbf, 0xa9, 0x37, 0x42, 0x78, 0x2b, 0x06, 0xf6, 0xb5, 0x07, 0x7f,
+  0xde, 0x61, 0x1e, 0x45, 0x69, 0xe9, 0xb0, 0xee, 0xc2, 0x77, 0x6f, 0x8f,
+  0xdd, 0xdf, 0xdd, 0x3e, 0x8d, 0x46, 0xdf, 0x9b, 0x46, 0xe7, 0x1d, 0x26,
+  0xa7, 0x8b, 0x46, 0xee, 0x0c, 0x03, 0xa2, 0xa7, 0xf7, 0x6d, 0x5c, 0x35,
+  0x5a, 0x3f, 0xcb, 0x20, 0x05, 0xa3, 0x20, 0x39, 0x2f, 0x1b, 0xa5, 0xdf,
+  0x40, 0x12, 0xfd, 0x23, 0x1a, 0x86, 0xb1, 0x77, 0xc0, 0x2e, 0x24, 0x66,
+  0x5f, 0xac, 0xdf, 0x68, 0xb5, 0xbe, 0xf9, 0xbe, 0xab, 0xd5, 0x25, 0xc1,
+  0xdd, 0xc0, 0x89, 0x33, 0x38, 0x9a, 0x9c, 0xc5, 0x59, 0x29, 0x91, 0xbe,
+  0x49, 0xc2, 0xf0, 0x2f, 0x90, 0x4b, 0x83, 0x09, 0xa6, 0xdd, 0xf8, 0xb9,
+  0xc6, 0xfe, 0x2e, 0xd0, 0x77, 0x69, 0x38, 0x08, 0x3e, 0xc6, 0x78, 0xb1,
+  0xfc, 0xc6, 0x1d, 0xed, 0xe8, 0x46, 0x8c, 0x60, 0xf4, 0x73, 0x6c, 0x29,
+  0xe7, 0xe1, 0x79, 0x9c, 0x94, 0x0e, 0xd2, 0xe6, 0xe5, 0x00, 0xce, 0x47,
+  0xdd, 0xad, 0x0f, 0x1b, 0xef, 0xee, 0xca, 0x76, 0xbd, 0xf5, 0xb3, 0x10,
+  0x61, 0x7f, 0x7a, 0x7a, 0x94, 0x84, 0x68, 0xcc, 0x56, 0xee, 0xf0, 0x06,
+  0xe5, 0x80, 0xd7, 0x86, 0x17, 0x77, 0x65, 0x80, 0x83, 0x9f, 0x66, 0x17,
+  0x9b, 0xc9, 0x9d, 0xf8, 0xed, 0x41, 0x9c, 0x05, 0xa3, 0x85, 0x85, 0xdb,
+  0x5f, 0xed, 0x1b, 0x3f, 0xcb, 0x80, 0xcd, 0xec, 0x39, 0xcc, 0xc6, 0x6c,
+  0x71, 0xf1, 0xf6, 0xc7, 0xac, 0xfd, 0x73, 0x9f, 0x79, 0xd2, 0xcb, 0xf1,
+  0xe0, 0x88, 0x9b, 0x13, 0x95, 0x0d, 0xe0, 0x87, 0x10, 0x4b, 0x7a, 0x6c,
+  0x1c, 0xef, 0xca, 0x02, 0x1f, 0xff, 0x2c, 0xf4, 0x3a, 0x08, 0x46, 0x83,
+  0xe9, 0x28, 0xc8, 0xca, 0xbd, 0xdb, 0x77, 0x77, 0x3d, 0xf8, 0x17, 0x84,
+  0xd5, 0xe4, 0x5b, 0x2c, 0xee, 0xe7, 0x3f, 0xcf, 0xc1, 0x07, 0x8d, 0x6f,
+  0x8e, 0xc8, 0xde, 0x2d, 0x2d, 0x1b, 0xb0, 0x1d, 0x2a, 0xe8, 0x75, 0x81,
+  0x30, 0xef, 0x0a, 0x45, 0x9e, 0xff, 0x2c, 0x83, 0x3c, 0x0c, 0xbf, 0x44,
+  0x68, 0x36, 0x41, 0xd6, 0xb2, 0x65, 0x83, 0x8c, 0xa3, 0xfb, 0x89, 0x9c,
+  0x47, 0xab, 0xc4, 0xcb, 0x6f, 0x26, 0x5f, 0xde, 0x61, 0xee, 0x39, 0x7b,
+  0x5c, 0x00, 0x1c, 0xcf, 0xfd, 0x24, 0x86, 0xb1, 0x4f, 0xe3, 0xe4, 0xae,
+  0x90, 0x6d, 0xfc, 0xf3, 0xf0, 0x86, 0x14, 0x35, 0x6e, 0xa5, 0x6c, 0x61,
+  0x0f, 0xb8, 0x42, 0x1a, 0x9c, 0x4f, 0x46, 0xae, 0x08, 0x98, 0xdf, 0x3e,
+  0xe2, 0xca, 0x5d, 0x18, 0xaa, 0x9c, 0x36, 0xe9, 0x72, 0xec, 0xe8, 0x6c,
+  0x78, 0x1e, 0x95, 0x8d, 0xda, 0xd3, 0xe5, 0x25, 0xb2, 0x8d, 0x47, 0x3f,
+  0xac, 0x6f, 0xb0, 0xd0, 0xb7, 0x7f, 0x8e, 0x83, 0x64, 0xbd, 0xa3, 0xce,
+  0xce, 0x1b, 0x6f, 0x63, 0x9a, 0xc5, 0xde, 0x1e, 0x99, 0x73, 0xdf, 0x95,
+  0x45, 0xfc, 0xd7, 0xcf, 0x31, 0xc4, 0xcc, 0xdd, 0xe9, 0x88, 0xec, 0x82,
+  0x8f, 0xfe, 0x9c, 0xa6, 0x59, 0x74, 0x52, 0x7a, 0x72, 0xef, 0xee, 0xfd,
+  0xe6, 0xed, 0xe2, 0x05, 0x6e, 0xa5, 0xf4, 0x3e, 0xcf, 0xa0, 0xfd, 0xfb,
+  0xe7, 0xde, 0x80, 0xd0, 0xe3, 0x71, 0x74, 0x94, 0x61, 0x38, 0xda, 0x92,
+  0x78, 0xbf, 0x5c, 0x80, 0x0f, 0x33, 0x6f, 0xf3, 0x2c, 0x9a, 0xdc, 0x84,
+  0x5e, 0xe7, 0x34, 0x19, 0x48, 0x2f, 0xd3, 0x2c, 0x3c, 0xbf, 0x3b, 0xf6,
+  0x02, 0xce, 0xa8, 0xee, 0x7c, 0x8b, 0x46, 0x6c, 0x7f, 0x40, 0x58, 0xd5,
+  0xc1, 0x0f, 0x25, 0xc6, 0x9b, 0xc6, 0x48, 0xa2, 0x51, 0x3b, 0x9a, 0x4e,
+  0x86, 0x70, 0xce, 0x81, 0xe5, 0x5d, 0xca, 0x41, 0x99, 0x09, 0x95, 0xb7,
+  0x77, 0xb0, 0x71, 0xfb, 0x3b, 0x74, 0xf0, 0x03, 0x14, 0xeb, 0x3f, 0x2e,
+  0xce, 0x14, 0xac, 0x6b, 0xf4, 0x24, 0xfa, 0x41, 0x77, 0xe2, 0xdf, 0x76,
+  0x18, 0xbf, 0x8b, 0xb0, 0x8e, 0x4e, 0x59, 0xa8, 0x3e, 0x3a, 0x2a, 0x49,
+  0xf5, 0x20, 0x71, 0x50, 0x1e, 0xd7, 0x2b, 0xbd, 0x6d, 0x2e, 0xfa, 0x5d,
+  0x63, 0x59, 0xd5, 0x64, 0x93, 0xe9, 0xf0, 0x68, 0x10, 0x24, 0x43, 0x37,
+  0xa7, 0x7c, 0x4d, 0x23, 0xe9, 0x1d, 0x52, 0x0e, 0x0c, 0xb4, 0x26, 0x47,
+  0xa3, 0xeb, 0x14, 0x1d, 0x8d, 0xd9, 0xf9, 0xb2, 0x57, 0x9f, 0x89, 0xd6,
+  0xb1, 0x0c, 0xac, 0x15, 0x0e, 0x0d, 0xcd, 0xe0, 0x19, 0x5a, 0x4b, 0x18,
+  0x98, 0x84, 0x4f, 0x71, 0x6e, 0x23, 0x4e, 0x7e, 0x60, 0x68, 0xa6, 0x67,
+  0x37, 0x65, 0x97, 0xaa, 0x47, 0x68, 0xbf, 0x39, 0x8a, 0x58, 0xa7, 0x84,
+  0x7d, 0x1f, 0xeb, 0x17, 0x05, 0xcc, 0xb1, 0x56, 0xc7, 0x6e, 0xd8, 0x60,
+  0xf4, 0xc3, 0xec, 0x02, 0xc3, 0xf3, 0xf0, 0x73, 0x37, 0x33, 0xaa, 0x27,
+  0x6b, 0x75, 0x1c, 0xad, 0x33, 0x18, 0xe5, 0x0b, 0x74, 0x5e, 0x4a, 0xe0,
+  0x73, 0x4a, 0x31, 0xbd, 0x01, 0x86, 0xd9, 0x7f, 0xc3, 0x68, 0xf0, 0x46,
+  0x7b, 0xcf, 0x0d, 0xd6, 0x20, 0x7b, 0x4b, 0x7d, 0xbc, 0xa9, 0x6a, 0x6c,
+  0x14, 0x4f, 0x87, 0x94, 0x7b, 0x6a, 0x14, 0x07, 0xc3, 0x92, 0xf5, 0xe7,
+  0x31, 0x8f, 0x0f, 0x66, 0xd0, 0xaf, 0xfc, 0xe0, 0x88, 0xf0, 0x31, 0xbf,
+  0x15, 0x4e, 0xf8, 0x03, 0xd8, 0x13, 0x1b, 0x88, 0xe9, 0xa4, 0x6c, 0x18,
+  0x98, 0x97, 0x1d, 0x63, 0xbd, 0x48, 0xc2, 0x8a, 0x37, 0x0c, 0x9f, 0x0e,
+  0x2a, 0x83, 0x39, 0x1e, 0x07, 0xe1, 0x24, 0x5b, 0xf7, 0xdb, 0xfd, 0x68,
+  0xec, 0x2f, 0xcd, 0x3c, 0xa4, 0x9c, 0x39, 0xbe, 0xfc, 0x50, 0xb2, 0x03,
+  0xdd, 0x25, 0x6e, 0x57, 0x37, 0xbc, 0x7e, 0x74, 0x12, 0xb9, 0xd9, 0xd9,
+  0xa7, 0x68, 0xf1, 0x4d, 0x54, 0xca, 0xb2, 0xbe, 0xbd, 0x91, 0xa8, 0x55,
+  0x9c, 0xa0, 0x97, 0x88, 0xfb, 0x62, 0x30, 0xa9, 0x6d, 0x66, 0x13, 0x0f,
+  0x88, 0xd7, 0xb9, 0xd2, 0x7f, 0x89, 0xdb, 0xe3, 0x01, 0xaa, 0xa2, 0xbc,
+  0x7d, 0x74, 0xf5, 0x9a, 0x67, 0xe9, 0xcc, 0xdc, 0x03, 0x10, 0x57, 0xd4,
+  0x88, 0x8f, 0x15, 0x57, 0x3d, 0xc1, 0x30, 0x8a, 0xab, 0xd8, 0x82, 0x0c,
+  0x78, 0x31, 0x4d, 0xa3, 0xe1, 0xcb, 0x2e, 0xfb, 0x71, 0xc3, 0xb3, 0x79,
+  0x29, 0x8d, 0x16, 0x2d, 0xa3, 0x45, 0x93, 0xe5, 0x6c, 0x33, 0x2f, 0xe9,
+  0x3a, 0x87, 0x22, 0x9e, 0x66, 0x15, 0xca, 0x5a, 0x8a, 0x77, 0xe3, 0x75,
+  0xbb, 0x3b, 0x5b, 0x8e, 0x9e, 0xdb, 0xf6, 0x5e, 0x5b, 0x98, 0x49, 0xec,
+  0x17, 0x20, 0x08, 0x1d, 0xf3, 0x5f, 0x5a, 0x4c, 0xc7, 0x5d, 0xab, 0xba,
+  0x2a, 0xb3, 0xc6, 0x69, 0xda, 0xe7, 0xa0, 0xa1, 0x47, 0x63, 0xc0, 0xd5,
+  0xff, 0x0e, 0xe3, 0x36, 0x8a, 0x4f, 0xa3, 0x71, 0x45, 0x70, 0x77, 0xc4,
+  0x05, 0xe3, 0x42, 0xcc, 0x3e, 0x74, 0x35, 0xb3, 0x1c, 0x11, 0x5b, 0xae,
+  0x9d, 0xc1, 0x86, 0x8d, 0x11, 0x63, 0xe5, 0x96, 0x4a, 0x13, 0x74, 0x1e,
+  0x3c, 0x8b, 0x47, 0xc3, 0x30, 0x59, 0xf7, 0x11, 0x65, 0x5b, 0x21, 0xb6,
+  0x4d, 0x64, 0xe1, 0x57, 0x2b, 0x88, 0x24, 0x0c, 0x86, 0x28, 0xc5, 0x38,
+  0xdc, 0x83, 0xa8, 0x69, 0x38, 0xb8, 0xc3, 0x5a, 0x32, 0x6b, 0x2f, 0xd5,
+  0x4b, 0x58, 0xf3, 0xc3, 0x47, 0x06, 0xe3, 0xc4, 0x5d, 0xc4, 0xc9, 0xd0,
+  0x3d, 0x3a, 0x65, 0x25, 0xa4, 0x61, 0x70, 0x17, 0xbb, 0xdd, 0xa1, 0x28,
+  0x4d, 0xbf, 0x44, 0xac, 0x86, 0x2f, 0x9b, 0x45, 0x67, 0xc9, 0x1f, 0x94,
+  0x11, 0x69, 0x0c, 0xf2, 0x6d, 0x9c, 0x7c, 0x3e, 0x1a, 0x9c, 0x85, 0xe8,
+  0x97, 0x5e, 0x96, 0x19, 0x89, 0xaf, 0xb6, 0x9b, 0xe7, 0x44, 0x72, 0x08,
+  0x16, 0x73, 0xc6, 0x19, 0x8e, 0xcf, 0x27, 0xd9, 0xdd, 0xd1, 0x50, 0x09,
+  0x5b, 0x64, 0x37, 0x39, 0x71, 0x71, 0x0d, 0xb0, 0x5e, 0xe4, 0x4e, 0xc4,
+  0x2f, 0xf7, 0xe9, 0xe7, 0xf7, 0x71, 0x72, 0xb1, 0xaf, 0xda, 0x4a, 0x2d,
+  0x71, 0x39, 0x5b, 0x92, 0x97, 0x1c, 0xeb, 0x9a, 0x63, 0xa1, 0x9f, 0x07,
+  0x5f, 0x47, 0xe1, 0xf8, 0x34, 0x3b, 0x5b, 0xf7, 0x57, 0x8c, 0x48, 0x05,
+  0x4b, 0xb7, 0xaa, 0x74, 0x57, 0x06, 0x3a, 0x18, 0x0f, 0xc2, 0x51, 0x4d,
+  0x91, 0x67, 0x06, 0xc1, 0x3f, 0x2d, 0xcf, 0x3d, 0xb2, 0xf1, 0x7e, 0x73,
+  0x7b, 0xf7, 0xd6, 0x34, 0x3c, 0xbc, 0x2f, 0xf1, 0xe7, 0xbb, 0x70, 0xea,
+  0x81, 0x3d, 0xa8, 0xb4, 0xef, 0x7b, 0xbf, 0x7f, 0x43, 0x75, 0xb5, 0x83,
+  0x17, 0x04, 0xa3, 0x30, 0xb9, 0x43, 0xac, 0xe0, 0x22, 0x48, 0x9c, 0xca,
+  0x7d, 0x26, 0xc2, 0xef, 0x6e, 0x7f, 0x38, 0x98, 0x69, 0xd5, 0xdf, 0x73,
+  0xce, 0x7b, 0xce, 0x03, 0x72, 0xc7, 0xe7, 0xb3, 0x38, 0x01, 0x06, 0xc0,
+  0xf8, 0x42, 0x3c, 0x0c, 0x46, 0x47, 0x47, 0x5c, 0x05, 0xa8, 0x4f, 0x39,
+  0x96, 0xa0, 0xa1, 0x13, 0xfc, 0x48, 0xf9, 0xfe, 0xf2, 0xa6, 0xcb, 0xb0,
+  0xe6, 0x39, 0x23, 0x4f, 0x37, 0x3d, 0xcf, 0xd2, 0x60, 0xe8, 0xff, 0xef,
+  0xca, 0xb8, 0xe7, 0x42, 0x8d, 0x39, 0x2f, 0xfa, 0xf5, 0x53, 0xe9, 0xc9,
+  0x3f, 0x6c, 0xb5, 0x6f, 0x73, 0xa1, 0x38, 0x9d, 0x24, 0xd9, 0x78, 0x51,
+  0xe3, 0xdf, 0x64, 0x73, 0x94, 0xfd, 0x3a, 0x07, 0xa3, 0x30, 0x48, 0x66,
+  0xa3, 0x61, 0x61, 0x91, 0x33, 0x0a, 0x33, 0xc9, 0x98, 0xf1, 0x56, 0xef,
+  0x8f, 0x71, 0xbb, 0x0d, 0x40, 0xe4, 0x37, 0x48, 0x29, 0x1a, 0xae, 0xfb,
+  0x0c, 0xf3, 0x03, 0x28, 0xb2, 0x01, 0x45, 0x4a, 0x75, 0xf5, 0xac, 0xe8,
+  0xd1, 0x91, 0x80, 0x67, 0x10, 0x37, 0x9c, 0x15, 0xf9, 0xa7, 0xb9, 0x08,
+  0x50, 0x2a, 0xa4, 0xfe, 0xd0, 0x7a, 0x89, 0x4a, 0xb2, 0x30, 0x81, 0xa3,
+  0x69, 0x74, 0x7e, 0x0a, 0xfb, 0xbd, 0x54, 0x56, 0xfe, 0x53, 0xab, 0x44,
+  0x02, 0x34, 0xe7, 0xa6, 0x3e, 0xf5, 0xfc, 0x22, 0xec, 0xa7, 0xf1, 0xe0,
+  0x73, 0x98, 0x7d, 0xe2, 0x6f, 0x5d, 0xed, 0xe1, 0x14, 0x79, 0x18, 0x63,
+  0xed, 0x33, 0x70, 0x3f, 0xff, 0x65, 0x1a, 0x9d, 0x8e, 0x81, 0x13, 0xd2,
+  0x59, 0x84, 0x3c, 0xb0, 0xad, 0xcd, 0xa7, 0x83, 0x24, 0x9a, 0xe4, 0xdd,
+  0x03, 0x08, 0x29, 0x1c, 0xcd, 0xb3, 0x64, 0x8a, 0xe1, 0x4e, 0xd6, 0xbd,
+  0x2b, 0x7a, 0x4f, 0x6e, 0xe4, 0xab, 0xde, 0x61, 0x3e, 0x06, 0x57, 0xb4,
+  0x09, 0xad, 0x7a, 0x3e, 0xfe, 0xe3, 0xb7, 0x48, 0x5c, 0x82, 0x5f, 0x69,
+  0x86, 0xbe, 0xf5, 0xf0, 0x3b, 0x8d, 0xfe, 0x82, 0xdf, 0x2b, 0x4f, 0xbc,
+  0xeb, 0x96, 0x59, 0x87, 0x05, 0x0d, 0x85, 0xe3, 0x60, 0x5e, 0xaf, 0x7f,
+  0x99, 0x85, 0x79, 0xad, 0x8e, 0xb5, 0x52, 0x91, 0xca, 0x7c, 0xae, 0x5a,
+  0xd0, 0x23, 0x92, 0xc4, 0x66, 0xab, 0x0d, 0xdd, 0x9e, 0xa9, 0x02, 0x86,
+  0xa7, 0xfd, 0x43, 0x49, 0x4c, 0x3d, 0x6b, 0x6d, 0x4c, 0x40, 0x2a, 0xf2,
+  0x8f, 0xce, 0x5c, 0x99, 0x67, 0x4a, 0xad, 0xaa, 0xd7, 0x6b, 0xdd, 0xbb,
+  0x5e, 0xbb, 0x27, 0xcf, 0xf4, 0x7e, 0x90, 0xa4, 0x61, 0x92, 0x4f, 0xf7,
+  0x24, 0x86, 0xc9, 0x5e, 0x66, 0x85, 0x27, 0xf8, 0x89, 0x95, 0xda, 0x48,
+  0x92, 0xe0, 0xb2, 0xd1, 0x9f, 0x9e, 0x9c, 0x00, 0x48, 0x46, 0x21, 0x5b,
+  0x21, 0x23, 0x9f, 0x18, 0x43, 0xf2, 0xb0, 0x77, 0x4d, 0x0e, 0xa4, 0xa0,
+  0x26, 0x7e, 0x2b, 0xc1, 0x80, 0x40, 0x23, 0x66, 0xdd, 0x43, 0xf6, 0xaa,
+  0xb7, 0x96, 0xd7, 0xc4, 0x18, 0x81, 0x6d, 0xc0, 0x03, 0x8a, 0x2f, 0x17,
+  0x6f, 0xb1, 0x6d, 0x78, 0x33, 0x0e, 0x2f, 0xbc, 0x8f, 0xd1, 0x38, 0x7b,
+  0x5e, 0x60, 0xd4, 0x2c, 0x0a, 0x45, 0x27, 0x5e, 0x43, 0x69, 0x52, 0xc6,
+  0xa8, 0xc0, 0x8a, 0x35, 0xd9, 0x85, 0xa1, 0x01, 0x88, 0xf2, 0x30, 0xb4,
+  0x4f, 0x43, 0x7a, 0xdd, 0x28, 0xe9, 0xe3, 0xda, 0x3d, 0x55, 0x4b, 0x91,
+  0x4d, 0x93, 0xb1, 0x77, 0xd8, 0x6e, 0xb7, 0x0b, 0x8c, 0xda, 0x38, 0xf8,
+  0xbb, 0x44, 0x74, 0x18, 0xaa, 0x3d, 0x6f, 0xad, 0xd9, 0x6b, 0x9f, 0x07,
+  0x93, 0x46, 0xa3, 0xe9, 0xad, 0xbf, 0xd4, 0x10, 0x93, 0x60, 0x29, 0x1d,
+  0x68, 0x27, 0xe1, 0x70, 0x3a, 0x08, 0x1b, 0x8d, 0x60, 0x30, 0x10, 0x28,
+  0xec, 0x64, 0xe1, 0xb9, 0x03, 0x04, 0xfe, 0x07, 0x25, 0x0f, 0x8b, 0x82,
+  0x6d, 0x24, 0x92, 0x1e, 0xf4, 0x93, 0x86, 0x15, 0xfa, 0xf7, 0x47, 0x30,
+  0x9a, 0x86, 0xca, 0x54, 0x12, 0xbc, 0x35, 0x2b, 0x2c, 0x8e, 0x12, 0x80,
+  0x34, 0xbf, 0x5f, 0xb7, 0xbc, 0xab, 0x6b, 0xad, 0x9e, 0xfc, 0xfb, 0xfa,
+  0x9e, 0x06, 0x65, 0x3c, 0x1d, 0x8d, 0xd8, 0x67, 0x4e, 0x8d, 0x6e, 0x6c,
+  0xa4, 0xae, 0xb1, 0xa8, 0x2b, 0x5e, 0x43, 0xea, 0x12, 0x92, 0xb8, 0x31,
+  0xb3, 0x18, 0x85, 0x92, 0x51, 0xfd, 0xaa, 0x6b, 0x64, 0xb1, 0x99, 0x43,
+  0x41, 0x5e, 0x0b, 0x0b, 0xbd, 0x35, 0x0b, 0x04, 0xce, 0xc7, 0x4c, 0x18,
+  0x0a, 0x41, 0xef, 0x13, 0x79, 0x0a, 0x50, 0xe6, 0xd8, 0xe4, 0x34, 0xbc,
+  0xb0, 0x2e, 0x75, 0xab, 0x8d, 0xab, 0x71, 0xcd, 0x85, 0x5d, 0x41, 0x43,
+  0x5a, 0x8d, 0x66, 0xcf, 0x3a, 0x37, 0x12, 0x2d, 0xf9, 0x9e, 0xdf, 0x2c,
+  0x29, 0x73, 0x34, 0x38, 0x0b, 0x92, 0x96, 0x17, 0x8d, 0x87, 0xe1, 0xd7,
+  0x12, 0xc2, 0xc1, 0xd5, 0x43, 0x43, 0x24, 0x75, 0x72, 0x81, 0xd5, 0xea,
+  0x79, 0x2f, 0xbd, 0x47, 0x9d, 0xa6, 0xa3, 0xa2, 0xd4, 0x89, 0x2e, 0x0d,
+  0x5f, 0xfb, 0x04, 0x8e, 0x70, 0x9b, 0xd0, 0xe8, 0x26, 0x48, 0x3c, 0x4e,
+  0x98, 0x0e, 0x9a, 0xbb, 0x2e, 0xa3, 0x44, 0xdf, 0xb7, 0x10, 0xa2, 0xa3,
+  0xef, 0x7f, 0xc6, 0xd1, 0xb8, 0xe1, 0xbb, 0x46, 0x06, 0x10, 0x3d, 0x6f,
+  0x18, 0xe4, 0x5a, 0x50, 0x66, 0x15, 0x1f, 0xb8, 0x15, 0x5e, 0x57, 0xbd,
+  0xe4, 0xe1, 0x30, 0x3c, 0xb1, 0xcc, 0x19, 0x7c, 0x43, 0xda, 0xc2, 0xaf,
+  0x16, 0xaa, 0xb2, 0x2d, 0x5b, 0x58, 0xae, 0xcb, 0xcd, 0x7c, 0xf9, 0xc1,
+  0x2e, 0xb0, 0xf4, 0xab, 0xf7, 0xdb, 0xeb, 0xee, 0x26, 0x3f, 0x1a, 0xfc,
+  0x36, 0x8a, 0xfb, 0xc1, 0xc8, 0xdb, 0xeb, 0xff, 0x09, 0x22, 0xf6, 0xaf,
+  0x4b, 0x7c, 0x8f, 0x90, 0x0a, 0x88, 0x1d, 0x82, 0x89, 0x7d, 0xef, 0x82,
+  0xc9, 0x04, 0x26, 0x7a, 0x55, 0x42, 0xab, 0x83, 0xbb, 0x0e, 0x7d, 0x14,
+  0x69, 0x92, 0xfc, 0x62, 0xb3, 0x5a, 0x51, 0x3f, 0x62, 0xaa, 0x24, 0xe9,
+  0xeb, 0x23, 0xf5, 0xeb, 0xb3, 0x15, 0xb9, 0xea, 0xe3, 0xfc, 0x23, 0xbc,
+  0xc7, 0x6c, 0x10, 0xd2, 0xb7, 0x27, 0x45, 0xc5, 0x7f, 0xac, 0x20, 0x58,
+  0xe5, 0xeb, 0xd3, 0xe2, 0xeb, 0x93, 0xcf, 0x6f, 0xff, 0xc2, 0x54, 0x09,
+  0xe1, 0x56, 0x7c, 0x31, 0x96, 0x8a, 0x3c, 0xcf, 0x8b, 0x74, 0x29, 0x2a,
+  0x1b, 0xe6, 0x04, 0x39, 0x60, 0x29, 0x41, 0xa4, 0x52, 0xff, 0xc8, 0x4b,
+  0xed, 0x82, 0x5c, 0xb7, 0x49, 0x51, 0x88, 0x58, 0x5e, 0x2a, 0x5e, 0x88,
+  0x93, 0x0d, 0x3f, 0x67, 0xfd, 0x1e, 0x5e, 0xa6, 0xef, 0xe2, 0x7e, 0x34,
+  0x0a, 0x31, 0xf2, 0x13, 0xd4, 0x45, 0x67, 0x20, 0xdf, 0x51, 0x44, 0x1e,
+  0x42, 0x2c, 0xb7, 0xaa, 0xcd, 0x34, 0xdf, 0xcf, 0x51, 0xa0, 0xdc, 0x8a,
+  0x07, 0x12, 0x52, 0xf8, 0x1f, 0x46, 0x52, 0x80, 0x8f, 0xcf, 0xb4, 0xd7,
+  0xd3, 0x09, 0xbc, 0xfc, 0x55, 0x7b, 0x49, 0xe1, 0x02, 0xe0, 0xfd, 0x53,
+  0xed, 0x3d, 0x5e, 0x6d, 0xc3, 0xeb, 0x25, 0xe9, 0xb5, 0x24, 0x65, 0x50,
+  0xba, 0x92, 0x79, 0x70, 0x3a, 0xb3, 0xe1, 0xf4, 0xd8, 0x81, 0xd3, 0x5f,
+  0x76, 0x9c, 0x9e, 0xd8, 0x71, 0x62, 0x59, 0x50, 0xd2, 0x12, 0xac, 0x3e,
+  0xa2, 0xd9, 0x8f, 0x15, 0xad, 0xd7, 0x36, 0xb4, 0x36, 0x1d, 0x68, 0x6d,
+  0xd8, 0xd1, 0xda, 0x32, 0xd1, 0xe2, 0xff, 0x0c, 0x83, 0x2c, 0xf8, 0x8f,
+  0x69, 0x38, 0x0d, 0x87, 0xb9, 0x14, 0x15, 0xa5, 0x9f, 0x52, 0x16, 0x13,
+  0x77, 0xd5, 0x3b, 0x09, 0x46, 0x69, 0xc8, 0x5e, 0x9f, 0x07, 0x5f, 0xbb,
+  0x4c, 0xb4, 0x7e, 0xb6, 0xc2, 0xde, 0xfc, 0x9b, 0xea, 0xe1, 0x29, 0x07,
+  0x9a, 0xe0, 0x2d, 0xa0, 0x10, 0x8b, 0xd7, 0x27, 0x5b, 0x70, 0xd6, 0x56,
+  0xaa, 0x43, 0xff, 0xbe, 0x84, 0xc9, 0xce, 0xbe, 0x54, 0x94, 0xb1, 0x9b,
+  0x55, 0xda, 0x66, 0xc5, 0xab, 0x20, 0x9b, 0xa2, 0xf0, 0xbe, 0x0c, 0x6b,
+  0x3f, 0xff, 0xbf, 0x27, 0x7f, 0xec, 0x86, 0xd0, 0xec, 0x78, 0x00, 0xc0,
+  0x17, 0x3b, 0xec, 0x3d, 0x86, 0xb4, 0x85, 0xa3, 0xe8, 0xa7, 0x42, 0x0e,
+  0x9c, 0x46, 0xf2, 0x48, 0xb3, 0x5b, 0xfc, 0xd7, 0xb4, 0x1a, 0xe4, 0xc6,
+  0x8a, 0x6f, 0x3b, 0x2c, 0xbd, 0x8e, 0xfa, 0x89, 0x85, 0xee, 0xc2, 0x2e,
+  0x33, 0xf1, 0x38, 0xd5, 0x0b, 0xe4, 0x51, 0x9b, 0x58, 0xd4, 0x52, 0xfd,
+  0x33, 0x3b, 0x50, 0xe9, 0x6f, 0xd9, 0x71, 0x6f, 0x13, 0x8f, 0xb4, 0xfa,
+  0x27, 0x76, 0xd4, 0x60, 0x78, 0x62, 0xc4, 0x06, 0xf3, 0x3b, 0xb3, 0x24,
+  0x60, 0x46, 0x19, 0xae, 0xaf, 0xdc, 0xbc, 0x40, 0xff, 0x8c, 0xc7, 0x03,
+  0x37, 0x68, 0xfc, 0xba, 0xc9, 0x42, 0xac, 0x99, 0x28, 0x43, 0xdf, 0xcf,
+  0x23, 0x38, 0x9c, 0x19, 0xef, 0x29, 0x42, 0x92, 0x0d, 0x1c, 0xfb, 0x02,
+  0xc3, 0x32, 0x38, 0xb3, 0x7d, 0x86, 0x33, 0x62, 0x97, 0xce, 0x88, 0xfc,
+  0xde, 0x22, 0x8a, 0xc7, 0xfc, 0xb4, 0x68, 0x94, 0x84, 0xe3, 0x20, 0x2f,
+  0x54, 0xf2, 0xc9, 0x3e, 0xb5, 0x58, 0xc0, 0xda, 0x3a, 0x7f, 0x7f, 0x80,
+  0x4a, 0x2d, 0xdb, 0xc7, 0x7d, 0x7e, 0x35, 0x65, 0xa5, 0x0a, 0x2c, 0xd0,
+  0xed, 0x6e, 0x39, 0xbf, 0x6d, 0x4c, 0xdc, 0xd8, 0x74, 0xb3, 0xa0, 0xf4,
+  0x23, 0xae, 0x1b, 0xfd, 0x13, 0xe9, 0xcf, 0xac, 0x2f, 0xf7, 0x3e, 0x5b,
+  0x5f, 0x6f, 0x32, 0x4d, 0xa1, 0x85, 0x3c, 0xce, 0x27, 0x8e, 0xb7, 0x26,
+  0x24, 0xf6, 0x7e, 0x93, 0x74, 0xf3, 0x8e, 0x6f, 0x65, 0xcd, 0x18, 0xa3,
+  0xc3, 0x99, 0x0d, 0xb3, 0x64, 0x3d, 0xe0, 0xf4, 0x84, 0x31, 0x89, 0x93,
+  0x7c, 0xcd, 0xe6, 0x44, 0xd1, 0x25, 0x46, 0xf1, 0x31, 0x19, 0x15, 0x9c,
+  0x02, 0xc7, 0x47, 0xdd, 0x75, 0x68, 0x93, 0x0a, 0x26, 0x12, 0x5b, 0xc3,
+  0x7b, 0xd5, 0xa2, 0x06, 0x6f, 0xf0, 0x42, 0x59, 0xb4, 0x17, 0xe9, 0x26,
+  0xde, 0xa5, 0x69, 0xed, 0xa6, 0x9c, 0x8a, 0x36, 0xe3, 0x29, 0x86, 0x73,
+  0x95, 0x3e, 0xbc, 0x8f, 0xbb, 0x53, 0xb2, 0xe5, 0x10, 0x74, 0x3a, 0x3e,
+  0x35, 0x0b, 0x21, 0xb4, 0x18, 0x7b, 0xbb, 0xcc, 0x65, 0x94, 0x5f, 0xbd,
+  0x5c, 0x07, 0x42, 0x4c, 0x8f, 0x8c, 0xd3, 0x72, 0xf9, 0x84, 0x6e, 0xf3,
+  0x3e, 0xa9, 0x7d, 0x05, 0x49, 0x45, 0x3e, 0x61, 0xa1, 0x54, 0xfb, 0x4b,
+  0x21, 0xc7, 0xb4, 0x0b, 0x7e, 0x2c, 0x8b, 0x70, 0x58, 0x4a, 0x2a, 0x74,
+  0x91, 0xea, 0xb2, 0xee, 0xd2, 0xaf, 0x4e, 0xd1, 0x97, 0xfd, 0xb7, 0x4c,
+  0xcf, 0xcd, 0xbd, 0xf7, 0xef, 0xb7, 0x37, 0x0f, 0x76, 0xde, 0xff, 0x56,
+  0x51, 0xbc, 0x43, 0xcf, 0xbd, 0xfd, 0xed, 0xf7, 0x15, 0x05, 0x57, 0x18,
+  0xdc, 0xdd, 0xbd, 0x6e, 0x35, 0xd0, 0x47, 0x79, 0xd9, 0xed, 0xad, 0x8a,
+  0xa2, 0x30, 0x84, 0xf2, 0x4f, 0x71, 0xca, 0x52, 0xc6, 0xa0, 0x8d, 0x77,
+  0xf0, 0x97, 0x68, 0xa9, 0x12, 0xda, 0x44, 0x7f, 0x3a, 0x30, 0x75, 0x56,
+  0xed, 0xef, 0x57, 0x56, 0xad, 0x08, 0xa8, 0xf0, 0xe9, 0x66, 0xa9, 0xe1,
+  0x38, 0x07, 0xf4, 0xa1, 0xf5, 0xcf, 0x6b, 0x76, 0xe8, 0x8f, 0x6a, 0x40,
+  0x47, 0x6d, 0x41, 0x7e, 0xe2, 0xac, 0x01, 0xfc, 0xda, 0x72, 0x72, 0xd5,
+  0x89, 0xc7, 0xa4, 0x8b, 0x01, 0x00, 0xca, 0xc2, 0x9c, 0x04, 0x2d, 0x27,
+  0x8a, 0x42, 0xe3, 0x92, 0x6f, 0xad, 0x1a, 0x89, 0x0e, 0x58, 0x54, 0xbc,
+  0xf6, 0x28, 0x3e, 0x6d, 0xf8, 0x79, 0x21, 0x9f, 0x83, 0x2a, 0x25, 0xcd,
+  0x92, 0xf1, 0x64, 0xcd, 0x5b, 0x29, 0x1f, 0xda, 0x27, 0x59, 0x82, 0x15,
+  0xe4, 0x71, 0xe6, 0x3f, 0x01, 0x5b, 0xe0, 0x1b, 0x47, 0x03, 0x64, 0x89,
+  0x10, 0xc0, 0xe4, 0x98, 0x6b, 0xbd, 0xb4, 0x2c, 0x31, 0x75, 0xe8, 0x1f,
+  0x3c, 0x60, 0x4b, 0xf3, 0x43, 0x4e, 0x40, 0x8d, 0xa6, 0x8c, 0x36, 0x3b,
+  0xa0, 0x38, 0xf0, 0x2c, 0x63, 0x15, 0x85, 0x52, 0xc8, 0x98, 0xeb, 0xf0,
+  0xc2, 0x2b, 0xa6, 0x41, 0xfe, 0x6a, 0xb0, 0xc2, 0x96, 0x77, 0xe8, 0x07,
+  0xc9, 0x70, 0x1a, 0x8d, 0x63, 0x5f, 0x9c, 0x42, 0xd5, 0x81, 0x8c, 0xc7,
+  0x20, 0x89, 0x8c, 0xb5, 0x6e, 0x1a, 0x53, 0x75, 0x81, 0x89, 0x32, 0xb0,
+  0xa0, 0x2f, 0xcd, 0xba, 0x65, 0x34, 0x69, 0xac, 0xa5, 0x22, 0x4a, 0x5b,
+  0x2a, 0xbf, 0x5c, 0x58, 0x28, 0x8a, 0x91, 0xa6, 0x9e, 0x33, 0x44, 0x75,
+  0x7c, 0xf9, 0x4b, 0x17, 0x48, 0xfe, 0x19, 0xcf, 0xa0, 0x61, 0x26, 0x00,
+  0xe4, 0x74, 0xd5, 0xf2, 0x9e, 0x2e, 0x2f, 0x2f, 0xdb, 0xeb, 0x2a, 0x24,
+  0x82, 0x44, 0xe0, 0x68, 0xa1, 0xce, 0x04, 0x69, 0x95, 0x54, 0x79, 0x13,
+  0x8a, 0x2d, 0x76, 0xf8, 0xfc, 0xdb, 0x27, 0x80, 0x68, 0xb9, 0x7a, 0x06,
+  0x44, 0x49, 0x79, 0x0a, 0xe6, 0x1c, 0x38, 0xd7, 0xfa, 0xb0, 0x22, 0xd8,
+  0x87, 0x3d, 0x37, 0xb9, 0x3c, 0x80, 0x23, 0x07, 0x14, 0x06, 0x6a, 0x4a,
+  0x82, 0x4b, 0xd4, 0x73, 0xc0, 0xb1, 0xc3, 0xde, 0x1d, 0x7e, 0x27, 0x89,
+  0x1d, 0xe2, 0x7f, 0xea, 0xfd, 0xfa, 0x56, 0xb3, 0xfd, 0xf8, 0xc9, 0x1c,
+  0xb3, 0x8d, 0x4b, 0x9a, 0xe3, 0xd9, 0xc6, 0x43, 0x0d, 0x4b, 0x84, 0x04,
+  0x13, 0x17, 0x9f, 0x78, 0xa4, 0xa4, 0x7a, 0x4d, 0x9d, 0xd5, 0xb9, 0xe1,
+  0x59, 0x30, 0x1e, 0x82, 0xa8, 0x4a, 0x53, 0x4d, 0xa9, 0x20, 0x1a, 0x9a,
+  0xc2, 0x56, 0x86, 0xd9, 0xb4, 0xea, 0x52, 0x6d, 0x0a, 0x44, 0x09, 0xe7,
+  0xe2, 0x94, 0x84, 0xfa, 0x0f, 0x19, 0x9c, 0xb5, 0x8b, 0xc5, 0x81, 0x4c,
+  0x2f, 0xde, 0x66, 0xf6, 0x19, 0x6b, 0x2e, 0x11, 0x40, 0xaa, 0xf9, 0x72,
+  0xdd, 0x7b, 0xb6, 0x8c, 0x6b, 0x46, 0xeb, 0xad, 0x54, 0x7a, 0x1a, 0xb5,
+  0x85, 0x60, 0xdf, 0xfe, 0x82, 0x3a, 0x4d, 0xa4, 0x0a, 0x4d, 0x57, 0x65,
+  0x07, 0xae, 0xac, 0x97, 0x6b, 0x41, 0x70, 0x4c, 0xf6, 0xb9, 0xe7, 0xfd,
+  0xea, 0x31, 0x42, 0xe3, 0xc7, 0x35, 0x96, 0x25, 0x0d, 0x95, 0x50, 0x61,
+  0xc8, 0xe5, 0xbf, 0x9c, 0xe7, 0x6d, 0x01, 0x4c, 0x58, 0x2c, 0x11, 0xbb,
+  0xb3, 0x1b, 0x88, 0x39, 0x1e, 0xc7, 0x08, 0xe5, 0x70, 0xb9, 0x87, 0xd2,
+  0x64, 0x16, 0x0f, 0xe2, 0x11, 0xe6, 0x0e, 0x49, 0x29, 0x31, 0xf0, 0x61,
+  0xa7, 0xc7, 0xf3, 0xae, 0xe1, 0xd9, 0x19, 0x7e, 0xaf, 0xb4, 0xdb, 0x8f,
+  0x7a, 0x00, 0x9c, 0x2f, 0xd2, 0xc6, 0xee, 0x76, 0x93, 0xb2, 0xfd, 0x8e,
+  0xbd, 0x06, 0xdd, 0x86, 0xb5, 0x3c, 0xea, 0x5c, 0xd3, 0x9b, 0x04, 0x51,
+  0x92, 0xde, 0x2b, 0x04, 0xb1, 0xee, 0xc1, 0xc6, 0xc1, 0xc7, 0xee, 0xd1,
+  0xfe, 0x87, 0xbd, 0x83, 0xbd, 0xcd, 0xbd, 0xdd, 0xa3, 0x3f, 0xb6, 0x3f,
+  0x74, 0x77, 0xf6, 0xde, 0x43, 0xef, 0x3a, 0x6b, 0x6a, 0x91, 0x37, 0x1f,
+  0x36, 0xde, 0x6d, 0x1f, 0xbd, 0xf9, 0xb8, 0xbb, 0xcb, 0xba, 0x6e, 0xf9,
+  0xb8, 0xb5, 0xbd, 0x7b, 0xb0, 0x21, 0x57, 0x35, 0xc8, 0x0a, 0x97, 0x11,
+  0x21, 0xae, 0xed, 0x42, 0xf4, 0x8e, 0xcf, 0xac, 0xf7, 0xc2, 0x7b, 0xec,
+  0xfd, 0xfd, 0x37, 0xeb, 0x20, 0xf6, 0xff, 0x97, 0x75, 0x17, 0x9a, 0xe5,
+  0x5b, 0x13, 0xc3, 0x81, 0x25, 0xfe, 0x60, 0xeb, 0x9d, 0x81, 0xec, 0x70,
+  0x45, 0x1e, 0xbf, 0x54, 0x28, 0x38, 0x1b, 0xfb, 0xbc, 0xd2, 0xf3, 0xfe,
+  0xe6, 0x18, 0x1d, 0xc2, 0xa0, 0xbe, 0x78, 0xe1, 0x3d, 0x97, 0x76, 0xf4,
+  0x02, 0x5c, 0x81, 0x56, 0x31, 0x34, 0x25, 0xa2, 0xa9, 0xc6, 0x47, 0x5f,
+  0x78, 0x06, 0x59, 0xf2, 0x1e, 0x78, 0x4b, 0x4b, 0xde, 0x45, 0x10, 0x21,
+  0x6f, 0x26, 0x0f, 0x91, 0xc0, 0x4b, 0xc7, 0xc1, 0x24, 0x3d, 0x93, 0x02,
+  0x5f, 0x5f, 0x6b, 0x2a, 0x4c, 0x4c, 0x59, 0x89, 0xe9, 0x28, 0x45, 0x1f,
+  0x58, 0x77, 0xd7, 0x2d, 0xb3, 0xa3, 0x34, 0xf8, 0xaa, 0x0c, 0xc1, 0x05,
+  0xaf, 0xd3, 0xf4, 0x1e, 0x78, 0xcb, 0x5f, 0x4f, 0x4e, 0xb4, 0x38, 0xec,
+  0xab, 0xee, 0xed, 0x41, 0x5d, 0x95, 0xf9, 0xd0, 0xc2, 0x50, 0x09, 0x14,
+  0xcd, 0x4e, 0x43, 0x99, 0x34, 0x63, 0x34, 0xd2, 0xe5, 0x1d, 0x6d, 0xd4,
+  0xe2, 0x30, 0xec, 0x89, 0x43, 0xd4, 0x18, 0x81, 0x6c, 0x13, 0x41, 0xef,
+  0x1f, 0xaf, 0xc1, 0x3f, 0x80, 0x39, 0x0c, 0xaf, 0x4c, 0x52, 0xf4, 0x76,
+  0xdd, 0x5b, 0x71, 0x48, 0x60, 0xac, 0x0f, 0x87, 0x6c, 0xca, 0xa3, 0x5e,
+  0x2f, 0x27, 0x05, 0x82, 0xd5, 0x73, 0x88, 0x3b, 0xc6, 0xc6, 0x98, 0x2a,
+  0x83, 0x60, 0x90, 0xf5, 0x4b, 0xef, 0xb1, 0xdc, 0x3e, 0xe5, 0x96, 0x67,
+  0xdd, 0x2e, 0x24, 0xbf, 0x5c, 0x70, 0xb3, 0x0e, 0x8b, 0xb6, 0xab, 0xd6,
+  0xd9, 0xa4, 0xad, 0x22, 0x9e, 0xeb, 0xb0, 0x80, 0x24, 0xd3, 0x71, 0x4b,
+  0xa9, 0x69, 0x38, 0x1e, 0x36, 0xfc, 0x57, 0xbe, 0x89, 0xad, 0xd4, 0x17,
+  0x8b, 0x88, 0x9c, 0x79, 0x87, 0x4c, 0xa9, 0xd3, 0x22, 0x0d, 0x4b, 0x8b,
+  0x27, 0x79, 0x7a, 0x7d, 0x99, 0x85, 0xcb, 0xf2, 0x8f, 0x8e, 0xfc, 0x63,
+  0x05, 0x67, 0xc1, 0xe8, 0xa1, 0xbc, 0x70, 0xf9, 0x9d, 0xf4, 0x50, 0x2d,
+  0xa7, 0xa8, 0xb9, 0x79, 0xbb, 0x3d, 0xb3, 0xda, 0x36, 0x2a, 0xc6, 0x87,
+  0xf1, 0x60, 0x8a, 0x79, 0x5e, 0x71, 0x73, 0x4a, 0x2e, 0x99, 0x8d, 0x7b,
+  0x9c, 0x34, 0x8e, 0x0f, 0x91, 0x11, 0xc3, 0x2f, 0xfc, 0xb6, 0x98, 0x84,
+  0x27, 0xeb, 0xfe, 0xfd, 0x2b, 0xd1, 0xda, 0xb5, 0xdf, 0x3b, 0x6e, 0xca,
+  0xf0, 0x58, 0x76, 0xe3, 0x7d, 0x49, 0x6b, 0xe5, 0xad, 0xe7, 0x8d, 0xdc,
+  0x2b, 0x96, 0x9a, 0x78, 0x85, 0x77, 0x79, 0x1b, 0x59, 0x96, 0x44, 0x80,
+  0x69, 0xd8, 0xf0, 0xb5, 0xa6, 0xa4, 0x5b, 0x0f, 0xbc, 0xaa, 0x8f, 0xc7,
+  0xa1, 0x29, 0x97, 0xc0, 0x9e, 0xa5, 0x2b, 0xc9, 0xda, 0xb0, 0x0a, 0xb6,
+  0x83, 0xc1, 0x59, 0x83, 0xe9, 0x9c, 0xd8, 0x07, 0x26, 0x22, 0x34, 0x4c,
+  0x04, 0x9b, 0x4a, 0x07, 0x70, 0x4e, 0x68, 0x14, 0xe9, 0xf2, 0x7c, 0xd1,
+  0x07, 0x9a, 0xb7, 0xdd, 0x06, 0xe1, 0x47, 0x4b, 0xc7, 0xbb, 0xb9, 0x46,
+  0x6d, 0xc6, 0x01, 0x65, 0xcd, 0x4a, 0xc3, 0x89, 0xa4, 0xaa, 0xc3, 0x74,
+  0x10, 0x23, 0x8c, 0x80, 0xaa, 0xc9, 0x2b, 0xeb, 0x3f, 0x6b, 0xa8, 0xd9,
+  0x34, 0xb7, 0x06, 0x4e, 0x6d, 0x39, 0x14, 0xe8, 0x41, 0x61, 0x2f, 0xd1,
+  0x6e, 0xb7, 0xc7, 0xe8, 0x04, 0x8f, 0x3a, 0xb2, 0x98, 0x09, 0x41, 0x9a,
+  0xdc, 0x90, 0x2b, 0xfe, 0x9a, 0xad, 0x59, 0x6b, 0xe5, 0x4a, 0x41, 0x5e,
+  0x55, 0xa1, 0x50, 0x56, 0x84, 0xa5, 0xdb, 0xc1, 0xe5, 0xc4, 0x48, 0xba,
+  0x45, 0xfa, 0x1e, 0x4d, 0xf8, 0x64, 0x57, 0x7f, 0xf8, 0xb9, 0x9d, 0x05,
+  0xa7, 0xef, 0x69, 0x87, 0x85, 0x45, 0xec, 0x1f, 0x6c, 0xf9, 0x3a, 0xa3,
+  0xe5, 0xc5, 0x22, 0x90, 0xfb, 0x13, 0x12, 0xc3, 0xd6, 0x59, 0x5a, 0xe3,
+  0x57, 0x9e, 0x2f, 0x42, 0xfe, 0x8f, 0x7d, 0x24, 0xba, 0x22, 0x01, 0x80,
+  0x6f, 0x93, 0xe9, 0xfa, 0x62, 0xb2, 0xb5, 0x76, 0x7f, 0xe1, 0xed, 0x02,
+  0x40, 0x5e, 0x64, 0x55, 0x14, 0x99, 0x04, 0x78, 0x4b, 0xb6, 0xcd, 0xe6,
+  0x5f, 0x93, 0x55, 0xa9, 0x4f, 0x56, 0x4c, 0x53, 0x65, 0x9d, 0x30, 0xca,
+  0xf0, 0x5b, 0x20, 0x9d, 0x59, 0xef, 0xaa, 0x43, 0x10, 0xfb, 0xed, 0x70,
+  0x58, 0x4c, 0x37, 0x13, 0x54, 0xd3, 0x22, 0xbe, 0x91, 0x6e, 0x5a, 0xa3,
+  0x8a, 0x9c, 0xb6, 0xf8, 0x48, 0x5b, 0xce, 0x35, 0x62, 0xce, 0x50, 0x94,
+  0x2b, 0x46, 0xc6, 0x5c, 0xe8, 0xac, 0x14, 0x4c, 0xcd, 0xdf, 0x7f, 0xdb,
+  0x30, 0x75, 0x55, 0xe0, 0x19, 0x4c, 0x64, 0x8c, 0x85, 0xde, 0xa7, 0x68,
+  0xd7, 0x7e, 0xb1, 0x1e, 0x0c, 0x07, 0x18, 0x51, 0xe4, 0xb7, 0x20, 0x1a,
+  0x5b, 0xee, 0xc6, 0x65, 0x4a, 0xcb, 0xc9, 0xac, 0x21, 0xb1, 0x67, 0x12,
+  0x00, 0x96, 0x61, 0x4f, 0x80, 0xc9, 0xa5, 0x3f, 0x4c, 0xad, 0x8c, 0x45,
+  0x23, 0xc3, 0x6f, 0xe4, 0x73, 0xf3, 0x9f, 0xb9, 0x1b, 0x5e, 0x11, 0x0d,
+  0xaf, 0xcc, 0xd2, 0xf0, 0x17, 0xc5, 0x9c, 0x67, 0xee, 0xc6, 0x1f, 0x8b,
+  0xc6, 0x1f, 0xcf, 0xd2, 0xf8, 0x84, 0x1b, 0xf4, 0xcc, 0xdd, 0xec, 0x73,
+  0xd1, 0xec, 0xf3, 0x99, 0x9a, 0x2d, 0x52, 0x0a, 0xcf, 0xdb, 0x72, 0x67,
+  0x99, 0xb7, 0xdc, 0x59, 0x9e, 0xa5, 0x65, 0x5b, 0x7e, 0xef, 0x79, 0x51,
+  0x58, 0x11, 0x28, 0xac, 0xd4, 0x44, 0x01, 0xf5, 0xcc, 0x1d, 0x5d, 0x27,
+  0xca, 0xf0, 0x3a, 0xa7, 0xd8, 0x62, 0xc3, 0x39, 0x70, 0xe9, 0xdc, 0x84,
+  0xea, 0xd5, 0x3c, 0x83, 0x73, 0x37, 0x3e, 0x1f, 0xe5, 0x6b, 0xc9, 0x96,
+  0xe6, 0x6e, 0x7d, 0x3e, 0xd2, 0xc7, 0x14, 0x5b, 0x37, 0x69, 0xf2, 0x97,
+  0x59, 0x9a, 0x84, 0x43, 0x12, 0x6b, 0x35, 0x0b, 0x26, 0x4f, 0xb5, 0x66,
+  0xe1, 0x5b, 0xed, 0x76, 0x9f, 0xbb, 0xda, 0x25, 0x20, 0x6e, 0xe6, 0x96,
+  0x85, 0x93, 0xb9, 0x3b, 0x3b, 0xe7, 0x4a, 0x3b, 0x99, 0x8e, 0x46, 0x6f,
+  0x43, 0xbc, 0xe2, 0x9e, 0xbb, 0xe5, 0xb9, 0x16, 0xd8, 0x8a, 0x7d, 0x81,
+  0x59, 0x93, 0xe0, 0xce, 0x8e, 0xd8, 0xca, 0x4d, 0x56, 0x1b, 0xcb, 0xb5,
+  0x84, 0x06, 0x22, 0xc0, 0x73, 0x3f, 0x9c, 0xf6, 0xcf, 0xbe, 0xcc, 0x8f,
+  0xc1, 0x7c, 0x4b, 0xae, 0x3c, 0x89, 0xf5, 0xdc, 0xc8, 0xcc, 0xb2, 0x02,
+  0xb9, 0xf4, 0xa2, 0xe8, 0xfd, 0x55, 0x25, 0x7e, 0x95, 0xde, 0x5f, 0x3b,
+  0x03, 0xae, 0x38, 0xcf, 0x80, 0x6e, 0xfd, 0xb1, 0xac, 0x00, 0x37, 0xe0,
+  0x97, 0xa8, 0x9d, 0x51, 0x47, 0x67, 0xb3, 0xf6, 0x94, 0x95, 0xf5, 0x69,
+  0x16, 0x8d, 0x28, 0xe5, 0x7b, 0x4a, 0x29, 0x26, 0x4f, 0x28, 0xe9, 0xba,
+  0xa1, 0x3d, 0xae, 0x77, 0x91, 0x34, 0x97, 0x3a, 0x9c, 0xad, 0x04, 0xd4,
+  0x2d, 0x8f, 0xbc, 0x8c, 0x59, 0x19, 0x19, 0x6b, 0xc2, 0x7d, 0x9f, 0x24,
+  0x59, 0x76, 0x49, 0xda, 0xe9, 0x4a, 0xf1, 0x95, 0x57, 0x51, 0xf5, 0xbb,
+  0xb2, 0xe6, 0x83, 0xea, 0x54, 0xcd, 0xe5, 0xf2, 0xf7, 0x9d, 0xcb, 0xce,
+  0xe3, 0x9a, 0x93, 0x99, 0x57, 0x6e, 0x61, 0x47, 0x93, 0xcb, 0xd2, 0x99,
+  0xb4, 0x5f, 0x38, 0xce, 0x35, 0x95, 0x86, 0x75, 0x6b, 0x31, 0xbe, 0xd2,
+  0xa8, 0x5e, 0x95, 0x95, 0xd2, 0x6e, 0xd7, 0x76, 0xb0, 0x91, 0x2f, 0xb0,
+  0xf4, 0x71, 0xcd, 0xa5, 0x6e, 0x1d, 0x8d, 0x7c, 0xef, 0xce, 0x94, 0xfe,
+  0xa2, 0x66, 0xc3, 0x76, 0x1d, 0xde, 0xf2, 0x0a, 0xfd, 0xbf, 0x7c, 0x84,
+  0x34, 0x8d, 0x07, 0x34, 0x60, 0x6a, 0x09, 0x04, 0xd3, 0xe4, 0x7a, 0x69,
+  0x6f, 0x63, 0x7f, 0xc7, 0x72, 0x19, 0xcf, 0xcd, 0xc1, 0x10, 0x73, 0x74,
+  0x44, 0x90, 0xb0, 0x17, 0x54, 0x1b, 0x82, 0x28, 0xd5, 0x38, 0x3e, 0xcb,
+  0xb2, 0xc9, 0xea, 0xd2, 0xd2, 0xfd, 0x2b, 0x59, 0x2d, 0xc3, 0xed, 0x99,
+  0xae, 0x97, 0xd2, 0xc1, 0xab, 0xfb, 0x57, 0x58, 0xff, 0xfa, 0xc1, 0x38,
+  0x1e, 0xc0, 0x79, 0x29, 0x5c, 0xbf, 0x7f, 0x85, 0xb7, 0x08, 0x5b, 0x74,
+  0x8b, 0x88, 0x87, 0x1b, 0xc4, 0xb6, 0xd1, 0xbc, 0x3e, 0x96, 0x39, 0x95,
+  0xb0, 0xfa, 0xb2, 0xb4, 0x8e, 0xa4, 0x87, 0xaf, 0x90, 0x8c, 0xfd, 0xc0,
+  0x47, 0x9d, 0x70, 0xfe, 0xb3, 0xe3, 0x3b, 0xe8, 0xda, 0x75, 0x19, 0x54,
+  0xa9, 0xf7, 0x5f, 0x00, 0xa8, 0xff, 0x1a, 0xf3, 0xa8, 0x57, 0xff, 0x1a,
+  0xfb, 0x95, 0xd5, 0xd2, 0x01, 0xbc, 0x19, 0x1d, 0xc4, 0x13, 0x55, 0x01,
+  0x65, 0x16, 0x61, 0x7b, 0xb6, 0x4c, 0x63, 0xb3, 0x8c, 0xeb, 0x74, 0xd6,
+  0x71, 0xc5, 0x2d, 0xbb, 0xbb, 0xbb, 0x77, 0xe0, 0x9d, 0x07, 0xe3, 0xe0,
+  0x94, 0xce, 0xdc, 0xc5, 0x5c, 0x63, 0x8e, 0x41, 0xa6, 0x0a, 0xb2, 0x2a,
+  0xea, 0x84, 0x41, 0xeb, 0x88, 0x94, 0x8d, 0x0e, 0x75, 0xce, 0x43, 0x52,
+  0xe7, 0x00, 0x96, 0x18, 0x80, 0x0f, 0xfd, 0x2d, 0x7a, 0x87, 0xec, 0x48,
+  0xdd, 0x7b, 0x28, 0xa9, 0x72, 0x7e, 0x91, 0x60, 0xd5, 0xd1, 0xd3, 0x7f,
+  0x0e, 0x2f, 0xa1, 0x49, 0xa9, 0x52, 0x95, 0xa2, 0x6c, 0xcd, 0xc4, 0x7b,
+  0x07, 0xed, 0x93, 0x2b, 0xa1, 0x90, 0x9a, 0x2b, 0x1a, 0x0a, 0x08, 0xf0,
+  0x8a, 0xf9, 0x37, 0x37, 0xfc, 0x8d, 0x14, 0x1d, 0x70, 0x50, 0xe3, 0x8e,
+  0x03, 0xc0, 0x1d, 0x65, 0x14, 0x25, 0x24, 0xd9, 0xea, 0x91, 0xf2, 0x29,
+  0x3d, 0x94, 0x1b, 0xed, 0x91, 0xbd, 0x3e, 0x92, 0x28, 0xf4, 0xa3, 0xd0,
+  0xe1, 0xb5, 0xf1, 0x0e, 0xa6, 0x21, 0x7c, 0x1b, 0xde, 0xab, 0x17, 0x1f,
+  0x9a, 0xe7, 0x03, 0x69, 0x51, 0xf0, 0x02, 0xbe, 0xf8, 0xc9, 0x8d, 0x9d,
+  0x99, 0x6e, 0x65, 0x1b, 0x50, 0xbc, 0x34, 0xd4, 0x3a, 0x72, 0x57, 0x53,
+  0xa3, 0xab, 0xbc, 0x0b, 0x72, 0xfb, 0x2a, 0x0f, 0xe5, 0x24, 0xb8, 0x84,
+  0x3d, 0x5a, 0x42, 0xe2, 0x78, 0x45, 0x36, 0xde, 0x40, 0x62, 0x72, 0xef,
+  0x80, 0xf4, 0xd0, 0x81, 0x35, 0x7f, 0x49, 0xb8, 0xa5, 0xd3, 0x3e, 0x33,
+  0xba, 0x6f, 0x2c, 0xb7, 0xbc, 0x95, 0xc7, 0xcd, 0xeb, 0x07, 0xf7, 0xaf,
+  0x16, 0x0a, 0xc2, 0x04, 0x72, 0xe4, 0xbd, 0x77, 0x98, 0xae, 0x8b, 0x95,
+  0xdf, 0xf0, 0x1f, 0xfb, 0x15, 0x45, 0x99, 0xe5, 0x64, 0x7e, 0x49, 0x5a,
+  0x56, 0x2c, 0xef, 0x14, 0x8e, 0x08, 0xe2, 0x99, 0x36, 0x04, 0xf0, 0x94,
+  0x6d, 0x10, 0x15, 0x95, 0xf3, 0xcb, 0x0b, 0x51, 0xfa, 0xaa, 0xc2, 0x22,
+  0x47, 0x18, 0x74, 0x49, 0x0d, 0xae, 0x95, 0x56, 0xb9, 0x76, 0x7e, 0xbd,
+  0x76, 0x99, 0xd6, 0xcb, 0x9b, 0x41, 0x59, 0x05, 0xd3, 0x8f, 0x43, 0x32,
+  0xb2, 0x6f, 0x0f, 0xf0, 0x48, 0x2c, 0x46, 0x4f, 0x15, 0x18, 0x71, 0x32,
+  0xac, 0x7c, 0xa1, 0x98, 0xa5, 0x47, 0xae, 0x59, 0xe2, 0x22, 0x42, 0x17,
+  0x78, 0x03, 0x5e, 0xd2, 0xa2, 0xfc, 0xd1, 0xf0, 0x0d, 0xbb, 0x51, 0xbf,
+  0x49, 0xaa, 0x49, 0xb2, 0x50, 0xd1, 0xc6, 0xb4, 0xc6, 0xd4, 0x0a, 0x3a,
+  0x05, 0xa2, 0x5e, 0xe2, 0x21, 0xa4, 0x44, 0x3a, 0xd9, 0x57, 0x3a, 0xd9,
+  0x69, 0x43, 0x02, 0xc4, 0xf9, 0x64, 0xb9, 0x59, 0x2a, 0x2e, 0x33, 0x15,
+  0xa1, 0xb5, 0xff, 0xca, 0x02, 0x61, 0xe5, 0x5e, 0x2d, 0x57, 0x73, 0x62,
+  0xfb, 0x48, 0x55, 0x74, 0x74, 0x16, 0x53, 0x02, 0x7e, 0x44, 0x9d, 0xc3,
+  0x7e, 0x04, 0xaa, 0x1d, 0xec, 0x6d, 0xed, 0xad, 0x7a, 0x98, 0x3c, 0x80,
+  0x6c, 0x9b, 0x62, 0x2d, 0xe0, 0x82, 0xad, 0xcf, 0x9d, 0x79, 0xfb, 0x3c,
+  0xe3, 0xfa, 0xbd, 0xd1, 0xda, 0x9d, 0x61, 0xdd, 0xce, 0xb0, 0x66, 0xed,
+  0xeb, 0xd5, 0xb6, 0x56, 0xad, 0xeb, 0x54, 0x59, 0x93, 0x40, 0x8c, 0x79,
+  0x01, 0x85, 0x04, 0xd1, 0x73, 0x05, 0x77, 0x95, 0xb7, 0x07, 0xef, 0x76,
+  0x35, 0x12, 0x84, 0x69, 0xd6, 0x02, 0x18, 0xca, 0x42, 0x44, 0x71, 0x63,
+  0xf1, 0x70, 0xe3, 0x61, 0xcb, 0x7b, 0xf8, 0x1a, 0x1f, 0x9b, 0xf8, 0xd8,
+  0xc2, 0xc7, 0x36, 0x3e, 0xde, 0xe0, 0xe3, 0x37, 0x7c, 0xbc, 0xc5, 0xc7,
+  0x0e, 0x3e, 0xfe, 0x89, 0x8f, 0xdf, 0xf1, 0xb1, 0x8b, 0x8f, 0x77, 0xf8,
+  0x78, 0x8f, 0x8f, 0x3d, 0x7c, 0xec, 0xe3, 0xe3, 0x3f, 0xf0, 0xf1, 0x01,
+  0x1f, 0x5d, 0x7c, 0x1c, 0xe0, 0xe3, 0x23, 0x3e, 0xfe, 0xc0, 0xc7, 0x27,
+  0x7c, 0xfc, 0x5f, 0x7c, 0xfc, 0x27, 0x3e, 0xfe, 0xdf, 0xc3, 0xe2, 0x16,
+  0xe4, 0x61, 0x80, 0x6f, 0xfa, 0xf8, 0x18, 0xe0, 0x63, 0x88, 0x8f, 0x10,
+  0x1f, 0x27, 0xf8, 0x38, 0xc5, 0xc7, 0x19, 0x3e, 0x22, 0x7c, 0xfc, 0x89,
+  0x8f, 0xcf, 0xf8, 0x18, 0xe1, 0xe3, 0x1c, 0x1f, 0x63, 0x7c, 0xc4, 0xf8,
+  0x98, 0xe0, 0xe3, 0xdf, 0xf8, 0x48, 0xf0, 0x91, 0xe2, 0x23, 0xc3, 0xc7,
+  0x14, 0x1f, 0x5f, 0xf0, 0x71, 0x81, 0x8f, 0xaf, 0xf8, 0xb8, 0xc4, 0xc7,
+  0x5f, 0x32, 0x26, 0xcb, 0xf8, 0xa6, 0x83, 0x8f, 0x15, 0x7c, 0x3c, 0xc2,
+  0xc7, 0x63, 0x7c, 0x3c, 0xc1, 0xc7, 0x53, 0x7c, 0x3c, 0xc3, 0xc7, 0x73,
+  0x7c, 0xfc, 0x03, 0x1f, 0x8b, 0xf8, 0x68, 0xe3, 0xe3, 0x08, 0x1f, 0xff,
+  0x85, 0x8f, 0x06, 0x3e, 0x9a, 0xf8, 0xf8, 0x05, 0x1f, 0xbf, 0xe2, 0x63,
+  0x15, 0x1f, 0xad, 0x87, 0xec, 0xfe, 0x86, 0x39, 0x6c, 0x0d, 0xce, 0xd0,
+  0x5d, 0x6b, 0xa8, 0x3b, 0x6b, 0xf1, 0x99, 0x3a, 0x96, 0x23, 0x04, 0x54,
+  0xc4, 0x6f, 0x46, 0xb1, 0x4a, 0x48, 0x27, 0x42, 0x60, 0xc1, 0x5b, 0x33,
+  0x00, 0x7e, 0x5d, 0x7c, 0xc8, 0x63, 0xaa, 0xc2, 0xce, 0x7c, 0x96, 0x98,
+  0x1f, 0x78, 0x30, 0xd5, 0x94, 0xd1, 0x56, 0xf1, 0xd9, 0x12, 0x43, 0xd5,
+  0xb8, 0xa1, 0xa3, 0x46, 0x4d, 0xb8, 0x59, 0xb0, 0xee, 0xa3, 0x17, 0xd0,
+  0x83, 0xff, 0xf3, 0x35, 0x58, 0xfb, 0xfa, 0xec, 0xe9, 0xf3, 0xe2, 0xa3,
+  0x24, 0x11, 0xe6, 0xef, 0x78, 0x98, 0x66, 0x06, 0x4b, 0x20, 0x5f, 0x84,
+  0x50, 0x38, 0x16, 0x2b, 0x81, 0x39, 0x7d, 0x3d, 0x7c, 0x28, 0x2f, 0x09,
+  0x8e, 0x36, 0xae, 0x06, 0xba, 0x7c, 0x74, 0x30, 0x65, 0x28, 0xf6, 0x0a,
+  0xff, 0x58, 0x67, 0x77, 0x8a, 0xa6, 0x18, 0x22, 0x81, 0xd4, 0x56, 0xbd,
+  0xce, 0xeb, 0x65, 0x53, 0x82, 0x65, 0x34, 0x1a, 0x78, 0x21, 0x33, 0x58,
+  0xe1, 0xfa, 0x01, 0x1f, 0x16, 0x16, 0x4c, 0x3f, 0xb2, 0xb0, 0xf2, 0x4a,
+  0x59, 0x9e, 0x47, 0xe9, 0xe2, 0x93, 0x9d, 0x3a, 0xdd, 0xd2, 0x9b, 0x53,
+  0x00, 0x8d, 0x98, 0xd4, 0x59, 0x05, 0x06, 0x27, 0x0d, 0xc0, 0x70, 0x0e,
+  0xc3, 0x76, 0x39, 0xec, 0x7e, 0x83, 0x1c, 0x85, 0xe1, 0xdc, 0xd8, 0x28,
+  0x6b, 0x41, 0xb8, 0x7e, 0xb7, 0xbc, 0xce, 0x72, 0xb3, 0x69, 0xde, 0xfd,
+  0xab, 0x0c, 0x5b, 0x1b, 0x51, 0xf5, 0xa0, 0xb3, 0xd4, 0x8f, 0xc6, 0x34,
+  0x67, 0x64, 0x86, 0x67, 0xec, 0xdb, 0xba, 0xd4, 0x9c, 0x70, 0xa7, 0x6a,
+  0x82, 0x27, 0x7e, 0xb4, 0x83, 0xc2, 0x8a, 0xad, 0xd1, 0x34, 0xea, 0x04,
+  0xb2, 0x8d, 0x9b, 0x21, 0xa5, 0x48, 0x5f, 0x65, 0x5f, 0x5f, 0x90, 0x4b,
+  0x14, 0x8e, 0x6d, 0x75, 0x2d, 0xe6, 0x0e, 0xf6, 0x2d, 0x76, 0x4d, 0x8e,
+  0xe2, 0xcc, 0xaf, 0x36, 0xe2, 0x28, 0xb1, 0x35, 0x4b, 0x35, 0x17, 0x7d,
+  0x65, 0x77, 0x64, 0x3e, 0x45, 0x4a, 0xcb, 0x86, 0x1f, 0xb7, 0x84, 0x7e,
+  0xcb, 0x33, 0xf0, 0x51, 0x5d, 0x9e, 0xae, 0xd7, 0xea, 0x2a, 0x93, 0xec,
+  0xea, 0x29, 0xdb, 0xe6, 0x54, 0x90, 0x0e, 0x4e, 0xb3, 0x20, 0x0c, 0x69,
+  0x9c, 0xc5, 0xad, 0x64, 0xf1, 0x49, 0x5a, 0x24, 0xa8, 0x2e, 0x45, 0xfd,
+  0xee, 0xaa, 0xf9, 0x4a, 0x33, 0x46, 0x17, 0x3e, 0xa3, 0xb9, 0x3f, 0xe2,
+  0x9a, 0x51, 0x65, 0xc5, 0x02, 0x65, 0xa5, 0x04, 0x0a, 0x39, 0x2e, 0x9a,
+  0x60, 0x1e, 0x59, 0xc0, 0x3c, 0x2a, 0x01, 0x83, 0x1e, 0x8e, 0x26, 0x94,
+  0x27, 0x16, 0x28, 0x4f, 0x1c, 0x50, 0x72, 0x77, 0x47, 0x13, 0xcc, 0x53,
+  0x0b, 0x98, 0xa7, 0x76, 0x30, 0x5b, 0x7b, 0x9f, 0xde, 0x77, 0x37, 0x37,
+  0x76, 0xb7, 0x2d, 0x60, 0x1e, 0xdb, 0xab, 0x08, 0x27, 0x4c, 0xa3, 0x42,
+  0xc7, 0x55, 0xe1, 0xe9, 0xf3, 0xaf, 0x4f, 0x9e, 0x3d, 0x35, 0x2b, 0xac,
+  0x74, 0x56, 0x51, 0x26, 0xe9, 0x5f, 0x62, 0xf4, 0x3a, 0xaf, 0x63, 0x7c,
+  0x5e, 0x91, 0x3f, 0xaf, 0x58, 0x61, 0xbf, 0xfe, 0xcf, 0xfd, 0x8d, 0x6e,
+  0x57, 0x02, 0x3d, 0x64, 0xd1, 0xaf, 0xed, 0x98, 0x6c, 0x7e, 0xec, 0x1e,
+  0xec, 0xbd, 0xf3, 0x2b, 0x58, 0xcf, 0x76, 0x92, 0xc4, 0xc9, 0x07, 0xd4,
+  0x25, 0x6a, 0x4c, 0x48, 0x92, 0x3c, 0xd5, 0x1a, 0x1b, 0xe3, 0xe1, 0xce,
+  0x38, 0xca, 0x90, 0xb3, 0x2d, 0x2f, 0xcb, 0xf4, 0x6e, 0x2d, 0x66, 0x3b,
+  0x18, 0x48, 0xf2, 0xa3, 0xce, 0x89, 0xec, 0x12, 0x2b, 0x69, 0x46, 0x1c,
+  0x22, 0xaa, 0xab, 0x3b, 0x8d, 0xda, 0xf6, 0xb6, 0x11, 0xa0, 0xf9, 0x71,
+  0x87, 0x1b, 0x5a, 0x28, 0x32, 0x2d, 0xfa, 0x0e, 0xfd, 0x16, 0x66, 0xc2,
+  0xde, 0xcc, 0x2d, 0xaa, 0x33, 0x10, 0x7a, 0x93, 0x15, 0xd2, 0x72, 0x85,
+  0xf2, 0xdb, 0xa6, 0x27, 0xd5, 0xcb, 0x48, 0x93, 0x74, 0x16, 0x0d, 0x43,
+  0xf4, 0xd7, 0x25, 0xe5, 0x70, 0x47, 0xb5, 0x79, 0xbf, 0xce, 0x5d, 0xa1,
+  0x9d, 0xc3, 0x65, 0x1c, 0x78, 0x9d, 0x05, 0x73, 0x75, 0x19, 0xea, 0x7f,
+  0xa2, 0x54, 0xd6, 0x89, 0x02, 0xff, 0x8d, 0x82, 0x11, 0x99, 0xab, 0x4e,
+  0xc7, 0x03, 0x36, 0x8b, 0xf4, 0x57, 0xee, 0xe5, 0x3d, 0x61, 0x75, 0x5a,
+  0xf4, 0x9a, 0xbe, 0xf3, 0x37, 0xc5, 0xee, 0x05, 0x04, 0x9d, 0x57, 0x14,
+  0x63, 0x4e, 0x9c, 0xbc, 0x4d, 0x26, 0xbd, 0x28, 0x9c, 0xb5, 0xa1, 0x39,
+  0xc0, 0x12, 0xf7, 0xc3, 0xa1, 0xa8, 0xd2, 0x6c, 0xb6, 0x04, 0x46, 0xd0,
+  0x5a, 0x1a, 0x8f, 0xbe, 0x84, 0x8d, 0xc3, 0x1e, 0x6e, 0xbd, 0x88, 0x2b,
+  0x06, 0x27, 0x87, 0x53, 0x6f, 0x81, 0x2a, 0xbb, 0x51, 0x7a, 0x0b, 0xaf,
+  0xf5, 0xa3, 0x3b, 0x48, 0x32, 0x67, 0xec, 0xb5, 0x71, 0x3c, 0xa7, 0x10,
+  0xe7, 0x4d, 0x32, 0xb3, 0x2d, 0x78, 0xbe, 0x54, 0xea, 0x22, 0x89, 0x50,
+  0x7c, 0xa0, 0x62, 0x2d, 0xef, 0x17, 0xfc, 0x97, 0x8f, 0x3c, 0x23, 0x05,
+  0x6c, 0xae, 0x21, 0x5e, 0x17, 0x8e, 0x32, 0xcc, 0x1a, 0x45, 0x78, 0x84,
+  0xa2, 0x17, 0xb5, 0x55, 0xcd, 0x38, 0xd4, 0x4a, 0x18, 0xe8, 0x29, 0x05,
+  0x6a, 0xe0, 0xa9, 0x96, 0x07, 0x84, 0x95, 0x17, 0x0a, 0xe6, 0x0a, 0x76,
+  0x0d, 0xa3, 0xa0, 0xd6, 0x97, 0x4d, 0x5d, 0x8d, 0xe1, 0x50, 0x9b, 0x9a,
+  0xa5, 0xea, 0x68, 0x44, 0x5c, 0xdd, 0x31, 0x8b, 0x42, 0x97, 0x8c, 0x97,
+  0x4a, 0xb7, 0x0c, 0x44, 0x1b, 0xd6, 0x0a, 0x9a, 0x24, 0x2c, 0xa8, 0x86,
+  0x26, 0x52, 0xd5, 0xbc, 0xb3, 0x57, 0x05, 0x73, 0xc8, 0x25, 0xdb, 0x7e,
+  0x3c, 0xbc, 0x6c, 0xd3, 0xf1, 0x85, 0xac, 0xa3, 0x98, 0x7e, 0xa0, 0x91,
+  0x07, 0xce, 0x5f, 0xc4, 0xe5, 0xeb, 0x37, 0x4b, 0xae, 0x54, 0x5c, 0x90,
+  0x82, 0xe1, 0xd0, 0x09, 0x46, 0xc3, 0xdb, 0x20, 0x31, 0x75, 0x1a, 0xf5,
+  0xf9, 0x29, 0x13, 0xcd, 0x99, 0x36, 0x9b, 0x07, 0x28, 0x5b, 0x2f, 0x28,
+  0xc9, 0x57, 0xb4, 0xd9, 0x1a, 0xfc, 0x2b, 0x59, 0xe2, 0x36, 0x0c, 0xcc,
+  0x58, 0x80, 0x3f, 0xbf, 0xe9, 0xba, 0x42, 0xd0, 0x5c, 0xa6, 0x6b, 0x59,
+  0xba, 0xd5, 0x19, 0x7e, 0x1e, 0x29, 0xac, 0x72, 0x02, 0x8c, 0x53, 0x02,
+  0x47, 0x58, 0x6b, 0xb2, 0x1c, 0xe9, 0x1a, 0x66, 0x75, 0x95, 0x13, 0xed,
+  0x44, 0xb8, 0xbc, 0x69, 0x75, 0x02, 0xfd, 0x76, 0x1e, 0xeb, 0xac, 0xa9,
+  0x98, 0x37, 0xaa, 0x5c, 0xa6, 0xdc, 0xce, 0x51, 0xa3, 0x2f, 0xeb, 0xb2,
+  0x67, 0xeb, 0x69, 0xb6, 0x15, 0x2e, 0xe9, 0x3c, 0x95, 0xd5, 0xa5, 0xc0,
+  0x72, 0x5b, 0xb9, 0x1a, 0x10, 0x2b, 0x69, 0xc5, 0x3a, 0xe1, 0x55, 0x40,
+  0x2b, 0xe6, 0xd2, 0x36, 0x27, 0x26, 0x90, 0x9a, 0xb3, 0xa2, 0x8e, 0x62,
+  0xcd, 0x59, 0x29, 0x86, 0x3a, 0x3f, 0x3d, 0x8d, 0x52, 0x16, 0xf3, 0x64,
+  0xd5, 0xbb, 0x12, 0x6e, 0xce, 0xc4, 0x3c, 0x3f, 0x87, 0x97, 0xb9, 0xb7,
+  0x8b, 0x32, 0x02, 0x62, 0xae, 0x44, 0x45, 0x75, 0x06, 0xf3, 0xb7, 0xb0,
+  0xd5, 0x5c, 0x5d, 0xaf, 0x95, 0x55, 0x3c, 0x84, 0x26, 0xd0, 0x3a, 0x9d,
+  0x1a, 0x59, 0x93, 0x22, 0x1d, 0x0c, 0x82, 0x91, 0x28, 0x8b, 0xc7, 0x9f,
+  0x2c, 0x3c, 0x6f, 0xf8, 0xc5, 0xa8, 0xe5, 0x12, 0x08, 0x4c, 0xd7, 0x3f,
+  0xbb, 0x7b, 0xef, 0xdb, 0xec, 0xf6, 0x24, 0x3a, 0xb9, 0x6c, 0x58, 0x1a,
+  0x69, 0x36, 0x95, 0x90, 0x4b, 0x44, 0x60, 0x78, 0xb5, 0x54, 0xd9, 0x27,
+  0x02, 0x4d, 0x47, 0xc7, 0x86, 0x82, 0xd1, 0x69, 0x19, 0x46, 0xb4, 0xc3,
+  0xfa, 0x57, 0xd7, 0xf2, 0xea, 0xe5, 0xd2, 0xb7, 0x6b, 0x00, 0xe4, 0x90,
+  0x34, 0x6c, 0x92, 0x34, 0xc3, 0x67, 0x5c, 0x32, 0xe2, 0x95, 0xa9, 0x12,
+  0xd0, 0xe5, 0xa0, 0x74, 0x14, 0x0d, 0x40, 0x1a, 0x0a, 0x46, 0xa3, 0xa2,
+  0x92, 0xb1, 0x1b, 0xcb, 0x76, 0xdd, 0x08, 0x3e, 0x1a, 0x12, 0xe0, 0xdc,
+  0x8e, 0xe6, 0x88, 0x2e, 0xaf, 0xe0, 0x5f, 0x3a, 0x29, 0x4b, 0x8d, 0xd6,
+  0x33, 0x05, 0x96, 0xac, 0xa9, 0x2b, 0xee, 0x1e, 0x69, 0x59, 0x47, 0x8a,
+  0x33, 0x4b, 0x4d, 0xab, 0x65, 0x69, 0x2b, 0x33, 0x3d, 0x4e, 0xc9, 0xcb,
+  0x50, 0xdd, 0xc0, 0xd4, 0x55, 0xe7, 0x8e, 0x19, 0x01, 0xd4, 0x74, 0x39,
+  0x0a, 0xdb, 0x1c, 0x26, 0x37, 0xee, 0x96, 0xdc, 0x0f, 0xfc, 0x3e, 0x5a,
+  0x26, 0xf9, 0x16, 0xef, 0x02, 0x8d, 0xf5, 0x09, 0xc3, 0x81, 0x72, 0x9b,
+  0xa1, 0xc2, 0x9d, 0xaf, 0x70, 0x6f, 0x59, 0x56, 0xaf, 0x79, 0xc9, 0x81,
+  0x65, 0x63, 0x1c, 0x9d, 0x93, 0x71, 0x18, 0xf3, 0x2a, 0xb4, 0x9d, 0x38,
+  0xaa, 0x6e, 0xe5, 0xad, 0xad, 0xae, 0xd5, 0x01, 0x31, 0xd7, 0x0d, 0x7d,
+  0xb9, 0xef, 0xa2, 0xea, 0x1d, 0x78, 0xed, 0x92, 0x4f, 0x30, 0x5b, 0xfd,
+  0x7e, 0x9c, 0xe8, 0x67, 0xc6, 0x7c, 0x43, 0x14, 0x7f, 0xf0, 0xa3, 0x1a,
+  0x9f, 0x3c, 0xa0, 0x1d, 0x90, 0xfb, 0x61, 0xc3, 0xca, 0x2e, 0x1b, 0xfe,
+  0xe2, 0xe2, 0x17, 0x00, 0x82, 0x19, 0x23, 0x41, 0x1e, 0x22, 0xa3, 0xbf,
+  0x16, 0x9c, 0xe2, 0xc6, 0xc3, 0xf8, 0x82, 0xb1, 0x53, 0x86, 0xb3, 0xb7,
+  0xe0, 0xf9, 0x93, 0xaf, 0xbe, 0xbc, 0x54, 0xa4, 0xe3, 0x93, 0xdb, 0x18,
+  0x05, 0xc6, 0x80, 0x45, 0x66, 0xd1, 0x08, 0x96, 0x10, 0x41, 0x7a, 0xe5,
+  0x84, 0xb4, 0x4a, 0x44, 0x62, 0x98, 0x96, 0xbd, 0xc1, 0x23, 0x95, 0x08,
+  0x7a, 0x58, 0x38, 0xfe, 0x28, 0x1a, 0x3b, 0x29, 0x8c, 0x43, 0xae, 0xbc,
+  0x8b, 0x3f, 0xcb, 0x34, 0x82, 0xa6, 0x54, 0x17, 0xe4, 0x00, 0x4e, 0x87,
+  0xb2, 0xc6, 0xf1, 0xdb, 0x83, 0x83, 0x7d, 0xef, 0xfe, 0x55, 0x5e, 0x9c,
+  0x39, 0xfd, 0x5c, 0x7b, 0x8b, 0xe6, 0x4b, 0x9c, 0x8d, 0xfc, 0xae, 0x4f,
+  0xb1, 0xaa, 0x10, 0x05, 0x95, 0xfb, 0xbd, 0x60, 0xb8, 0x8b, 0xcc, 0x10,
+  0xb6, 0x1d, 0xe6, 0x83, 0x08, 0xff, 0x1a, 0x52, 0x22, 0x96, 0x22, 0x43,
+  0x14, 0xc4, 0x08, 0x4b, 0x7e, 0xa0, 0x17, 0xe2, 0xa4, 0xca, 0x3e, 0xa3,
+  0xf0, 0xb2, 0xfd, 0x05, 0xe6, 0x0c, 0x25, 0x19, 0xb4, 0xf3, 0x6b, 0x50,
+  0xe0, 0x22, 0x18, 0xb2, 0x46, 0x88, 0xaf, 0x35, 0x02, 0x1f, 0xc6, 0x3c,
+  0x12, 0x4d, 0x83, 0x57, 0xe7, 0x67, 0xbc, 0x42, 0xc9, 0x26, 0x81, 0xc6,
+  0x7f, 0x36, 0x52, 0xc9, 0x4d, 0x97, 0xe1, 0x99, 0x1f, 0x53, 0xfb, 0x22,
+  0xfd, 0x94, 0xc8, 0x30, 0x96, 0x9f, 0x01, 0x87, 0x31, 0xcf, 0x0b, 0x65,
+  0x9e, 0x00, 0x59, 0x25, 0xec, 0x0e, 0xf7, 0x9e, 0xc2, 0x97, 0x18, 0x03,
+  0xb8, 0xb0, 0x8b, 0xc2, 0x37, 0x19, 0xe6, 0x5f, 0x2f, 0x5e, 0x31, 0x8d,
+  0xad, 0xbf, 0x94, 0x4e, 0xa2, 0x93, 0x93, 0x74, 0x69, 0x18, 0x25, 0xbe,
+  0xa9, 0x9f, 0x65, 0x8a, 0xd9, 0xf6, 0x9f, 0x69, 0x3c, 0xb6, 0xa8, 0x62,
+  0x29, 0x15, 0x96, 0x36, 0x1c, 0x12, 0x32, 0x68, 0x9e, 0x53, 0x20, 0xc5,
+  0x4c, 0x23, 0x19, 0x0a, 0xf4, 0xda, 0x70, 0xf3, 0xe5, 0x9a, 0x19, 0x3c,
+  0x83, 0xe7, 0x65, 0xe8, 0xd2, 0x65, 0x12, 0x64, 0x67, 0x6c, 0x1b, 0xb0,
+  0x30, 0x17, 0x4d, 0x01, 0x2d, 0xba, 0xc3, 0xb3, 0x42, 0xbd, 0x42, 0x30,
+  0xeb, 0xf7, 0xaf, 0x10, 0x84, 0xd3, 0x7c, 0xc1, 0x42, 0xd4, 0x6e, 0xde,
+  0xa3, 0x46, 0x27, 0xb2, 0x28, 0xe3, 0x45, 0x01, 0x20, 0x98, 0xe3, 0xfb,
+  0x57, 0x38, 0x0f, 0xd7, 0x4b, 0xf7, 0xaf, 0xa8, 0xeb, 0xc6, 0xd5, 0x35,
+  0x23, 0xa0, 0x71, 0x28, 0xdb, 0xe3, 0xe9, 0x11, 0xe8, 0x1c, 0xab, 0x51,
+  0xc2, 0xfa, 0xc1, 0x03, 0x87, 0xf2, 0xbc, 0xe4, 0x9a, 0xd2, 0x14, 0x03,
+  0x98, 0x42, 0x84, 0x6b, 0x43, 0xd6, 0x0c, 0xd3, 0x02, 0xf7, 0x94, 0x73,
+  0xa6, 0x44, 0x14, 0x5e, 0xc4, 0xd4, 0xcb, 0xa7, 0x50, 0x09, 0x9a, 0x77,
+  0xe2, 0x0e, 0x76, 0x88, 0xd1, 0x31, 0x25, 0xea, 0x39, 0x64, 0xa1, 0x08,
+  0xc9, 0x55, 0x53, 0x52, 0xe5, 0xd7, 0x0a, 0xa7, 0xa7, 0x44, 0xbf, 0x64,
+  0xe8, 0x49, 0x90, 0x51, 0x7e, 0x12, 0x62, 0x54, 0x21, 0xa1, 0xe9, 0xf8,
+  0x57, 0x41, 0xe0, 0x41, 0x4a, 0xb5, 0xb7, 0x0e, 0xa2, 0x3e, 0x0f, 0xa2,
+  0xf1, 0x5b, 0xc1, 0x7c, 0x0e, 0x95, 0x2e, 0x34, 0x6c, 0x70, 0x5f, 0xbe,
+  0x44, 0x7b, 0x1b, 0xef, 0x81, 0xb7, 0xf2, 0xe4, 0x49, 0xab, 0x56, 0xf1,
+  0xce, 0xd3, 0x99, 0x8a, 0x3f, 0x9f, 0xa9, 0xf4, 0xb2, 0x51, 0xba, 0xa7,
+  0xf7, 0x90, 0x1d, 0xf4, 0x84, 0x58, 0xa8, 0x76, 0xb1, 0xdd, 0x6e, 0x17,
+  0x03, 0xd0, 0xd2, 0x3f, 0xe9, 0x23, 0x08, 0xbb, 0x52, 0x94, 0x61, 0x74,
+  0x48, 0x7e, 0xe3, 0x4a, 0xa4, 0x32, 0x68, 0x0f, 0xb8, 0x9b, 0xe2, 0x46,
+  0xd6, 0x58, 0x6e, 0x36, 0x0d, 0x28, 0xb3, 0xd1, 0x9a, 0x08, 0xd4, 0xb8,
+  0x8e, 0x4f, 0xae, 0xa1, 0xe3, 0x8a, 0x3b, 0x74, 0x89, 0xd4, 0x63, 0x23,
+  0x9c, 0x34, 0x9b, 0x4d, 0xe7, 0x02, 0x35, 0x42, 0xb0, 0x02, 0x01, 0x1e,
+  0xf6, 0x9a, 0xd6, 0xb1, 0x12, 0x6c, 0xe9, 0xf5, 0x28, 0xee, 0x53, 0x23,
+  0xf4, 0xc7, 0xa1, 0xd6, 0x9c, 0x34, 0x96, 0x4d, 0x00, 0xe4, 0x1d, 0xcb,
+  0x61, 0x03, 0x78, 0xae, 0x36, 0x95, 0x95, 0xa1, 0x76, 0xf1, 0xd8, 0x79,
+  0xb0, 0x9f, 0x89, 0x65, 0x1d, 0xdb, 0x6c, 0x17, 0xf2, 0x4d, 0xce, 0xb9,
+  0xb5, 0x5e, 0xc9, 0x21, 0xe6, 0xbc, 0x6b, 0x5d, 0x1e, 0x93, 0x4d, 0xf9,
+  0xb0, 0x3e, 0xe3, 0x50, 0x66, 0xd8, 0x60, 0xbe, 0x1d, 0xea, 0x6c, 0x85,
+  0x34, 0xca, 0x9c, 0xa3, 0xf0, 0xdb, 0x3d, 0x3a, 0x4e, 0x34, 0x1e, 0xb7,
+  0xbc, 0xa7, 0x92, 0x6c, 0x2f, 0x95, 0x66, 0x71, 0x05, 0xd0, 0xc2, 0xfe,
+  0x59, 0x1f, 0xcf, 0x3e, 0xf2, 0xa7, 0x8e, 0xf8, 0xb4, 0xa2, 0x18, 0xc2,
+  0x4b, 0x3d, 0xd0, 0x06, 0x49, 0xa4, 0x06, 0xd0, 0x15, 0x28, 0x30, 0x78,
+  0x1b, 0x18, 0x8c, 0xac, 0xe1, 0xef, 0x8c, 0x59, 0xb6, 0x46, 0xbe, 0x4b,
+  0x23, 0x39, 0x6b, 0xf1, 0x4d, 0xdd, 0x1a, 0x79, 0xb9, 0x5d, 0xe3, 0x00,
+  0x93, 0x37, 0xad, 0x1a, 0x99, 0xdc, 0x0e, 0x1c, 0x0d, 0x43, 0xc5, 0x7c,
+  0xec, 0xa6, 0xa0, 0xd7, 0x2a, 0x0d, 0x42, 0xfb, 0xcb, 0xca, 0x94, 0xc2,
+  0x8c, 0xb5, 0xbc, 0x7e, 0x47, 0x7d, 0xd7, 0xc1, 0x77, 0x2b, 0xea, 0xbb,
+  0x15, 0x7c, 0xf7, 0x48, 0x7d, 0xf7, 0xa8, 0x67, 0x52, 0x0d, 0x67, 0xd1,
+  0x0d, 0x68, 0xe7, 0xc5, 0x0b, 0x62, 0xa8, 0x0b, 0xf0, 0xa3, 0x83, 0x3f,
+  0x90, 0x5d, 0xe2, 0x8f, 0x15, 0x16, 0xfd, 0x01, 0xfe, 0xee, 0x3f, 0xb2,
+  0x00, 0xa0, 0xdd, 0x01, 0x40, 0x48, 0xac, 0xc1, 0x46, 0x82, 0x52, 0x73,
+  0x0b, 0xde, 0x63, 0x59, 0x50, 0x92, 0x58, 0x98, 0xcd, 0xe5, 0x7a, 0x20,
+  0x97, 0x15, 0x51, 0x71, 0x4d, 0x3c, 0x6c, 0x47, 0x7f, 0x19, 0xc3, 0xa6,
+  0xbe, 0xbc, 0x50, 0x80, 0x62, 0x95, 0xda, 0x70, 0x92, 0x4f, 0x1b, 0x32,
+  0x98, 0x66, 0x21, 0x12, 0xb2, 0x58, 0xde, 0x2a, 0xf6, 0xa6, 0xc0, 0x68,
+  0x4a, 0x6b, 0xa6, 0x80, 0xe9, 0x94, 0xdd, 0xf0, 0xcf, 0xdc, 0x2a, 0xb6,
+  0x61, 0x95, 0x1c, 0xb0, 0x08, 0x0f, 0xb3, 0x97, 0xda, 0xd6, 0x38, 0x60,
+  0xd9, 0x22, 0x54, 0x17, 0x94, 0xe1, 0x38, 0x14, 0xa0, 0x7b, 0xc6, 0x56,
+  0x8d, 0x89, 0xe2, 0xb9, 0xa7, 0x2e, 0x49, 0xfa, 0xfc, 0xa7, 0x2c, 0x10,
+  0x89, 0x22, 0xed, 0x60, 0x32, 0xa1, 0xa8, 0x07, 0x94, 0x14, 0xb3, 0xe5,
+  0x15, 0x4c, 0x59, 0x46, 0x0b, 0x08, 0xee, 0x4a, 0x44, 0x31, 0xc5, 0x50,
+  0x08, 0x11, 0x4b, 0x90, 0xb8, 0x14, 0x0f, 0xb2, 0x30, 0x5b, 0x04, 0x21,
+  0x22, 0x0c, 0xce, 0x7d, 0xa0, 0xf9, 0x96, 0x27, 0x90, 0xe2, 0xc6, 0xb3,
+  0x8d, 0x4e, 0xd3, 0x94, 0xb4, 0x34, 0xd1, 0x9b, 0x25, 0xee, 0x84, 0xb6,
+  0xd5, 0x25, 0x77, 0x4e, 0x1e, 0x44, 0xd0, 0xe0, 0xfe, 0x5e, 0xf7, 0x40,
+  0x0b, 0x77, 0x8a, 0xea, 0xd6, 0xd5, 0xbc, 0x0f, 0x52, 0xcc, 0xd3, 0x1a,
+  0x22, 0xad, 0x7d, 0x6f, 0xe0, 0xfc, 0xfd, 0x86, 0xf2, 0xac, 0x4d, 0x96,
+  0xe5, 0xc1, 0xb6, 0xed, 0x53, 0x67, 0x15, 0xe7, 0x8a, 0xf3, 0x9d, 0x71,
+  0x0c, 0xe7, 0xff, 0x2a, 0xb2, 0xaa, 0x9d, 0xb1, 0xde, 0xa4, 0x9b, 0x72,
+  0xb7, 0x0a, 0xf3, 0xd8, 0xa0, 0xcc, 0x88, 0xb9, 0xd8, 0x09, 0xb8, 0x83,
+  0x01, 0x32, 0x0e, 0x09, 0x87, 0x7f, 0x8d, 0xf7, 0x47, 0x21, 0x5e, 0x9f,
+  0x63, 0xe0, 0x17, 0x6f, 0x3a, 0xce, 0xa2, 0x11, 0x5d, 0xd9, 0x42, 0x67,
+  0xb9, 0xa7, 0x4c, 0xca, 0xc2, 0xf9, 0x90, 0xe5, 0x96, 0xb7, 0xf7, 0xbb,
+  0x25, 0x3a, 0x76, 0xb9, 0xf9, 0x25, 0x57, 0x1d, 0x88, 0xe4, 0x9d, 0xc0,
+  0xa6, 0x11, 0x75, 0xf3, 0x10, 0x60, 0x82, 0x35, 0xad, 0x86, 0x6d, 0xe3,
+  0x2e, 0x09, 0x03, 0x85, 0x10, 0x43, 0xec, 0x15, 0xfe, 0x6d, 0x91, 0x2d,
+  0x3d, 0x2a, 0x4f, 0x70, 0x6a, 0xdb, 0xd9, 0xd7, 0xcc, 0x57, 0xed, 0x1b,
+  0x61, 0x1c, 0xbe, 0xc0, 0xf0, 0x78, 0x97, 0xf1, 0x34, 0xf1, 0xb0, 0x06,
+  0xc8, 0x66, 0x59, 0xec, 0x05, 0xb4, 0xd8, 0xbc, 0x8f, 0x1f, 0x76, 0xbd,
+  0x46, 0xe0, 0xa5, 0x93, 0x70, 0x80, 0x97, 0xb2, 0xd3, 0x04, 0xbd, 0xb0,
+  0x02, 0x64, 0x50, 0x11, 0x32, 0x05, 0x2c, 0x38, 0xf6, 0x62, 0xc6, 0x05,
+  0xa3, 0x31, 0x65, 0x3f, 0xee, 0x27, 0xf1, 0x05, 0x4c, 0xcb, 0xc3, 0x14,
+  0x16, 0xca, 0x79, 0x2c, 0x2e, 0x85, 0xf9, 0xc6, 0x02, 0x30, 0x3f, 0x26,
+  0xc8, 0xbb, 0x00, 0x70, 0x9b, 0x5d, 0x4e, 0x33, 0xca, 0x83, 0xdf, 0x84,
+  0x2f, 0xef, 0x17, 0x22, 0x46, 0x5f, 0x01, 0x11, 0xf2, 0x3c, 0xe1, 0x3a,
+  0x40, 0x09, 0x16, 0x73, 0x48, 0x29, 0x14, 0x3b, 0x0c, 0x1a, 0x57, 0xeb,
+  0x10, 0x51, 0xe4, 0xa0, 0xba, 0x21, 0x2b, 0x0e, 0x38, 0x9d, 0x25, 0xe1,
+  0x09, 0xa2, 0x4d, 0x1d, 0xc0, 0x3f, 0x10, 0x65, 0xd1, 0x55, 0xc6, 0x43,
+  0xa1, 0x60, 0x9b, 0x8a, 0xad, 0x0b, 0x7c, 0xd7, 0x8a, 0x0f, 0x62, 0x8c,
+  0x91, 0x83, 0xc1, 0xc0, 0xe6, 0x4d, 0x6c, 0x10, 0xb7, 0x62, 0x48, 0x71,
+  0xa8, 0xc8, 0x0b, 0xee, 0x99, 0x97, 0x31, 0x8c, 0xaf, 0x6d, 0x9e, 0x45,
+  0xa3, 0x21, 0x73, 0xbb, 0xc9, 0x61, 0x6c, 0x45, 0xe9, 0x04, 0x67, 0x9c,
+  0x93, 0x1a, 0x29, 0x35, 0xbc, 0x98, 0x8d, 0x2a, 0x96, 0x14, 0xe5, 0x0e,
+  0xce, 0xa2, 0x14, 0xd3, 0x50, 0x03, 0x71, 0xa2, 0xb1, 0x61, 0x72, 0xe9,
+  0x05, 0x29, 0xc3, 0x8e, 0x2a, 0x02, 0xbd, 0x0c, 0x63, 0xd8, 0x69, 0xc6,
+  0x71, 0xe6, 0x61, 0x02, 0xbf, 0x1c, 0x04, 0x0c, 0x0f, 0x71, 0x75, 0xe8,
+  0x5b, 0xfc, 0x55, 0xea, 0x12, 0x6f, 0x96, 0x74, 0x2b, 0x24, 0xfc, 0xbe,
+  0x8b, 0xa7, 0x69, 0xc8, 0x7e, 0xfa, 0x04, 0x52, 0xe1, 0x81, 0xfd, 0x69,
+  0x1f, 0x84, 0x8a, 0x74, 0x95, 0x2e, 0x57, 0xa4, 0x70, 0xc5, 0x14, 0xac,
+  0x95, 0xc5, 0xb4, 0x55, 0xbf, 0xa0, 0x36, 0x6d, 0x95, 0x2f, 0x03, 0x1e,
+  0x1d, 0xb5, 0x59, 0xf4, 0xfa, 0x03, 0x49, 0x2d, 0x6c, 0xe4, 0x70, 0x0f,
+  0x76, 0x8d, 0x1b, 0x93, 0x6e, 0x94, 0x71, 0xe3, 0xca, 0x99, 0x4f, 0x3b,
+  0x6f, 0x76, 0xac, 0x2e, 0x37, 0x8a, 0xe9, 0x45, 0xb9, 0x7d, 0x1c, 0x16,
+  0x5d, 0x62, 0xfa, 0xad, 0x6a, 0xeb, 0xb8, 0x72, 0xed, 0x0b, 0x0f, 0xa6,
+  0x0b, 0x90, 0xdc, 0x9c, 0x8f, 0x38, 0xcc, 0xba, 0x57, 0x14, 0x75, 0xbb,
+  0xfd, 0x41, 0x91, 0x36, 0x85, 0x0b, 0xa1, 0xf0, 0x22, 0xc1, 0xc4, 0x2f,
+  0x8f, 0xa9, 0x26, 0xc7, 0x00, 0xae, 0x75, 0xbd, 0x59, 0x01, 0xc2, 0x72,
+  0x77, 0x68, 0xe6, 0xc3, 0xaa, 0x04, 0x97, 0x47, 0x1e, 0x76, 0x5e, 0x04,
+  0xd4, 0xc2, 0xaa, 0x00, 0x63, 0xbf, 0x86, 0x9d, 0x0f, 0x33, 0x0c, 0x7b,
+  0xcc, 0x35, 0xbb, 0xcc, 0x04, 0xdc, 0xef, 0x1e, 0x6c, 0x78, 0x7f, 0x7b,
+  0x5d, 0x20, 0x69, 0xef, 0x3d, 0xcb, 0x82, 0xe9, 0xd7, 0x74, 0x1d, 0x2d,
+  0x19, 0xc9, 0x1b, 0xf5, 0xdc, 0x32, 0x1f, 0x37, 0xef, 0xf8, 0x8d, 0xa9,
+  0xc4, 0x36, 0x1f, 0x37, 0x24, 0x13, 0x63, 0x32, 0x8e, 0x15, 0xef, 0x3c,
+  0x5a, 0x0e, 0x18, 0x6a, 0xf9, 0xfa, 0xb8, 0xd4, 0xaf, 0x44, 0x8a, 0xce,
+  0x6d, 0xb5, 0x1b, 0x41, 0x10, 0xc6, 0xdd, 0x84, 0x1c, 0x5b, 0xbb, 0x2d,
+  0xdd, 0x31, 0xf2, 0xf0, 0x55, 0x3c, 0x2c, 0xb7, 0xb5, 0x9a, 0x12, 0xb3,
+  0x5b, 0xae, 0x4b, 0x5a, 0x78, 0x51, 0x95, 0x0b, 0xeb, 0xee, 0x5b, 0x67,
+  0x13, 0x94, 0x65, 0x60, 0xa5, 0x7c, 0xb9, 0x8b, 0x8b, 0x21, 0xea, 0xef,
+  0xfd, 0x1a, 0x87, 0xba, 0x0a, 0xd9, 0xdb, 0x90, 0xbb, 0xd1, 0x28, 0x01,
+  0x47, 0xc9, 0xf5, 0x1d, 0xad, 0x93, 0x44, 0xbf, 0x9a, 0xaa, 0xea, 0x9a,
+  0x98, 0xa9, 0xc8, 0x06, 0x2d, 0x6f, 0x1d, 0x2e, 0xd1, 0xd9, 0x26, 0x36,
+  0x5f, 0x3b, 0x84, 0xba, 0x5c, 0xa0, 0x3b, 0x96, 0x52, 0x6d, 0x5c, 0xa0,
+  0x67, 0x73, 0xc2, 0x04, 0x3c, 0x10, 0x49, 0x86, 0xec, 0xc5, 0xa0, 0x48,
+  0x02, 0x7d, 0xff, 0x8a, 0x88, 0xa6, 0xed, 0xc9, 0xd2, 0x5e, 0x1a, 0x83,
+  0x68, 0xc4, 0xc8, 0x93, 0x0b, 0x79, 0x68, 0x3e, 0x9b, 0x82, 0x90, 0x77,
+  0x5c, 0x57, 0x45, 0xa0, 0x0b, 0x77, 0x5c, 0x70, 0xf0, 0xb9, 0x67, 0x29,
+  0x20, 0x2b, 0xf4, 0x43, 0x74, 0x25, 0xbc, 0xe4, 0xd7, 0x3c, 0xe4, 0xdb,
+  0x25, 0x3c, 0x22, 0x50, 0x9e, 0xe0, 0xa0, 0xf4, 0x86, 0xa9, 0x6c, 0x81,
+  0xdb, 0x74, 0x26, 0x66, 0xed, 0x3c, 0x42, 0xbd, 0xca, 0x19, 0xfd, 0x35,
+  0x6b, 0x88, 0x70, 0x39, 0xeb, 0x82, 0x4c, 0xdd, 0xca, 0xf6, 0x8a, 0x37,
+  0xcb, 0xaf, 0xea, 0x7b, 0x2a, 0x3a, 0xc0, 0x1b, 0x81, 0x57, 0x35, 0x1b,
+  0x46, 0x79, 0x8c, 0x5a, 0xde, 0x23, 0xbb, 0x11, 0xa3, 0x7d, 0xa1, 0x54,
+  0x63, 0xab, 0xef, 0xf5, 0xec, 0x1c, 0x07, 0x72, 0x75, 0xf8, 0x35, 0xb3,
+  0x88, 0x02, 0x92, 0x25, 0xa2, 0x3d, 0xfc, 0xa1, 0xda, 0x2f, 0xcd, 0x69,
+  0xba, 0x38, 0x75, 0x01, 0x10, 0xce, 0x3a, 0xb4, 0x28, 0x92, 0xec, 0x9b,
+  0x79, 0x72, 0xe0, 0xba, 0xda, 0x7f, 0x8d, 0x6d, 0xa7, 0x15, 0x3a, 0xff,
+  0x63, 0x7c, 0x28, 0x42, 0x0c, 0xff, 0x10, 0xe5, 0x5b, 0x7e, 0xd3, 0x55,
+  0x1e, 0x33, 0xf1, 0x10, 0x06, 0x2d, 0x2f, 0x1c, 0x93, 0x2a, 0x3e, 0x1c,
+  0x32, 0x06, 0xd1, 0x2b, 0x4f, 0xce, 0x75, 0xe5, 0x39, 0x6b, 0xea, 0xa6,
+  0xf2, 0xda, 0x8a, 0x58, 0xf5, 0x0e, 0x7b, 0xae, 0xfb, 0x0e, 0xac, 0x9e,
+  0xda, 0x9d, 0x7d, 0xe8, 0x93, 0x96, 0x05, 0x2c, 0xe5, 0xf6, 0x0a, 0xd6,
+  0x2b, 0x2a, 0xd8, 0x61, 0xa0, 0xd4, 0xf5, 0x8b, 0x2c, 0x61, 0x3e, 0x3f,
+  0x29, 0x73, 0x14, 0xc1, 0x7f, 0xd9, 0x56, 0x23, 0x25, 0x5f, 0x7c, 0x91,
+  0x0d, 0x8d, 0x2c, 0x95, 0x1e, 0x5d, 0xdd, 0xae, 0xfb, 0xf1, 0x24, 0x18,
+  0x44, 0xd9, 0xe5, 0x2a, 0xde, 0x6a, 0x71, 0xf7, 0x0e, 0x06, 0x23, 0xef,
+  0x3f, 0x86, 0x9f, 0x59, 0x42, 0xc3, 0x5a, 0x00, 0x89, 0x44, 0xf6, 0x62,
+  0x29, 0x1b, 0x2a, 0xb0, 0x5f, 0xca, 0xcd, 0x1a, 0x5f, 0xcd, 0xfc, 0x98,
+  0xbc, 0x78, 0x3e, 0xae, 0x68, 0x6e, 0x40, 0xd6, 0x06, 0xde, 0x2a, 0xfb,
+  0xe3, 0x88, 0x82, 0x6d, 0x2b, 0xa0, 0xe0, 0xef, 0xe4, 0xe5, 0xb1, 0xa2,
+  0xb4, 0x2c, 0x6c, 0x24, 0x8c, 0x81, 0x3e, 0xcb, 0xce, 0x47, 0xa5, 0x27,
+  0xf8, 0x0a, 0xf1, 0xce, 0xa6, 0x83, 0x24, 0x8d, 0x30, 0xc0, 0xb5, 0x6c,
+  0x87, 0xb3, 0x30, 0x23, 0x04, 0xb1, 0x56, 0xa3, 0x66, 0x1d, 0x33, 0x41,
+  0x7b, 0x6d, 0x2e, 0x41, 0xd4, 0xb2, 0xd9, 0x73, 0x08, 0x21, 0xcc, 0x2c,
+  0x4b, 0x30, 0x6c, 0xfd, 0xa2, 0x5a, 0x69, 0xb2, 0x18, 0x7a, 0x53, 0x10,
+  0x81, 0xca, 0x54, 0xb7, 0x0d, 0x3b, 0xdc, 0x69, 0x98, 0xa9, 0x81, 0xfd,
+  0x6c, 0x9e, 0xf6, 0x69, 0xe1, 0x66, 0x5f, 0x5f, 0xc4, 0x90, 0x45, 0x4a,
+  0xb7, 0x94, 0xe1, 0x18, 0xe5, 0xaa, 0x41, 0x72, 0x0f, 0x6f, 0xc9, 0xfc,
+  0x68, 0x63, 0x99, 0x6d, 0xec, 0x5b, 0x4c, 0x9b, 0x67, 0x3a, 0x32, 0xdd,
+  0xa6, 0x7c, 0xe4, 0x0f, 0xa7, 0xe7, 0xe7, 0xb9, 0x5c, 0xfb, 0x7d, 0xc5,
+  0x1f, 0x9f, 0x99, 0x64, 0xa2, 0x3a, 0x0b, 0xe4, 0x9b, 0x8d, 0x7d, 0x32,
+  0x3b, 0xca, 0xe5, 0x1b, 0x49, 0xf4, 0x29, 0x64, 0x10, 0x8f, 0xc8, 0x10,
+  0xc5, 0xa3, 0x32, 0x8d, 0xd6, 0xdc, 0xc2, 0x4e, 0xe7, 0x1f, 0x2b, 0xed,
+  0xce, 0xd3, 0xe7, 0xed, 0xc7, 0xed, 0xce, 0xbc, 0x62, 0x0e, 0xd9, 0x5a,
+  0x88, 0xc4, 0xba, 0x88, 0x9d, 0xed, 0x58, 0xcf, 0x7b, 0xb3, 0x49, 0x05,
+  0xd0, 0x3a, 0x94, 0xfd, 0x36, 0x34, 0xd9, 0x4a, 0xe9, 0xdf, 0x59, 0x90,
+  0x0b, 0x4e, 0x22, 0xe6, 0x82, 0xe1, 0x5f, 0x16, 0x3f, 0x87, 0x97, 0xaa,
+  0xa6, 0x9f, 0x2d, 0x38, 0x55, 0xe8, 0x37, 0x52, 0x92, 0x1d, 0x96, 0x7d,
+  0x44, 0x8a, 0xe5, 0x1b, 0x59, 0x1e, 0x3c, 0x92, 0xad, 0x62, 0x3d, 0x2d,
+  0x23, 0x0b, 0x6c, 0x25, 0x92, 0x84, 0xa9, 0x2e, 0x39, 0xfc, 0x2d, 0xaf,
+  0x7a, 0x58, 0xb4, 0xa2, 0x67, 0x05, 0xd4, 0x62, 0x54, 0x15, 0x30, 0x29,
+  0xc5, 0x97, 0x09, 0x94, 0x94, 0xa8, 0xb3, 0x40, 0x95, 0xe3, 0xf0, 0xb0,
+  0xf2, 0xa4, 0x30, 0xc2, 0x3c, 0x71, 0xa5, 0xd3, 0x81, 0x3e, 0xf6, 0x45,
+  0xe0, 0x1d, 0x56, 0xea, 0xd0, 0x47, 0x1e, 0xc3, 0xde, 0xe5, 0x99, 0x25,
+  0x38, 0x6c, 0x3e, 0xbf, 0xf2, 0x74, 0xe7, 0xc0, 0x79, 0x41, 0xa6, 0xef,
+  0x5a, 0x93, 0xf3, 0xc4, 0xa9, 0x10, 0xf5, 0x70, 0x3f, 0x58, 0x81, 0xa4,
+  0x42, 0xc5, 0xb0, 0x4a, 0xea, 0xc5, 0xc7, 0xc9, 0xcd, 0xfb, 0xc0, 0x09,
+  0x19, 0x1d, 0x7a, 0x24, 0x6f, 0x11, 0xfc, 0xf9, 0x2e, 0x1c, 0x4f, 0xd9,
+  0x4e, 0x69, 0x77, 0x67, 0x38, 0x57, 0xbe, 0xeb, 0xf1, 0x6c, 0x1d, 0x76,
+  0xf4, 0xcc, 0xe0, 0x17, 0xab, 0xfa, 0x4d, 0xf5, 0xd3, 0xc6, 0x68, 0xd4,
+  0xe0, 0x69, 0xf8, 0x7c, 0x2d, 0xf4, 0x30, 0x33, 0x61, 0xac, 0xdf, 0x0a,
+  0x81, 0xe2, 0xb5, 0x74, 0x58, 0x64, 0xc9, 0xe7, 0xb6, 0xf3, 0x67, 0xf8,
+  0xb1, 0x52, 0x62, 0x6d, 0x49, 0x1d, 0xb5, 0x46, 0x79, 0xe5, 0x36, 0x9d,
+  0xa6, 0xc9, 0x97, 0xd0, 0x47, 0xda, 0xaf, 0xac, 0x38, 0x82, 0x65, 0x91,
+  0x60, 0xf3, 0x3e, 0x48, 0x21, 0x5d, 0xf9, 0x60, 0x14, 0x98, 0xf0, 0x37,
+  0xd4, 0x06, 0xff, 0xbb, 0x64, 0x7f, 0xb3, 0x18, 0xde, 0xab, 0x3c, 0x4f,
+  0x73, 0x49, 0xe6, 0x10, 0x0f, 0x99, 0x8b, 0x36, 0xc8, 0x70, 0xec, 0x37,
+  0x39, 0x26, 0xab, 0x15, 0x6b, 0x48, 0x2e, 0xf6, 0x91, 0xcc, 0xf8, 0x30,
+  0x66, 0x25, 0xa6, 0xb7, 0xcd, 0xb5, 0x59, 0x4d, 0x68, 0x69, 0xb0, 0x68,
+  0x1e, 0x73, 0x0b, 0x4f, 0x0c, 0x41, 0xd3, 0xc9, 0x99, 0xb8, 0xbc, 0xaa,
+  0x90, 0xde, 0x81, 0x2d, 0x96, 0x91, 0x7b, 0x90, 0x13, 0x61, 0x31, 0x91,
+  0xb0, 0x06, 0x93, 0xd5, 0x9c, 0x31, 0x49, 0xc9, 0xc5, 0xa8, 0xec, 0xaa,
+  0xe0, 0x83, 0x2d, 0x39, 0xb4, 0x07, 0x9a, 0x53, 0xb7, 0xe4, 0x48, 0xc2,
+  0xfc, 0xba, 0x61, 0xc6, 0x95, 0x44, 0x34, 0x7e, 0x98, 0xbb, 0xe9, 0xf7,
+  0xf2, 0x21, 0xea, 0x97, 0x50, 0xaa, 0x91, 0xd4, 0x14, 0xab, 0x72, 0x21,
+  0xc5, 0x49, 0x84, 0x8c, 0x8a, 0x8d, 0xfb, 0xd1, 0x22, 0xe5, 0x89, 0xb3,
+  0x26, 0x2f, 0xe2, 0xac, 0xcb, 0xf3, 0x2d, 0x54, 0xd5, 0xa7, 0xf8, 0x04,
+  0x26, 0x90, 0x40, 0x2c, 0x1f, 0x3e, 0x33, 0x87, 0x12, 0xd4, 0x9e, 0x96,
+  0x35, 0xba, 0xe8, 0x27, 0x4a, 0x59, 0x3c, 0xa2, 0x81, 0x23, 0xa2, 0x74,
+  0xfd, 0x75, 0xac, 0x4e, 0x77, 0x9e, 0xf9, 0xa5, 0x4e, 0xd2, 0x64, 0x0b,
+  0x56, 0x49, 0x38, 0x09, 0x83, 0xcc, 0xb7, 0x27, 0xb5, 0x46, 0x93, 0x77,
+  0xb4, 0x9f, 0xb0, 0xa4, 0xcc, 0xa9, 0x87, 0xc5, 0x5a, 0xad, 0xae, 0xfe,
+  0xd2, 0xf0, 0x61, 0x9f, 0x88, 0xa7, 0x83, 0x33, 0x52, 0x4f, 0xf9, 0x78,
+  0x51, 0xc6, 0x24, 0xa9, 0x26, 0x1e, 0xd7, 0xce, 0x71, 0xd7, 0xc1, 0x6b,
+  0x25, 0xee, 0x84, 0x91, 0x97, 0x73, 0x8f, 0x8d, 0x40, 0xdc, 0x16, 0x3a,
+  0x45, 0xdd, 0xa1, 0x18, 0x4e, 0xd6, 0x4d, 0xd6, 0x44, 0xbd, 0x7c, 0xe7,
+  0xe4, 0x6d, 0x8a, 0xcd, 0xb3, 0x2c, 0x20, 0xcb, 0x4d, 0x46, 0x62, 0x3a,
+  0x29, 0xc6, 0x01, 0xe4, 0xec, 0xb2, 0x51, 0x98, 0xb5, 0xa7, 0xd7, 0xe5,
+  0xa7, 0x35, 0xe4, 0x57, 0x94, 0x17, 0x33, 0x0f, 0xaa, 0xef, 0xd6, 0xaf,
+  0x49, 0x59, 0x34, 0x67, 0xa0, 0xed, 0x9a, 0xd9, 0x6f, 0x4c, 0xac, 0x84,
+  0x7c, 0x82, 0xd2, 0x24, 0xca, 0x95, 0x76, 0x57, 0x48, 0x56, 0x2a, 0x75,
+  0x6e, 0xc4, 0x12, 0x7b, 0xe3, 0xc2, 0x2e, 0x93, 0xfa, 0x7a, 0x5a, 0x44,
+  0x37, 0x0e, 0x87, 0x37, 0x54, 0x17, 0x16, 0x7a, 0xa6, 0xf8, 0xaa, 0x28,
+  0x26, 0x31, 0x4c, 0x59, 0xa0, 0x52, 0x38, 0x26, 0x8d, 0xc6, 0x6c, 0xec,
+  0xa1, 0x4a, 0xd6, 0xae, 0x25, 0xe7, 0xb3, 0xae, 0xeb, 0x2a, 0x00, 0x0b,
+  0xe2, 0x49, 0x36, 0x72, 0x11, 0x20, 0x7c, 0xaa, 0xe3, 0x8c, 0x67, 0x5b,
+  0x22, 0x83, 0x3c, 0xda, 0x60, 0x8d, 0x50, 0xfb, 0x9a, 0x91, 0x85, 0x3c,
+  0x41, 0x73, 0x8f, 0xf0, 0xfc, 0x5c, 0x49, 0x97, 0xf9, 0xf3, 0x96, 0xd5,
+  0xdd, 0x64, 0xfe, 0x66, 0x4d, 0x16, 0xa0, 0x0a, 0xe8, 0x7a, 0x83, 0xc6,
+  0x7a, 0xd9, 0x0d, 0x4f, 0xa1, 0xde, 0x5b, 0xee, 0xae, 0xad, 0xae, 0x95,
+  0x19, 0x24, 0x01, 0x12, 0x5b, 0x29, 0x89, 0x13, 0xcc, 0xd2, 0xd1, 0xd1,
+  0x88, 0xa0, 0x2e, 0x2e, 0x32, 0x07, 0xee, 0x66, 0x31, 0xf2, 0xba, 0x31,
+  0x4f, 0x58, 0x42, 0xcf, 0x85, 0xcb, 0xb8, 0x0b, 0xf9, 0x8f, 0x64, 0x5f,
+  0x20, 0x6a, 0x6a, 0xd8, 0xf3, 0x13, 0xb8, 0x09, 0x7f, 0x3a, 0x16, 0xbe,
+  0x10, 0xb6, 0x24, 0x69, 0x39, 0x97, 0x74, 0x04, 0x45, 0x6d, 0xae, 0xd5,
+  0x4f, 0xeb, 0x59, 0x19, 0xf6, 0x16, 0x8d, 0x3a, 0x6b, 0xe7, 0xb9, 0x99,
+  0x21, 0xe8, 0xec, 0x75, 0x15, 0xf3, 0x2e, 0x92, 0x97, 0xa4, 0xa5, 0xcc,
+  0x5b, 0x49, 0x36, 0xac, 0x68, 0x14, 0xe5, 0x50, 0x60, 0x0d, 0xab, 0xda,
+  0x4a, 0x4d, 0x7e, 0x32, 0x93, 0x64, 0x69, 0x06, 0xef, 0x7c, 0x68, 0xc8,
+  0xcb, 0x45, 0x08, 0x89, 0xb2, 0x1e, 0x28, 0xf2, 0x72, 0x91, 0x1d, 0x39,
+  0x6f, 0xfa, 0x34, 0x14, 0x9a, 0xc1, 0xd7, 0x97, 0x3b, 0x43, 0x58, 0x71,
+  0xb4, 0x5b, 0xa1, 0xdf, 0xce, 0x06, 0x4c, 0x85, 0x1c, 0xaf, 0xa6, 0x2c,
+  0x13, 0xb2, 0x13, 0x5c, 0x9e, 0x5e, 0x96, 0x17, 0x95, 0x01, 0x5a, 0x72,
+  0x48, 0xcf, 0x28, 0x7a, 0xd3, 0x00, 0x3d, 0x64, 0x70, 0x1e, 0xa2, 0x08,
+  0x5e, 0x92, 0x43, 0xfa, 0x66, 0x63, 0x6f, 0xcf, 0x24, 0x5d, 0x85, 0x1f,
+  0x2b, 0xdb, 0xf3, 0x9b, 0x25, 0xe9, 0xa6, 0xeb, 0xc1, 0xe0, 0xc9, 0x45,
+  0x14, 0x50, 0x45, 0xd2, 0x68, 0xd7, 0x61, 0xfa, 0x50, 0x28, 0x67, 0x17,
+  0xb1, 0xeb, 0xd6, 0xca, 0x3c, 0xb3, 0x74, 0xe9, 0x71, 0x9c, 0xa9, 0x77,
+  0x11, 0x84, 0x0e, 0x21, 0xcf, 0x77, 0xed, 0xae, 0x9f, 0xf6, 0x79, 0x7d,
+  0xa1, 0xe5, 0x6c, 0x96, 0xe6, 0xc5, 0xae, 0xee, 0x0a, 0x87, 0xc3, 0x6d,
+  0x06, 0x8c, 0x4e, 0x15, 0x09, 0xaf, 0x4b, 0x43, 0x09, 0x90, 0xb2, 0x1a,
+  0x26, 0x18, 0x75, 0xdf, 0x30, 0xc1, 0xa5, 0x59, 0xb5, 0xeb, 0x00, 0x12,
+  0xd7, 0xdb, 0x26, 0xb0, 0x22, 0xcb, 0x76, 0x75, 0xdf, 0x82, 0x89, 0xd9,
+  0x9f, 0x22, 0x11, 0x77, 0x75, 0x7d, 0xb4, 0x4a, 0x8a, 0x6c, 0x83, 0x22,
+  0x12, 0x76, 0xd7, 0x06, 0x41, 0xb7, 0x02, 0x0a, 0x1c, 0x91, 0x23, 0xbe,
+  0x94, 0x54, 0x58, 0x21, 0x75, 0x95, 0xab, 0x99, 0xe0, 0x4b, 0x31, 0x10,
+  0x85, 0x17, 0x99, 0xad, 0x7a, 0xcf, 0x06, 0x28, 0x4f, 0x1a, 0x5f, 0x0f,
+  0x12, 0xf7, 0xc2, 0x53, 0x40, 0x29, 0x89, 0xed, 0x4b, 0xc1, 0xf0, 0xd8,
+  0x07, 0xb4, 0x33, 0x2a, 0x20, 0xb4, 0x2c, 0xf4, 0xa5, 0x40, 0x28, 0xa2,
+  0x1c, 0xde, 0x40, 0x29, 0x10, 0x58, 0x17, 0xab, 0xe6, 0x96, 0x46, 0x95,
+  0xfb, 0x8b, 0x08, 0xed, 0x5c, 0xcb, 0xe6, 0xed, 0x50, 0x0f, 0x04, 0x51,
+  0xab, 0x0c, 0x41, 0x8b, 0xda, 0x50, 0xd1, 0x13, 0x28, 0x6d, 0xe3, 0x44,
+  0x46, 0x98, 0x81, 0x3a, 0x03, 0xc2, 0x2a, 0x89, 0xf8, 0xb0, 0x0a, 0x3c,
+  0x9e, 0x48, 0xde, 0xb5, 0xee, 0x54, 0x9d, 0x18, 0x15, 0x56, 0x97, 0x5d,
+  0x9e, 0x73, 0xbe, 0x14, 0x0b, 0x2a, 0xb5, 0x18, 0x7f, 0x36, 0x9b, 0xce,
+  0x13, 0xc6, 0xd7, 0xa8, 0x3f, 0x60, 0x65, 0x75, 0x52, 0xa5, 0x04, 0xf6,
+  0xf5, 0x3a, 0xc0, 0x4a, 0xab, 0x3d, 0x28, 0x92, 0xdd, 0x57, 0x51, 0x39,
+  0x14, 0xd3, 0xfb, 0xc0, 0xb3, 0xde, 0x93, 0x91, 0x65, 0x3d, 0x00, 0xcc,
+  0x20, 0xd3, 0x06, 0xa4, 0xd6, 0x48, 0x08, 0x28, 0xce, 0xa1, 0x98, 0x85,
+  0x91, 0x32, 0x58, 0x8c, 0x50, 0xf3, 0x31, 0xb9, 0xd6, 0x95, 0x85, 0x94,
+  0xbc, 0x63, 0x24, 0x84, 0xda, 0xb4, 0xae, 0xec, 0x0b, 0xdc, 0x20, 0xfa,
+  0x2b, 0xb4, 0xc8, 0xbe, 0xaa, 0x47, 0x78, 0x43, 0x3b, 0x46, 0xa9, 0x82,
+  0x9d, 0xec, 0x48, 0x63, 0x11, 0xdf, 0xcf, 0x82, 0xf1, 0x69, 0xe8, 0x72,
+  0x35, 0x2e, 0xdc, 0x25, 0xb8, 0x50, 0x28, 0x5f, 0xd5, 0x1e, 0x92, 0xe5,
+  0x75, 0xea, 0xf7, 0x64, 0xc3, 0x0e, 0xc9, 0x29, 0xba, 0x21, 0xea, 0x1d,
+  0x2e, 0xf7, 0x9c, 0x9e, 0x62, 0x32, 0x76, 0x36, 0x75, 0x81, 0xab, 0xc6,
+  0xeb, 0x2a, 0xf5, 0x9b, 0x70, 0x5f, 0xae, 0x61, 0x07, 0xe4, 0x06, 0xa2,
+  0xde, 0x73, 0x57, 0x5d, 0xf7, 0x56, 0xe2, 0x24, 0x95, 0x75, 0xc2, 0xda,
+  0x98, 0xd4, 0x02, 0x93, 0xdf, 0x18, 0x3b, 0x01, 0x15, 0xa6, 0x0b, 0x15,
+  0x90, 0xb8, 0xa9, 0x8e, 0x15, 0x90, 0x1e, 0x26, 0xa7, 0xea, 0xfc, 0xb7,
+  0x65, 0x89, 0x91, 0x55, 0x15, 0xe4, 0xa5, 0x0a, 0xe6, 0xa6, 0x23, 0x48,
+  0x95, 0x0a, 0x97, 0x73, 0xd1, 0xb9, 0x95, 0x56, 0x54, 0xbf, 0x96, 0x3d,
+  0x84, 0xb8, 0xa8, 0xd6, 0xe3, 0xa9, 0x95, 0xae, 0x42, 0xc1, 0x22, 0xe7,
+  0xc6, 0x8f, 0x01, 0xa8, 0x85, 0x20, 0x5b, 0xb5, 0x62, 0x35, 0xd9, 0xc0,
+  0x18, 0xc6, 0x9c, 0xe2, 0xfc, 0xcb, 0x2a, 0xa1, 0xab, 0xe2, 0x74, 0x3c,
+  0x0c, 0x4f, 0x40, 0x5c, 0x18, 0xe2, 0xa9, 0x97, 0x5e, 0x3b, 0xa2, 0x72,
+  0x28, 0xf9, 0x0e, 0xf4, 0x31, 0xa9, 0x68, 0xbc, 0x6e, 0xda, 0x45, 0x0b,
+  0x7c, 0xf4, 0xad, 0x68, 0x58, 0xf5, 0x9e, 0xae, 0xb1, 0x63, 0x5b, 0xcc,
+  0xf7, 0x98, 0x80, 0x0a, 0x74, 0xcb, 0x90, 0x74, 0xf1, 0xe9, 0xcf, 0xe1,
+  0x25, 0x29, 0xad, 0x1c, 0x8c, 0x1a, 0xe7, 0x8e, 0xf1, 0x66, 0x28, 0xb8,
+  0x29, 0x6e, 0x09, 0x3a, 0x8f, 0x9a, 0x55, 0xae, 0x58, 0x75, 0xbb, 0x74,
+  0x03, 0xba, 0xba, 0x21, 0x6d, 0xdd, 0x12, 0x7d, 0x99, 0x51, 0xd7, 0x2d,
+  0x74, 0x56, 0x93, 0xd6, 0x6c, 0x4a, 0x1b, 0xf7, 0x2c, 0xac, 0x3c, 0x6b,
+  0xde, 0x84, 0x9c, 0x15, 0x49, 0xa2, 0x56, 0x1c, 0xc4, 0x9a, 0x11, 0x10,
+  0x95, 0x48, 0x74, 0xf9, 0xcd, 0x52, 0x3e, 0x37, 0x8e, 0xb0, 0x50, 0x8e,
+  0xe8, 0x88, 0x64, 0xe1, 0x29, 0xe1, 0x6f, 0x0b, 0x8c, 0x28, 0x97, 0xb1,
+  0xc6, 0x14, 0xb3, 0x55, 0xe2, 0xb8, 0x99, 0x51, 0x71, 0x70, 0x38, 0xe6,
+  0x8a, 0x50, 0xb9, 0xa6, 0xc4, 0x23, 0x74, 0x77, 0x9a, 0x43, 0x31, 0x13,
+  0xfe, 0xd8, 0x03, 0x5a, 0x4a, 0xf1, 0x2c, 0xaf, 0xf5, 0xa8, 0x96, 0x7a,
+  0x50, 0x4b, 0x6d, 0x0b, 0xc9, 0xd5, 0x5e, 0x9c, 0xac, 0x57, 0x29, 0xc9,
+  0x98, 0x88, 0xd2, 0xc5, 0x22, 0x92, 0xb1, 0x37, 0x45, 0x7a, 0x6c, 0xac,
+  0xfe, 0x7b, 0x78, 0x29, 0xab, 0x53, 0x75, 0xc6, 0x50, 0x87, 0x29, 0x54,
+  0x6d, 0x66, 0xf7, 0xea, 0xd2, 0xb5, 0x09, 0x48, 0x61, 0x79, 0x66, 0xdf,
+  0x11, 0x63, 0xb4, 0x2e, 0x76, 0x6a, 0x33, 0xe5, 0xc3, 0x0d, 0xd9, 0x21,
+  0xf3, 0xbf, 0xd1, 0x4e, 0x3a, 0x0f, 0xd7, 0x64, 0xdb, 0xc4, 0x2b, 0x6c,
+  0x0b, 0x72, 0xb9, 0xde, 0xca, 0x65, 0xa7, 0x38, 0x97, 0xfa, 0xe8, 0xe6,
+  0x31, 0x75, 0xc8, 0xac, 0x16, 0xad, 0xe8, 0x78, 0x37, 0xc9, 0x12, 0x1a,
+  0x07, 0xac, 0xc5, 0x27, 0xca, 0x61, 0xd4, 0xa6, 0x0d, 0x2f, 0xcd, 0x96,
+  0xe5, 0xf2, 0x25, 0x47, 0x8d, 0x75, 0x61, 0x36, 0xec, 0x6e, 0x2a, 0xd7,
+  0xa8, 0x96, 0xd9, 0x44, 0x05, 0xca, 0x06, 0xbd, 0x56, 0x31, 0xd7, 0x8e,
+  0xdb, 0xe6, 0xbb, 0xd3, 0x27, 0x83, 0xc7, 0xda, 0xc2, 0x92, 0x6b, 0xac,
+  0x79, 0x8e, 0xa5, 0x99, 0x83, 0x10, 0x14, 0xde, 0x12, 0xa1, 0xa8, 0xff,
+  0xc8, 0x0f, 0x38, 0x4e, 0xa2, 0x57, 0x0e, 0xb2, 0x35, 0xa9, 0x9e, 0x6f,
+  0xe3, 0x15, 0x64, 0x5f, 0xb1, 0x55, 0x52, 0x70, 0xcb, 0x02, 0xcb, 0x1b,
+  0x10, 0xbc, 0x75, 0xa7, 0x06, 0xf0, 0xfc, 0xaf, 0x4a, 0x31, 0x89, 0x8a,
+  0xe2, 0x1f, 0x6b, 0xa5, 0x92, 0x18, 0xc3, 0xfd, 0x04, 0xa8, 0x2b, 0x6d,
+  0x38, 0xaf, 0x9c, 0x76, 0x34, 0xa2, 0x74, 0x05, 0xb6, 0x15, 0x9b, 0x82,
+  0xe5, 0xb0, 0xde, 0x50, 0x62, 0xe2, 0xea, 0x67, 0x6e, 0xed, 0x7a, 0x46,
+  0x7e, 0xad, 0x5c, 0xd6, 0xc9, 0x1f, 0x24, 0x5b, 0x39, 0xa5, 0xe1, 0xdc,
+  0xa4, 0x48, 0x7e, 0x2b, 0x5d, 0xdc, 0x2b, 0xaf, 0xf5, 0x9b, 0x73, 0xf9,
+  0xa3, 0x7a, 0xd3, 0x26, 0x7f, 0x51, 0xf7, 0x56, 0xe9, 0x03, 0x6d, 0x53,
+  0xf2, 0xf0, 0x61, 0xfc, 0x1c, 0xab, 0x80, 0x11, 0xe1, 0xa6, 0x58, 0x58,
+  0xca, 0xc6, 0x69, 0x56, 0xf8, 0x0b, 0x5b, 0xb2, 0xcd, 0x41, 0xe1, 0x68,
+  0x62, 0x7c, 0xbd, 0x50, 0x13, 0x13, 0x32, 0xd7, 0xe9, 0xe3, 0x8b, 0x94,
+  0x72, 0xd6, 0x45, 0x93, 0xeb, 0xd5, 0xe7, 0x9d, 0xa5, 0x63, 0x95, 0x5d,
+  0xdf, 0x73, 0x18, 0x9d, 0xc9, 0xaa, 0x5c, 0x2f, 0x3a, 0x3f, 0x95, 0x83,
+  0x8a, 0x69, 0x81, 0xe8, 0x92, 0x01, 0x29, 0x06, 0x38, 0x3f, 0xc2, 0xf8,
+  0x00, 0x2e, 0xa0, 0x0f, 0x0f, 0x93, 0x70, 0xb4, 0x4e, 0x91, 0x17, 0xc2,
+  0x45, 0xba, 0xaf, 0x65, 0x7e, 0x09, 0xbd, 0x87, 0x12, 0x74, 0xf5, 0x0e,
+  0xfe, 0x8c, 0xa2, 0x38, 0xca, 0x16, 0xd3, 0x7a, 0xb4, 0x77, 0x3e, 0xbe,
+  0x38, 0xb2, 0xf8, 0xe7, 0x3d, 0xe6, 0xb3, 0xc0, 0xc2, 0x3f, 0xa1, 0x0f,
+  0xc3, 0x8b, 0x25, 0xb4, 0x97, 0x7e, 0x79, 0xef, 0xc5, 0x12, 0xaa, 0x5f,
+  0x5f, 0xde, 0xfb, 0xff, 0x7e, 0x86, 0xb2, 0xb2, 0xdf, 0xe3, 0x04, 0x00
 };
-const unsigned int webui_html_len = 170341;
+const unsigned int webui_html_len = 170700;
+const char webui_html_etag[] = "\"1790575260\"";